@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <testutil/assert.h>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <random>
@@ -29,8 +30,83 @@ namespace starrocks {
 
 inline int kTestChunkSize = 4096;
 
+// Shape of the values generated by Bench::create_column.
+struct ColumnDataSpec {
+    // Number of distinct values, 0 means every row gets a distinct value.
+    int64_t cardinality = 0;
+    // Exponent of the zipf distribution over the distinct values, 0 means uniform.
+    double skew = 0;
+    // Ratio of null rows, the column is nullable iff it's positive.
+    double null_ratio = 0;
+    // Length range of the string values.
+    size_t min_length = 8;
+    size_t max_length = 16;
+};
+
 class Bench {
 public:
+    // Generate a column of INT, BIGINT, DOUBLE or VARCHAR shaped by |spec|. The i-th distinct value is
+    // derived from i, so columns generated with the same cardinality can be joined with each other.
+    static ColumnPtr create_column(const TypeDescriptor& type_desc, const ColumnDataSpec& spec, int num_rows,
+                                   std::mt19937_64* rng) {
+        ColumnPtr column = ColumnHelper::create_column(type_desc, spec.null_ratio > 0);
+        column->reserve(num_rows);
+
+        std::vector<double> zipf_cdf;
+        if (spec.cardinality > 0 && spec.skew > 0) {
+            zipf_cdf.resize(spec.cardinality);
+            double sum = 0;
+            for (int64_t i = 0; i < spec.cardinality; i++) {
+                sum += 1 / std::pow(i + 1, spec.skew);
+                zipf_cdf[i] = sum;
+            }
+            for (auto& x : zipf_cdf) {
+                x /= sum;
+            }
+        }
+
+        std::uniform_real_distribution<double> unit(0, 1);
+        std::uniform_int_distribution<int64_t> uniform(0, std::max<int64_t>(spec.cardinality - 1, 0));
+        std::string str;
+        for (int i = 0; i < num_rows; i++) {
+            if (spec.null_ratio > 0 && unit(*rng) < spec.null_ratio) {
+                column->append_nulls(1);
+                continue;
+            }
+            int64_t k = i;
+            if (!zipf_cdf.empty()) {
+                k = std::lower_bound(zipf_cdf.begin(), zipf_cdf.end(), unit(*rng)) - zipf_cdf.begin();
+                k = std::min<int64_t>(k, spec.cardinality - 1);
+            } else if (spec.cardinality > 0) {
+                k = uniform(*rng);
+            }
+            switch (type_desc.type) {
+            case TYPE_INT:
+                column->append_datum(Datum(static_cast<int32_t>(k)));
+                break;
+            case TYPE_BIGINT:
+                column->append_datum(Datum(k));
+                break;
+            case TYPE_DOUBLE:
+                column->append_datum(Datum(static_cast<double>(k)));
+                break;
+            case TYPE_VARCHAR: {
+                size_t len = spec.min_length;
+                if (spec.max_length > spec.min_length) {
+                    len += k % (spec.max_length - spec.min_length + 1);
+                }
+                str = std::to_string(k);
+                str.resize(std::max(len, str.size()), 'x');
+                column->append_datum(Datum(Slice(str)));
+                break;
+            }
+            default:
+                LOG(FATAL) << "unsupported type of generated column: " << type_desc.debug_string();
+            }
+        }
+        return column;
+    }
+
     static ColumnPtr create_series_column(const TypeDescriptor& type_desc, int num_rows, bool nullable = true) {
         // TODO: support more types.
         DCHECK_EQ(TYPE_INT, type_desc.type);
@@ -0,0 +1,540 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Micro benchmarks of the hot operators, driven through the same APIs as the pipeline drivers,
+// on synthetic chunks with controlled cardinality, skew, null ratio and string length.
+//
+// Each benchmark reports rows/s and bytes/s of its input, e.g.
+//   operator_bench --benchmark_filter=BM_hash_join_probe --benchmark_min_time=2
+
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+#include "bench.h"
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exec/aggregator.h"
+#include "exec/hash_joiner.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
+#include "exec/pipeline/aggregate/aggregate_blocking_source_operator.h"
+#include "exec/pipeline/exchange/adaptive_compression_selector.h"
+#include "exec/pipeline/exchange/exchange_chunk_serializer.h"
+#include "exec/pipeline/hashjoin/hash_join_probe_operator.h"
+#include "exec/pipeline/hashjoin/hash_joiner_factory.h"
+#include "exec/pipeline/query_context.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+#include "util/compression/block_compression.h"
+#include "util/compression/zstd_dict_compression.h"
+
+namespace starrocks {
+
+static constexpr int kNumChunks = 64;
+static constexpr int32_t kPlanNodeId = 1;
+
+// The runtime objects an operator needs to be prepared outside of a fragment.
+class OperatorBenchEnv {
+public:
+    explicit OperatorBenchEnv(const std::vector<SlotTypeDescInfoArray>& tuples) {
+        TQueryOptions query_options;
+        query_options.batch_size = kTestChunkSize;
+        _state = std::make_shared<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        _state->init_instance_mem_tracker();
+
+        _mem_tracker = std::make_unique<MemTracker>(-1, "operator_bench");
+        _query_ctx = std::make_shared<pipeline::QueryContext>();
+        _query_ctx->init_mem_tracker(-1, _mem_tracker.get());
+        _state->set_query_ctx(_query_ctx.get());
+        _state->set_desc_tbl(DescTblHelper::generate_desc_tbl(_state.get(), _pool, tuples));
+    }
+
+    RuntimeState* state() { return _state.get(); }
+    ObjectPool* pool() { return &_pool; }
+    TupleDescriptor* tuple_desc(TupleId id) { return _state->desc_tbl().get_tuple_descriptor(id); }
+
+private:
+    ObjectPool _pool;
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::shared_ptr<pipeline::QueryContext> _query_ctx;
+    std::shared_ptr<RuntimeState> _state;
+};
+
+static SlotTypeDescInfo make_slot(const std::string& name, LogicalType type, bool nullable) {
+    auto type_desc = type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH)
+                                          : TypeDescriptor(type);
+    return {name, type_desc, nullable};
+}
+
+static TExprNode make_slot_ref(const SlotDescriptor* slot) {
+    return ExprsTestHelper::create_slot_expr_node(slot->parent(), slot->id(), slot->type().to_thrift(),
+                                                  slot->is_nullable());
+}
+
+// Generate the chunks of |tuple| with one spec per slot.
+static std::vector<ChunkPtr> create_chunks(const TupleDescriptor* tuple, const std::vector<ColumnDataSpec>& specs,
+                                           int num_chunks, uint64_t seed, size_t* num_bytes) {
+    std::mt19937_64 rng(seed);
+    std::vector<ChunkPtr> chunks;
+    *num_bytes = 0;
+    for (int i = 0; i < num_chunks; i++) {
+        auto chunk = std::make_shared<Chunk>();
+        for (size_t j = 0; j < tuple->slots().size(); j++) {
+            auto* slot = tuple->slots()[j];
+            chunk->append_column(Bench::create_column(slot->type(), specs[j], kTestChunkSize, &rng), slot->id());
+        }
+        *num_bytes += chunk->bytes_usage();
+        chunks.emplace_back(std::move(chunk));
+    }
+    return chunks;
+}
+
+// Keep the dict codes of the string column of |slot_id| in |chunks|, as if they were read from the dict encoded pages
+// of a segment, see BinaryColumn::set_dict_codes(). The chunks share one dictionary.
+static void set_dict_codes(const std::vector<ChunkPtr>& chunks, SlotId slot_id) {
+    auto dict = BinaryColumn::create();
+    std::unordered_map<std::string, int32_t> word_codes;
+    std::vector<Buffer<int32_t>> codes_per_chunk;
+    for (const auto& chunk : chunks) {
+        const auto* binary = ColumnHelper::get_binary_column(chunk->get_column_by_slot_id(slot_id).get());
+        Buffer<int32_t> codes(binary->size());
+        for (size_t i = 0; i < binary->size(); i++) {
+            Slice word = binary->get_slice(i);
+            auto [iter, inserted] = word_codes.emplace(word.to_string(), static_cast<int32_t>(dict->size()));
+            if (inserted) {
+                dict->append(word);
+            }
+            codes[i] = iter->second;
+        }
+        codes_per_chunk.emplace_back(std::move(codes));
+    }
+    BinaryColumn::DictPtr shared_dict = std::move(dict);
+    for (size_t i = 0; i < chunks.size(); i++) {
+        auto* binary = ColumnHelper::get_binary_column(chunks[i]->get_column_by_slot_id(slot_id).get());
+        binary->set_dict_codes(shared_dict, std::move(codes_per_chunk[i]));
+    }
+}
+
+static void report_throughput(benchmark::State& state, size_t num_rows, size_t num_bytes) {
+    state.SetItemsProcessed(state.iterations() * num_rows);
+    state.SetBytesProcessed(state.iterations() * num_bytes);
+}
+
+// Args: build rows, key type, zipf skew of the probe keys (x100), null ratio of the keys (%),
+// whether the hash table is partitioned (see hash_join_partition_min_build_rows),
+// number of distinct probe keys (0 for twice the build rows), whether the string probe keys keep their dict codes.
+//
+// The build side has distinct keys, and the probe keys hit if they are less than the build rows. The hash table is
+// built once, the timed loop pushes the probe chunks into HashJoinProbeOperator and pulls all the output.
+static void BM_hash_join_probe(benchmark::State& state) {
+    const int64_t build_rows = state.range(0);
+    const auto key_type = static_cast<LogicalType>(state.range(1));
+    const double skew = state.range(2) / 100.0;
+    const double null_ratio = state.range(3) / 100.0;
+    const bool partitioned = state.range(4) != 0;
+    const int64_t probe_cardinality = state.range(5);
+    const bool dict_codes = state.range(6) != 0;
+
+    OperatorBenchEnv env(
+            {{make_slot("probe_key", key_type, null_ratio > 0), make_slot("probe_value", TYPE_BIGINT, false)},
+             {make_slot("build_key", key_type, false), make_slot("build_value", TYPE_BIGINT, false)}});
+    auto* probe_tuple = env.tuple_desc(0);
+    auto* build_tuple = env.tuple_desc(1);
+
+    std::vector<ExprContext*> probe_expr_ctxs(1);
+    std::vector<ExprContext*> build_expr_ctxs(1);
+    auto probe_key = ExprsTestHelper::create_slot_expr(make_slot_ref(probe_tuple->slots()[0]));
+    auto build_key = ExprsTestHelper::create_slot_expr(make_slot_ref(build_tuple->slots()[0]));
+    ASSERT_OK(Expr::create_expr_tree(env.pool(), probe_key, &probe_expr_ctxs[0], env.state()));
+    ASSERT_OK(Expr::create_expr_tree(env.pool(), build_key, &build_expr_ctxs[0], env.state()));
+
+    THashJoinNode join_node;
+    join_node.__set_join_op(TJoinOp::INNER_JOIN);
+    join_node.__set_distribution_mode(TJoinDistributionMode::PARTITIONED);
+    join_node.__set_is_push_down(false);
+    join_node.__set_build_runtime_filters_from_planner(false);
+    RowDescriptor probe_row_desc(probe_tuple);
+    RowDescriptor build_row_desc(build_tuple);
+    HashJoinerParam param(env.pool(), join_node, {false}, build_expr_ctxs, probe_expr_ctxs, {}, {}, build_row_desc,
+                          probe_row_desc, TPlanNodeType::OLAP_SCAN_NODE, TPlanNodeType::OLAP_SCAN_NODE, true, {}, {},
+                          {}, TJoinDistributionMode::PARTITIONED, false, false);
+    auto joiner_factory = std::make_shared<pipeline::HashJoinerFactory>(param);
+    ASSERT_OK(joiner_factory->prepare(env.state()));
+
+    // Build the hash table the way HashJoinBuildOperator does.
+    size_t num_bytes = 0;
+    auto builder = joiner_factory->create_builder(1, 0);
+    RuntimeProfile build_profile("build");
+    ASSERT_OK(builder->prepare_builder(env.state(), &build_profile));
+    int num_build_chunks = (build_rows + kTestChunkSize - 1) / kTestChunkSize;
+    std::mt19937_64 rng(1);
+    // The default spec generates distinct keys.
+    auto build_keys = Bench::create_column(build_tuple->slots()[0]->type(), ColumnDataSpec(),
+                                           num_build_chunks * kTestChunkSize, &rng);
+    for (int i = 0; i < num_build_chunks; i++) {
+        auto chunk = std::make_shared<Chunk>();
+        auto keys = build_keys->clone_empty();
+        keys->append(*build_keys, i * kTestChunkSize, kTestChunkSize);
+        chunk->append_column(std::move(keys), build_tuple->slots()[0]->id());
+        chunk->append_column(Bench::create_column(TypeDescriptor(TYPE_BIGINT), ColumnDataSpec(), kTestChunkSize, &rng),
+                             build_tuple->slots()[1]->id());
+        ASSERT_OK(builder->append_chunk_to_ht(chunk));
+    }
+    if (partitioned) {
+        builder->hash_join_builder()->hash_table().set_partition_cache_bytes(config::hash_join_partition_cache_bytes);
+    }
+    ASSERT_OK(builder->build_ht(env.state()));
+    // The partitioned probe buffers the probe rows, flush them at the last chunk of every iteration.
+    const int64_t partition_probe_rows = config::hash_join_partition_probe_rows;
+    config::hash_join_partition_probe_rows = kNumChunks * kTestChunkSize;
+    builder->enter_probe_phase();
+
+    pipeline::HashJoinProbeOperatorFactory probe_factory(1, kPlanNodeId, joiner_factory);
+    ASSERT_OK(probe_factory.prepare(env.state()));
+    auto probe_op = probe_factory.create(1, 0);
+    ASSERT_OK(probe_op->prepare(env.state()));
+
+    ColumnDataSpec probe_key_spec{
+            .cardinality = probe_cardinality > 0 ? probe_cardinality : num_build_chunks * kTestChunkSize * 2,
+            .skew = skew,
+            .null_ratio = null_ratio};
+    auto probe_chunks = create_chunks(probe_tuple, {probe_key_spec, ColumnDataSpec()}, kNumChunks, 2, &num_bytes);
+    if (dict_codes) {
+        set_dict_codes(probe_chunks, probe_tuple->slots()[0]->id());
+    }
+
+    size_t num_output_rows = 0;
+    for (auto _ : state) {
+        // The probe operator takes over the pushed chunks, and appends to them if the hash table is partitioned.
+        state.PauseTiming();
+        std::vector<ChunkPtr> chunks;
+        for (auto& chunk : probe_chunks) {
+            chunks.emplace_back(chunk->clone_unique());
+        }
+        state.ResumeTiming();
+        for (auto& chunk : chunks) {
+            ASSERT_OK(probe_op->push_chunk(env.state(), chunk));
+            while (probe_op->has_output()) {
+                ASSIGN_OR_ABORT(auto output, probe_op->pull_chunk(env.state()));
+                num_output_rows += output != nullptr ? output->num_rows() : 0;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(num_output_rows);
+    report_throughput(state, kNumChunks * kTestChunkSize, num_bytes);
+    state.counters["output_rows"] = benchmark::Counter(num_output_rows, benchmark::Counter::kAvgIterations);
+
+    ASSERT_OK(probe_op->set_finishing(env.state()));
+    ASSERT_OK(probe_op->set_finished(env.state()));
+    probe_op->close(env.state());
+    probe_factory.close(env.state());
+    joiner_factory->close(env.state());
+    config::hash_join_partition_probe_rows = partition_probe_rows;
+}
+
+static void hash_join_probe_args(benchmark::internal::Benchmark* b) {
+    for (int64_t build_rows : {1 << 12, 1 << 16, 1 << 20}) {
+        for (LogicalType key_type : {TYPE_BIGINT, TYPE_VARCHAR}) {
+            b->Args({build_rows, key_type, 0, 0, 0, 0, 0});
+        }
+    }
+    b->Args({1 << 16, TYPE_BIGINT, 110, 0, 0, 0, 0});
+    b->Args({1 << 16, TYPE_BIGINT, 0, 20, 0, 0, 0});
+    // The hash tables larger than the caches, with and without partitioning.
+    for (int64_t build_rows : {1 << 22, 1 << 24}) {
+        for (LogicalType key_type : {TYPE_BIGINT, TYPE_VARCHAR}) {
+            b->Args({build_rows, key_type, 0, 0, 0, 0, 0});
+            b->Args({build_rows, key_type, 0, 0, 1, 0, 0});
+        }
+    }
+    // The string probe keys of a small dictionary, with and without the dict codes.
+    for (int64_t probe_cardinality : {16, 1 << 10}) {
+        b->Args({1 << 16, TYPE_VARCHAR, 0, 0, 0, probe_cardinality, 0});
+        b->Args({1 << 16, TYPE_VARCHAR, 0, 0, 0, probe_cardinality, 1});
+    }
+    b->Args({1 << 16, TYPE_VARCHAR, 0, 20, 0, 1 << 10, 0});
+    b->Args({1 << 16, TYPE_VARCHAR, 0, 20, 0, 1 << 10, 1});
+}
+
+// Args: number of groups, key type, zipf skew of the keys (x100), null ratio of the keys (%),
+// whether the string keys keep their dict codes.
+//
+// Runs `SELECT key, sum(value), count(*) GROUP BY key` through the blocking aggregate sink and source
+// operators. Each iteration creates fresh operators, only pushing and pulling the chunks is timed.
+static void BM_aggregate_blocking(benchmark::State& state) {
+    const int64_t cardinality = state.range(0);
+    const auto key_type = static_cast<LogicalType>(state.range(1));
+    const double skew = state.range(2) / 100.0;
+    const double null_ratio = state.range(3) / 100.0;
+    const bool key_nullable = null_ratio > 0;
+    const bool dict_codes = state.range(4) != 0;
+
+    OperatorBenchEnv env({{make_slot("key", key_type, key_nullable), make_slot("value", TYPE_BIGINT, false)},
+                          {make_slot("key", key_type, key_nullable), make_slot("sum", TYPE_BIGINT, false),
+                           make_slot("count", TYPE_BIGINT, false)}});
+    auto* input_tuple = env.tuple_desc(0);
+    auto* output_tuple = env.tuple_desc(1);
+
+    TTypeDesc bigint_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+    TExprNode key_node = make_slot_ref(input_tuple->slots()[0]);
+    TExprNode value_node = make_slot_ref(input_tuple->slots()[1]);
+    auto sum_fn = ExprsTestHelper::create_builtin_function("sum", {bigint_type}, bigint_type, bigint_type);
+    auto count_fn = ExprsTestHelper::create_builtin_function("count", {}, bigint_type, bigint_type);
+
+    TPlanNode tnode;
+    tnode.__set_node_id(kPlanNodeId);
+    tnode.__set_node_type(TPlanNodeType::AGGREGATION_NODE);
+    tnode.__set_row_tuples({output_tuple->id()});
+    tnode.__set_limit(-1);
+    TAggregationNode agg_node;
+    agg_node.__set_grouping_exprs({ExprsTestHelper::create_slot_expr(key_node)});
+    agg_node.__set_aggregate_functions({ExprsTestHelper::create_aggregate_expr(sum_fn, {value_node}),
+                                        ExprsTestHelper::create_aggregate_expr(count_fn, {})});
+    for (auto& agg_expr : agg_node.aggregate_functions) {
+        agg_expr.nodes[0].__set_is_nullable(false);
+    }
+    agg_node.__set_intermediate_tuple_id(output_tuple->id());
+    agg_node.__set_output_tuple_id(output_tuple->id());
+    agg_node.__set_need_finalize(true);
+    tnode.__set_agg_node(agg_node);
+
+    size_t num_bytes = 0;
+    ColumnDataSpec key_spec{.cardinality = cardinality, .skew = skew, .null_ratio = null_ratio};
+    auto chunks = create_chunks(input_tuple, {key_spec, ColumnDataSpec()}, kNumChunks, 1, &num_bytes);
+    if (dict_codes) {
+        set_dict_codes(chunks, input_tuple->slots()[0]->id());
+    }
+
+    size_t num_groups = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto aggregator_factory = std::make_shared<AggregatorFactory>(tnode);
+        pipeline::AggregateBlockingSinkOperatorFactory sink_factory(1, kPlanNodeId, aggregator_factory, nullptr);
+        pipeline::AggregateBlockingSourceOperatorFactory source_factory(2, kPlanNodeId, aggregator_factory);
+        ASSERT_OK(sink_factory.prepare(env.state()));
+        ASSERT_OK(source_factory.prepare(env.state()));
+        auto sink_op = sink_factory.create(1, 0);
+        auto source_op = source_factory.create(1, 0);
+        ASSERT_OK(sink_op->prepare(env.state()));
+        ASSERT_OK(source_op->prepare(env.state()));
+        state.ResumeTiming();
+
+        for (auto& chunk : chunks) {
+            ASSERT_OK(sink_op->push_chunk(env.state(), chunk));
+        }
+        ASSERT_OK(sink_op->set_finishing(env.state()));
+        while (!source_op->is_finished()) {
+            ASSIGN_OR_ABORT(auto output, source_op->pull_chunk(env.state()));
+            num_groups += output != nullptr ? output->num_rows() : 0;
+        }
+
+        state.PauseTiming();
+        ASSERT_OK(source_op->set_finished(env.state()));
+        sink_op->close(env.state());
+        source_op->close(env.state());
+        source_factory.close(env.state());
+        sink_factory.close(env.state());
+        state.ResumeTiming();
+    }
+    report_throughput(state, kNumChunks * kTestChunkSize, num_bytes);
+    state.counters["groups"] = benchmark::Counter(num_groups, benchmark::Counter::kAvgIterations);
+}
+
+static void aggregate_blocking_args(benchmark::internal::Benchmark* b) {
+    for (int64_t cardinality : {16, 1 << 12, 1 << 18}) {
+        for (LogicalType key_type : {TYPE_BIGINT, TYPE_VARCHAR}) {
+            b->Args({cardinality, key_type, 0, 0, 0});
+        }
+    }
+    b->Args({1 << 18, TYPE_BIGINT, 110, 0, 0});
+    b->Args({1 << 12, TYPE_BIGINT, 0, 20, 0});
+    // The string keys with the dict codes, the dictionaries are not larger than the chunks.
+    for (int64_t cardinality : {16, 1 << 12}) {
+        b->Args({cardinality, TYPE_VARCHAR, 0, 0, 1});
+        b->Args({cardinality, TYPE_VARCHAR, 0, 20, 0});
+        b->Args({cardinality, TYPE_VARCHAR, 0, 20, 1});
+    }
+}
+
+// Args: compression type, encode level, string length, cardinality, compression mode.
+// Compression mode is 0 for the codec of the query, 1 for the zstd dictionary and 2 for the adaptive selector.
+//
+// ExchangeSinkOperator needs a fragment context and brpc channels to be created, so this drives the
+// ExchangeChunkSerializer of the operator directly, which serializes the chunk into ChunkPB with the encode context
+// of the channel and compresses the serialized data.
+static void BM_exchange_serialize(benchmark::State& state) {
+    const auto compress_type = static_cast<CompressionTypePB>(state.range(0));
+    const auto encode_level = static_cast<int32_t>(state.range(1));
+    const auto str_length = static_cast<size_t>(state.range(2));
+    const int64_t cardinality = state.range(3);
+    const int64_t compression_mode = state.range(4);
+
+    OperatorBenchEnv env({{make_slot("c0", TYPE_BIGINT, true), make_slot("c1", TYPE_DOUBLE, false),
+                           make_slot("c2", TYPE_VARCHAR, true)}});
+    ColumnDataSpec number_spec{.cardinality = cardinality, .null_ratio = 0.05};
+    ColumnDataSpec string_spec{.cardinality = cardinality, .null_ratio = 0.05, .min_length = str_length,
+                               .max_length = str_length * 2};
+    size_t num_bytes = 0;
+    auto chunks = create_chunks(env.tuple_desc(0), {number_spec, number_spec, string_spec}, kNumChunks, 1, &num_bytes);
+
+    const BlockCompressionCodec* codec = nullptr;
+    ASSERT_OK(get_block_compression_codec(compress_type, &codec));
+
+    RuntimeProfile profile("ExchangeSink");
+    for (auto _ : state) {
+        state.PauseTiming();
+        pipeline::ExchangeChunkSerializer serializer(encode_level, compress_type, codec, &profile);
+        std::unique_ptr<ZstdDictCompressor> dict_compressor;
+        std::unique_ptr<pipeline::AdaptiveCompressionSelector> compression_selector;
+        if (compression_mode == 1) {
+            dict_compressor = std::make_unique<ZstdDictCompressor>(config::transmission_compression_dict_sample_chunks,
+                                                                   config::transmission_compression_dict_size);
+        } else if (compression_mode == 2) {
+            // A link of 1GB/s.
+            compression_selector = std::make_unique<pipeline::AdaptiveCompressionSelector>(
+                    std::vector<CompressionTypePB>{CompressionTypePB::NO_COMPRESSION, CompressionTypePB::LZ4,
+                                                   CompressionTypePB::ZSTD},
+                    compress_type, []() { return 1e9; });
+        }
+        state.ResumeTiming();
+
+        bool is_first_chunk = true;
+        for (auto& chunk : chunks) {
+            ChunkPB chunk_pb;
+            ASSERT_OK(serializer.serialize(chunk.get(), &chunk_pb, &is_first_chunk, dict_compressor.get(),
+                                           compression_selector.get(), 1));
+        }
+    }
+    report_throughput(state, kNumChunks * kTestChunkSize, num_bytes);
+    state.counters["serialized_bytes"] = benchmark::Counter(profile.get_counter("SerializedBytes")->value(),
+                                                            benchmark::Counter::kAvgIterations);
+    state.counters["compressed_bytes"] = benchmark::Counter(profile.get_counter("CompressedBytes")->value(),
+                                                            benchmark::Counter::kAvgIterations);
+}
+
+static void exchange_serialize_args(benchmark::internal::Benchmark* b) {
+    for (CompressionTypePB type :
+         {CompressionTypePB::NO_COMPRESSION, CompressionTypePB::LZ4, CompressionTypePB::ZSTD}) {
+        for (int64_t str_length : {8, 64}) {
+            b->Args({type, 0, str_length, 1 << 10, 0});
+            b->Args({type, 0, str_length, 0, 0});
+        }
+        // The default transmission_encode_level of the session.
+        b->Args({type, 7, 8, 1 << 10, 0});
+    }
+    b->Args({CompressionTypePB::ZSTD, 0, 8, 1 << 10, 1});
+    b->Args({CompressionTypePB::LZ4, 0, 8, 1 << 10, 2});
+}
+
+static TExprNode make_expr_node(TExprNodeType::type node_type, TExprOpcode::type opcode, TPrimitiveType::type type,
+                                int num_children) {
+    TExprNode node;
+    node.__set_node_type(node_type);
+    node.__set_opcode(opcode);
+    node.__set_child_type(TPrimitiveType::BIGINT);
+    node.__set_type(ExprsTestHelper::create_scalar_type_desc(type));
+    node.__set_num_children(num_children);
+    return node;
+}
+
+static TExprNode make_bigint_literal(int64_t value) {
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::INT_LITERAL);
+    node.__set_type(ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT));
+    node.__set_num_children(0);
+    TIntLiteral literal;
+    literal.__set_value(value);
+    node.__set_int_literal(literal);
+    return node;
+}
+
+enum ExprBenchKind { ARITHMETIC = 0, PREDICATE = 1 };
+
+// Args: expression kind, null ratio of the inputs (%).
+//
+// ARITHMETIC: (a + b) * (a - b)
+// PREDICATE:  a > b AND a < 1000
+static void BM_expr_evaluate(benchmark::State& state) {
+    const auto kind = static_cast<ExprBenchKind>(state.range(0));
+    const double null_ratio = state.range(1) / 100.0;
+
+    OperatorBenchEnv env({{make_slot("a", TYPE_BIGINT, null_ratio > 0), make_slot("b", TYPE_BIGINT, null_ratio > 0)}});
+    auto* tuple = env.tuple_desc(0);
+    TExprNode a = make_slot_ref(tuple->slots()[0]);
+    TExprNode b = make_slot_ref(tuple->slots()[1]);
+
+    // The nodes of the tree in pre-order.
+    TExpr texpr;
+    if (kind == ARITHMETIC) {
+        texpr.nodes = {make_expr_node(TExprNodeType::ARITHMETIC_EXPR, TExprOpcode::MULTIPLY, TPrimitiveType::BIGINT, 2),
+                       make_expr_node(TExprNodeType::ARITHMETIC_EXPR, TExprOpcode::ADD, TPrimitiveType::BIGINT, 2),
+                       a,
+                       b,
+                       make_expr_node(TExprNodeType::ARITHMETIC_EXPR, TExprOpcode::SUBTRACT, TPrimitiveType::BIGINT, 2),
+                       a,
+                       b};
+    } else {
+        texpr.nodes = {
+                make_expr_node(TExprNodeType::COMPOUND_PRED, TExprOpcode::COMPOUND_AND, TPrimitiveType::BOOLEAN, 2),
+                make_expr_node(TExprNodeType::BINARY_PRED, TExprOpcode::GT, TPrimitiveType::BOOLEAN, 2),
+                a,
+                b,
+                make_expr_node(TExprNodeType::BINARY_PRED, TExprOpcode::LT, TPrimitiveType::BOOLEAN, 2),
+                a,
+                make_bigint_literal(1000)};
+    }
+    ExprContext* ctx = nullptr;
+    ASSERT_OK(Expr::create_expr_tree(env.pool(), texpr, &ctx, env.state()));
+    ASSERT_OK(ctx->prepare(env.state()));
+    ASSERT_OK(ctx->open(env.state()));
+
+    ColumnDataSpec spec{.cardinality = 1 << 16, .null_ratio = null_ratio};
+    size_t num_bytes = 0;
+    auto chunks = create_chunks(tuple, {spec, spec}, kNumChunks, 1, &num_bytes);
+
+    for (auto _ : state) {
+        for (auto& chunk : chunks) {
+            ASSIGN_OR_ABORT(auto result, ctx->evaluate(chunk.get()));
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    report_throughput(state, kNumChunks * kTestChunkSize, num_bytes);
+    ctx->close(env.state());
+}
+
+static void expr_evaluate_args(benchmark::internal::Benchmark* b) {
+    for (ExprBenchKind kind : {ARITHMETIC, PREDICATE}) {
+        b->Args({kind, 0});
+        b->Args({kind, 20});
+    }
+}
+
+BENCHMARK(BM_hash_join_probe)->Apply(hash_join_probe_args)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_aggregate_blocking)->Apply(aggregate_blocking_args)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_exchange_serialize)->Apply(exchange_serialize_args)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_expr_evaluate)->Apply(expr_evaluate_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -48,6 +48,12 @@ void BinaryColumnBase<T>::check_or_die() const {
 template <typename T>
 void BinaryColumnBase<T>::append(const Column& src, size_t offset, size_t count) {
     const auto& b = down_cast<const BinaryColumnBase<T>&>(src);
+    if (_can_append_dict_codes(b)) {
+        _dict = b._dict;
+        _dict_codes.insert(_dict_codes.end(), b._dict_codes.begin() + offset, b._dict_codes.begin() + offset + count);
+    } else {
+        _reset_dict_codes();
+    }
     const unsigned char* p = &b._bytes[b._offsets[offset]];
     const unsigned char* e = &b._bytes[b._offsets[offset + count]];
 
@@ -65,6 +71,16 @@ void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* in
     const auto& src_column = down_cast<const BinaryColumnBase<T>&>(src);
     const auto& src_offsets = src_column.get_offset();
     const auto& src_bytes = src_column.get_bytes();
+    if (_can_append_dict_codes(src_column)) {
+        _dict = src_column._dict;
+        const size_t num_codes = _dict_codes.size();
+        _dict_codes.resize(num_codes + size);
+        for (size_t i = 0; i < size; i++) {
+            _dict_codes[num_codes + i] = src_column._dict_codes[indexes[from + i]];
+        }
+    } else {
+        _reset_dict_codes();
+    }
 
     size_t cur_row_count = _offsets.size() - 1;
     size_t cur_byte_size = _bytes.size();
@@ -94,6 +110,7 @@ void BinaryColumnBase<T>::append_value_multiple_times(const Column& src, uint32_
     auto& src_column = down_cast<const BinaryColumnBase<T>&>(src);
     auto& src_offsets = src_column.get_offset();
     auto& src_bytes = src_column.get_bytes();
+    _reset_dict_codes();
 
     size_t cur_row_count = _offsets.size() - 1;
     size_t cur_byte_size = _bytes.size();
@@ -147,6 +164,7 @@ ColumnPtr BinaryColumnBase<T>::replicate(const std::vector<uint32_t>& offsets) {
 
 template <typename T>
 bool BinaryColumnBase<T>::append_strings(const Buffer<Slice>& strs) {
+    _reset_dict_codes();
     for (const auto& s : strs) {
         const auto* const p = reinterpret_cast<const Bytes::value_type*>(s.data);
         _bytes.insert(_bytes.end(), p, p + s.size);
@@ -187,6 +205,7 @@ void append_fixed_length(const Buffer<Slice>& strs, Bytes* bytes, typename Binar
 
 template <typename T>
 bool BinaryColumnBase<T>::append_strings_overflow(const Buffer<Slice>& strs, size_t max_length) {
+    _reset_dict_codes();
     if (max_length <= 8) {
         append_fixed_length<T, 8>(strs, &_bytes, &_offsets);
     } else if (max_length <= 16) {
@@ -213,6 +232,7 @@ bool BinaryColumnBase<T>::append_continuous_strings(const Buffer<Slice>& strs) {
     if (strs.empty()) {
         return true;
     }
+    _reset_dict_codes();
     size_t new_size = _bytes.size();
     const auto* p = reinterpret_cast<const uint8_t*>(strs.front().data);
     const auto* q = reinterpret_cast<const uint8_t*>(strs.back().data + strs.back().size);
@@ -231,6 +251,7 @@ bool BinaryColumnBase<T>::append_continuous_strings(const Buffer<Slice>& strs) {
 template <typename T>
 bool BinaryColumnBase<T>::append_continuous_fixed_length_strings(const char* data, size_t size, int fixed_length) {
     if (size == 0) return true;
+    _reset_dict_codes();
     size_t bytes_size = _bytes.size();
 
     // copy blob
@@ -275,6 +296,7 @@ bool BinaryColumnBase<T>::append_continuous_fixed_length_strings(const char* dat
 
 template <typename T>
 void BinaryColumnBase<T>::append_value_multiple_times(const void* value, size_t count) {
+    _reset_dict_codes();
     const auto* slice = reinterpret_cast<const Slice*>(value);
     size_t size = slice->size * count;
     _bytes.reserve(size);
@@ -327,6 +349,7 @@ void BinaryColumnBase<T>::fill_default(const Filter& filter) {
 template <typename T>
 void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes) {
     const auto& src_column = down_cast<const BinaryColumnBase<T>&>(src);
+    _reset_dict_codes();
     size_t replace_num = src.size();
     bool need_resize = false;
     for (size_t i = 0; i < replace_num; ++i) {
@@ -368,6 +391,7 @@ void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes
 template <typename T>
 void BinaryColumnBase<T>::assign(size_t n, size_t idx) {
     std::string value = std::string((char*)_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
+    _reset_dict_codes();
     _bytes.clear();
     _offsets.clear();
     _offsets.emplace_back(0);
@@ -388,6 +412,7 @@ void BinaryColumnBase<T>::remove_first_n_values(size_t count) {
 
     ColumnPtr column = cut(count, remain_size);
     auto* binary_column = down_cast<BinaryColumnBase<T>*>(column.get());
+    _reset_dict_codes();
     _offsets = std::move(binary_column->_offsets);
     _bytes = std::move(binary_column->_bytes);
     _slices_cache = false;
@@ -425,6 +450,9 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
     auto result_offset = from;
 
     uint8_t* data = _bytes.data();
+    // resize() drops the codes, keep them to filter them too.
+    DictPtr dict = std::move(_dict);
+    Buffer<int32_t> dict_codes = std::move(_dict_codes);
 
 #ifdef __AVX2__
     const uint8_t* f_data = filter.data();
@@ -494,6 +522,16 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
     }
 
     this->resize(result_offset);
+    if (dict != nullptr) {
+        size_t num_codes = from;
+        for (size_t i = from; i < to; ++i) {
+            dict_codes[num_codes] = dict_codes[i];
+            num_codes += filter[i] != 0;
+        }
+        DCHECK_EQ(result_offset, num_codes);
+        dict_codes.resize(result_offset);
+        set_dict_codes(std::move(dict), std::move(dict_codes));
+    }
     return result_offset;
 }
 
@@ -551,6 +589,7 @@ const uint8_t* BinaryColumnBase<T>::deserialize_and_append(const uint8_t* pos) {
     uint32_t string_size{};
     strings::memcpy_inlined(&string_size, pos, sizeof(uint32_t));
     pos += sizeof(uint32_t);
+    _reset_dict_codes();
 
     size_t old_size = _bytes.size();
     _bytes.insert(_bytes.end(), pos, pos + string_size);
@@ -694,6 +733,7 @@ StatusOr<ColumnPtr> BinaryColumnBase<T>::upgrade_if_overflow() {
             // NOTE(yanz): in BinaryColumnBase, we have an invariant that `_offsets.back == _bytes.size()`;  
             // and since _bytes has been moved to new_column, we have to clear _offset to keep the invariant.
             _offsets.clear();
+            _reset_dict_codes();
             return new_column;
         } else {
             return nullptr;
@@ -721,6 +761,7 @@ StatusOr<ColumnPtr> BinaryColumnBase<T>::downgrade() {
                 new_column->get_offset()[i] = static_cast<uint32_t>(_offsets[i]);
             }
             _offsets.resize(0);
+            _reset_dict_codes();
             return new_column;
         }
     }
@@ -35,6 +35,8 @@ public:
 
     using Bytes = starrocks::raw::RawVectorPad16<uint8_t>;
 
+    using DictPtr = std::shared_ptr<const BinaryColumnBase<T>>;
+
     struct BinaryDataProxyContainer {
         BinaryDataProxyContainer(const BinaryColumnBase& column) : _column(column) {}
 
@@ -61,11 +63,15 @@ public:
     }
 
     // NOTE: do *NOT* copy |_slices|
-    BinaryColumnBase(const BinaryColumnBase<T>& rhs) : _bytes(rhs._bytes), _offsets(rhs._offsets) {}
+    BinaryColumnBase(const BinaryColumnBase<T>& rhs)
+            : _bytes(rhs._bytes), _offsets(rhs._offsets), _dict(rhs._dict), _dict_codes(rhs._dict_codes) {}
 
     // NOTE: do *NOT* copy |_slices|
     BinaryColumnBase(BinaryColumnBase<T>&& rhs) noexcept
-            : _bytes(std::move(rhs._bytes)), _offsets(std::move(rhs._offsets)) {}
+            : _bytes(std::move(rhs._bytes)),
+              _offsets(std::move(rhs._offsets)),
+              _dict(std::move(rhs._dict)),
+              _dict_codes(std::move(rhs._dict_codes)) {}
 
     BinaryColumnBase<T>& operator=(const BinaryColumnBase<T>& rhs) {
         BinaryColumnBase<T> tmp(rhs);
@@ -163,6 +169,7 @@ public:
         _offsets.resize(n + 1, _offsets.back());
         _bytes.resize(_offsets.back());
         _slices_cache = false;
+        _reset_dict_codes();
     }
 
     void assign(size_t n, size_t idx) override;
@@ -176,6 +183,7 @@ public:
         _bytes.insert(_bytes.end(), str.data, str.data + str.size);
         _offsets.emplace_back(_bytes.size());
         _slices_cache = false;
+        _reset_dict_codes();
     }
     DIAGNOSTIC_POP
 
@@ -196,6 +204,7 @@ public:
         _bytes.insert(_bytes.end(), str.data(), str.data() + str.size());
         _offsets.emplace_back(_bytes.size());
         _slices_cache = false;
+        _reset_dict_codes();
     }
 
     bool append_strings(const Buffer<Slice>& strs) override;
@@ -213,11 +222,13 @@ public:
     void append_default() override {
         _offsets.emplace_back(_bytes.size());
         _slices_cache = false;
+        _reset_dict_codes();
     }
 
     void append_default(size_t count) override {
         _offsets.insert(_offsets.end(), count, static_cast<uint32_t>(_bytes.size()));
         _slices_cache = false;
+        _reset_dict_codes();
     }
 
     ColumnPtr replicate(const std::vector<uint32_t>& offsets) override;
@@ -283,19 +294,26 @@ public:
 
     const BinaryDataProxyContainer& get_proxy_data() const { return _immuable_container; }
 
-    Bytes& get_bytes() { return _bytes; }
+    Bytes& get_bytes() {
+        _reset_dict_codes();
+        return _bytes;
+    }
 
     const Bytes& get_bytes() const { return _bytes; }
 
     const uint8_t* continuous_data() const override { return reinterpret_cast<const uint8_t*>(_bytes.data()); }
 
-    Offsets& get_offset() { return _offsets; }
+    Offsets& get_offset() {
+        _reset_dict_codes();
+        return _offsets;
+    }
     const Offsets& get_offset() const { return _offsets; }
 
     Datum get(size_t n) const override { return Datum(get_slice(n)); }
 
     size_t container_memory_usage() const override {
-        return _bytes.capacity() + _offsets.capacity() * sizeof(_offsets[0]) + _slices.capacity() * sizeof(_slices[0]);
+        return _bytes.capacity() + _offsets.capacity() * sizeof(_offsets[0]) + _slices.capacity() * sizeof(_slices[0]) +
+               _dict_codes.capacity() * sizeof(_dict_codes[0]);
     }
 
     size_t reference_memory_usage(size_t from, size_t size) const override { return 0; }
@@ -308,6 +326,8 @@ public:
         swap(_offsets, r._offsets);
         swap(_slices, r._slices);
         swap(_slices_cache, r._slices_cache);
+        swap(_dict, r._dict);
+        swap(_dict_codes, r._dict_codes);
     }
 
     void reset_column() override {
@@ -317,10 +337,29 @@ public:
         _offsets.resize(1, 0);
         _slices.clear();
         _slices_cache = false;
+        _reset_dict_codes();
     }
 
     void invalidate_slice_cache() { _slices_cache = false; }
 
+    // The values may be decoded from a dictionary, e.g. the dict encoded pages of a segment column. The codes of
+    // the values in the dictionary are kept along with them, so that the operators can work on the dictionary
+    // instead of the values, e.g. hash every word of the dictionary once instead of the value of every row.
+    // The codes are dropped once the column is modified, except by filter_range() and appending the values of
+    // the same dictionary.
+    void set_dict_codes(DictPtr dict, Buffer<int32_t> codes) {
+        DCHECK_EQ(size(), codes.size());
+        _dict = std::move(dict);
+        _dict_codes = std::move(codes);
+    }
+
+    bool has_dict_codes() const { return _dict != nullptr; }
+
+    const DictPtr& dict() const { return _dict; }
+
+    // For the i-th value, get_slice(i) == dict()->get_slice(dict_codes()[i]).
+    const Buffer<int32_t>& dict_codes() const { return _dict_codes; }
+
     std::string debug_item(size_t idx) const override;
 
     std::string raw_item_value(size_t idx) const override;
@@ -344,8 +383,22 @@ public:
 private:
     void _build_slices() const;
 
+    void _reset_dict_codes() {
+        if (_dict != nullptr) {
+            _dict.reset();
+            _dict_codes.clear();
+        }
+    }
+
+    // Whether the codes can be kept after appending the values of `src`.
+    bool _can_append_dict_codes(const BinaryColumnBase<T>& src) const {
+        return src._dict != nullptr && (_dict == src._dict || (_dict == nullptr && size() == 0));
+    }
+
     Bytes _bytes;
     Offsets _offsets;
+    DictPtr _dict;
+    Buffer<int32_t> _dict_codes;
 
     mutable Container _slices;
     mutable bool _slices_cache = false;
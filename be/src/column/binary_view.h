@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "gutil/endian.h"
+#include "util/memcmp.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// A 16-byte view of a string with its first bytes inlined, a.k.a. the "German string" layout:
+//
+//   | size (4 bytes) | prefix (4 bytes) | the rest of a short string, or the pointer to the string (8 bytes) |
+//
+// The strings of at most 12 bytes are fully inlined and padded with zeros, the longer strings keep their first
+// 4 bytes in the prefix and point to the original data, which must outlive the view.
+// Most of the comparisons of the strings differing in the first bytes are decided by the size and the prefix
+// without touching the out-of-line data, so it's used to inline the strings in the sort permutations instead
+// of Slice, which has the same size.
+//
+// It's not used for the equality of the hash join keys and the group by keys: the hash tables compare the keys
+// of the same bucket or the same hash tag, which are mostly equal and have to be compared in full anyway, and
+// Slice::operator== already rejects the keys of different sizes without touching the data.
+class BinaryView {
+public:
+    static constexpr size_t kPrefixSize = 4;
+    static constexpr size_t kInlineSize = 12;
+
+    BinaryView() { memset(this, 0, sizeof(BinaryView)); }
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    BinaryView(const Slice& slice) : _size(static_cast<uint32_t>(slice.size)) {
+        if (_size <= kInlineSize) {
+            memset(_prefix, 0, kInlineSize);
+            if (_size > 0) {
+                memcpy(_prefix, slice.data, _size);
+            }
+        } else {
+            memcpy(_prefix, slice.data, kPrefixSize);
+            _data = slice.data;
+        }
+    }
+
+    size_t size() const { return _size; }
+
+    bool is_inlined() const { return _size <= kInlineSize; }
+
+    const char* data() const { return is_inlined() ? _prefix : _data; }
+
+    Slice to_slice() const { return {data(), _size}; }
+
+    // The same order as Slice::compare, but normalized to -1, 0 and 1.
+    int compare(const BinaryView& rhs) const {
+        // The prefixes padded with zeros are compared as big endian integers, which is the order of memcmp.
+        const uint32_t lhs_prefix = BigEndian::Load32(_prefix);
+        const uint32_t rhs_prefix = BigEndian::Load32(rhs._prefix);
+        if (lhs_prefix != rhs_prefix) {
+            return lhs_prefix < rhs_prefix ? -1 : 1;
+        }
+        const size_t min_size = std::min(_size, rhs._size);
+        if (min_size > kPrefixSize) {
+            int res = memcmp(data() + kPrefixSize, rhs.data() + kPrefixSize, min_size - kPrefixSize);
+            if (res != 0) {
+                return res < 0 ? -1 : 1;
+            }
+        }
+        return _size == rhs._size ? 0 : (_size < rhs._size ? -1 : 1);
+    }
+
+    bool operator==(const BinaryView& rhs) const {
+        // Compare the size and the prefix at once.
+        if (memcmp(this, &rhs, sizeof(uint32_t) + kPrefixSize) != 0) {
+            return false;
+        }
+        if (is_inlined()) {
+            return memcmp(_inlined, rhs._inlined, sizeof(_inlined)) == 0;
+        }
+        return memequal(_data + kPrefixSize, _size - kPrefixSize, rhs._data + kPrefixSize, _size - kPrefixSize);
+    }
+
+    bool operator!=(const BinaryView& rhs) const { return !(*this == rhs); }
+
+    bool operator<(const BinaryView& rhs) const { return compare(rhs) < 0; }
+
+private:
+    uint32_t _size;
+    char _prefix[kPrefixSize];
+    union {
+        char _inlined[kInlineSize - kPrefixSize];
+        const char* _data;
+    };
+};
+
+static_assert(sizeof(BinaryView) == 16);
+
+} // namespace starrocks
@@ -28,6 +28,9 @@ MVMaintenanceTaskInfo MVMaintenanceTaskInfo::from_maintenance_task(const TMVMain
     res.job_id = maintenance_task.job_id;
     res.task_id = maintenance_task.task_id;
     res.query_id = maintenance_task.query_id;
+    if (maintenance_task.__isset.start_maintenance && maintenance_task.start_maintenance.__isset.committed_epoch_id) {
+        res.committed_epoch_id = maintenance_task.start_maintenance.committed_epoch_id;
+    }
     return res;
 }
 
@@ -62,14 +62,16 @@ class TMVStartEpochTask;
  *  `MVMaintenanceTaskInfo` contains the basic MV maintenance tasks info for all task types.
  */
 struct MVMaintenanceTaskInfo {
-    int64_t signature;
+    int64_t signature = 0;
     std::string db_name;
     std::string mv_name;
-    int64_t db_id;
-    int64_t mv_id;
-    int64_t job_id;
-    int64_t task_id;
+    int64_t db_id = 0;
+    int64_t mv_id = 0;
+    int64_t job_id = 0;
+    int64_t task_id = 0;
     TUniqueId query_id;
+    // The last epoch committed by FE, which the states are recovered from. -1 if none.
+    int64_t committed_epoch_id = -1;
 
     static MVMaintenanceTaskInfo from_maintenance_task(const TMVMaintenanceTasks& maintenance_task);
 };
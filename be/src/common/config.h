@@ -227,6 +227,9 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Full sort of at least this many rows sorts the normalized keys of the order-by columns by radix sort,
+// instead of sorting the columns one by one. 0 disables it.
+CONF_mInt64(sort_normalized_key_min_rows, "4096");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
@@ -271,6 +274,13 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// Cache for data pages decoded into columns, hot pages in it skip decompression and decoding.
+// It's in addition to storage_page_cache_limit, and "0" disables it.
+CONF_mString(decoded_page_cache_limit, "0");
+// Eviction policy of the storage page caches, "lru" or "tinylfu".
+// "tinylfu" admits a new page only if it's accessed more frequently than the page it would evict,
+// so that a large scan can't flush the hot pages.
+CONF_String(storage_page_cache_eviction_policy, "lru");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
@@ -618,6 +628,15 @@ CONF_mInt32(flush_thread_num_per_store, "2");
 // Default value is cpu cores * 2
 CONF_mInt32(lake_flush_thread_num_per_store, "0");
 
+// Sort and aggregate a memtable in parallel when it has at least `memtable_parallel_sort_min_rows` rows,
+// which speeds up the flush of a large single tablet load, at the cost of a higher peak memory.
+CONF_mBool(enable_memtable_parallel_sort, "false");
+CONF_mInt64(memtable_parallel_sort_min_rows, "1000000");
+// The max number of runs a memtable is split into for the parallel sort.
+CONF_mInt32(memtable_parallel_sort_dop, "4");
+// Number of threads shared by all the memtables to sort in parallel, 0 means the number of cpu cores.
+CONF_Int32(memtable_sort_thread_num, "0");
+
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
 CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
@@ -668,6 +687,28 @@ CONF_Int32(late_materialization_ratio, "10");
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// Evaluate the bloom/IN join runtime filters in the segment iterator before late materialization, so the other
+// columns of the rows filtered out by them are not decoded.
+CONF_mBool(enable_segment_runtime_filter_pushdown, "true");
+
+// Keep the dict codes of the dictionary encoded strings read from the segments in the columns, so the hash
+// aggregation and the join probe compute the hash of each distinct word only once. Only the columns read as the
+// only key of a hash aggregation or a join probe in the same fragment keep the codes.
+CONF_mBool(enable_segment_dict_codes, "true");
+
+// The min number of the LIKE/REGEXP predicates with constant patterns on the same column in an OR predicate to
+// match them by one Hyperscan multi-pattern database, which scans every string once for all the patterns.
+// 0 to disable it.
+CONF_mInt32(like_multi_pattern_min_patterns, "3");
+
+// The local directory of the disk-backed state tables of the incremental materialized views.
+CONF_String(stream_state_table_dir, "${STARROCKS_HOME}/stream_state");
+// The max bytes of the in-memory write buffer of a disk-backed state table, it's flushed into a sstable when full.
+CONF_mInt64(stream_state_table_write_buffer_size, "67108864");
+// The max number of the sstables of a disk-backed state table, they're merged into one at the epoch checkpoint
+// when exceeded.
+CONF_mInt32(stream_state_table_max_sstables, "8");
+
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
 
@@ -731,6 +772,11 @@ CONF_mDouble(pipeline_connector_scan_thread_num_per_cpu, "8");
 CONF_Int64(pipeline_scan_thread_pool_queue_size, "102400");
 // The number of execution threads for pipeline engine.
 CONF_Int64(pipeline_exec_thread_pool_thread_num, "0");
+// Whether to split the execution threads of pipeline engine by NUMA node. If true, each execution thread
+// is bound to the cores of a NUMA node, the drivers of a fragment instance are executed by the threads of
+// the same node, and the threads take drivers from other nodes only when there are none of their own node.
+// It takes effect only on the machines with more than one NUMA node.
+CONF_Bool(pipeline_enable_numa_aware_executor, "false");
 // The number of threads for preparing fragment instances in pipeline engine, vCPUs by default.
 // *  "n": positive integer, fixed number of threads to n.
 // *  "0": default value, means the same as number of cpu cores.
@@ -780,10 +826,28 @@ CONF_mInt64(tablet_internal_parallel_max_splitted_scan_bytes, "536870912");
 // Only when scan_dop is not less than min_scan_dop, this table can use tablet internal parallel,
 // where scan_dop = estimated_scan_rows / splitted_scan_rows.
 CONF_mInt64(tablet_internal_parallel_min_scan_dop, "4");
+// If > 0, the morsels of a physically split tablet are split by the estimated cost of the rows instead of the
+// number of them: the rows of the pages skipped by the zone maps of the pushed-down predicates cost much less.
+// When the rest cost is low, the cost picked up at one time shrinks to rest_cost/(adaptive_split_factor*scan_dop),
+// and a scan driver slower than the others picks up a proportionally smaller morsel, no less than
+// min_splitted_scan_rows, so that all the scan drivers finish at about the same time.
+// 0 means always pick up splitted_scan_rows rows.
+CONF_mInt64(tablet_internal_parallel_adaptive_split_factor, "2");
 
 // Only the num rows of lake tablet less than lake_tablet_rows_splitted_ratio * splitted_scan_rows, than the lake tablet can be splitted.
 CONF_mDouble(lake_tablet_rows_splitted_ratio, "1.5");
 
+// Share the scan of a tablet among the concurrent queries which read the same rowsets with the same columns and
+// the same pushed-down predicates, so that the pages are read, decompressed and decoded only once.
+CONF_mBool(enable_shared_scan, "false");
+// The max number of chunks buffered by a shared scan. When it's full, the query owning the scan waits for the
+// slowest ones at most shared_scan_max_wait_ms, then the slowest ones are detached from it and read the rest rows
+// by themselves.
+// The other queries also wait for the owner at most shared_scan_max_wait_ms when they have consumed all the chunks.
+// The scan threads are yielded to the other scans during the waiting.
+CONF_mInt32(shared_scan_max_buffered_chunks, "32");
+CONF_mInt64(shared_scan_max_wait_ms, "100");
+
 // The bitmap serialize version.
 CONF_Int16(bitmap_serialize_version, "1");
 // The max hdfs file handle.
@@ -849,10 +913,19 @@ CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
 CONF_mBool(parquet_statistics_process_more_filter_enable, "true");
+// Prune the row groups by the bloom filters of the column chunks for the equality and in predicates.
+CONF_mBool(parquet_bloom_filter_enable, "true");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Read the coalesced ranges of local segment files in batches through io_uring, falls back
+// to pread if io_uring is not supported by the kernel.
+CONF_mBool(enable_io_uring_read, "false");
+// Queue depth of the io_uring instance of each thread.
+CONF_Int32(io_uring_queue_depth, "64");
+// Max number of coalesced buffers of a column read in one batch.
+CONF_mInt32(io_uring_read_batch_size, "8");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -908,6 +981,9 @@ CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
 // if runtime filter size is larger than send_runtime_filter_via_http_rpc_min_size, be will transmit runtime filter via http protocol.
 // this is a default value, maybe changed by global_runtime_filter_rpc_http_min_size in session variable.
 CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
+// The join runtime filter of integer keys uses an exact bitset instead of the bloom filter, if the keys are in a range
+// no larger than this value. Set it to 0 to disable the bitset.
+CONF_mInt64(runtime_filter_exact_bitset_max_range, "16777216");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -965,6 +1041,8 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// Eviction policy of the lake metadata cache, "lru" or "tinylfu".
+CONF_String(lake_metadata_cache_eviction_policy, "lru");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
@@ -1083,6 +1161,14 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Whether to read ahead the next blocks of the remote data files which are read sequentially, from the datacache
+// or the remote storage, on the readahead thread pool while the scanner decodes the current blocks.
+CONF_mBool(datacache_readahead_enable, "true");
+// The number of blocks read ahead of a sequential reader of a file.
+CONF_mInt32(datacache_readahead_max_blocks, "4");
+// The memory limit of the blocks being read ahead by a query, 0 means no readahead.
+CONF_mInt64(datacache_readahead_max_bytes_per_query, "268435456");
+CONF_Int32(datacache_readahead_thread_num, "16");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1336,4 +1422,17 @@ CONF_Bool(python_worker_reuse, "true");
 CONF_Int32(python_worker_expire_time_sec, "300");
 CONF_mBool(enable_pk_strict_memcheck, "true");
 
+// Hash join radix-partitions the hash table by the high bits of the buckets once the build side holds at least
+// this many rows and the hash table is larger than hash_join_partition_cache_bytes, so that each partition of the
+// hash table fits in hash_join_partition_cache_bytes. The probe rows are buffered up to
+// hash_join_partition_probe_rows and probed partition by partition. Disabled if <= 0.
+CONF_mInt64(hash_join_partition_min_build_rows, "4194304");
+CONF_mInt64(hash_join_partition_cache_bytes, "1048576");
+CONF_mInt64(hash_join_partition_probe_rows, "65536");
+
+// When enable_transmission_compression_dict is set, each exchange channel samples this many chunks
+// to train a zstd dictionary of at most transmission_compression_dict_size bytes.
+CONF_mInt32(transmission_compression_dict_sample_chunks, "8");
+CONF_mInt32(transmission_compression_dict_size, "65536");
+
 } // namespace starrocks::config
@@ -450,6 +450,18 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferCounter", TUnit::UNIT, prefix);
         _profile.datacache_read_block_buffer_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferBytes", TUnit::BYTES, prefix);
+        _profile.datacache_readahead_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadaheadCounter", TUnit::UNIT, prefix);
+        _profile.datacache_readahead_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadaheadBytes", TUnit::BYTES, prefix);
+        _profile.datacache_readahead_cache_bytes = ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadaheadCacheBytes",
+                                                                     TUnit::BYTES, "DataCacheReadaheadBytes");
+        _profile.datacache_readahead_hit_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadaheadHitCounter", TUnit::UNIT, prefix);
+        _profile.datacache_readahead_hit_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadaheadHitBytes", TUnit::BYTES, prefix);
+        _profile.datacache_readahead_wait_timer =
+                ADD_CHILD_TIMER(_runtime_profile, "DataCacheReadaheadWaitTimer", prefix);
     }
 
     {
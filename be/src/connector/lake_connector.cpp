@@ -181,6 +181,24 @@ Status LakeDataSource::init_global_dicts(TabletReaderParams* params) {
     return Status::OK();
 }
 
+// The string columns read as the only key of the hash aggregations and the join probes keep their dict codes.
+void LakeDataSource::init_dict_code_columns() {
+    const auto& key_slots = _runtime_state->dict_code_key_slots();
+    if (key_slots.empty()) {
+        return;
+    }
+    for (auto slot : *_slots) {
+        if (key_slots.count(slot->id()) == 0 || !slot->type().is_string_type()) {
+            continue;
+        }
+        int32_t index = _tablet_schema->field_index(slot->col_name());
+        if (index >= 0) {
+            _dict_code_column_ids.insert(index);
+        }
+    }
+    _params.dict_code_column_ids = &_dict_code_column_ids;
+}
+
 Status LakeDataSource::init_unused_output_columns(const std::vector<std::string>& unused_output_columns) {
     for (const auto& col_name : unused_output_columns) {
         int32_t index = _tablet_schema->field_index(col_name);
@@ -305,6 +323,7 @@ Status LakeDataSource::init_tablet_reader(RuntimeState* runtime_state) {
 
     RETURN_IF_ERROR(get_tablet(_scan_range));
     RETURN_IF_ERROR(init_global_dicts(&_params));
+    init_dict_code_columns();
     RETURN_IF_ERROR(init_unused_output_columns(thrift_lake_scan_node.unused_output_column_name));
     RETURN_IF_ERROR(init_scanner_columns(scanner_columns));
     RETURN_IF_ERROR(init_reader_params(_scanner_ranges, scanner_columns, reader_columns));
@@ -58,6 +58,7 @@ public:
 private:
     Status get_tablet(const TInternalScanRange& scan_range);
     Status init_global_dicts(TabletReaderParams* params);
+    void init_dict_code_columns();
     Status init_unused_output_columns(const std::vector<std::string>& unused_output_columns);
     Status init_scanner_columns(std::vector<uint32_t>& scanner_columns);
     void decide_chunk_size(bool has_predicate);
@@ -95,6 +96,7 @@ private:
     std::shared_ptr<ChunkIterator> _prj_iter;
 
     std::unordered_set<uint32_t> _unused_output_column_ids;
+    std::unordered_set<uint32_t> _dict_code_column_ids;
     // For release memory.
     using PredicatePtr = std::unique_ptr<ColumnPredicate>;
     std::vector<PredicatePtr> _predicate_free_pool;
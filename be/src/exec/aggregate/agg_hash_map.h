@@ -403,7 +403,10 @@ struct AggHashMapWithOneStringKeyWithNullable
             (*not_founds).assign(chunk_size, 0);
         }
 
-        if (this->hash_map.bucket_count() < prefetch_threhold) {
+        if (_can_compute_by_dict_codes(column)) {
+            this->template compute_agg_by_dict_codes<Func, allocate_and_compute_state, compute_not_founds>(
+                    column, nullptr, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
+        } else if (this->hash_map.bucket_count() < prefetch_threhold) {
             this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                     column, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
         } else {
@@ -436,7 +439,11 @@ struct AggHashMapWithOneStringKeyWithNullable
             auto* data_column = down_cast<BinaryColumn*>(nullable_column->data_column().get());
             DCHECK(data_column->is_binary());
 
-            if (!nullable_column->has_null()) {
+            if (_can_compute_by_dict_codes(data_column)) {
+                const auto* null_data = nullable_column->has_null() ? &nullable_column->null_column_data() : nullptr;
+                this->template compute_agg_by_dict_codes<Func, allocate_and_compute_state, compute_not_founds>(
+                        data_column, null_data, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
+            } else if (!nullable_column->has_null()) {
                 if (this->hash_map.bucket_count() < prefetch_threhold) {
                     this->template compute_agg_noprefetch<Func, allocate_and_compute_state, compute_not_founds>(
                             data_column, agg_states, pool, std::forward<Func>(allocate_func), not_founds);
@@ -451,6 +458,65 @@ struct AggHashMapWithOneStringKeyWithNullable
         }
     }
 
+    // The keys decoded from a dictionary keep their dict codes, look up every word of the dictionary only once,
+    // if there are not more words than the keys.
+    static bool _can_compute_by_dict_codes(const BinaryColumn* column) {
+        return column->has_dict_codes() && column->dict()->size() <= column->size();
+    }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_by_dict_codes(BinaryColumn* column, const NullData* null_data,
+                                                   Buffer<AggDataPtr>* agg_states, MemPool* pool, Func&& allocate_func,
+                                                   std::vector<uint8_t>* not_founds) {
+        if constexpr (!allocate_and_compute_state && !compute_not_founds) {
+            return;
+        }
+        const auto& dict = *column->dict();
+        const auto& codes = column->dict_codes();
+        // The state of every word, and whether the word has been looked up.
+        _dict_word_states.assign(dict.size(), nullptr);
+        _dict_word_looked_up.assign(dict.size(), 0);
+        const size_t num_rows = column->size();
+        for (size_t i = 0; i < num_rows; i++) {
+            if (null_data != nullptr && (*null_data)[i]) {
+                if (UNLIKELY(null_key_data == nullptr)) {
+                    null_key_data = allocate_func(nullptr);
+                }
+                (*agg_states)[i] = null_key_data;
+                continue;
+            }
+            const int32_t code = codes[i];
+            if (!_dict_word_looked_up[code]) {
+                _dict_word_looked_up[code] = 1;
+                auto key = dict.get_slice(code);
+                if constexpr (allocate_and_compute_state) {
+                    auto iter = this->hash_map.lazy_emplace(key, [&](const auto& ctor) {
+                        if constexpr (compute_not_founds) {
+                            DCHECK(not_founds);
+                            (*not_founds)[i] = 1;
+                        }
+                        uint8_t* pos = pool->allocate(key.size);
+                        strings::memcpy_inlined(pos, key.data, key.size);
+                        Slice pk{pos, key.size};
+                        AggDataPtr pv = allocate_func(pk);
+                        ctor(pk, pv);
+                    });
+                    _dict_word_states[code] = iter->second;
+                } else if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                    _dict_word_states[code] = iter->second;
+                }
+            }
+            if constexpr (allocate_and_compute_state) {
+                (*agg_states)[i] = _dict_word_states[code];
+            } else if (_dict_word_states[code] != nullptr) {
+                (*agg_states)[i] = _dict_word_states[code];
+            } else {
+                DCHECK(not_founds);
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
     template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
     ALWAYS_NOINLINE void compute_agg_prefetch(BinaryColumn* column, Buffer<AggDataPtr>* agg_states, MemPool* pool,
                                               Func&& allocate_func, std::vector<uint8_t>* not_founds) {
@@ -582,6 +648,8 @@ struct AggHashMapWithOneStringKeyWithNullable
     static constexpr bool has_single_null_key = is_nullable;
 
     AggDataPtr null_key_data = nullptr;
+    std::vector<AggDataPtr> _dict_word_states;
+    std::vector<uint8_t> _dict_word_looked_up;
     ResultVector results;
 };
 
@@ -29,6 +29,7 @@ public:
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
     void push_down_join_runtime_filter(RuntimeState* state, RuntimeFilterProbeCollector* collector) override;
+    const std::vector<ExprContext*>& group_by_expr_ctxs() const { return _group_by_expr_ctxs; }
 
 protected:
     const TPlanNode& _tnode;
@@ -176,7 +176,8 @@ Status AggregateBlockingNode::get_next(RuntimeState* state, ChunkPtr* chunk, boo
 template <class AggFactory, class SourceFactory, class SinkFactory>
 pipeline::OpFactories AggregateBlockingNode::_decompose_to_pipeline(pipeline::OpFactories& ops_with_sink,
                                                                     pipeline::PipelineBuilderContext* context,
-                                                                    bool per_bucket_optimize) {
+                                                                    bool per_bucket_optimize,
+                                                                    bool shared_hash_table) {
     using namespace pipeline;
 
     auto workgroup = context->fragment_context()->workgroup();
@@ -188,13 +189,14 @@ pipeline::OpFactories AggregateBlockingNode::_decompose_to_pipeline(pipeline::Op
 
     auto should_cache = context->should_interpolate_cache_operator(id(), ops_with_sink[0]);
     auto* upstream_source_op = context->source_operator(ops_with_sink);
-    auto operators_generator = [this, should_cache, upstream_source_op, context,
-                                spill_channel_factory](bool post_cache) {
+    auto operators_generator = [this, should_cache, upstream_source_op, context, spill_channel_factory,
+                                shared_hash_table](bool post_cache) {
         // create aggregator factory
         // shared by sink operator and source operator
         auto aggregator_factory = std::make_shared<AggFactory>(_tnode);
         AggrMode aggr_mode = should_cache ? (post_cache ? AM_BLOCKING_POST_CACHE : AM_BLOCKING_PRE_CACHE) : AM_DEFAULT;
         aggregator_factory->set_aggr_mode(aggr_mode);
+        aggregator_factory->set_enable_shared_hash_table(shared_hash_table);
         auto sink_operator = std::make_shared<SinkFactory>(context->next_operator_id(), id(), aggregator_factory,
                                                            spill_channel_factory);
         auto source_operator = std::make_shared<SourceFactory>(context->next_operator_id(), id(), aggregator_factory);
@@ -249,6 +251,14 @@ pipeline::OpFactories AggregateBlockingNode::decompose_to_pipeline(pipeline::Pip
             _tnode.agg_node.__isset.use_per_bucket_optimize && _tnode.agg_node.use_per_bucket_optimize;
     bool has_group_by_keys = agg_node.__isset.grouping_exprs && !_tnode.agg_node.grouping_exprs.empty();
     bool could_local_shuffle = context->could_local_shuffle(ops_with_sink);
+    bool enable_agg_spill = runtime_state()->enable_spill() && runtime_state()->enable_agg_spill() && has_group_by_keys;
+    // Instead of shuffling the input by the group by keys, the sink drivers insert into the hash tables
+    // of each other directly, each of them owns a hash partition of the group by keys.
+    bool shared_hash_table = runtime_state()->enable_shared_agg_hash_table() && has_group_by_keys &&
+                             could_local_shuffle && !sorted_streaming_aggregate && !enable_agg_spill &&
+                             !use_per_bucket_optimize &&
+                             context->source_operator(ops_with_sink)->degree_of_parallelism() > 1 &&
+                             !context->should_interpolate_cache_operator(id(), ops_with_sink[0]);
 
     auto try_interpolate_local_shuffle = [this, context](auto& ops) {
         return context->maybe_interpolate_local_shuffle_exchange(runtime_state(), id(), ops, [this]() {
@@ -271,13 +281,13 @@ pipeline::OpFactories AggregateBlockingNode::decompose_to_pipeline(pipeline::Pip
             if (!has_group_by_keys) {
                 ops_with_sink =
                         context->maybe_interpolate_local_passthrough_exchange(runtime_state(), id(), ops_with_sink);
-            } else if (could_local_shuffle) {
+            } else if (could_local_shuffle && !shared_hash_table) {
                 ops_with_sink = try_interpolate_local_shuffle(ops_with_sink);
             }
         } else {
             if (!has_group_by_keys) {
                 // Do nothing.
-            } else if (could_local_shuffle) {
+            } else if (could_local_shuffle && !shared_hash_table) {
                 ops_with_sink = try_interpolate_local_shuffle(ops_with_sink);
             }
         }
@@ -291,14 +301,14 @@ pipeline::OpFactories AggregateBlockingNode::decompose_to_pipeline(pipeline::Pip
                 _decompose_to_pipeline<StreamingAggregatorFactory, SortedAggregateStreamingSourceOperatorFactory,
                                        SortedAggregateStreamingSinkOperatorFactory>(ops_with_sink, context, false);
     } else {
-        if (runtime_state()->enable_spill() && runtime_state()->enable_agg_spill() && has_group_by_keys) {
+        if (enable_agg_spill) {
             ops_with_source = _decompose_to_pipeline<AggregatorFactory, SpillableAggregateBlockingSourceOperatorFactory,
                                                      SpillableAggregateBlockingSinkOperatorFactory>(
                     ops_with_sink, context, use_per_bucket_optimize && has_group_by_keys);
         } else {
             ops_with_source = _decompose_to_pipeline<AggregatorFactory, AggregateBlockingSourceOperatorFactory,
                                                      AggregateBlockingSinkOperatorFactory>(
-                    ops_with_sink, context, use_per_bucket_optimize && has_group_by_keys);
+                    ops_with_sink, context, use_per_bucket_optimize && has_group_by_keys, shared_hash_table);
         }
     }
 
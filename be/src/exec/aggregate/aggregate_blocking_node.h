@@ -35,6 +35,7 @@ public:
 private:
     template <class AggFactory, class SourceFactory, class SinkFactory>
     pipeline::OpFactories _decompose_to_pipeline(pipeline::OpFactories& ops_with_sink,
-                                                 pipeline::PipelineBuilderContext* context, bool per_bucket_optimize);
+                                                 pipeline::PipelineBuilderContext* context, bool per_bucket_optimize,
+                                                 bool shared_hash_table = false);
 };
 } // namespace starrocks
@@ -14,6 +14,8 @@
 
 #include "aggregator.h"
 
+#include <fmt/format.h>
+
 #include <algorithm>
 #include <memory>
 #include <type_traits>
@@ -25,15 +27,18 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
 #include "exec/spill/spiller.hpp"
 #include "exprs/anyval_util.h"
+#include "exprs/jit/jit_engine.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -269,6 +274,7 @@ Status Aggregator::open(RuntimeState* state) {
             _state_allocator.pool = _mem_pool.get();
         }
     }
+    _prepare_jit_agg_update(state);
 
     // AggregateFunction::create needs to call create in JNI,
     // but prepare is executed in bthread, which will cause the JNI code to crash
@@ -766,9 +772,15 @@ Status Aggregator::compute_batch_agg_states(Chunk* chunk, size_t chunk_size) {
     bool use_intermediate = _use_intermediate_as_input();
     auto& agg_expr_ctxs = use_intermediate ? _intermediate_agg_expr_ctxs : _agg_expr_ctxs;
 
+    bool use_jit = _jit_agg_update != nullptr && !use_intermediate;
+
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
+        if (use_jit && _is_jit_agg_funcs[i]) {
+            // updated by the compiled function after all the arguments are evaluated
+            continue;
+        }
         // batch call update or merge
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
@@ -779,10 +791,108 @@ Status Aggregator::compute_batch_agg_states(Chunk* chunk, size_t chunk_size) {
                                            _agg_input_columns[i][0].get(), _tmp_agg_states.data());
         }
     }
+    if (use_jit && !_jit_update_batch(chunk_size)) {
+        for (size_t i : _jit_agg_fn_indexes) {
+            _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
+                                            _agg_input_raw_columns[i].data(), _tmp_agg_states.data());
+        }
+    }
     RETURN_IF_ERROR(check_has_error());
     return Status::OK();
 }
 
+void Aggregator::_prepare_jit_agg_update(RuntimeState* state) {
+    _jit_agg_update = nullptr;
+    _jit_agg_obj_cache.reset();
+    _jit_agg_updates.clear();
+    _jit_agg_fn_indexes.clear();
+    _is_jit_agg_funcs.assign(_agg_fn_ctxs.size(), false);
+    if (_group_by_expr_ctxs.empty() || _is_only_group_by_columns || !state->is_jit_enabled() ||
+        !state->can_jit_expr(CompilableExprType::AGGREGATE)) {
+        return;
+    }
+
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        JITAggregateUpdate update;
+        if (_is_merge_funcs[i] || _agg_expr_ctxs[i].size() > 1 ||
+            !_agg_functions[i]->get_jit_update(_agg_states_offsets[i], &update)) {
+            continue;
+        }
+        _jit_agg_updates.emplace_back(update);
+        _jit_agg_fn_indexes.emplace_back(i);
+    }
+    // It's not worth compiling a single function, whose update_batch is already a tight loop.
+    if (_jit_agg_updates.size() < 2) {
+        _jit_agg_updates.clear();
+        _jit_agg_fn_indexes.clear();
+        return;
+    }
+
+    // The offsets are part of the name, since they are constants in the compiled function.
+    std::string func_name = "jit_agg";
+    for (const auto& update : _jit_agg_updates) {
+        func_name += fmt::format("_{}.{}.{}.{}.{}.{}.{}", static_cast<int>(update.kind),
+                                 static_cast<int>(update.arg_type), static_cast<int>(update.value_type),
+                                 update.value_offset, update.count_offset, update.null_flag_offset, update.skip_null);
+    }
+
+    auto start = MonotonicNanos();
+    auto obj_cache = std::make_shared<JitObjectCache>(func_name, JITEngine::get_instance()->get_func_cache());
+    auto st = JITEngine::compile_aggregate_function(obj_cache.get(), _jit_agg_updates);
+    auto elapsed = MonotonicNanos() - start;
+    if (state->fragment_ctx() != nullptr) {
+        state->fragment_ctx()->update_jit_profile(elapsed);
+    }
+    if (!st.ok() || obj_cache->get_func() == nullptr) {
+        LOG(INFO) << "JIT: compile aggregate functions failed, time cost: " << elapsed / 1000000.0 << " ms"
+                  << " Reason: " << st;
+        _jit_agg_updates.clear();
+        _jit_agg_fn_indexes.clear();
+        return;
+    }
+    VLOG_QUERY << "JIT: compile aggregate functions success, time cost: " << elapsed / 1000000.0
+               << " ms :" << func_name;
+    _jit_agg_obj_cache = std::move(obj_cache);
+    _jit_agg_update = _jit_agg_obj_cache->get_func();
+    for (size_t i : _jit_agg_fn_indexes) {
+        _is_jit_agg_funcs[i] = true;
+    }
+    _runtime_profile->add_info_string("JITAggregateFunctions", std::to_string(_jit_agg_fn_indexes.size()));
+}
+
+bool Aggregator::_jit_update_batch(size_t chunk_size) {
+    std::vector<JITColumn> columns;
+    columns.reserve(_jit_agg_updates.size() + 1);
+    for (size_t k = 0; k < _jit_agg_updates.size(); k++) {
+        const auto& update = _jit_agg_updates[k];
+        if (!update.has_input()) {
+            continue;
+        }
+        const Column* column = _agg_input_raw_columns[_jit_agg_fn_indexes[k]][0];
+        const int8_t* null_flags = nullptr;
+        if (column->is_nullable()) {
+            if (!update.skip_null) {
+                return false;
+            }
+            const auto* nullable_column = down_cast<const NullableColumn*>(column);
+            null_flags = reinterpret_cast<const int8_t*>(nullable_column->null_column()->raw_data());
+            column = nullable_column->data_column().get();
+        } else if (update.skip_null) {
+            if (_jit_agg_zero_null_flags.size() < chunk_size) {
+                _jit_agg_zero_null_flags.resize(chunk_size, 0);
+            }
+            null_flags = reinterpret_cast<const int8_t*>(_jit_agg_zero_null_flags.data());
+        }
+        // the data of count(nullable) is not read
+        const int8_t* datums =
+                update.arg_type == TYPE_NULL ? nullptr : reinterpret_cast<const int8_t*>(column->raw_data());
+        columns.emplace_back(JITColumn{datums, null_flags});
+    }
+    columns.emplace_back(JITColumn{reinterpret_cast<const int8_t*>(_tmp_agg_states.data()), nullptr});
+    _jit_agg_update(chunk_size, columns.data());
+    return true;
+}
+
 Status Aggregator::compute_batch_agg_states_with_selection(Chunk* chunk, size_t chunk_size) {
     SCOPED_TIMER(_agg_stat->agg_function_compute_timer);
     bool use_intermediate = _use_intermediate_as_input();
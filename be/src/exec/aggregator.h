@@ -48,6 +48,8 @@
 namespace starrocks {
 
 struct HashTableKeyAllocator;
+class JitObjectCache;
+struct JITColumn;
 
 struct RawHashTableIterator {
     RawHashTableIterator(HashTableKeyAllocator* alloc_, size_t x_, int y_) : alloc(alloc_), x(x_), y(y_) {}
@@ -220,7 +222,7 @@ struct AggregatorParams {
     std::vector<TExpr> intermediate_aggr_exprs;
 
     // Incremental MV
-    // Whether it's testing, use MemStateTable in testing, instead use IMTStateTable.
+    // Whether it's testing, use MemStateTable in testing, instead use PersistentStateTable.
     bool is_testing;
     // Whether input is only append-only or with retract messages.
     bool is_append_only;
@@ -391,6 +393,24 @@ public:
 
     void set_streaming_all_states(bool streaming_all_states) { _streaming_all_states = streaming_all_states; }
 
+    // Serializes the sink drivers updating this aggregator when the hash tables are shared among drivers.
+    std::mutex& shared_sink_mutex() { return _shared_sink_mutex; }
+    // The chunks left by the sink drivers failing to lock shared_sink_mutex, which are aggregated by the holder.
+    // The lock only guards the list, so it's held for a short while.
+    void add_pending_shared_chunk(ChunkPtr chunk) {
+        std::lock_guard<std::mutex> l(_pending_shared_chunks_mutex);
+        _num_pending_shared_rows += chunk->num_rows();
+        _pending_shared_chunks.emplace_back(std::move(chunk));
+    }
+    std::vector<ChunkPtr> take_pending_shared_chunks() {
+        std::vector<ChunkPtr> chunks;
+        std::lock_guard<std::mutex> l(_pending_shared_chunks_mutex);
+        _num_pending_shared_rows = 0;
+        chunks.swap(_pending_shared_chunks);
+        return chunks;
+    }
+    size_t num_pending_shared_rows() const { return _num_pending_shared_rows; }
+
     bool is_streaming_all_states() const { return _streaming_all_states; }
 
     HashTableKeyAllocator _state_allocator;
@@ -418,6 +438,10 @@ protected:
     std::queue<ChunkPtr> _buffer;
     std::unique_ptr<pipeline::ChunkBufferMemoryManager> _buffer_mem_manager;
     std::mutex _buffer_mutex;
+    std::mutex _shared_sink_mutex;
+    std::mutex _pending_shared_chunks_mutex;
+    std::vector<ChunkPtr> _pending_shared_chunks;
+    std::atomic<size_t> _num_pending_shared_rows = 0;
 
     // Certain aggregates require a finalize step, which is the final step of the
     // aggregate after consuming all input rows. The finalize step converts the aggregate
@@ -464,6 +488,16 @@ protected:
     std::vector<bool> _is_merge_funcs;
     // In order batch update agg states
     Buffer<AggDataPtr> _tmp_agg_states;
+
+    // The updates of the simple aggregate functions compiled into one loop over _tmp_agg_states by JIT,
+    // _jit_agg_update is nullptr if they are not compiled.
+    std::shared_ptr<JitObjectCache> _jit_agg_obj_cache;
+    void (*_jit_agg_update)(int64_t, JITColumn*) = nullptr;
+    std::vector<JITAggregateUpdate> _jit_agg_updates;
+    std::vector<size_t> _jit_agg_fn_indexes;
+    std::vector<bool> _is_jit_agg_funcs;
+    // All zero null flags for the non-nullable arguments of the compiled nullable functions.
+    std::vector<uint8_t> _jit_agg_zero_null_flags;
     std::vector<AggFunctionTypes> _agg_fn_types;
 
     // Exprs used to evaluate conjunct
@@ -537,6 +571,12 @@ protected:
     // initial const columns for i'th FunctionContext.
     [[nodiscard]] Status _evaluate_const_columns(int i);
 
+    // Compile the updates of the simple aggregate functions, e.g. sum/count/min/max/avg of numbers, into one loop
+    // over the states of a batch, instead of a virtual update_batch call and a pass over the states per function.
+    void _prepare_jit_agg_update(RuntimeState* state);
+    // Update the states by the compiled function, return false if the arguments don't match the compiled function.
+    bool _jit_update_batch(size_t chunk_size);
+
     // Create new aggregate function result column by type
     Columns _create_agg_result_columns(size_t num_rows, bool use_intermediate);
     Columns _create_group_by_columns(size_t num_rows);
@@ -645,12 +685,23 @@ public:
 
     std::atomic<int64_t>& get_shared_limit_countdown() { return _shared_limit_countdown; }
 
+    // If true, the aggregator of each driver owns a partition of the group by keys, and the sink drivers route
+    // every input row into the aggregator owning its key, so there is exactly one state per key in the fragment
+    // instance and no local shuffle before the aggregation.
+    void set_enable_shared_hash_table(bool enable) { _enable_shared_hash_table = enable; }
+    bool enable_shared_hash_table() const { return _enable_shared_hash_table; }
+    void incr_shared_sinker() { _num_unfinished_shared_sinkers++; }
+    // Return true if the caller is the last sinker to finish, the shared aggregators are complete from then on.
+    bool finish_shared_sinker() { return --_num_unfinished_shared_sinkers == 0; }
+
 private:
     const TPlanNode& _tnode;
     AggregatorParamsPtr _aggregator_param;
     std::unordered_map<size_t, Ptr> _aggregators;
     AggrMode _aggr_mode = AggrMode::AM_DEFAULT;
     std::atomic<int64_t> _shared_limit_countdown;
+    bool _enable_shared_hash_table = false;
+    std::atomic<int32_t> _num_unfinished_shared_sinkers = 0;
 };
 
 using AggregatorFactory = AggregatorFactoryBase<Aggregator>;
@@ -15,21 +15,76 @@
 #include "exec/hash_join_components.h"
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/hash_joiner.h"
 
 namespace starrocks {
 
-Status HashJoinProber::push_probe_chunk(RuntimeState* state, ChunkPtr&& chunk) {
-    DCHECK(!_probe_chunk);
-    _probe_chunk = std::move(chunk);
-    _current_probe_has_remain = true;
-    RETURN_IF_ERROR(_hash_joiner.prepare_probe_key_columns(&_key_columns, _probe_chunk));
+Status HashJoinProber::push_probe_chunk(RuntimeState* state, ChunkPtr&& chunk, JoinHashTable* hash_table) {
+    DCHECK(probe_chunk_empty());
+    if (!hash_table->is_partitioned()) {
+        _probe_chunk = std::move(chunk);
+        _current_probe_has_remain = true;
+        RETURN_IF_ERROR(_hash_joiner.prepare_probe_key_columns(&_key_columns, _probe_chunk));
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(_hash_joiner.prepare_probe_key_columns(&_key_columns, chunk));
+    hash_table->probe_partitions(state, _key_columns, chunk->num_rows(), &_chunk_partitions);
+    _key_columns.clear();
+    _num_partitions = hash_table->get_num_partitions();
+    if (_buffered_chunk == nullptr) {
+        _buffered_chunk = std::move(chunk);
+    } else {
+        _buffered_chunk->append(*chunk);
+    }
+    _buffered_partitions.insert(_buffered_partitions.end(), _chunk_partitions.begin(), _chunk_partitions.end());
+    if (static_cast<int64_t>(_buffered_chunk->num_rows()) >= config::hash_join_partition_probe_rows) {
+        flush_probe_chunk(state);
+    }
     return Status::OK();
 }
 
+// Counting sort the buffered rows by partition, then cut them into the chunks to probe. The partitions are ranges of
+// buckets in ascending order, so the probe walks the hash table from the first partition to the last one.
+void HashJoinProber::flush_probe_chunk(RuntimeState* state) {
+    DCHECK(_buffered_chunk != nullptr);
+    const uint32_t num_rows = _buffered_chunk->num_rows();
+    DCHECK_EQ(num_rows, _buffered_partitions.size());
+
+    Buffer<uint32_t> offsets(_num_partitions + 1, 0);
+    for (uint32_t partition : _buffered_partitions) {
+        offsets[partition + 1]++;
+    }
+    for (uint32_t i = 1; i <= _num_partitions; i++) {
+        offsets[i] += offsets[i - 1];
+    }
+    Buffer<uint32_t> order(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        order[offsets[_buffered_partitions[i]]++] = i;
+    }
+
+    const uint32_t chunk_size = state->chunk_size();
+    for (uint32_t from = 0; from < num_rows; from += chunk_size) {
+        const uint32_t size = std::min(chunk_size, num_rows - from);
+        ChunkPtr chunk = _buffered_chunk->clone_empty_with_slot(size);
+        chunk->append_selective(*_buffered_chunk, order.data(), from, size);
+        _partitioned_chunks.emplace_back(std::move(chunk));
+    }
+    _buffered_chunk.reset();
+    _buffered_partitions.clear();
+}
+
 StatusOr<ChunkPtr> HashJoinProber::probe_chunk(RuntimeState* state, JoinHashTable* hash_table) {
     auto chunk = std::make_shared<Chunk>();
     TRY_CATCH_ALLOC_SCOPE_START()
+    if (_probe_chunk == nullptr) {
+        DCHECK(!_partitioned_chunks.empty());
+        _probe_chunk = std::move(_partitioned_chunks.front());
+        _partitioned_chunks.pop_front();
+        _current_probe_has_remain = true;
+        RETURN_IF_ERROR(_hash_joiner.prepare_probe_key_columns(&_key_columns, _probe_chunk));
+    }
     DCHECK(_current_probe_has_remain && _probe_chunk);
     RETURN_IF_ERROR(hash_table->probe(state, _key_columns, &_probe_chunk, &chunk, &_current_probe_has_remain));
     RETURN_IF_ERROR(_hash_joiner.filter_probe_output_chunk(chunk, *hash_table));
@@ -55,6 +110,9 @@ StatusOr<ChunkPtr> HashJoinProber::probe_remain(RuntimeState* state, JoinHashTab
 void HashJoinProber::reset() {
     _probe_chunk.reset();
     _current_probe_has_remain = false;
+    _buffered_chunk.reset();
+    _buffered_partitions.clear();
+    _partitioned_chunks.clear();
 }
 
 void HashJoinBuilder::create(const HashTableParam& param) {
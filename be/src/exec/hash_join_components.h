@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "exec/join_hash_map.h"
@@ -25,9 +27,15 @@ class HashJoinProber {
 public:
     HashJoinProber(HashJoiner& hash_joiner) : _hash_joiner(hash_joiner) {}
 
-    bool probe_chunk_empty() const { return _probe_chunk == nullptr; }
+    bool probe_chunk_empty() const { return _probe_chunk == nullptr && _partitioned_chunks.empty(); }
+
+    // If the hash table is partitioned, the probe rows are buffered until there are enough to be reordered by
+    // partition, so that the probe of every partition only reads that part of the hash table.
+    [[nodiscard]] Status push_probe_chunk(RuntimeState* state, ChunkPtr&& chunk, JoinHashTable* hash_table);
 
-    [[nodiscard]] Status push_probe_chunk(RuntimeState* state, ChunkPtr&& chunk);
+    // The probe rows buffered for partitioning, flush them once there is no more input.
+    bool has_buffered_probe_rows() const { return _buffered_chunk != nullptr; }
+    void flush_probe_chunk(RuntimeState* state);
 
     // probe hash table
     [[nodiscard]] StatusOr<ChunkPtr> probe_chunk(RuntimeState* state, JoinHashTable* hash_table);
@@ -43,6 +51,13 @@ private:
     ChunkPtr _probe_chunk;
     Columns _key_columns;
     bool _current_probe_has_remain = false;
+
+    // for the partitioned hash table
+    ChunkPtr _buffered_chunk;
+    Buffer<uint32_t> _buffered_partitions;
+    Buffer<uint32_t> _chunk_partitions;
+    uint32_t _num_partitions = 0;
+    std::deque<ChunkPtr> _partitioned_chunks;
 };
 
 class HashJoinBuilder {
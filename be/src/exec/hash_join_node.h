@@ -51,6 +51,7 @@ public:
     bool can_generate_global_runtime_filter() const;
     TJoinDistributionMode::type distribution_mode() const;
     const std::list<RuntimeFilterBuildDescriptor*>& build_runtime_filters() const;
+    const std::vector<ExprContext*>& probe_expr_ctxs() const { return _probe_expr_ctxs; }
     void push_down_join_runtime_filter(RuntimeState* state, RuntimeFilterProbeCollector* collector) override;
 
 private:
@@ -240,7 +240,7 @@ bool HashJoiner::has_output() const {
 
 Status HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
     DCHECK(chunk && !chunk->is_empty());
-    return _hash_join_prober->push_probe_chunk(state, std::move(chunk));
+    return _hash_join_prober->push_probe_chunk(state, std::move(chunk), &_hash_join_builder->hash_table());
 }
 
 StatusOr<ChunkPtr> HashJoiner::pull_chunk(RuntimeState* state) {
@@ -254,6 +254,9 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
     auto chunk = std::make_shared<Chunk>();
     auto& ht = _hash_join_builder->hash_table();
 
+    if (_phase != HashJoinPhase::PROBE && _hash_join_prober->has_buffered_probe_rows()) {
+        _hash_join_prober->flush_probe_chunk(state);
+    }
     if (_phase == HashJoinPhase::PROBE || !_hash_join_prober->probe_chunk_empty()) {
         ASSIGN_OR_RETURN(chunk, _hash_join_prober->probe_chunk(state, &ht))
         return chunk;
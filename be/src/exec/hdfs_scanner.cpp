@@ -16,9 +16,12 @@
 
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/query_context.h"
 #include "fs/hdfs/fs_hdfs.h"
 #include "io/compressed_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "util/compression/compression_utils.h"
 #include "util/compression/stream_compression.h"
 
@@ -239,6 +242,22 @@ Status HdfsScanner::open_random_access_file() {
         _cache_input_stream->set_priority(_scanner_params.datacache_priority);
         _cache_input_stream->set_ttl_seconds(_scanner_params.datacache_ttl_seconds);
         _cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
+        auto* query_ctx = _runtime_state->query_ctx();
+        if (config::datacache_readahead_enable && query_ctx != nullptr) {
+            io::CacheInputStream::ReadaheadOptions readahead_options;
+            readahead_options.thread_pool = ExecEnv::GetInstance()->datacache_readahead_pool();
+            readahead_options.max_blocks = config::datacache_readahead_max_blocks;
+            readahead_options.query_bytes = query_ctx->mutable_datacache_readahead_bytes();
+            readahead_options.max_query_bytes = config::datacache_readahead_max_bytes_per_query;
+            readahead_options.mem_tracker = CurrentThread::mem_tracker();
+            readahead_options.open_stream = [fs = _scanner_params.fs, path = _scanner_params.path,
+                                             file_size]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+                ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(path));
+                file->set_size(file_size);
+                return file->stream();
+            };
+            _cache_input_stream->set_readahead_options(readahead_options);
+        }
         _shared_buffered_input_stream->set_align_size(_cache_input_stream->get_align_size());
         input_stream = _cache_input_stream;
     }
@@ -368,6 +387,12 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_counter, stats.readahead_count);
+        COUNTER_UPDATE(profile->datacache_readahead_bytes, stats.readahead_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_cache_bytes, stats.readahead_cache_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_hit_counter, stats.readahead_hit_count);
+        COUNTER_UPDATE(profile->datacache_readahead_hit_bytes, stats.readahead_hit_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_wait_timer, stats.readahead_wait_ns);
 
         if (_runtime_state->query_options().__isset.query_type &&
             _runtime_state->query_options().query_type == TQueryType::LOAD) {
@@ -82,6 +82,10 @@ struct HdfsScanStats {
     // page index
     int64_t rows_before_page_index = 0;
     int64_t page_index_ns = 0;
+    // bloom filter
+    int64_t bloom_filter_ns = 0;
+    int64_t bloom_filter_bytes_read = 0;
+    int64_t bloom_filter_skip_groups = 0;
 
     // late materialize round-by-round
     int64_t group_min_round_cost = 0;
@@ -130,6 +134,12 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_write_fail_bytes = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_counter = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_counter = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_cache_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_hit_counter = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_hit_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_readahead_wait_timer = nullptr;
 
     RuntimeProfile::Counter* shared_buffered_shared_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_shared_io_bytes = nullptr;
@@ -86,6 +86,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     // page index
     RuntimeProfile::Counter* rows_before_page_index = nullptr;
     RuntimeProfile::Counter* page_index_timer = nullptr;
+    // bloom filter
+    RuntimeProfile::Counter* bloom_filter_timer = nullptr;
+    RuntimeProfile::Counter* bloom_filter_bytes_read = nullptr;
+    RuntimeProfile::Counter* bloom_filter_skip_groups = nullptr;
 
     RuntimeProfile* root = profile->runtime_profile;
     ADD_COUNTER(root, kParquetProfileSectionPrefix, TUnit::NONE);
@@ -126,6 +130,11 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
             kParquetProfileSectionPrefix);
     rows_before_page_index = ADD_CHILD_COUNTER(root, "RowsBeforePageIndex", TUnit::UNIT, kParquetProfileSectionPrefix);
     page_index_timer = ADD_CHILD_TIMER(root, "PageIndexTime", kParquetProfileSectionPrefix);
+    bloom_filter_timer = ADD_CHILD_TIMER(root, "BloomFilterTime", kParquetProfileSectionPrefix);
+    bloom_filter_bytes_read =
+            ADD_CHILD_COUNTER(root, "BloomFilterBytesRead", TUnit::BYTES, kParquetProfileSectionPrefix);
+    bloom_filter_skip_groups =
+            ADD_CHILD_COUNTER(root, "BloomFilterSkipGroups", TUnit::UNIT, kParquetProfileSectionPrefix);
 
     COUNTER_UPDATE(request_bytes_read, _app_stats.request_bytes_read);
     COUNTER_UPDATE(request_bytes_read_uncompressed, _app_stats.request_bytes_read_uncompressed);
@@ -151,6 +160,9 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     do_update_iceberg_v2_counter(root, kParquetProfileSectionPrefix);
     COUNTER_UPDATE(rows_before_page_index, _app_stats.rows_before_page_index);
     COUNTER_UPDATE(page_index_timer, _app_stats.page_index_ns);
+    COUNTER_UPDATE(bloom_filter_timer, _app_stats.bloom_filter_ns);
+    COUNTER_UPDATE(bloom_filter_bytes_read, _app_stats.bloom_filter_bytes_read);
+    COUNTER_UPDATE(bloom_filter_skip_groups, _app_stats.bloom_filter_skip_groups);
 }
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
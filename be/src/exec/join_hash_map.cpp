@@ -176,6 +176,7 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
     }
 }
 
+template <bool only_buckets>
 void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     probe_state->probe_pool->clear();
 
@@ -209,13 +210,16 @@ void SerializedJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items,
 
     // serialize and init search
     if (!null_columns.empty()) {
-        _probe_nullable_column(table_items, probe_state, data_columns, null_columns, ptr);
+        _probe_nullable_column<only_buckets>(table_items, probe_state, data_columns, null_columns, ptr);
     } else {
-        _probe_column(table_items, probe_state, data_columns, ptr);
+        _probe_column<only_buckets>(table_items, probe_state, data_columns, ptr);
+    }
+    if constexpr (!only_buckets) {
+        probe_state->consider_probe_time_locality();
     }
-    probe_state->consider_probe_time_locality();
 }
 
+template <bool only_buckets>
 void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                             const Columns& data_columns, uint8_t* ptr) {
     uint32_t row_count = probe_state->probe_row_count;
@@ -226,12 +230,16 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
                 JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
         ptr += probe_state->probe_slice[i].size;
     }
+    if constexpr (only_buckets) {
+        return;
+    }
 
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
 }
 
+template <bool only_buckets>
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
                                                      HashTableProbeState* probe_state, const Columns& data_columns,
                                                      const NullColumns& null_columns, uint8_t* ptr) {
@@ -258,13 +266,23 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+            if constexpr (!only_buckets) {
+                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+            }
+        } else if constexpr (only_buckets) {
+            // the null keys match nothing, put them into any partition.
+            probe_state->buckets[i] = 0;
         } else {
             probe_state->next[i] = 0;
         }
     }
 }
 
+template void SerializedJoinProbeFunc::lookup_init<false>(const JoinHashTableItems& table_items,
+                                                          HashTableProbeState* probe_state);
+template void SerializedJoinProbeFunc::lookup_init<true>(const JoinHashTableItems& table_items,
+                                                         HashTableProbeState* probe_state);
+
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
 void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_index_output(ChunkPtr* chunk) {
     _probe_state->probe_index.resize((*chunk)->num_rows());
@@ -541,14 +559,7 @@ Status JoinHashTable::build(RuntimeState* state) {
     RETURN_IF_ERROR(_table_items->build_chunk->upgrade_if_overflow());
     _table_items->has_large_column = _table_items->build_chunk->has_large_column();
 
-    // If the join key is column ref of build chunk, fetch from build chunk directly
-    size_t join_key_count = _table_items->join_keys.size();
-    for (size_t i = 0; i < join_key_count; i++) {
-        if (_table_items->join_keys[i].col_ref != nullptr) {
-            SlotId slot_id = _table_items->join_keys[i].col_ref->slot_id();
-            _table_items->key_columns[i] = _table_items->build_chunk->get_column_by_slot_id(slot_id);
-        }
-    }
+    _fetch_key_columns_from_build_chunk();
 
     RETURN_IF_ERROR(_upgrade_key_columns_if_overflow());
 
@@ -568,9 +579,25 @@ Status JoinHashTable::build(RuntimeState* state) {
         assert(false);
     }
 
+    if (is_partitioned()) {
+        // The columns of the build chunk have been reordered by partition.
+        _fetch_key_columns_from_build_chunk();
+    }
+
     return Status::OK();
 }
 
+void JoinHashTable::_fetch_key_columns_from_build_chunk() {
+    // If the join key is column ref of build chunk, fetch from build chunk directly
+    size_t join_key_count = _table_items->join_keys.size();
+    for (size_t i = 0; i < join_key_count; i++) {
+        if (_table_items->join_keys[i].col_ref != nullptr) {
+            SlotId slot_id = _table_items->join_keys[i].col_ref->slot_id();
+            _table_items->key_columns[i] = _table_items->build_chunk->get_column_by_slot_id(slot_id);
+        }
+    }
+}
+
 void JoinHashTable::reset_probe_state(starrocks::RuntimeState* state) {
     _hash_map_type = _choose_join_hash_map();
     switch (_hash_map_type) {
@@ -604,6 +631,20 @@ Status JoinHashTable::probe(RuntimeState* state, const Columns& key_columns, Chu
     return Status::OK();
 }
 
+void JoinHashTable::probe_partitions(RuntimeState* state, const Columns& key_columns, size_t num_rows,
+                                     Buffer<uint32_t>* partitions) {
+    switch (_hash_map_type) {
+#define M(NAME)                                                              \
+    case JoinHashMapType::NAME:                                              \
+        _##NAME->probe_partitions(state, key_columns, num_rows, partitions); \
+        break;
+        APPLY_FOR_JOIN_VARIANTS(M)
+#undef M
+    default:
+        assert(false);
+    }
+}
+
 Status JoinHashTable::probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     switch (_hash_map_type) {
 #define M(NAME)                                   \
@@ -128,9 +128,16 @@ struct JoinHashTableItems {
     bool has_large_column = false;
     float keys_per_bucket = 0;
     size_t used_buckets = 0;
+    // the bytes of the keys and `next` read by probe.
+    size_t probe_bytes = 0;
     bool cache_miss_serious = false;
     bool mor_reader_mode = false;
     bool enable_late_materialization = false;
+    // If > 0, the hash table is radix-partitioned into the partitions of about this many bytes once it's larger,
+    // see JoinHashMap::_partition_build_rows. The partition of a bucket is `bucket >> partition_shift`.
+    size_t partition_cache_bytes = 0;
+    uint32_t num_partitions = 1;
+    uint32_t partition_shift = 0;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -139,7 +146,7 @@ struct JoinHashTableItems {
         if (used_buckets == 0) { // to avoid redo
             used_buckets = SIMD::count_nonzero(first);
             keys_per_bucket = used_buckets == 0 ? 0 : row_count * 1.0 / used_buckets;
-            size_t probe_bytes = key_bytes + row_count * sizeof(uint32_t);
+            probe_bytes = key_bytes + row_count * sizeof(uint32_t);
             // cache miss is serious when
             // 1) the ht's size is enough large, for example, larger than (1UL << 27) bytes.
             // 2) smaller ht but most buckets have more than one keys
@@ -451,9 +458,16 @@ public:
     using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
 
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
+    // If only_buckets, only compute the buckets of the probe rows without looking up the hash table.
+    template <bool only_buckets = false>
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
     static bool equal(const CppType& x, const CppType& y) { return x == y; }
+
+private:
+    // If the string keys keep their dict codes, compute the bucket of every word of the dictionary only once.
+    static bool _calc_bucket_nums_by_dict_codes(const JoinHashTableItems& table_items,
+                                                HashTableProbeState* probe_state);
 };
 
 template <LogicalType LT>
@@ -480,6 +494,7 @@ public:
     }
 
     // serialize and calculate hash values for probe keys.
+    template <bool only_buckets = false>
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
 
     static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state) {
@@ -489,8 +504,10 @@ public:
     static bool equal(const CppType& x, const CppType& y) { return x == y; }
 
 private:
+    template <bool only_buckets>
     static void _probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                               const Columns& data_columns);
+    template <bool only_buckets>
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                        const Columns& data_columns, const NullColumns& null_columns);
 };
@@ -505,13 +522,16 @@ public:
         probe_state->is_nulls.resize(state->chunk_size());
     }
 
+    template <bool only_buckets = false>
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
 
     static bool equal(const Slice& x, const Slice& y) { return x == y; }
 
 private:
+    template <bool only_buckets>
     static void _probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                               const Columns& data_columns, uint8_t* ptr);
+    template <bool only_buckets>
     static void _probe_nullable_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                        const Columns& data_columns, const NullColumns& null_columns, uint8_t* ptr);
 };
@@ -551,6 +571,10 @@ public:
         }
         return;
     }
+    void probe_partitions(RuntimeState* state, const Columns& key_columns, size_t num_rows,
+                          Buffer<uint32_t>* partitions) {
+        partitions->assign(num_rows, 0);
+    }
     void probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* has_remain) {
         // For RIGHT ANTI-JOIN, RIGHT SEMI-JOIN, FULL OUTER-JOIN, right table is empty,
         // do nothing for probe_remain.
@@ -665,6 +689,8 @@ public:
     void build(RuntimeState* state);
     void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                bool* has_remain);
+    void probe_partitions(RuntimeState* state, const Columns& key_columns, size_t num_rows,
+                          Buffer<uint32_t>* partitions);
     void probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* has_remain);
     template <bool is_remain>
     void lazy_output(RuntimeState* state, ChunkPtr* probe_chunk, ChunkPtr* result_chunk);
@@ -690,6 +716,9 @@ private:
     void _probe_index_output(ChunkPtr* chunk);
     void _build_index_output(ChunkPtr* chunk);
 
+    void _init_partitions();
+    void _partition_build_rows();
+
     void _search_ht(RuntimeState* state, ChunkPtr* probe_chunk);
     void _search_ht_remain(RuntimeState* state);
 
@@ -824,6 +853,10 @@ public:
     Status build(RuntimeState* state);
     void reset_probe_state(RuntimeState* state);
     Status probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk, bool* eos);
+    // Compute the partition of each of the `num_rows` probe rows, the rows of partition p only match the build rows
+    // of partition p. Must not be called while a probe has remain.
+    void probe_partitions(RuntimeState* state, const Columns& key_columns, size_t num_rows,
+                          Buffer<uint32_t>* partitions);
     Status probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* eos);
     template <bool is_remain>
     Status lazy_output(RuntimeState* state, ChunkPtr* probe_chunk, ChunkPtr* result_chunk);
@@ -841,6 +874,11 @@ public:
     size_t get_output_build_column_count() const { return _table_items->output_build_column_count; }
     size_t get_bucket_size() const { return _table_items->bucket_size; }
     float get_keys_per_bucket() const;
+    // Must be called before build(). If the hash table is larger than `cache_bytes`, the build rows are
+    // radix-partitioned by bucket into the partitions of about `cache_bytes` each. 0 disables it.
+    void set_partition_cache_bytes(size_t cache_bytes) { _table_items->partition_cache_bytes = cache_bytes; }
+    bool is_partitioned() const { return _table_items->num_partitions > 1; }
+    uint32_t get_num_partitions() const { return _table_items->num_partitions; }
     void remove_duplicate_index(Filter* filter);
     JoinHashTableItems* table_items() const { return _table_items.get(); }
 
@@ -851,6 +889,7 @@ private:
     void _init_build_column(const HashTableParam& param);
     void _init_mor_reader();
     void _init_join_keys();
+    void _fetch_key_columns_from_build_chunk();
 
     JoinHashMapType _choose_join_hash_map();
     static size_t _get_size_of_fixed_and_contiguous_type(LogicalType data_type);
@@ -260,10 +260,17 @@ const Buffer<typename DirectMappingJoinProbeFunc<LT>::CppType>& DirectMappingJoi
 }
 
 template <LogicalType LT>
+template <bool only_buckets>
 void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     size_t probe_row_count = probe_state->probe_row_count;
-    auto& data = get_key_data(*probe_state);
-    JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
+    if (!_calc_bucket_nums_by_dict_codes(table_items, probe_state)) {
+        auto& data = get_key_data(*probe_state);
+        JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0,
+                                                     data.size());
+    }
+    if constexpr (only_buckets) {
+        return;
+    }
 
     if ((*probe_state->key_columns)[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
@@ -307,6 +314,41 @@ const Buffer<typename JoinProbeFunc<LT>::CppType>& JoinProbeFunc<LT>::get_key_da
 }
 
 template <LogicalType LT>
+bool JoinProbeFunc<LT>::_calc_bucket_nums_by_dict_codes(const JoinHashTableItems& table_items,
+                                                        HashTableProbeState* probe_state) {
+    if constexpr (lt_is_string<LT>) {
+        const Column* key_column = (*probe_state->key_columns)[0].get();
+        if (key_column->is_nullable()) {
+            key_column = down_cast<const NullableColumn*>(key_column)->data_column().get();
+        }
+        if (!key_column->is_binary()) {
+            return false;
+        }
+        const auto* binary_column = down_cast<const BinaryColumn*>(key_column);
+        if (!binary_column->has_dict_codes() || binary_column->dict()->size() > binary_column->size()) {
+            return false;
+        }
+        // The dictionary is shared by the columns read from the same segment, so do not use get_data()
+        // which may build the slices of the dictionary lazily.
+        const auto& dict = *binary_column->dict();
+        Buffer<CppType> words(dict.size());
+        for (size_t i = 0; i < words.size(); i++) {
+            words[i] = dict.get_slice(i);
+        }
+        Buffer<uint32_t> word_buckets(words.size());
+        JoinHashMapHelper::calc_bucket_nums<CppType>(words, table_items.bucket_size, &word_buckets, 0, words.size());
+        const auto& codes = binary_column->dict_codes();
+        for (size_t i = 0; i < codes.size(); i++) {
+            probe_state->buckets[i] = word_buckets[codes[i]];
+        }
+        return true;
+    } else {
+        return false;
+    }
+}
+
+template <LogicalType LT>
+template <bool only_buckets>
 void FixedSizeJoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
     // prepare columns
     Columns data_columns;
@@ -334,14 +376,17 @@ void FixedSizeJoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_ite
 
     // serialize and init search
     if (!null_columns.empty()) {
-        _probe_nullable_column(table_items, probe_state, data_columns, null_columns);
+        _probe_nullable_column<only_buckets>(table_items, probe_state, data_columns, null_columns);
     } else {
-        _probe_column(table_items, probe_state, data_columns);
+        _probe_column<only_buckets>(table_items, probe_state, data_columns);
+    }
+    if constexpr (!only_buckets) {
+        probe_state->consider_probe_time_locality();
     }
-    probe_state->consider_probe_time_locality();
 }
 
 template <LogicalType LT>
+template <bool only_buckets>
 void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
                                                const Columns& data_columns) {
     uint32_t row_count = probe_state->probe_row_count;
@@ -350,6 +395,9 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
+    if constexpr (only_buckets) {
+        return;
+    }
 
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
@@ -357,6 +405,7 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
 }
 
 template <LogicalType LT>
+template <bool only_buckets>
 void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems& table_items,
                                                         HashTableProbeState* probe_state, const Columns& data_columns,
                                                         const NullColumns& null_columns) {
@@ -376,6 +425,9 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
+    if constexpr (only_buckets) {
+        return;
+    }
 
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
@@ -413,6 +465,140 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
 void JoinHashMap<LT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
     BuildFunc().construct_hash_table(state, _table_items, _probe_state);
+    // Direct mapping uses the key itself as the bucket index, the whole table is small enough to stay in cache.
+    if constexpr (!std::is_same_v<BuildFunc, DirectMappingJoinBuildFunc<LT>>) {
+        if (_table_items->partition_cache_bytes > 0 && _table_items->row_count > 0) {
+            _init_partitions();
+            if (_table_items->num_partitions > 1) {
+                _partition_build_rows();
+            }
+        }
+    }
+}
+
+// The partitions are ranges of buckets, so the partition of a row is the high bits of its bucket. Split the table into
+// as many partitions as needed for the `first`, `next` and keys of one partition to fit in partition_cache_bytes.
+template <LogicalType LT, class BuildFunc, class ProbeFunc>
+void JoinHashMap<LT, BuildFunc, ProbeFunc>::_init_partitions() {
+    static constexpr uint32_t MAX_NUM_PARTITIONS = 1024;
+    const uint32_t bucket_size = _table_items->bucket_size;
+    DCHECK_EQ(bucket_size & (bucket_size - 1), 0);
+    const size_t table_bytes = _table_items->probe_bytes + bucket_size * sizeof(uint32_t);
+
+    uint32_t num_partitions = 1;
+    while (num_partitions < MAX_NUM_PARTITIONS && num_partitions < bucket_size &&
+           num_partitions * _table_items->partition_cache_bytes < table_bytes) {
+        num_partitions <<= 1;
+    }
+    _table_items->num_partitions = num_partitions;
+    _table_items->partition_shift = __builtin_ctz(bucket_size) - __builtin_ctz(num_partitions);
+}
+
+template <LogicalType LT, class BuildFunc, class ProbeFunc>
+void JoinHashMap<LT, BuildFunc, ProbeFunc>::probe_partitions(RuntimeState* state, const Columns& key_columns,
+                                                             size_t num_rows, Buffer<uint32_t>* partitions) {
+    DCHECK(!_probe_state->has_remain);
+    DCHECK_LE(num_rows, static_cast<size_t>(state->chunk_size()));
+    if constexpr (std::is_same_v<BuildFunc, DirectMappingJoinBuildFunc<LT>>) {
+        partitions->assign(num_rows, 0);
+    } else {
+        _probe_state->key_columns = &key_columns;
+        _probe_state->probe_row_count = num_rows;
+        ProbeFunc().template lookup_init<true>(*_table_items, _probe_state);
+
+        const uint32_t shift = _table_items->partition_shift;
+        partitions->resize(num_rows);
+        for (size_t i = 0; i < num_rows; i++) {
+            (*partitions)[i] = _probe_state->buckets[i] >> shift;
+        }
+    }
+}
+
+// When the build side is much larger than the cache, every probe misses on `first`, then on each `next` of the
+// bucket chain and on the build key it points to, because the build rows are linked in arrival order.
+// Renumber the build rows in bucket order, so that the rows of a partition, i.e. a range of buckets, are adjacent.
+// HashJoinProber partitions the probe rows by the same bits and probes them partition by partition, so the probe
+// of one partition only reads the `first`, `next` and keys of that partition, which stay in cache.
+//
+// The columns are reordered one by one and each replaces the old one at once, so the extra memory is one column
+// and the index arrays at most, instead of a whole copy of the build side.
+template <LogicalType LT, class BuildFunc, class ProbeFunc>
+void JoinHashMap<LT, BuildFunc, ProbeFunc>::_partition_build_rows() {
+    const uint32_t row_count = _table_items->row_count;
+    auto& first = _table_items->first;
+    auto& next = _table_items->next;
+
+    // order[new_index] = old_index. Row 0 is reserved as the end of bucket chains and keeps its position.
+    Buffer<uint32_t> order;
+    order.reserve(row_count + 1);
+    order.emplace_back(0);
+    Buffer<uint32_t> new_index(row_count + 1, 0);
+    for (uint32_t bucket = 0; bucket < _table_items->bucket_size; bucket++) {
+        for (uint32_t i = first[bucket]; i != 0; i = next[i]) {
+            new_index[i] = order.size();
+            order.emplace_back(i);
+        }
+    }
+    // The rows with null keys are not linked into any bucket, keep them at the tail for the outer joins.
+    for (uint32_t i = 1; i < row_count + 1; i++) {
+        if (new_index[i] == 0) {
+            new_index[i] = order.size();
+            order.emplace_back(i);
+        }
+    }
+    DCHECK_EQ(order.size(), row_count + 1);
+
+    {
+        Buffer<uint32_t> new_next(row_count + 1, 0);
+        for (uint32_t i = 1; i < row_count + 1; i++) {
+            new_next[i] = new_index[next[order[i]]];
+        }
+        next.swap(new_next);
+    }
+    for (uint32_t bucket = 0; bucket < _table_items->bucket_size; bucket++) {
+        first[bucket] = new_index[first[bucket]];
+    }
+    Buffer<uint32_t>().swap(new_index);
+
+    const auto reorder_column = [&order](const ColumnPtr& column) -> ColumnPtr {
+        ColumnPtr dst = column->clone_empty();
+        dst->reserve(order.size());
+        dst->append_selective(*column, order.data(), 0, order.size());
+        return dst;
+    };
+
+    // The key columns referencing the build chunk are replaced together, so the old column is released at once.
+    // They are fetched from the build chunk again by JoinHashTable::build.
+    auto& build_chunk = _table_items->build_chunk;
+    auto& key_columns = _table_items->key_columns;
+    std::vector<uint8_t> reordered_keys(key_columns.size(), 0);
+    for (size_t idx = 0; idx < build_chunk->num_columns(); idx++) {
+        const ColumnPtr old_column = build_chunk->get_column_by_index(idx);
+        ColumnPtr new_column = reorder_column(old_column);
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            if (key_columns[i] == old_column) {
+                key_columns[i] = new_column;
+                reordered_keys[i] = 1;
+            }
+        }
+        build_chunk->update_column_by_index(std::move(new_column), idx);
+    }
+
+    for (size_t i = 0; i < key_columns.size(); i++) {
+        if (!reordered_keys[i]) {
+            key_columns[i] = reorder_column(key_columns[i]);
+        }
+    }
+    if (_table_items->build_key_column != nullptr) {
+        _table_items->build_key_column = reorder_column(_table_items->build_key_column);
+    }
+    if (!_table_items->build_slice.empty()) {
+        Buffer<Slice> build_slice(row_count + 1);
+        for (uint32_t i = 0; i < row_count + 1; i++) {
+            build_slice[i] = _table_items->build_slice[order[i]];
+        }
+        _table_items->build_slice.swap(build_slice);
+    }
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
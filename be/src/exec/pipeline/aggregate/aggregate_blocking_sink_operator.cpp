@@ -19,7 +19,11 @@
 
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
 #include "runtime/current_thread.h"
+#include "util/defer_op.h"
+#include "util/hash_util.hpp"
 #include "util/race_detect.h"
 
 namespace starrocks::pipeline {
@@ -29,53 +33,116 @@ Status AggregateBlockingSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
     RETURN_IF_ERROR(_aggregator->open(state));
 
-    _agg_group_by_with_limit = (!_aggregator->is_none_group_by_exprs() &&     // has group by keys
-                                _aggregator->limit() != -1 &&                 // has limit
-                                _aggregator->conjunct_ctxs().empty() &&       // no 'having' clause
-                                _aggregator->get_aggr_phase() == AggrPhase2); // phase 2, keep it to make things safe
+    _agg_group_by_with_limit = (!_aggregator->is_none_group_by_exprs() &&      // has group by keys
+                                _aggregator->limit() != -1 &&                  // has limit
+                                _aggregator->conjunct_ctxs().empty() &&        // no 'having' clause
+                                _aggregator->get_aggr_phase() == AggrPhase2 && // phase 2, keep it to make things safe
+                                _shared_aggregators.empty()); // each hash table only sees part of the keys when shared
+    if (!_shared_aggregators.empty()) {
+        _unique_metrics->add_info_string("SharedHashTable", "true");
+        _max_pending_shared_rows =
+                MAX_PENDING_SHARED_CHUNKS_PER_DRIVER * _shared_aggregators.size() * state->chunk_size();
+    }
     return Status::OK();
 }
 
+bool AggregateBlockingSinkOperator::need_input() const {
+    if (is_finished()) {
+        return false;
+    }
+    if (_shared_aggregators.empty()) {
+        return true;
+    }
+    // The chunks waiting for the busy hash tables are aggregated by the drivers holding them, so wait for them
+    // instead of piling up more.
+    size_t num_pending_rows = 0;
+    for (const auto& aggregator : _shared_aggregators) {
+        num_pending_rows += aggregator->num_pending_shared_rows();
+    }
+    return num_pending_rows < _max_pending_shared_rows;
+}
+
 void AggregateBlockingSinkOperator::close(RuntimeState* state) {
     auto* counter = ADD_COUNTER(_unique_metrics, "HashTableMemoryUsage", TUnit::BYTES);
     counter->set(_aggregator->hash_map_memory_usage());
+    for (auto& aggregator : _shared_aggregators) {
+        if (aggregator != _aggregator) {
+            aggregator->unref(state);
+        }
+    }
+    _shared_aggregators.clear();
     _aggregator->unref(state);
     Operator::close(state);
 }
 
+void AggregateBlockingSinkOperator::set_shared_aggregators(AggregatorFactory* aggregator_factory,
+                                                           std::vector<AggregatorPtr> aggregators,
+                                                           const std::vector<ExprContext*>* partition_expr_ctxs) {
+    DCHECK_LT(_driver_sequence, aggregators.size());
+    DCHECK(aggregators[_driver_sequence] == _aggregator);
+    _aggregator_factory = aggregator_factory;
+    _shared_aggregators = std::move(aggregators);
+    _partition_expr_ctxs = partition_expr_ctxs;
+    // The aggregator of this driver is already reffed in constructor.
+    for (auto& aggregator : _shared_aggregators) {
+        if (aggregator != _aggregator) {
+            aggregator->ref();
+        }
+    }
+}
+
 Status AggregateBlockingSinkOperator::set_finishing(RuntimeState* state) {
     if (_is_finished) return Status::OK();
     ONCE_DETECT(_set_finishing_once);
-    auto defer = DeferOp([this]() {
-        COUNTER_UPDATE(_aggregator->input_row_count(), _aggregator->num_input_rows());
-        _aggregator->sink_complete();
+
+    if (!_shared_aggregators.empty()) {
         _is_finished = true;
+        // The other drivers may still insert into the shared hash tables,
+        // so only the last finished driver could complete all of them.
+        if (_aggregator_factory->finish_shared_sinker()) {
+            for (auto& aggregator : _shared_aggregators) {
+                // The other drivers are finished, so the lock is free, and no chunks are left pending normally.
+                std::unique_lock<std::mutex> lock(aggregator->shared_sink_mutex());
+                RETURN_IF_ERROR(_aggregate_pending_shared_chunks(aggregator.get(), lock));
+                _finish_aggregator(state, aggregator.get());
+            }
+        }
+        return Status::OK();
+    }
+
+    _finish_aggregator(state, _aggregator.get());
+    _is_finished = true;
+    return Status::OK();
+}
+
+void AggregateBlockingSinkOperator::_finish_aggregator(RuntimeState* state, Aggregator* aggregator) {
+    auto defer = DeferOp([aggregator]() {
+        COUNTER_UPDATE(aggregator->input_row_count(), aggregator->num_input_rows());
+        aggregator->sink_complete();
     });
 
     // skip processing if cancelled
     if (state->is_cancelled()) {
-        return Status::OK();
+        return;
     }
 
-    if (!_aggregator->is_none_group_by_exprs()) {
-        COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    if (!aggregator->is_none_group_by_exprs()) {
+        COUNTER_SET(aggregator->hash_table_size(), (int64_t)aggregator->hash_map_variant().size());
         // If hash map is empty, we don't need to return value
-        if (_aggregator->hash_map_variant().size() == 0) {
-            _aggregator->set_ht_eos();
+        if (aggregator->hash_map_variant().size() == 0) {
+            aggregator->set_ht_eos();
         }
-        _aggregator->hash_map_variant().visit(
-                [&](auto& hash_map_with_key) { _aggregator->it_hash() = _aggregator->_state_allocator.begin(); });
+        aggregator->hash_map_variant().visit(
+                [&](auto& hash_map_with_key) { aggregator->it_hash() = aggregator->_state_allocator.begin(); });
 
-    } else if (_aggregator->is_none_group_by_exprs()) {
+    } else if (aggregator->is_none_group_by_exprs()) {
         // for aggregate no group by, if _num_input_rows is 0,
         // In update phase, we directly return empty chunk.
         // In merge phase, we will handle it.
-        if (_aggregator->num_input_rows() == 0 && !_aggregator->needs_finalize()) {
-            _aggregator->set_ht_eos();
+        if (aggregator->num_input_rows() == 0 && !aggregator->needs_finalize()) {
+            aggregator->set_ht_eos();
         }
     }
-
-    return Status::OK();
 }
 
 Status AggregateBlockingSinkOperator::reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
@@ -89,52 +156,166 @@ StatusOr<ChunkPtr> AggregateBlockingSinkOperator::pull_chunk(RuntimeState* state
 }
 
 Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    RETURN_IF_ERROR(_aggregator->evaluate_groupby_exprs(chunk.get()));
+    DCHECK_LE(chunk->num_rows(), state->chunk_size());
+    if (!_shared_aggregators.empty()) {
+        return _push_chunk_to_shared_aggregators(chunk);
+    }
+    return _aggregate_chunk(_aggregator.get(), chunk);
+}
+
+Status AggregateBlockingSinkOperator::_aggregate_chunk(Aggregator* aggregator, const ChunkPtr& chunk) {
+    RETURN_IF_ERROR(aggregator->evaluate_groupby_exprs(chunk.get()));
 
     const auto chunk_size = chunk->num_rows();
-    DCHECK_LE(chunk_size, state->chunk_size());
 
-    SCOPED_TIMER(_aggregator->agg_compute_timer());
+    SCOPED_TIMER(aggregator->agg_compute_timer());
     // try to build hash table if has group by keys
-    if (!_aggregator->is_none_group_by_exprs()) {
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(chunk_size, _shared_limit_countdown, _agg_group_by_with_limit));
-        TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
+    if (!aggregator->is_none_group_by_exprs()) {
+        TRY_CATCH_BAD_ALLOC(aggregator->build_hash_map(chunk_size, _shared_limit_countdown, _agg_group_by_with_limit));
+        TRY_CATCH_BAD_ALLOC(aggregator->try_convert_to_two_level_map());
     }
 
     // batch compute aggregate states
-    if (_aggregator->is_none_group_by_exprs()) {
-        RETURN_IF_ERROR(_aggregator->compute_single_agg_state(chunk.get(), chunk_size));
+    if (aggregator->is_none_group_by_exprs()) {
+        RETURN_IF_ERROR(aggregator->compute_single_agg_state(chunk.get(), chunk_size));
     } else {
         if (_agg_group_by_with_limit) {
-            // use `_aggregator->streaming_selection()` here to mark whether needs to filter key when compute agg states,
+            // use `aggregator->streaming_selection()` here to mark whether needs to filter key when compute agg states,
             // it's generated in `build_hash_map`
-            size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection().data(), chunk_size);
+            size_t zero_count = SIMD::count_zero(aggregator->streaming_selection().data(), chunk_size);
             if (zero_count == chunk_size) {
-                RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
+                RETURN_IF_ERROR(aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
             } else {
-                RETURN_IF_ERROR(_aggregator->compute_batch_agg_states_with_selection(chunk.get(), chunk_size));
+                RETURN_IF_ERROR(aggregator->compute_batch_agg_states_with_selection(chunk.get(), chunk_size));
             }
         } else {
-            RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
+            RETURN_IF_ERROR(aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
         }
     }
 
-    _aggregator->update_num_input_rows(chunk_size);
-    RETURN_IF_ERROR(_aggregator->check_has_error());
+    aggregator->update_num_input_rows(chunk_size);
+    RETURN_IF_ERROR(aggregator->check_has_error());
+
+    return Status::OK();
+}
+
+// Each row is routed to the hash table owning its group by keys, and the hash tables are visited starting
+// from this driver's own one, so that the drivers mostly lock different hash tables at the same time.
+// The pipeline workers never wait for a hash table held by another driver, the rows of it are left to the holder.
+Status AggregateBlockingSinkOperator::_push_chunk_to_shared_aggregators(const ChunkPtr& chunk) {
+    const size_t num_rows = chunk->num_rows();
+    const size_t num_partitions = _shared_aggregators.size();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+
+    _partition_ids.assign(num_rows, HashUtil::FNV_SEED);
+    for (auto* ctx : *_partition_expr_ctxs) {
+        ASSIGN_OR_RETURN(auto column, ctx->evaluate(chunk.get()));
+        column->fnv_hash(_partition_ids.data(), 0, num_rows);
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+        _partition_ids[i] = ReduceOp()(_partition_ids[i], num_partitions);
+    }
+
+    _partition_start_points.assign(num_partitions + 1, 0);
+    for (size_t i = 0; i < num_rows; ++i) {
+        _partition_start_points[_partition_ids[i]]++;
+    }
+    // We make the last item equal with number of rows of this chunk.
+    for (size_t i = 1; i <= num_partitions; ++i) {
+        _partition_start_points[i] += _partition_start_points[i - 1];
+    }
+    _partition_row_indexes.resize(num_rows);
+    for (int32_t i = num_rows - 1; i >= 0; --i) {
+        _partition_row_indexes[--_partition_start_points[_partition_ids[i]]] = i;
+    }
+
+    for (size_t k = 0; k < num_partitions; ++k) {
+        size_t partition = (_driver_sequence + k) % num_partitions;
+        auto partition_chunk = _take_partition_chunk(chunk, partition);
+        if (partition_chunk == nullptr) {
+            continue;
+        }
+        auto* aggregator = _shared_aggregators[partition].get();
+        std::unique_lock<std::mutex> lock(aggregator->shared_sink_mutex(), std::try_to_lock);
+        if (lock.owns_lock()) {
+            RETURN_IF_ERROR(_aggregate_chunk(aggregator, partition_chunk));
+        } else {
+            aggregator->add_pending_shared_chunk(std::move(partition_chunk));
+            // Try again, in case the holder has released it before seeing the chunk.
+            if (!lock.try_lock()) {
+                continue;
+            }
+        }
+        RETURN_IF_ERROR(_aggregate_pending_shared_chunks(aggregator, lock));
+    }
 
     return Status::OK();
 }
 
+// The pending chunks are checked again after unlocking, because a driver may add one after they are taken
+// but fail to lock before the unlocking. Then either this driver or the new holder aggregates it.
+Status AggregateBlockingSinkOperator::_aggregate_pending_shared_chunks(Aggregator* aggregator,
+                                                                       std::unique_lock<std::mutex>& lock) {
+    DCHECK(lock.owns_lock());
+    while (true) {
+        for (const auto& chunk : aggregator->take_pending_shared_chunks()) {
+            RETURN_IF_ERROR(_aggregate_chunk(aggregator, chunk));
+        }
+        lock.unlock();
+        // Order the unlocking before the check, pairing with the adding before the retry in the other drivers.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (aggregator->num_pending_shared_rows() == 0 || !lock.try_lock()) {
+            return Status::OK();
+        }
+    }
+}
+
+ChunkPtr AggregateBlockingSinkOperator::_take_partition_chunk(const ChunkPtr& chunk, size_t partition) {
+    const uint32_t from = _partition_start_points[partition];
+    const uint32_t size = _partition_start_points[partition + 1] - from;
+    if (size == 0) {
+        return nullptr;
+    }
+    if (size == chunk->num_rows()) {
+        return chunk;
+    }
+    ChunkPtr partition_chunk = chunk->clone_empty(size);
+    partition_chunk->append_selective(*chunk, _partition_row_indexes.data(), from, size);
+    return partition_chunk;
+}
+
 Status AggregateBlockingSinkOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    if (_aggregator_factory->enable_shared_hash_table()) {
+        const auto& grouping_exprs = _aggregator_factory->t_node().agg_node.grouping_exprs;
+        RETURN_IF_ERROR(
+                Expr::create_expr_trees(state->obj_pool(), grouping_exprs, &_partition_expr_ctxs, state, true));
+        RETURN_IF_ERROR(Expr::prepare(_partition_expr_ctxs, state));
+        RETURN_IF_ERROR(Expr::open(_partition_expr_ctxs, state));
+    }
     return Status::OK();
 }
 
+void AggregateBlockingSinkOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_partition_expr_ctxs, state);
+    OperatorFactory::close(state);
+}
+
 OperatorPtr AggregateBlockingSinkOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
     // init operator
     auto aggregator = _aggregator_factory->get_or_create(driver_sequence);
     auto op = std::make_shared<AggregateBlockingSinkOperator>(aggregator, this, _id, _plan_node_id, driver_sequence,
                                                               _aggregator_factory->get_shared_limit_countdown());
+    if (_aggregator_factory->enable_shared_hash_table() && degree_of_parallelism > 1) {
+        std::vector<AggregatorPtr> aggregators(degree_of_parallelism);
+        for (int32_t i = 0; i < degree_of_parallelism; ++i) {
+            aggregators[i] = _aggregator_factory->get_or_create(i);
+        }
+        _aggregator_factory->incr_shared_sinker();
+        op->set_shared_aggregators(_aggregator_factory.get(), std::move(aggregators), &_partition_expr_ctxs);
+    }
     return op;
 }
 
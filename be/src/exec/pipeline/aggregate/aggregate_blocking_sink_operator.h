@@ -15,6 +15,7 @@
 #pragma once
 
 #include <atomic>
+#include <mutex>
 #include <utility>
 
 #include "exec/aggregator.h"
@@ -38,7 +39,7 @@ public:
     ~AggregateBlockingSinkOperator() override = default;
 
     bool has_output() const override { return false; }
-    bool need_input() const override { return !is_finished(); }
+    bool need_input() const override;
     bool is_finished() const override { return _is_finished || _aggregator->is_finished(); }
     [[nodiscard]] Status set_finishing(RuntimeState* state) override;
 
@@ -49,6 +50,11 @@ public:
     [[nodiscard]] Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
     [[nodiscard]] Status reset_state(RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
+    // Share the hash tables with the other drivers, aggregators[i] is the aggregator of the i-th driver,
+    // and it owns the group by keys whose hash modulo the number of drivers is i.
+    void set_shared_aggregators(AggregatorFactory* aggregator_factory, std::vector<AggregatorPtr> aggregators,
+                                const std::vector<ExprContext*>* partition_expr_ctxs);
+
 protected:
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
     // It is used to perform aggregation algorithms shared by
@@ -59,11 +65,31 @@ protected:
     AggregatorPtr _aggregator = nullptr;
 
 private:
+    static constexpr size_t MAX_PENDING_SHARED_CHUNKS_PER_DRIVER = 4;
+
+    [[nodiscard]] Status _aggregate_chunk(Aggregator* aggregator, const ChunkPtr& chunk);
+    void _finish_aggregator(RuntimeState* state, Aggregator* aggregator);
+
+    [[nodiscard]] Status _push_chunk_to_shared_aggregators(const ChunkPtr& chunk);
+    ChunkPtr _take_partition_chunk(const ChunkPtr& chunk, size_t partition);
+    // Aggregate the chunks left by the other drivers into the aggregator locked by lock, then release it.
+    [[nodiscard]] Status _aggregate_pending_shared_chunks(Aggregator* aggregator, std::unique_lock<std::mutex>& lock);
+
     // Whether prev operator has no output
     std::atomic_bool _is_finished = false;
     // whether enable aggregate group by limit optimize
     bool _agg_group_by_with_limit = false;
     std::atomic<int64_t>& _shared_limit_countdown;
+
+    // Only used when the hash tables are shared among drivers.
+    AggregatorFactory* _aggregator_factory = nullptr;
+    std::vector<AggregatorPtr> _shared_aggregators;
+    const std::vector<ExprContext*>* _partition_expr_ctxs = nullptr;
+    std::vector<uint32_t> _partition_ids;
+    std::vector<uint32_t> _partition_row_indexes;
+    std::vector<uint32_t> _partition_start_points;
+    // Stop pulling the input while there are so many rows waiting for the busy hash tables.
+    size_t _max_pending_shared_rows = 0;
 };
 
 class AggregateBlockingSinkOperatorFactory final : public OperatorFactory {
@@ -76,10 +102,13 @@ public:
     ~AggregateBlockingSinkOperatorFactory() override = default;
 
     [[nodiscard]] Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
 
 private:
     AggregatorFactoryPtr _aggregator_factory;
+    // Route the input rows to the shared aggregators by group by keys.
+    std::vector<ExprContext*> _partition_expr_ctxs;
 };
 } // namespace starrocks::pipeline
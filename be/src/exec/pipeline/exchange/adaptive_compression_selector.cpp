@@ -0,0 +1,124 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/adaptive_compression_selector.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace starrocks::pipeline {
+
+// Refresh the link throughput every so many chunks, since it needs a lock of SinkBuffer.
+static constexpr int64_t kRefreshLinkThroughputInterval = 16;
+// Try a codec other than the best one every so many chunks to keep its statistics fresh.
+static constexpr int64_t kExploreInterval = 32;
+// Weight of the new sample in the moving averages.
+static constexpr double kSampleWeight = 0.25;
+
+AdaptiveCompressionSelector::AdaptiveCompressionSelector(std::vector<CompressionTypePB> candidates,
+                                                         CompressionTypePB default_codec,
+                                                         LinkThroughputFunc link_throughput)
+        : _candidates(std::move(candidates)),
+          _link_throughput_func(std::move(link_throughput)),
+          _stats(_candidates.size()),
+          _num_chunks(_candidates.size(), 0) {
+    DCHECK(!_candidates.empty());
+    auto it = std::find(_candidates.begin(), _candidates.end(), default_codec);
+    _current = it == _candidates.end() ? 0 : it - _candidates.begin();
+    for (size_t i = 0; i < _candidates.size(); ++i) {
+        if (_candidates[i] == CompressionTypePB::NO_COMPRESSION) {
+            // Nothing to measure, it costs no cpu and reduces nothing.
+            _stats[i].measured = true;
+        }
+    }
+}
+
+CompressionTypePB AdaptiveCompressionSelector::next_codec() {
+    if (_num_picked++ % kRefreshLinkThroughputInterval == 0) {
+        _link_throughput = _link_throughput_func();
+    }
+
+    size_t index = _current;
+    auto unmeasured = std::find_if(_stats.begin(), _stats.end(), [](const auto& stats) { return !stats.measured; });
+    if (unmeasured != _stats.end()) {
+        // Measure each codec once at first.
+        index = unmeasured - _stats.begin();
+    } else if (_link_throughput > 0) {
+        // Without the link throughput, keep the default codec.
+        _current = _choose_best();
+        index = _current;
+        if (_candidates.size() > 1 && _num_picked % kExploreInterval == 0) {
+            _next_explore = (_next_explore + 1) % _candidates.size();
+            if (_next_explore == _current) {
+                _next_explore = (_next_explore + 1) % _candidates.size();
+            }
+            index = _next_explore;
+        }
+    }
+
+    _num_chunks[index]++;
+    return _candidates[index];
+}
+
+void AdaptiveCompressionSelector::update(CompressionTypePB codec, size_t uncompressed_size, size_t compressed_size,
+                                         int64_t compress_ns) {
+    if (codec == CompressionTypePB::NO_COMPRESSION || uncompressed_size == 0 || compressed_size == 0) {
+        return;
+    }
+    auto it = std::find(_candidates.begin(), _candidates.end(), codec);
+    if (it == _candidates.end()) {
+        return;
+    }
+    auto& stats = _stats[it - _candidates.begin()];
+    double ratio = static_cast<double>(uncompressed_size) / compressed_size;
+    double speed = static_cast<double>(uncompressed_size) * 1e9 / std::max<int64_t>(compress_ns, 1);
+    if (!stats.measured) {
+        stats.measured = true;
+        stats.ratio = ratio;
+        stats.speed = speed;
+    } else {
+        stats.ratio += kSampleWeight * (ratio - stats.ratio);
+        stats.speed += kSampleWeight * (speed - stats.speed);
+    }
+}
+
+// Estimated seconds to deliver one uncompressed byte.
+double AdaptiveCompressionSelector::_estimate_cost(size_t index) const {
+    const auto& stats = _stats[index];
+    if (_candidates[index] == CompressionTypePB::NO_COMPRESSION) {
+        return 1 / _link_throughput;
+    }
+    if (stats.speed <= 0) {
+        return std::numeric_limits<double>::max();
+    }
+    return 1 / stats.speed + 1 / (stats.ratio * _link_throughput);
+}
+
+size_t AdaptiveCompressionSelector::_choose_best() const {
+    size_t best = _current;
+    double best_cost = _estimate_cost(_current);
+    for (size_t i = 0; i < _candidates.size(); ++i) {
+        double cost = _estimate_cost(i);
+        if (cost < best_cost) {
+            best = i;
+            best_cost = cost;
+        }
+    }
+    return best;
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,76 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "gen_cpp/types.pb.h"
+
+namespace starrocks::pipeline {
+
+// AdaptiveCompressionSelector picks the compression codec of the chunks sent through one exchange channel.
+//
+// For each candidate codec, it measures the compression ratio and the compression speed of the chunks
+// compressed with it. Together with the throughput of the link to the destination, measured by SinkBuffer,
+// the time to deliver a chunk is estimated as
+//     compress_time + compressed_size / link_throughput
+// and the codec with the minimum estimated time is chosen. So compression is skipped on fast links, e.g. within
+// a rack, where it only wastes CPU, and the slower but stronger codec wins on slow links, e.g. across regions.
+//
+// The statistics of the codecs not chosen get stale, so the other codecs are tried once in a while.
+class AdaptiveCompressionSelector {
+public:
+    // Returns the throughput of the link in bytes per second, or 0 if it is not measured yet.
+    using LinkThroughputFunc = std::function<double()>;
+
+    AdaptiveCompressionSelector(std::vector<CompressionTypePB> candidates, CompressionTypePB default_codec,
+                                LinkThroughputFunc link_throughput);
+
+    // Codec to compress the next chunk with.
+    CompressionTypePB next_codec();
+
+    // Feedback the result of compressing a chunk with the codec returned by next_codec().
+    void update(CompressionTypePB codec, size_t uncompressed_size, size_t compressed_size, int64_t compress_ns);
+
+    // How many chunks are compressed with each codec, for profile.
+    const std::vector<int64_t>& num_chunks() const { return _num_chunks; }
+    const std::vector<CompressionTypePB>& candidates() const { return _candidates; }
+
+private:
+    struct CodecStats {
+        bool measured = false;
+        // Uncompressed size / compressed size.
+        double ratio = 1;
+        // Uncompressed bytes compressed per second.
+        double speed = 0;
+    };
+
+    size_t _choose_best() const;
+    double _estimate_cost(size_t index) const;
+
+    const std::vector<CompressionTypePB> _candidates;
+    const LinkThroughputFunc _link_throughput_func;
+    std::vector<CodecStats> _stats;
+    std::vector<int64_t> _num_chunks;
+
+    size_t _current;
+    // Round-robin cursor of the codecs to explore.
+    size_t _next_explore = 0;
+    int64_t _num_picked = 0;
+    double _link_throughput = 0;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,140 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/exchange_chunk_serializer.h"
+
+#include "common/config.h"
+#include "exec/pipeline/exchange/adaptive_compression_selector.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
+#include "util/compression/block_compression.h"
+#include "util/compression/zstd_dict_compression.h"
+#include "util/stopwatch.hpp"
+
+namespace starrocks::pipeline {
+
+ExchangeChunkSerializer::ExchangeChunkSerializer(int32_t encode_level, CompressionTypePB compress_type,
+                                                 const BlockCompressionCodec* compress_codec, RuntimeProfile* profile)
+        : _encode_level(encode_level), _compress_type(compress_type), _compress_codec(compress_codec) {
+    _sender_input_bytes_counter = ADD_COUNTER(profile, "SenderInputBytes", TUnit::BYTES);
+    _serialized_bytes_counter = ADD_COUNTER(profile, "SerializedBytes", TUnit::BYTES);
+    _compressed_bytes_counter = ADD_COUNTER(profile, "CompressedBytes", TUnit::BYTES);
+    _serialize_chunk_timer = ADD_TIMER(profile, "SerializeChunkTime");
+    _compress_timer = ADD_TIMER(profile, "CompressTime");
+}
+
+Status ExchangeChunkSerializer::serialize(const Chunk* src, ChunkPB* dst, bool* is_first_chunk,
+                                          ZstdDictCompressor* dict_compressor,
+                                          AdaptiveCompressionSelector* compression_selector, int num_receivers) {
+    VLOG_ROW << "[ExchangeChunkSerializer] serializing " << src->num_rows() << " rows";
+    auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
+    COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
+    {
+        SCOPED_TIMER(_serialize_chunk_timer);
+        // We only serialize chunk meta for first chunk
+        if (*is_first_chunk) {
+            _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
+            StatusOr<ChunkPB> res = Status::OK();
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
+            RETURN_IF_ERROR(res);
+            res->Swap(dst);
+            *is_first_chunk = false;
+        } else {
+            StatusOr<ChunkPB> res = Status::OK();
+            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context));
+            RETURN_IF_ERROR(res);
+            res->Swap(dst);
+        }
+    }
+    if (_encode_context) {
+        _encode_context->set_encode_levels_in_pb(dst);
+    }
+    DCHECK(dst->has_uncompressed_size());
+    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
+    const size_t serialized_size = dst->uncompressed_size();
+    COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
+
+    CompressionTypePB compress_type = _compress_type;
+    const BlockCompressionCodec* compress_codec = _compress_codec;
+    if (compression_selector != nullptr) {
+        compress_type = compression_selector->next_codec();
+        RETURN_IF_ERROR(get_block_compression_codec(compress_type, &compress_codec));
+    }
+
+    if (compress_codec != nullptr && compress_codec->exceed_max_input_size(serialized_size)) {
+        return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
+                                                         compress_codec->max_input_size()));
+    }
+
+    // try compress the ChunkPB data
+    if (compress_codec != nullptr && serialized_size > 0) {
+        SCOPED_TIMER(_compress_timer);
+        MonotonicStopWatch compress_watch;
+        compress_watch.start();
+
+        // The chunks are compressed without dictionary until enough samples are collected.
+        bool use_dict = false;
+        if (dict_compressor != nullptr && !dict_compressor->is_failed()) {
+            if (dict_compressor->is_trained()) {
+                use_dict = true;
+            } else {
+                dict_compressor->add_sample(Slice(dst->data()));
+            }
+        }
+
+        if (use_dict) {
+            RETURN_IF_ERROR(dict_compressor->compress(Slice(dst->data()), &_compression_scratch));
+        } else if (use_compression_pool(compress_codec->type())) {
+            Slice compressed_slice;
+            Slice input(dst->data());
+            RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
+                                                     &_compression_scratch));
+        } else {
+            int max_compressed_size = compress_codec->max_compressed_len(serialized_size);
+
+            if (_compression_scratch.size() < max_compressed_size) {
+                _compression_scratch.resize(max_compressed_size);
+            }
+
+            Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
+
+            Slice input(dst->data());
+            RETURN_IF_ERROR(compress_codec->compress(input, &compressed_slice));
+            _compression_scratch.resize(compressed_slice.size);
+        }
+        if (compression_selector != nullptr) {
+            compression_selector->update(compress_type, serialized_size, _compression_scratch.size(),
+                                         compress_watch.elapsed_time());
+        }
+
+        double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
+        if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
+            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
+            dst->set_compress_type(compress_type);
+            if (use_dict) {
+                dst->set_compress_dict_id(dict_compressor->dict_id());
+                // Send the dictionary along with the first chunk compressed with it.
+                if (!dict_compressor->is_dict_delivered()) {
+                    dst->set_compress_dict(dict_compressor->dict());
+                    dict_compressor->set_dict_delivered();
+                }
+            }
+        }
+        COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
+        VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "column/chunk.h"
+#include "common/status.h"
+#include "gen_cpp/data.pb.h"
+#include "serde/protobuf_serde.h"
+#include "util/raw_container.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class BlockCompressionCodec;
+class ZstdDictCompressor;
+
+namespace pipeline {
+
+class AdaptiveCompressionSelector;
+
+// ExchangeChunkSerializer turns the chunks sent by an exchange sink into ChunkPB, i.e. serializes them with
+// the encode context of the stream and compresses the serialized data.
+// It is not thread-safe, each sink has its own one.
+class ExchangeChunkSerializer {
+public:
+    // The counters are added to profile.
+    ExchangeChunkSerializer(int32_t encode_level, CompressionTypePB compress_type,
+                            const BlockCompressionCodec* compress_codec, RuntimeProfile* profile);
+
+    // For the first chunk , serialize the chunk data and meta to ChunkPB both.
+    // For other chunk, only serialize the chunk data to ChunkPB.
+    // If dict_compressor is not null, the chunk data is compressed with the dictionary trained on the
+    // first chunks of the stream.
+    // If compression_selector is not null, the codec is chosen by it instead of the one of the query.
+    Status serialize(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, ZstdDictCompressor* dict_compressor,
+                     AdaptiveCompressionSelector* compression_selector, int num_receivers);
+
+private:
+    const int32_t _encode_level;
+    const CompressionTypePB _compress_type;
+    const BlockCompressionCodec* const _compress_codec;
+
+    std::shared_ptr<serde::EncodeContext> _encode_context;
+
+    // String to write compressed chunk data in serialize().
+    // This is a string so we can swap() with the string in the ChunkPB we're serializing
+    // to (we don't compress directly into the ChunkPB in case the compressed data is
+    // longer than the uncompressed data).
+    raw::RawString _compression_scratch;
+
+    RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
+    RuntimeProfile::Counter* _compress_timer = nullptr;
+    RuntimeProfile::Counter* _sender_input_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _serialized_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _compressed_bytes_counter = nullptr;
+};
+
+} // namespace pipeline
+} // namespace starrocks
@@ -118,6 +118,8 @@ private:
     PassThroughContext _pass_through_context;
 
     bool _is_first_chunk = true;
+    std::unique_ptr<ZstdDictCompressor> _dict_compressor;
+    std::unique_ptr<AdaptiveCompressionSelector> _compression_selector;
     PInternalService_Stub* _brpc_stub = nullptr;
 
     // If pipeline level shuffle is enable, the size of the _chunks
@@ -161,6 +163,15 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
         return Status::OK();
     }
 
+    if (_parent->_enable_compression_dict) {
+        _dict_compressor = std::make_unique<ZstdDictCompressor>(config::transmission_compression_dict_sample_chunks,
+                                                                config::transmission_compression_dict_size);
+    }
+    if (_parent->_enable_adaptive_compression) {
+        _compression_selector = _parent->_create_compression_selector(
+                [this]() { return _parent->_buffer->network_throughput(_fragment_instance_id); });
+    }
+
     if (_brpc_dest_addr.hostname.empty()) {
         LOG(WARNING) << "there is no brpc destination address's hostname"
                         ", maybe version is not compatible.";
@@ -248,7 +259,8 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(
+                    chunk, pchunk, &_is_first_chunk, _dict_compressor.get(), _compression_selector.get())));
             _current_request_bytes += pchunk->data().size();
         }
     }
@@ -404,7 +416,34 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         // compress transmitted data.
         _compress_type = CompressionTypePB::LZ4;
     }
-    RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
+    const BlockCompressionCodec* compress_codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &compress_codec));
+    _enable_adaptive_compression = state->enable_adaptive_transmission_compression();
+    if (_enable_adaptive_compression) {
+        // For broadcast, the same data is sent to all the destinations, so it is limited by the slowest link.
+        _compression_selector = _create_compression_selector([this]() {
+            double min_throughput = 0;
+            for (auto* channel : _channels) {
+                if (channel->use_pass_through()) {
+                    continue;
+                }
+                double throughput = _buffer->network_throughput(channel->get_fragment_instance_id());
+                if (throughput > 0 && (min_throughput == 0 || throughput < min_throughput)) {
+                    min_throughput = throughput;
+                }
+            }
+            return min_throughput;
+        });
+        _unique_metrics->add_info_string("AdaptiveCompression", "true");
+    }
+    // Dictionary only helps zstd on small chunks.
+    _enable_compression_dict = !_enable_adaptive_compression && state->enable_transmission_compression_dict() &&
+                               _compress_type == CompressionTypePB::ZSTD;
+    if (_enable_compression_dict) {
+        _dict_compressor = std::make_unique<ZstdDictCompressor>(config::transmission_compression_dict_sample_chunks,
+                                                                config::transmission_compression_dict_size);
+        _unique_metrics->add_info_string("CompressionDict", "true");
+    }
 
     std::string instances;
     for (const auto& channel : _channels) {
@@ -437,15 +476,12 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     std::shuffle(_channel_indices.begin(), _channel_indices.end(), std::mt19937(std::random_device()()));
 
     _bytes_pass_through_counter = ADD_COUNTER(_unique_metrics, "BytesPassThrough", TUnit::BYTES);
-    _sender_input_bytes_counter = ADD_COUNTER(_unique_metrics, "SenderInputBytes", TUnit::BYTES);
-    _serialized_bytes_counter = ADD_COUNTER(_unique_metrics, "SerializedBytes", TUnit::BYTES);
-    _compressed_bytes_counter = ADD_COUNTER(_unique_metrics, "CompressedBytes", TUnit::BYTES);
+    _chunk_serializer = std::make_unique<ExchangeChunkSerializer>(_encode_level, _compress_type, compress_codec,
+                                                                  _unique_metrics.get());
 
-    _serialize_chunk_timer = ADD_TIMER(_unique_metrics, "SerializeChunkTime");
     _shuffle_hash_timer = ADD_TIMER(_unique_metrics, "ShuffleHashTime");
     _shuffle_chunk_append_counter = ADD_COUNTER(_unique_metrics, "ShuffleChunkAppendCounter", TUnit::UNIT);
     _shuffle_chunk_append_timer = ADD_TIMER(_unique_metrics, "ShuffleChunkAppendTime");
-    _compress_timer = ADD_TIMER(_unique_metrics, "CompressTime");
     _pass_through_buffer_peak_mem_usage = _unique_metrics->AddHighWaterMarkCounter(
             "PassThroughBufferPeakMemoryUsage", TUnit::BYTES,
             RuntimeProfile::Counter::create_strategy(TUnit::BYTES, TCounterMergeType::SKIP_FIRST_MERGE));
@@ -520,7 +556,8 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
             TRY_CATCH_BAD_ALLOC(
-                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size())));
+                    RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _dict_compressor.get(),
+                                                    _compression_selector.get(), _channels.size())));
             _current_request_bytes += pchunk->data().size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > config::max_transmit_batched_bytes) {
@@ -665,72 +702,11 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk, int num_receivers) {
-    VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
-    auto send_input_bytes = serde::ProtobufChunkSerde::max_serialized_size(*src, nullptr);
-    COUNTER_UPDATE(_sender_input_bytes_counter, send_input_bytes * num_receivers);
-    {
-        SCOPED_TIMER(_serialize_chunk_timer);
-        // We only serialize chunk meta for first chunk
-        if (*is_first_chunk) {
-            _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(src->columns().size(), _encode_level);
-            StatusOr<ChunkPB> res = Status::OK();
-            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
-            *is_first_chunk = false;
-        } else {
-            StatusOr<ChunkPB> res = Status::OK();
-            TRY_CATCH_BAD_ALLOC(res = serde::ProtobufChunkSerde::serialize_without_meta(*src, _encode_context));
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
-        }
-    }
-    if (_encode_context) {
-        _encode_context->set_encode_levels_in_pb(dst);
-    }
-    DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
-    const size_t serialized_size = dst->uncompressed_size();
-    COUNTER_UPDATE(_serialized_bytes_counter, serialized_size * num_receivers);
-
-    if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(serialized_size)) {
-        return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
-                                                         _compress_codec->max_input_size()));
-    }
-
-    // try compress the ChunkPB data
-    if (_compress_codec != nullptr && serialized_size > 0) {
-        SCOPED_TIMER(_compress_timer);
-
-        if (use_compression_pool(_compress_codec->type())) {
-            Slice compressed_slice;
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice, true, serialized_size, nullptr,
-                                                      &_compression_scratch));
-        } else {
-            int max_compressed_size = _compress_codec->max_compressed_len(serialized_size);
-
-            if (_compression_scratch.size() < max_compressed_size) {
-                _compression_scratch.resize(max_compressed_size);
-            }
-
-            Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
-
-            Slice input(dst->data());
-            RETURN_IF_ERROR(_compress_codec->compress(input, &compressed_slice));
-            _compression_scratch.resize(compressed_slice.size);
-        }
-
-        double compress_ratio = (static_cast<double>(serialized_size)) / _compression_scratch.size();
-        if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
-            dst->set_compress_type(_compress_type);
-        }
-        COUNTER_UPDATE(_compressed_bytes_counter, _compression_scratch.size() * num_receivers);
-        VLOG_ROW << "uncompressed size: " << serialized_size << ", compressed size: " << _compression_scratch.size();
-    }
-    return Status::OK();
+Status ExchangeSinkOperator::serialize_chunk(const Chunk* src, ChunkPB* dst, bool* is_first_chunk,
+                                             ZstdDictCompressor* dict_compressor,
+                                             AdaptiveCompressionSelector* compression_selector, int num_receivers) {
+    return _chunk_serializer->serialize(src, dst, is_first_chunk, dict_compressor, compression_selector,
+                                        num_receivers);
 }
 
 int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkParamsPtr& chunk_request,
@@ -22,6 +22,8 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/adaptive_compression_selector.h"
+#include "exec/pipeline/exchange/exchange_chunk_serializer.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
@@ -29,7 +31,7 @@
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "serde/protobuf_serde.h"
-#include "util/raw_container.h"
+#include "util/compression/zstd_dict_compression.h"
 #include "util/runtime_profile.h"
 
 namespace butil {
@@ -79,12 +81,25 @@ public:
 
     // For the first chunk , serialize the chunk data and meta to ChunkPB both.
     // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
+    // If dict_compressor is not null, the chunk data is compressed with the dictionary trained on the
+    // first chunks of the stream.
+    // If compression_selector is not null, the codec is chosen by it instead of the one of the query.
+    Status serialize_chunk(const Chunk* chunk, ChunkPB* dst, bool* is_first_chunk,
+                           ZstdDictCompressor* dict_compressor = nullptr,
+                           AdaptiveCompressionSelector* compression_selector = nullptr, int num_receivers = 1);
 
     // Return the physical bytes of attachment.
     int64_t construct_brpc_attachment(const PTransmitChunkParamsPtr& _chunk_request, butil::IOBuf& attachment);
 
 private:
+    std::unique_ptr<AdaptiveCompressionSelector> _create_compression_selector(
+            AdaptiveCompressionSelector::LinkThroughputFunc link_throughput) const {
+        return std::make_unique<AdaptiveCompressionSelector>(
+                std::vector<CompressionTypePB>{CompressionTypePB::NO_COMPRESSION, CompressionTypePB::LZ4,
+                                               CompressionTypePB::ZSTD},
+                _compress_type, std::move(link_throughput));
+    }
+
     bool _is_large_chunk(size_t sz) const {
         // ref olap_scan_node.cpp release_large_columns
         return sz > runtime_state()->chunk_size() * 512;
@@ -162,25 +177,23 @@ private:
     size_t _current_request_bytes = 0;
 
     bool _is_first_chunk = true;
+    // Only used when broadcast, each channel has its own dictionary and selector otherwise.
+    std::unique_ptr<ZstdDictCompressor> _dict_compressor;
+    std::unique_ptr<AdaptiveCompressionSelector> _compression_selector;
 
-    // String to write compressed chunk data in serialize().
-    // This is a string so we can swap() with the string in the ChunkPB we're serializing
-    // to (we don't compress directly into the ChunkPB in case the compressed data is
-    // longer than the uncompressed data).
-    raw::RawString _compression_scratch;
+    // Will set in prepare
+    std::unique_ptr<ExchangeChunkSerializer> _chunk_serializer;
 
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
-    const BlockCompressionCodec* _compress_codec = nullptr;
+    // Whether to compress the chunks with trained zstd dictionaries.
+    bool _enable_compression_dict = false;
+    // Whether to choose the codec of each channel by the measured compression ratio and link throughput.
+    bool _enable_adaptive_compression = false;
 
-    RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_chunk_append_counter = nullptr;
     RuntimeProfile::Counter* _shuffle_chunk_append_timer = nullptr;
-    RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_pass_through_counter = nullptr;
-    RuntimeProfile::Counter* _sender_input_bytes_counter = nullptr;
-    RuntimeProfile::Counter* _serialized_bytes_counter = nullptr;
-    RuntimeProfile::Counter* _compressed_bytes_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _pass_through_buffer_peak_mem_usage = nullptr;
 
     std::atomic<bool> _is_finished = false;
@@ -209,7 +222,6 @@ private:
 
     std::unique_ptr<Shuffler> _shuffler;
 
-    std::shared_ptr<serde::EncodeContext> _encode_context = nullptr;
 };
 
 class ExchangeSinkOperatorFactory final : public OperatorFactory {
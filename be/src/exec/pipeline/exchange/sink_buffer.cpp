@@ -16,6 +16,7 @@
 
 #include <bthread/bthread.h>
 
+#include <algorithm>
 #include <chrono>
 #include <string_view>
 
@@ -51,6 +52,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _buffers[instance_id.lo] = std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>();
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
+            _num_in_flight_dict_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
             _dest_addrs[instance_id.lo] = dest.brpc_server;
@@ -196,10 +198,7 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
 int64_t SinkBuffer::_network_time() {
     int64_t max = 0;
     for (auto& [_, time_trace] : _network_times) {
-        double average_concurrency =
-                static_cast<double>(time_trace.accumulated_concurrency) / std::max(1, time_trace.times);
-        int64_t average_accumulated_time =
-                static_cast<int64_t>(time_trace.accumulated_time / std::max(1.0, average_concurrency));
+        int64_t average_accumulated_time = time_trace.network_time();
         if (average_accumulated_time > max) {
             max = average_accumulated_time;
         }
@@ -246,13 +245,27 @@ void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
     }
 }
 
+double SinkBuffer::network_throughput(const TUniqueId& instance_id) {
+    auto it = _mutexes.find(instance_id.lo);
+    if (it == _mutexes.end()) {
+        return 0;
+    }
+    std::lock_guard<Mutex> l(*it->second);
+    const auto& time_trace = _network_times[instance_id.lo];
+    int64_t network_time = time_trace.network_time();
+    if (network_time <= 0) {
+        return 0;
+    }
+    return static_cast<double>(time_trace.accumulated_bytes) * 1e9 / network_time;
+}
+
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receiver_post_process_time) {
+                                      const int64_t receiver_post_process_time, const int64_t bytes) {
     const int64_t get_response_timestamp = MonotonicNanos();
     _last_receive_time = get_response_timestamp;
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     int64_t time_usage = get_response_timestamp - send_timestamp - receiver_post_process_time;
-    _network_times[instance_id.lo].update(time_usage, concurrency);
+    _network_times[instance_id.lo].update(time_usage, concurrency, bytes);
     _rpc_cumulative_time += time_usage;
     _rpc_count++;
 }
@@ -323,6 +336,11 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             need_wait = true;
             return Status::OK();
         }
+        // Likewise, the compression dictionary must be received before the packets compressed with it
+        if (_num_in_flight_dict_rpcs[instance_id.lo] > 0) {
+            need_wait = true;
+            return Status::OK();
+        }
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
                 if (need_wait) {
@@ -365,8 +383,12 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             _request_sent++;
         }
 
+        const bool has_compress_dict =
+                std::any_of(request.params->chunks().begin(), request.params->chunks().end(),
+                            [](const ChunkPB& chunk) { return chunk.has_compress_dict(); });
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), MonotonicNanos()});
+                {instance_id, request.params->sequence(), MonotonicNanos(), has_compress_dict,
+                 static_cast<int64_t>(request.attachment.size())});
         if (_first_send_time == -1) {
             _first_send_time = MonotonicNanos();
         }
@@ -378,6 +400,9 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                if (ctx.has_compress_dict) {
+                    --_num_in_flight_dict_rpcs[ctx.instance_id.lo];
+                }
             }
 
             const auto& dest_addr = _dest_addrs[ctx.instance_id.lo];
@@ -396,6 +421,9 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                if (ctx.has_compress_dict) {
+                    --_num_in_flight_dict_rpcs[ctx.instance_id.lo];
+                }
             }
             if (!status.ok()) {
                 _is_finishing = true;
@@ -407,7 +435,8 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                                             status.message());
             } else {
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
+                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time(),
+                                         ctx.attachment_bytes);
                     _process_send_window(ctx.instance_id, ctx.sequence);
                 }));
             }
@@ -415,6 +444,9 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         ++_total_in_flight_rpc;
         ++_num_in_flight_rpcs[instance_id.lo];
+        if (has_compress_dict) {
+            ++_num_in_flight_dict_rpcs[instance_id.lo];
+        }
 
         // Attachment will be released by process_mem_tracker in closure->Run() in bthread, when receiving the response,
         // so decrease the memory usage of attachment from instance_mem_tracker immediately before sending the request.
@@ -42,6 +42,9 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    // Whether the request carries a compression dictionary used by the following requests.
+    bool has_compress_dict = false;
+    int64_t attachment_bytes = 0;
 };
 
 struct TransmitChunkInfo {
@@ -68,11 +71,18 @@ struct TimeTrace {
     int32_t times = 0;
     int64_t accumulated_time = 0;
     int32_t accumulated_concurrency = 0;
+    int64_t accumulated_bytes = 0;
 
-    void update(int64_t time, int32_t concurrency) {
+    void update(int64_t time, int32_t concurrency, int64_t bytes) {
         times++;
         accumulated_time += time;
         accumulated_concurrency += concurrency;
+        accumulated_bytes += bytes;
+    }
+
+    int64_t network_time() const {
+        double average_concurrency = static_cast<double>(accumulated_concurrency) / std::max(1, times);
+        return static_cast<int64_t>(accumulated_time / std::max(1.0, average_concurrency));
     }
 };
 
@@ -98,11 +108,14 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // Estimated throughput of the link to the destination in bytes per second, 0 if no data is received yet.
+    double network_throughput(const TUniqueId& instance_id);
+
 private:
     using Mutex = bthread::Mutex;
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receiver_post_process_time);
+                              const int64_t receiver_post_process_time, const int64_t bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
@@ -154,6 +167,9 @@ private:
     phmap::flat_hash_map<int64_t, std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>> _buffers;
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
+    // The number of in-flight requests carrying compression dictionaries, no more request is sent until they are
+    // received, since the following requests may be compressed with the dictionaries.
+    phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_dict_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
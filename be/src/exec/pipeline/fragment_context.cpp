@@ -315,6 +315,13 @@ Status FragmentContext::reset_epoch() {
     return iterate_pipeline(caller);
 }
 
+Status FragmentContext::publish_epoch(int64_t epoch_id) {
+    const std::function<Status(Pipeline*)> caller = [this, epoch_id](Pipeline* pipeline) {
+        return pipeline->publish_epoch(_runtime_state.get(), epoch_id);
+    };
+    return iterate_pipeline(caller);
+}
+
 void FragmentContext::count_down_epoch_pipeline(RuntimeState* state, size_t val) {
     size_t total_execution_groups = _execution_groups.size();
     bool all_groups_finished = _num_finished_epoch_pipelines.fetch_add(val) + val == total_execution_groups;
@@ -140,8 +140,19 @@ public:
     const workgroup::WorkGroupPtr& workgroup() const { return _workgroup; }
     bool enable_resource_group() const { return _workgroup != nullptr; }
 
+    // The NUMA node whose executor threads run the drivers of this fragment instance, so that the hash tables
+    // and chunk buffers they allocate stay in the local memory of the node. -1 means not assigned yet.
+    int numa_node() const { return _numa_node.load(std::memory_order_acquire); }
+    // Assign |numa_node| if no node is assigned yet, and return the assigned node.
+    int assign_numa_node(int numa_node) {
+        int expected = -1;
+        _numa_node.compare_exchange_strong(expected, numa_node, std::memory_order_acq_rel);
+        return _numa_node.load(std::memory_order_acquire);
+    }
+
     // STREAM MV
     [[nodiscard]] Status reset_epoch();
+    [[nodiscard]] Status publish_epoch(int64_t epoch_id);
     void set_is_stream_pipeline(bool is_stream_pipeline) { _is_stream_pipeline = is_stream_pipeline; }
     bool is_stream_pipeline() const { return _is_stream_pipeline; }
     void count_down_epoch_pipeline(RuntimeState* state, size_t val = 1);
@@ -198,6 +209,7 @@ private:
 
     MorselQueueFactoryMap _morsel_queue_factories;
     workgroup::WorkGroupPtr _workgroup = nullptr;
+    std::atomic<int> _numa_node = -1;
 
     std::atomic<Status*> _final_status = nullptr;
     Status _s_status;
@@ -18,6 +18,8 @@
 #include <unordered_map>
 
 #include "common/config.h"
+#include "exec/aggregate/aggregate_blocking_node.h"
+#include "exec/aggregate/aggregate_streaming_node.h"
 #include "exec/cross_join_node.h"
 #include "exec/exchange_node.h"
 #include "exec/exec_node.h"
@@ -35,6 +37,8 @@
 #include "exec/scan_node.h"
 #include "exec/tablet_sink.h"
 #include "exec/workgroup/work_group.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
 #include "gutil/casts.h"
 #include "gutil/map_util.h"
 #include "runtime/data_stream_mgr.h"
@@ -332,6 +336,26 @@ static void collect_shuffle_hash_bucket_rf_ids(const ExecNode* node, std::unorde
     }
 }
 
+// Collect the slots read as the only key of the hash aggregations and the join probes, the scans keep the dict codes
+// of the strings read into them, see BinaryColumn::set_dict_codes(). The keys of other shapes, e.g. the expressions
+// and the multiple columns, don't use the codes, and neither do the operators of the other fragments, since the
+// exchange serializes the values.
+static void collect_dict_code_key_slots(const ExecNode* node, std::unordered_set<SlotId>& slot_ids) {
+    for (const auto* child : node->children()) {
+        collect_dict_code_key_slots(child, slot_ids);
+    }
+    const std::vector<ExprContext*>* key_ctxs = nullptr;
+    if (node->type() == TPlanNodeType::HASH_JOIN_NODE) {
+        key_ctxs = &down_cast<const HashJoinNode*>(node)->probe_expr_ctxs();
+    } else if (dynamic_cast<const AggregateBlockingNode*>(node) != nullptr ||
+               dynamic_cast<const AggregateStreamingNode*>(node) != nullptr) {
+        key_ctxs = &down_cast<const AggregateBaseNode*>(node)->group_by_expr_ctxs();
+    }
+    if (key_ctxs != nullptr && key_ctxs->size() == 1 && (*key_ctxs)[0]->root()->is_slotref()) {
+        slot_ids.insert(down_cast<const ColumnRef*>((*key_ctxs)[0]->root())->slot_id());
+    }
+}
+
 static std::unordered_set<int32_t> collect_broadcast_join_right_offsprings(
         const ExecNode* node, BroadcastJoinRightOffsprings& broadcast_join_right_offsprings) {
     std::vector<std::unordered_set<int32_t>> offsprings_per_child;
@@ -387,6 +411,9 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
     std::unordered_set<int32_t> filter_ids;
     collect_shuffle_hash_bucket_rf_ids(plan, filter_ids);
     runtime_state->set_shuffle_hash_bucket_rf_ids(std::move(filter_ids));
+    std::unordered_set<SlotId> dict_code_key_slots;
+    collect_dict_code_key_slots(plan, dict_code_key_slots);
+    runtime_state->set_dict_code_key_slots(std::move(dict_code_key_slots));
     BroadcastJoinRightOffsprings broadcast_join_right_offsprings_map;
     collect_broadcast_join_right_offsprings(plan, broadcast_join_right_offsprings_map);
     runtime_state->set_broadcast_join_right_offsprings(std::move(broadcast_join_right_offsprings_map));
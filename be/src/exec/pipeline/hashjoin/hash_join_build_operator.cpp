@@ -17,6 +17,7 @@
 #include <numeric>
 #include <utility>
 
+#include "common/config.h"
 #include "exec/pipeline/query_context.h"
 #include "exprs/runtime_filter_bank.h"
 #include "runtime/current_thread.h"
@@ -84,7 +85,15 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
     if (state->is_cancelled()) {
         return Status::Cancelled("runtime state is cancelled");
     }
+    auto& ht = _join_builder->hash_join_builder()->hash_table();
+    if (config::hash_join_partition_min_build_rows > 0 &&
+        _join_builder->get_ht_row_count() >= config::hash_join_partition_min_build_rows) {
+        ht.set_partition_cache_bytes(config::hash_join_partition_cache_bytes);
+    }
     RETURN_IF_ERROR(_join_builder->build_ht(state));
+    if (ht.is_partitioned()) {
+        _unique_metrics->add_info_string("HashTablePartitions", std::to_string(ht.get_num_partitions()));
+    }
 
     size_t merger_index = _driver_sequence;
     // Broadcast Join only has one build operator.
@@ -34,6 +34,7 @@
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
+#include "util/compression/compression_utils.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks::pipeline {
@@ -235,7 +236,8 @@ Status SpillableHashJoinProbeOperator::_push_probe_chunk(RuntimeState* state, co
             // TODO: add chunk accumulator here
             auto partitioned_chunk = chunk->clone_empty();
             (void)partitioned_chunk->append_selective(*chunk, selection.data(), from, size);
-            (void)_probers[iter->second]->push_probe_chunk(state, std::move(partitioned_chunk));
+            (void)_probers[iter->second]->push_probe_chunk(state, std::move(partitioned_chunk),
+                                                           &_builders[iter->second]->hash_table());
         }
         probe_partition->num_rows += size;
     };
@@ -368,7 +370,8 @@ Status SpillableHashJoinProbeOperator::_restore_probe_partition(RuntimeState* st
             auto chunk_st = _current_reader[i]->restore(
                     state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(_current_reader[i])));
             if (chunk_st.ok() && chunk_st.value() && !chunk_st.value()->is_empty()) {
-                RETURN_IF_ERROR(_probers[i]->push_probe_chunk(state, std::move(chunk_st.value())));
+                RETURN_IF_ERROR(_probers[i]->push_probe_chunk(state, std::move(chunk_st.value()),
+                                                              &_builders[i]->hash_table()));
             } else if (chunk_st.status().is_end_of_file()) {
                 _probe_read_eofs[i] = true;
             } else if (!chunk_st.ok()) {
@@ -532,6 +535,7 @@ Status SpillableHashJoinProbeOperatorFactory::prepare(RuntimeState* state) {
     _spill_options->name = "hash-join-probe";
     _spill_options->plan_node_id = _plan_node_id;
     _spill_options->encode_level = state->spill_encode_level();
+    _spill_options->compress_type = CompressionUtils::to_compression_pb(state->spill_compression_type());
     _spill_options->wg = state->fragment_ctx()->workgroup();
     _spill_options->enable_buffer_read = state->enable_spill_buffer_read();
     _spill_options->max_read_buffer_bytes = state->max_spill_read_buffer_bytes_per_driver();
@@ -227,6 +227,9 @@ public:
     virtual Status set_epoch_finished(RuntimeState* state) { return Status::OK(); }
     // Called when the new Epoch starts at first to reset operator's internal state.
     virtual Status reset_epoch(RuntimeState* state) { return Status::OK(); }
+    // Called when the finished Epoch is committed by FE, then the operator's state of the Epoch can be
+    // checkpointed, otherwise it's discarded by `reset_epoch`.
+    virtual Status publish_epoch(RuntimeState* state, int64_t epoch_id) { return Status::OK(); }
 
     // Adjusts the execution mode of the operator (will only be called by the OperatorMemoryResourceManager component)
     virtual void set_execute_mode(int performance_level) {}
@@ -154,6 +154,15 @@ Status Pipeline::reset_epoch(RuntimeState* state) {
     return Status::OK();
 }
 
+Status Pipeline::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    for (const auto& driver : drivers()) {
+        DCHECK(down_cast<pipeline::StreamPipelineDriver*>(driver.get()));
+        auto* stream_driver = down_cast<pipeline::StreamPipelineDriver*>(driver.get());
+        RETURN_IF_ERROR(stream_driver->publish_epoch(state, epoch_id));
+    }
+    return Status::OK();
+}
+
 struct OutputAmplificationAddCalculator {
     size_t operator()(size_t accumulate, size_t value) const { return accumulate + value; }
 };
@@ -96,6 +96,7 @@ public:
 
     // STREAM MV
     Status reset_epoch(RuntimeState* state);
+    Status publish_epoch(RuntimeState* state, int64_t epoch_id);
     void count_down_epoch_finished_driver(RuntimeState* state);
 
     size_t output_amplification_factor() const;
@@ -437,6 +437,9 @@ public:
     void set_in_queue(DriverQueue* in_queue) { _in_queue = in_queue; }
     size_t get_driver_queue_level() const { return _driver_queue_level; }
     void set_driver_queue_level(size_t driver_queue_level) { _driver_queue_level = driver_queue_level; }
+    // The NUMA node whose executor threads prefer to run this driver, -1 means any node.
+    int numa_node() const { return _numa_node; }
+    void set_numa_node(int numa_node) { _numa_node = numa_node; }
 
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
@@ -524,6 +527,7 @@ protected:
     DriverQueue* _in_queue = nullptr;
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
+    int _numa_node = -1;
     std::atomic<bool> _in_ready_queue{false};
 
     // metrics
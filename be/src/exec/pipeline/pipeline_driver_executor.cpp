@@ -14,12 +14,17 @@
 
 #include "exec/pipeline/pipeline_driver_executor.h"
 
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstring>
 #include <memory>
 
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -40,6 +45,11 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_schedule_count, [this]() { return _schedule_count.load(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_execution_time, [this]() { return _driver_execution_ns.load(); });
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_queue_len, [this]() { return _driver_queue->size(); });
+    REGISTER_GAUGE_STARROCKS_METRIC(pipe_driver_numa_steal_count, [this]() { return _numa_steal_count.load(); });
+    if (config::pipeline_enable_numa_aware_executor && CpuInfo::get_max_num_numa_nodes() > 1) {
+        _num_numa_nodes = CpuInfo::get_max_num_numa_nodes();
+        LOG(INFO) << "[PIPELINE] NUMA-aware executor " << _name << ": numa_nodes=" << _num_numa_nodes;
+    }
     REGISTER_GAUGE_STARROCKS_METRIC(pipe_poller_block_queue_len,
                                     [this]() { return _blocked_driver_poller->blocked_driver_queue_len(); });
 }
@@ -73,9 +83,29 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
     driver->finalize(runtime_state, state, _schedule_count, _driver_execution_ns);
 }
 
+int GlobalDriverExecutor::_bind_worker_to_numa_node(int worker_id) {
+    if (_num_numa_nodes <= 1) {
+        return DriverQueue::ANY_NUMA_NODE;
+    }
+    const int numa_node = worker_id % _num_numa_nodes;
+    // The memory is allocated on the node of the thread touching it first, so binding the thread also keeps
+    // the hash tables and chunks built by the drivers in the local memory of the node.
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : CpuInfo::get_cores_of_numa_node(numa_node)) {
+        CPU_SET(core, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "[PIPELINE] Fail to bind worker " << worker_id << " to numa node " << numa_node << ": "
+                     << std::strerror(ret);
+    }
+    return numa_node;
+}
+
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    const int numa_node = _bind_worker_to_numa_node(worker_id);
     std::queue<DriverRawPtr> local_driver_queue;
     while (true) {
         if (_num_threads_setter.should_shrink()) {
@@ -90,7 +120,7 @@ void GlobalDriverExecutor::_worker_thread() {
             current_thread->set_idle(true);
         }
 
-        auto maybe_driver = _get_next_driver(local_driver_queue);
+        auto maybe_driver = _get_next_driver(local_driver_queue, numa_node);
         if (maybe_driver.status().is_cancelled()) {
             return;
         }
@@ -221,7 +251,8 @@ void GlobalDriverExecutor::_worker_thread() {
     }
 }
 
-StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverRawPtr>& local_driver_queue) {
+StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverRawPtr>& local_driver_queue,
+                                                               int numa_node) {
     DriverRawPtr driver = nullptr;
     if (!local_driver_queue.empty()) {
         const size_t local_driver_num = local_driver_queue.size();
@@ -245,12 +276,26 @@ StatusOr<DriverRawPtr> GlobalDriverExecutor::_get_next_driver(std::queue<DriverR
     // If local driver queue is not empty, we cannot block here. Otherwise these local drivers may not be scheduled until
     // ready queue is not empty.
     const bool need_block = local_driver_queue.empty();
-    return this->_driver_queue->take(need_block);
+    auto maybe_driver = this->_driver_queue->take(need_block, numa_node);
+    if (numa_node != DriverQueue::ANY_NUMA_NODE && maybe_driver.ok() && maybe_driver.value() != nullptr &&
+        maybe_driver.value()->numa_node() != numa_node) {
+        _numa_steal_count++;
+    }
+    return maybe_driver;
 }
 
 void GlobalDriverExecutor::submit(DriverRawPtr driver) {
     driver->start_timers();
 
+    if (_num_numa_nodes > 1) {
+        auto* fragment_ctx = driver->fragment_ctx();
+        int numa_node = fragment_ctx->numa_node();
+        if (numa_node < 0) {
+            numa_node = fragment_ctx->assign_numa_node(_next_numa_node++ % _num_numa_nodes);
+        }
+        driver->set_numa_node(numa_node);
+    }
+
     if (driver->is_precondition_block()) {
         driver->set_driver_state(DriverState::PRECONDITION_BLOCK);
         driver->mark_precondition_not_ready();
@@ -90,7 +90,10 @@ public:
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
     void _worker_thread();
-    StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue);
+    // Bind the current worker thread to the cores of a NUMA node, and return the node.
+    // Return DriverQueue::ANY_NUMA_NODE if the executor isn't NUMA-aware.
+    int _bind_worker_to_numa_node(int worker_id);
+    StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue, int numa_node);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     RuntimeProfile* _build_merged_instance_profile(QueryContext* query_ctx, FragmentContext* fragment_ctx,
                                                    ObjectPool* obj_pool);
@@ -110,6 +113,12 @@ private:
     std::unique_ptr<AuditStatisticsReporter> _audit_statistics_reporter;
 
     std::atomic<int> _next_id = 0;
+    // The number of NUMA nodes the worker threads are split into, 1 if the executor isn't NUMA-aware.
+    int _num_numa_nodes = 1;
+    // The NUMA node assigned to the next fragment instance, fragment instances are assigned round-robin.
+    std::atomic<uint32_t> _next_numa_node = 0;
+    // The number of drivers executed by the worker threads of the other NUMA nodes.
+    std::atomic_int64_t _numa_steal_count = 0;
     std::atomic_int64_t _schedule_count = 0;
     std::atomic_int64_t _driver_execution_ns = 0;
 
@@ -14,6 +14,8 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <algorithm>
+
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
@@ -55,6 +57,7 @@ void QuerySharedDriverQueue::put_back(const DriverRawPtr driver) {
         driver->update_peak_driver_queue_size_counter(_num_drivers);
         _cv.notify_one();
         ++_num_drivers;
+        _update_numa_node_mask();
     }
 }
 
@@ -73,6 +76,7 @@ void QuerySharedDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers)
         _cv.notify_one();
     }
     _num_drivers += drivers.size();
+    _update_numa_node_mask();
 }
 
 void QuerySharedDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
@@ -80,10 +84,9 @@ void QuerySharedDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
     put_back(driver);
 }
 
-StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block) {
+StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block, int numa_node) {
     // -1 means no candidates; else has candidate.
     int queue_idx = -1;
-    double target_accu_time = 0;
     DriverRawPtr driver_ptr = nullptr;
 
     {
@@ -93,16 +96,12 @@ StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block) {
                 return Status::Cancelled("Shutdown");
             }
 
-            // Find the queue with the smallest execution time.
-            for (int i = 0; i < QUEUE_SIZE; ++i) {
-                // we just search for queue has element
-                if (!_queues[i].empty()) {
-                    double local_target_time = _queues[i].accu_time_after_divisor();
-                    if (queue_idx < 0 || local_target_time < target_accu_time) {
-                        target_accu_time = local_target_time;
-                        queue_idx = i;
-                    }
-                }
+            // Find the queue with the smallest execution time, prefer the drivers of numa_node.
+            if (numa_node != ANY_NUMA_NODE) {
+                queue_idx = _pick_level(numa_node);
+            }
+            if (queue_idx < 0) {
+                queue_idx = _pick_level(ANY_NUMA_NODE);
             }
 
             if (queue_idx >= 0) {
@@ -116,10 +115,11 @@ StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block) {
 
         if (queue_idx >= 0) {
             // record queue's index to accumulate time for it.
-            driver_ptr = _queues[queue_idx].take(false);
+            driver_ptr = _queues[queue_idx].take(false, numa_node);
             driver_ptr->set_in_ready_queue(false);
 
             --_num_drivers;
+            _update_numa_node_mask();
         }
     }
 
@@ -127,6 +127,43 @@ StatusOr<DriverRawPtr> QuerySharedDriverQueue::take(const bool block) {
     return driver_ptr;
 }
 
+int QuerySharedDriverQueue::_pick_level(int numa_node) const {
+    int queue_idx = -1;
+    double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        // we just search for queue has element
+        bool has_driver =
+                numa_node == ANY_NUMA_NODE ? !_queues[i].empty() : _queues[i].size_of_numa_node(numa_node) > 0;
+        if (has_driver) {
+            double local_target_time = _queues[i].accu_time_after_divisor();
+            if (queue_idx < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                queue_idx = i;
+            }
+        }
+    }
+    return queue_idx;
+}
+
+bool QuerySharedDriverQueue::has_driver_of_numa_node(int numa_node) const {
+    if (numa_node < 0) {
+        return size() > 0;
+    }
+    return (_numa_node_mask.load(std::memory_order_relaxed) >> (numa_node % 64)) & 1;
+}
+
+void QuerySharedDriverQueue::_update_numa_node_mask() {
+    uint64_t mask = 0;
+    for (const auto& queue : _queues) {
+        for (size_t node = 0; node < queue.num_node_drivers.size(); node++) {
+            if (queue.num_node_drivers[node] > 0) {
+                mask |= uint64_t(1) << (node % 64);
+            }
+        }
+    }
+    _numa_node_mask.store(mask, std::memory_order_relaxed);
+}
+
 void QuerySharedDriverQueue::cancel(DriverRawPtr driver) {
     std::lock_guard<std::mutex> lock(_global_mutex);
     if (_is_closed) {
@@ -164,11 +201,17 @@ int QuerySharedDriverQueue::_compute_driver_level(const DriverRawPtr driver) con
 }
 
 void SubQuerySharedDriverQueue::put(const DriverRawPtr driver) {
+    size_t node = std::max(driver->numa_node(), 0);
+    if (queues.size() <= node) {
+        queues.resize(node + 1);
+        num_node_drivers.resize(node + 1, 0);
+    }
     if (driver->driver_state() == DriverState::CANCELED) {
-        queue.emplace_front(driver);
+        queues[node].emplace_front(driver);
     } else {
-        queue.emplace_back(driver);
+        queues[node].emplace_back(driver);
     }
+    num_node_drivers[node]++;
     num_drivers++;
 }
 
@@ -179,17 +222,28 @@ void SubQuerySharedDriverQueue::cancel(const DriverRawPtr driver) {
     }
 }
 
-DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
+DriverRawPtr SubQuerySharedDriverQueue::take(const bool block, int numa_node) {
     DCHECK(!empty());
     DCHECK(!block);
     if (!pending_cancel_queue.empty()) {
         DriverRawPtr driver = pending_cancel_queue.front();
         pending_cancel_queue.pop();
         cancelled_set.insert(driver);
+        --num_node_drivers[std::max(driver->numa_node(), 0)];
         --num_drivers;
         return driver;
     }
 
+    // Take the drivers of the other nodes only if there are none of numa_node, and take them
+    // from the node with the most drivers.
+    size_t node = 0;
+    if (size_of_numa_node(numa_node) > 0) {
+        node = numa_node;
+    } else {
+        node = std::max_element(num_node_drivers.begin(), num_node_drivers.end()) - num_node_drivers.begin();
+    }
+
+    auto& queue = queues[node];
     while (!queue.empty()) {
         DriverRawPtr driver = queue.front();
         queue.pop_front();
@@ -197,6 +251,7 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
         if (iter != cancelled_set.end()) {
             cancelled_set.erase(iter);
         } else {
+            --num_node_drivers[node];
             --num_drivers;
             return driver;
         }
@@ -238,7 +293,7 @@ void WorkGroupDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
     _put_back<true>(driver);
 }
 
-StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
+StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block, int numa_node) {
     std::unique_lock<std::mutex> lock(_global_mutex);
 
     workgroup::WorkGroupDriverSchedEntity* wg_entity = nullptr;
@@ -254,7 +309,7 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
                 return nullptr;
             }
             _cv.wait(lock);
-        } else if (wg_entity = _take_next_wg(); wg_entity == nullptr) {
+        } else if (wg_entity = _take_next_wg(numa_node); wg_entity == nullptr) {
             int64_t cur_ns = MonotonicNanos();
             int64_t sleep_ns = _bandwidth_control_period_end_ns - cur_ns;
             if (sleep_ns <= 0) {
@@ -275,7 +330,7 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
         _dequeue_workgroup(wg_entity);
     }
 
-    auto maybe_driver = wg_entity->queue()->take(block);
+    auto maybe_driver = wg_entity->queue()->take(block, numa_node);
     if (maybe_driver.ok() && maybe_driver.value() != nullptr) {
         --_num_drivers;
     }
@@ -380,13 +435,26 @@ void WorkGroupDriverQueue::_update_min_wg() {
     }
 }
 
-workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg() {
+workgroup::WorkGroupDriverSchedEntity* WorkGroupDriverQueue::_take_next_wg(int numa_node) {
     workgroup::WorkGroupDriverSchedEntity* min_unthrottled_wg_entity = nullptr;
     for (auto* wg_entity : _wg_entities) {
-        if (!_throttled(wg_entity)) {
+        if (_throttled(wg_entity)) {
+            continue;
+        }
+        if (min_unthrottled_wg_entity == nullptr) {
             min_unthrottled_wg_entity = wg_entity;
+            if (numa_node == ANY_NUMA_NODE) {
+                break;
+            }
+        } else if (wg_entity->vruntime_ns() - min_unthrottled_wg_entity->vruntime_ns() >
+                   NUMA_LOCALITY_VRUNTIME_SLACK_NS) {
+            // The entities are sorted by vruntime, so the rest ones are even further behind.
             break;
         }
+        // has_driver_of_numa_node doesn't take the lock of the work group's queue, since it's only a hint.
+        if (wg_entity->queue()->has_driver_of_numa_node(numa_node)) {
+            return wg_entity;
+        }
     }
 
     return min_unthrottled_wg_entity;
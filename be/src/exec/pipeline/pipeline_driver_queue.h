@@ -27,6 +27,8 @@ using DriverQueuePtr = std::unique_ptr<DriverQueue>;
 
 class DriverQueue {
 public:
+    static constexpr int ANY_NUMA_NODE = -1;
+
     virtual ~DriverQueue() = default;
     virtual void close() = 0;
 
@@ -35,7 +37,9 @@ public:
     // *from_executor* means that the executor thread puts the driver back to the queue.
     virtual void put_back_from_executor(const DriverRawPtr driver) = 0;
 
-    virtual StatusOr<DriverRawPtr> take(const bool block) = 0;
+    // If numa_node is not ANY_NUMA_NODE, the drivers of this NUMA node are preferred, and the drivers of
+    // the other nodes are taken only when there are no ready drivers of this node.
+    virtual StatusOr<DriverRawPtr> take(const bool block, int numa_node = ANY_NUMA_NODE) = 0;
     virtual void cancel(DriverRawPtr driver) = 0;
 
     // Update statistics of the driver's workgroup,
@@ -44,6 +48,8 @@ public:
 
     virtual size_t size() const = 0;
     bool empty() const { return size() == 0; }
+    // It may be called without the lock of the caller's queue, so it may be stale and is only used as a hint.
+    virtual bool has_driver_of_numa_node(int numa_node) const { return !empty(); }
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
 };
@@ -56,17 +62,19 @@ public:
 // this may not be a big problem because the finalize operation is fast enough.
 //
 // We use some data structures to maintain the above properties:
-// 1. std::deque<DriverRawPtr> queue
-//   store the drivers added by PipelineDriverPoller, cancelled driver are added to the head and the others are added to the tail
+// 1. std::vector<std::deque<DriverRawPtr>> queues
+//   store the drivers added by PipelineDriverPoller, one deque per NUMA node (see PipelineDriver::numa_node),
+//   cancelled driver are added to the head and the others are added to the tail
 // 2. std::queue<DriverRawPtr> pending_cancel_queue
-//   store the drivers that are already in `queue` but cancelled, the drivers will only be added when the query is cancelled externally
+//   store the drivers that are already in `queues` but cancelled, the drivers will only be added when the query is cancelled externally
 // 3. std::unordered_set<DriverRawPtr> cancelled_set
 //   record drivers that have been taken in pending_cancel_queue
 //
 // When taking a driver from SubQuerySharedDriverQueue, we try to take it from `pending_cancel_queue` first.
 // if `pending_cancel_queue` is not empty, we take it from the head and record it in `cancelled_set`.
-// Otherwise, we take it from `queue`.
-// It should be noted that the driver in `queue` may already be taken from `pending_cancel_queue`,
+// Otherwise, we take it from the deque of the NUMA node of the executor thread, or from the longest deque
+// if there are no drivers of this node.
+// It should be noted that the driver in `queues` may already be taken from `pending_cancel_queue`,
 // we should ignore such drivers and try to get the next one.
 class SubQuerySharedDriverQueue {
 public:
@@ -78,12 +86,18 @@ public:
 
     void put(const DriverRawPtr driver);
     void cancel(const DriverRawPtr driver);
-    DriverRawPtr take(const bool block);
+    DriverRawPtr take(const bool block, int numa_node = DriverQueue::ANY_NUMA_NODE);
     inline bool empty() const { return num_drivers == 0; }
 
     inline size_t size() const { return num_drivers; }
+    size_t size_of_numa_node(int numa_node) const {
+        return numa_node >= 0 && static_cast<size_t>(numa_node) < num_node_drivers.size() ? num_node_drivers[numa_node]
+                                                                                           : 0;
+    }
 
-    std::deque<DriverRawPtr> queue;
+    // The drivers without NUMA node are in the first deque.
+    std::vector<std::deque<DriverRawPtr>> queues;
+    std::vector<size_t> num_node_drivers;
     std::queue<DriverRawPtr> pending_cancel_queue;
     std::unordered_set<DriverRawPtr> cancelled_set;
     size_t num_drivers = 0;
@@ -109,11 +123,12 @@ public:
     void update_statistics(const DriverRawPtr driver) override;
 
     // Return cancelled status, if the queue is closed.
-    StatusOr<DriverRawPtr> take(const bool block) override;
+    StatusOr<DriverRawPtr> take(const bool block, int numa_node = ANY_NUMA_NODE) override;
 
     void cancel(DriverRawPtr driver) override;
 
     size_t size() const override;
+    bool has_driver_of_numa_node(int numa_node) const override;
 
     bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
 
@@ -124,6 +139,11 @@ private:
     // When the driver at the i-th level costs _level_time_slices[i],
     // it will move to (i+1)-th level.
     int _compute_driver_level(const DriverRawPtr driver) const;
+    // Return the level with the smallest execution time among the levels having drivers of numa_node,
+    // or -1 if there is no such level.
+    int _pick_level(int numa_node) const;
+    // Should be guarded by _global_mutex.
+    void _update_numa_node_mask();
 
 private:
     // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns,
@@ -141,6 +161,10 @@ private:
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
     bool _is_closed = false;
+
+    // The (node % 64)-th bit is set if there are ready drivers of the NUMA node, read by
+    // has_driver_of_numa_node without _global_mutex.
+    std::atomic<uint64_t> _numa_node_mask = 0;
 };
 
 // WorkGroupDriverQueue contains two levels of queues.
@@ -163,7 +187,10 @@ public:
     // Return cancelled status, if the queue is closed.
     // Firstly, select the work group with the minimum vruntime.
     // Secondly, select the proper driver from the driver queue of this work group.
-    StatusOr<DriverRawPtr> take(const bool block) override;
+    // With numa_node, the work group with the minimum vruntime among the ones having drivers of this node is selected,
+    // if its vruntime is within NUMA_LOCALITY_VRUNTIME_SLACK_NS of the minimum one, so that locality doesn't starve
+    // the other work groups.
+    StatusOr<DriverRawPtr> take(const bool block, int numa_node = ANY_NUMA_NODE) override;
 
     void cancel(DriverRawPtr driver) override;
 
@@ -177,7 +204,7 @@ private:
     /// These methods should be guarded by the outside _global_mutex.
     template <bool from_executor>
     void _put_back(const DriverRawPtr driver);
-    workgroup::WorkGroupDriverSchedEntity* _take_next_wg();
+    workgroup::WorkGroupDriverSchedEntity* _take_next_wg(int numa_node = ANY_NUMA_NODE);
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
     // Apply hard bandwidth control to non-short-query workgroups, when there are queries of the short-query workgroup.
@@ -196,6 +223,7 @@ private:
 private:
     static constexpr int64_t SCHEDULE_PERIOD_PER_WG_NS = 100'000'000;
     static constexpr int64_t BANDWIDTH_CONTROL_PERIOD_NS = 100'000'000;
+    static constexpr int64_t NUMA_LOCALITY_VRUNTIME_SLACK_NS = 10'000'000;
 
     struct WorkGroupDriverSchedEntityComparator {
         using WorkGroupDriverSchedEntityPtr = workgroup::WorkGroupDriverSchedEntity*;
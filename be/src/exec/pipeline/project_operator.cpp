@@ -18,6 +18,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "exprs/expr.h"
+#include "exprs/json_functions.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
 
@@ -44,6 +45,8 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         return Status::OK();
     }
     TRY_CATCH_ALLOC_SCOPE_START();
+    // Parse the JSON documents of a column once for all the expressions.
+    JsonParseCache::Scope json_parse_cache_scope;
     {
         SCOPED_TIMER(_common_sub_expr_compute_timer);
         for (size_t i = 0; i < _common_sub_column_ids.size(); ++i) {
@@ -514,6 +514,7 @@ public:
                 continue;
             }
             auto* rf = desc->runtime_filter();
+            std::vector<JoinRuntimeFilter*> partial_rfs;
             for (auto& opt_params : _partial_bloom_filter_build_params) {
                 auto& opt_param = opt_params[i];
                 DCHECK(opt_param.has_value());
@@ -521,7 +522,11 @@ public:
                 if (param.column == nullptr || param.column->empty()) {
                     continue;
                 }
-                rf->concat(param.runtime_filter.get());
+                partial_rfs.emplace_back(param.runtime_filter.get());
+            }
+            JoinRuntimeFilter::prepare_concat(partial_rfs);
+            for (auto* partial_rf : partial_rfs) {
+                rf->concat(partial_rf);
             }
         }
         return Status::OK();
@@ -51,6 +51,9 @@ public:
     // Return true if eos is not reached
     // Return false if eos is reached or error occurred
     bool has_next_chunk() const { return _status.ok(); }
+    // Return true if all the rows of the morsel have been read
+    bool reach_eos() const { return _status.is_end_of_file(); }
+    const Morsel* morsel() const { return _morsel.get(); }
 
     Status buffer_next_batch_chunks_blocking(RuntimeState* state, size_t batch_size,
                                              const workgroup::WorkGroup* running_wg);
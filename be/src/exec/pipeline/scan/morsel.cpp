@@ -16,18 +16,24 @@
 
 #include <fmt/compile.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
+#include "storage/rowset/column_iterator.h"
 #include "storage/rowset/rowid_range_option.h"
 #include "storage/rowset/rowset.h"
+#include "storage/rowset/segment.h"
 #include "storage/rowset/short_key_range_option.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -231,12 +237,151 @@ void PhysicalSplitMorselQueue::set_key_ranges(TabletReaderParams::RangeStartOper
     _range_end_key = range_end_key;
 }
 
-StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_single_tablet() {
-    size_t num_taken_rows = 0;
+void PhysicalSplitMorselQueue::set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) {
+    SplitMorselQueue::set_tablet_rowsets(tablet_rowsets);
+    _num_rest_cost = 0;
+    for (const auto& rowsets : _tablet_rowsets) {
+        for (const auto& rowset : rowsets) {
+            _num_rest_cost += rowset->num_rows();
+        }
+    }
+}
+
+void PhysicalSplitMorselQueue::set_pred_tree(const TabletSchemaCSPtr& tablet_schema, PredicateTree pred_tree,
+                                             std::vector<std::unique_ptr<ColumnPredicate>>&& col_preds_owner) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _zone_map_predicates.clear();
+    // Only the predicates ANDed at the root are evaluated by the zone maps separately.
+    for (const auto& [cid, col_preds] : pred_tree.get_immediate_column_predicate_map()) {
+        if (cid < tablet_schema->num_columns()) {
+            _zone_map_predicates.emplace_back(tablet_schema->column(cid), col_preds);
+        }
+    }
+    _col_preds_owner = std::move(col_preds_owner);
+}
+
+double PhysicalSplitMorselQueue::next_splitted_scan_cost(double num_rest_cost, int64_t degree_of_parallelism,
+                                                         int64_t splitted_scan_rows, double driver_speed_ratio) {
+    const int64_t factor = config::tablet_internal_parallel_adaptive_split_factor;
+    if (factor <= 0) {
+        return splitted_scan_rows;
+    }
+    // Guided self-scheduling: each morsel takes a share of the rest cost, so the morsels become smaller
+    // as the scan drains, and the rest rows are spread over all the drivers instead of the slow ones.
+    const double min_cost = std::min(config::tablet_internal_parallel_min_splitted_scan_rows, splitted_scan_rows);
+    const double cost = std::max(num_rest_cost, 0.0) / (factor * std::max<int64_t>(degree_of_parallelism, 1));
+    // A driver slower than the others takes a proportionally smaller morsel, so it doesn't hold the rows that
+    // the others could have scanned earlier.
+    return std::max(std::clamp(cost, min_cost, static_cast<double>(splitted_scan_rows)) *
+                            std::clamp(driver_speed_ratio, 0.0, 1.0),
+                    min_cost);
+}
+
+PhysicalSplitMorselQueue::ScanCostPieces PhysicalSplitMorselQueue::build_scan_cost_pieces(
+        const SparseRange<>& scan_range, const SparseRange<>& hit_range) {
+    ScanCostPieces pieces;
+    size_t num_rows = 0;
+    double cost = 0;
+    auto add_piece = [&](rowid_t begin, rowid_t end, double row_cost) {
+        if (begin >= end) {
+            return;
+        }
+        num_rows += end - begin;
+        cost += (end - begin) * row_cost;
+        pieces.emplace_back(num_rows, cost);
+    };
+
+    size_t hit_idx = 0;
+    rowid_t prev_end = 0;
+    for (size_t i = 0; i < scan_range.size(); i++) {
+        const auto& range = scan_range[i];
+        // The scan range may be unsorted when the key ranges are.
+        if (range.begin() < prev_end) {
+            hit_idx = 0;
+        }
+        prev_end = range.end();
+
+        rowid_t pos = range.begin();
+        while (pos < range.end()) {
+            while (hit_idx < hit_range.size() && hit_range[hit_idx].end() <= pos) {
+                hit_idx++;
+            }
+            if (hit_idx >= hit_range.size() || hit_range[hit_idx].begin() >= range.end()) {
+                add_piece(pos, range.end(), kZoneMapFilteredRowCost);
+                break;
+            }
+            const auto& hit = hit_range[hit_idx];
+            if (hit.begin() > pos) {
+                add_piece(pos, hit.begin(), kZoneMapFilteredRowCost);
+                pos = hit.begin();
+            }
+            const rowid_t end = std::min(hit.end(), range.end());
+            add_piece(pos, end, 1);
+            pos = end;
+        }
+    }
+    return pieces;
+}
+
+double PhysicalSplitMorselQueue::scan_cost_of_rows(const ScanCostPieces& pieces, size_t num_rows) {
+    auto it = std::lower_bound(pieces.begin(), pieces.end(), num_rows,
+                               [](const auto& piece, size_t rows) { return piece.first < rows; });
+    if (it == pieces.end()) {
+        return pieces.empty() ? 0 : pieces.back().second;
+    }
+    const size_t prev_rows = it == pieces.begin() ? 0 : std::prev(it)->first;
+    const double prev_cost = it == pieces.begin() ? 0 : std::prev(it)->second;
+    return prev_cost + (it->second - prev_cost) * (num_rows - prev_rows) / (it->first - prev_rows);
+}
+
+size_t PhysicalSplitMorselQueue::scan_rows_of_cost(const ScanCostPieces& pieces, double cost) {
+    auto it = std::lower_bound(pieces.begin(), pieces.end(), cost,
+                               [](const auto& piece, double c) { return piece.second < c; });
+    if (it == pieces.end()) {
+        return pieces.empty() ? 0 : pieces.back().first;
+    }
+    const size_t prev_rows = it == pieces.begin() ? 0 : std::prev(it)->first;
+    const double prev_cost = it == pieces.begin() ? 0 : std::prev(it)->second;
+    const double row_cost = (it->second - prev_cost) / (it->first - prev_rows);
+    const auto rows = static_cast<size_t>(std::ceil((cost - prev_cost) / row_cost));
+    return std::min(prev_rows + rows, it->first);
+}
+
+double PhysicalSplitMorselQueue::_driver_speed_ratio(int32_t driver_sequence) const {
+    auto it = _driver_scan_speeds.find(driver_sequence);
+    if (it == _driver_scan_speeds.end()) {
+        return 1;
+    }
+    double total_speed = 0;
+    for (const auto& [_, speed] : _driver_scan_speeds) {
+        total_speed += speed;
+    }
+    return it->second * _driver_scan_speeds.size() / total_speed;
+}
+
+void PhysicalSplitMorselQueue::finish_morsel(int32_t driver_sequence, const Morsel* morsel) {
+    const auto* split_morsel = down_cast<const PhysicalSplitScanMorsel*>(morsel);
+    const int64_t elapsed_ns = MonotonicNanos() - split_morsel->pickup_time_ns();
+    if (split_morsel->scan_cost() <= 0 || elapsed_ns <= 0) {
+        return;
+    }
+    // The elapsed time includes waiting for the scan threads, so the drivers starved of them are slow too.
+    const double speed = split_morsel->scan_cost() / elapsed_ns;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto [it, inserted] = _driver_scan_speeds.emplace(driver_sequence, speed);
+    if (!inserted) {
+        it->second = (it->second + speed) / 2;
+    }
+}
+
+StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_single_tablet(double splitted_scan_cost,
+                                                                                          double* taken_cost) {
+    *taken_cost = 0;
     RowidRangeOptionPtr rowid_range = nullptr;
     auto has_taken_from_tablet = [&rowid_range]() { return rowid_range != nullptr; };
 
-    while (num_taken_rows < _splitted_scan_rows) {
+    while (*taken_cost < splitted_scan_cost) {
         if (_tablet_idx >= _tablets.size()) {
             return rowid_range;
         }
@@ -267,23 +412,39 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
             rowid_range = std::make_shared<RowidRangeOption>();
         }
 
+        // Take the rows of the rest cost of this morsel, so the morsel covers fewer rows where the pages are hit
+        // by the predicates, and more rows where they are skipped.
+        const size_t num_segment_rows = _segment_scan_costs.back().first;
+        const size_t num_prev_taken_rows = num_segment_rows - _num_segment_rest_rows;
+        const double prev_taken_cost = scan_cost_of_rows(_segment_scan_costs, num_prev_taken_rows);
+        const size_t num_rows =
+                std::max(scan_rows_of_cost(_segment_scan_costs, prev_taken_cost + splitted_scan_cost - *taken_cost),
+                         num_prev_taken_rows + 1) -
+                num_prev_taken_rows;
+
         SparseRange<> taken_range;
-        _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        _segment_range_iter.next_range(num_rows, &taken_range);
         _num_segment_rest_rows -= taken_range.span_size();
-        if (_num_segment_rest_rows < _splitted_scan_rows) {
-            // If there are too few rows left in the segment, take them all this time.
-            _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        if (_segment_scan_costs.back().second -
+                    scan_cost_of_rows(_segment_scan_costs, num_segment_rows - _num_segment_rest_rows) <
+            splitted_scan_cost) {
+            // If there is too little cost left in the segment, take them all this time.
+            _segment_range_iter.next_range(_num_segment_rest_rows, &taken_range);
             _num_segment_rest_rows = 0;
         }
+        const double cost =
+                scan_cost_of_rows(_segment_scan_costs, num_segment_rows - _num_segment_rest_rows) - prev_taken_cost;
+        _num_rest_cost -= cost;
 
         VLOG_ROW << "PhysicalSplitMorselQueue::_try_get_split_from_single_tablet "
                  << "[rowid_range_addr=" << rowid_range.get() << "] "
                  << "[tablet_idx=" << _tablet_idx << "] "
                  << "[rowset_idx=" << _rowset_idx << "] "
                  << "[segment_idx=" << _segment_idx << "] "
-                 << "[range=" << taken_range.to_string() << "] ";
+                 << "[range=" << taken_range.to_string() << "] "
+                 << "[cost=" << cost << "] ";
 
-        num_taken_rows += taken_range.span_size();
+        *taken_cost += cost;
         rowid_range->add(_cur_rowset(), _cur_segment(), std::make_shared<SparseRange<>>(std::move(taken_range)),
                          _is_first_split_of_segment);
         _is_first_split_of_segment = false;
@@ -296,7 +457,7 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
     return rowid_range;
 }
 
-StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get() {
+StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get_for_driver(int32_t driver_sequence) {
     std::lock_guard<std::mutex> lock(_mutex);
     if (_unget_morsel != nullptr) {
         return std::move(_unget_morsel);
@@ -305,14 +466,20 @@ StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get() {
     DCHECK(!_tablet_rowsets.empty());
     DCHECK_EQ(_tablets.size(), _tablet_rowsets.size());
 
-    ASSIGN_OR_RETURN(auto rowid_range, _try_get_split_from_single_tablet());
+    // The morsels are split only when they are picked up, so the rest rows are split by the speed of the drivers
+    // picking them up at runtime.
+    const double splitted_scan_cost = next_splitted_scan_cost(
+            _num_rest_cost, _degree_of_parallelism, _splitted_scan_rows, _driver_speed_ratio(driver_sequence));
+    double taken_cost = 0;
+    ASSIGN_OR_RETURN(auto rowid_range, _try_get_split_from_single_tablet(splitted_scan_cost, &taken_cost));
     if (rowid_range == nullptr) {
         return nullptr;
     }
 
     auto* scan_morsel = _cur_scan_morsel();
-    MorselPtr morsel = std::make_unique<PhysicalSplitScanMorsel>(
+    auto morsel = std::make_unique<PhysicalSplitScanMorsel>(
             scan_morsel->get_plan_node_id(), *(scan_morsel->get_scan_range()), std::move(rowid_range));
+    morsel->set_scan_cost(taken_cost, MonotonicNanos());
     morsel->set_rowsets(_tablet_rowsets[_tablet_idx]);
     _inc_split(_is_last_split_of_current_morsel());
     return morsel;
@@ -430,6 +597,7 @@ Status PhysicalSplitMorselQueue::_init_segment() {
 
     _num_segment_rest_rows = 0;
     _segment_scan_range.clear();
+    _segment_scan_costs.clear();
 
     auto* segment = _cur_segment();
     // The new rowset doesn't contain any segment.
@@ -462,9 +630,45 @@ Status PhysicalSplitMorselQueue::_init_segment() {
     _segment_range_iter = _segment_scan_range.new_iterator();
     _num_segment_rest_rows = _segment_scan_range.span_size();
 
+    SparseRange<> hit_range(0, segment->num_rows());
+    if (!_zone_map_predicates.empty() && config::tablet_internal_parallel_adaptive_split_factor > 0) {
+        // The zone maps only weight the rows of the morsels, and the segment iterator filters the rows by them
+        // again, so the scan goes on without the estimate on error.
+        if (auto hit_range_or = _get_row_ranges_by_zone_map(segment); hit_range_or.ok()) {
+            hit_range = std::move(hit_range_or.value());
+        } else {
+            LOG(WARNING) << "failed to estimate the scan cost of segment " << segment->file_name() << ": "
+                         << hit_range_or.status();
+        }
+    }
+    _segment_scan_costs = build_scan_cost_pieces(_segment_scan_range, hit_range);
+    // The rows out of the key ranges won't be scanned.
+    _num_rest_cost -= segment->num_rows() - scan_cost_of_rows(_segment_scan_costs, _num_segment_rest_rows);
+
     return Status::OK();
 }
 
+StatusOr<SparseRange<>> PhysicalSplitMorselQueue::_get_row_ranges_by_zone_map(Segment* segment) {
+    ASSIGN_OR_RETURN(auto read_file, segment->file_system()->new_random_access_file(segment->file_info()));
+
+    SparseRange<> hit_range(0, segment->num_rows());
+    for (const auto& [column, col_preds] : _zone_map_predicates) {
+        if (segment->column_with_uid(column.unique_id()) == nullptr) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(auto column_iter, segment->new_column_iterator_or_default(column, nullptr));
+        ColumnIteratorOptions iter_opts;
+        iter_opts.read_file = read_file.get();
+        iter_opts.stats = &_zone_map_stats;
+        RETURN_IF_ERROR(column_iter->init(iter_opts));
+
+        SparseRange<> r;
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_zone_map(col_preds, nullptr, &r, CompoundNodeType::AND));
+        hit_range &= r;
+    }
+    return hit_range;
+}
+
 void LogicalSplitMorselQueue::set_key_ranges(const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges) {
     for (const auto& key_range : key_ranges) {
         if (key_range->begin_scan_range.size() == 1 && key_range->begin_scan_range.get_value(0) == NEGATIVE_INFINITY) {
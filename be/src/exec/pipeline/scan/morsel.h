@@ -208,8 +208,18 @@ public:
 
     RowidRangeOptionPtr get_rowid_range_option() { return _rowid_range_option; }
 
+    // The estimated cost of the rows of this morsel, and when it is picked up from the morsel queue.
+    void set_scan_cost(double scan_cost, int64_t pickup_time_ns) {
+        _scan_cost = scan_cost;
+        _pickup_time_ns = pickup_time_ns;
+    }
+    double scan_cost() const { return _scan_cost; }
+    int64_t pickup_time_ns() const { return _pickup_time_ns; }
+
 private:
     RowidRangeOptionPtr _rowid_range_option;
+    double _scan_cost = 0;
+    int64_t _pickup_time_ns = 0;
 };
 
 class LogicalSplitScanMorsel final : public ScanMorsel {
@@ -334,11 +344,19 @@ public:
     }
     virtual void set_ticket_checker(const query_cache::TicketCheckerPtr& ticket_checker) {}
     virtual bool could_attch_ticket_checker() const { return false; }
+    // Set the predicates pushed down to the storage layer, whose column ids are of |tablet_schema|,
+    // and |col_preds_owner| owns them.
+    virtual void set_pred_tree(const TabletSchemaCSPtr& tablet_schema, PredicateTree pred_tree,
+                               std::vector<std::unique_ptr<ColumnPredicate>>&& col_preds_owner) {}
 
     virtual size_t num_original_morsels() const { return _num_morsels; }
     virtual size_t max_degree_of_parallelism() const { return _num_morsels; }
     virtual bool empty() const = 0;
     virtual StatusOr<MorselPtr> try_get() = 0;
+    // Pick up the next morsel for the scan driver of |driver_sequence|.
+    virtual StatusOr<MorselPtr> try_get_for_driver(int32_t driver_sequence) { return try_get(); }
+    // The scan driver of |driver_sequence| has read all the rows of |morsel|.
+    virtual void finish_morsel(int32_t driver_sequence, const Morsel* morsel) {}
     virtual void unget(MorselPtr&& morsel);
     virtual std::string name() const = 0;
     virtual StatusOr<bool> ready_for_next() const { return true; }
@@ -447,12 +465,38 @@ public:
     void set_key_ranges(TabletReaderParams::RangeStartOperation _range_start_op,
                         TabletReaderParams::RangeEndOperation _range_end_op, std::vector<OlapTuple> _range_start_key,
                         std::vector<OlapTuple> _range_end_key) override;
+    void set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) override;
+    void set_pred_tree(const TabletSchemaCSPtr& tablet_schema, PredicateTree pred_tree,
+                       std::vector<std::unique_ptr<ColumnPredicate>>&& col_preds_owner) override;
     bool empty() const override { return _unget_morsel == nullptr && _tablet_idx >= _tablets.size(); }
-    StatusOr<MorselPtr> try_get() override;
+    StatusOr<MorselPtr> try_get() override { return try_get_for_driver(-1); }
+    StatusOr<MorselPtr> try_get_for_driver(int32_t driver_sequence) override;
+    void finish_morsel(int32_t driver_sequence, const Morsel* morsel) override;
 
     std::string name() const override { return "physical_split_morsel_queue"; }
     Type type() const override { return PHYSICAL_SPLIT; }
 
+    // The cost of scanning a row skipped by the page zone maps, relative to a row of the hit pages.
+    static constexpr double kZoneMapFilteredRowCost = 1.0 / 16;
+
+    // The cost of the next morsel, when there is num_rest_cost left to be scanned by degree_of_parallelism drivers,
+    // and the driver picking it up scans driver_speed_ratio times as fast as the others on average.
+    // The cost of a row is 1 if it isn't skipped by the page zone maps, so it is in
+    // [min(tablet_internal_parallel_min_splitted_scan_rows, splitted_scan_rows), splitted_scan_rows],
+    // or always splitted_scan_rows if the adaptive split is disabled.
+    static double next_splitted_scan_cost(double num_rest_cost, int64_t degree_of_parallelism,
+                                          int64_t splitted_scan_rows, double driver_speed_ratio);
+
+    // The accumulated cost of the rows of a scan range in the order they are scanned. Each piece is
+    // (the number of rows from the beginning of the scan range to the end of the piece, the cost of these rows).
+    using ScanCostPieces = std::vector<std::pair<size_t, double>>;
+    // The rows of |scan_range| in |hit_range| cost 1, and the others cost kZoneMapFilteredRowCost.
+    static ScanCostPieces build_scan_cost_pieces(const SparseRange<>& scan_range, const SparseRange<>& hit_range);
+    // The cost of the first num_rows rows of the scan range.
+    static double scan_cost_of_rows(const ScanCostPieces& pieces, size_t num_rows);
+    // The number of the first rows of the scan range, whose cost reaches |cost|.
+    static size_t scan_rows_of_cost(const ScanCostPieces& pieces, double cost);
+
 private:
     rowid_t _lower_bound_ordinal(Segment* segment, const SeekTuple& key, bool lower) const;
     rowid_t _upper_bound_ordinal(Segment* segment, const SeekTuple& key, bool lower, rowid_t end) const;
@@ -467,9 +511,14 @@ private:
     // Load the meta of the new rowset and the index of the new segment,
     // and find the rowid range of each key range in this segment.
     Status _init_segment();
+    // The rows of the current segment which are not skipped by the page zone maps of the predicates.
+    StatusOr<SparseRange<>> _get_row_ranges_by_zone_map(Segment* segment);
     // Obtain row id ranges from multiple segments of multiple rowsets within a single tablet,
-    // until _splitted_scan_rows rows are retrieved.
-    StatusOr<RowidRangeOptionPtr> _try_get_split_from_single_tablet();
+    // until the rows of splitted_scan_cost are retrieved, and return the cost of them by |taken_cost|.
+    StatusOr<RowidRangeOptionPtr> _try_get_split_from_single_tablet(double splitted_scan_cost, double* taken_cost);
+    // How fast the driver of |driver_sequence| scans, relative to the average of the drivers.
+    // The slow drivers pick up the smaller morsels, and leave more rows to be split by the fast ones.
+    double _driver_speed_ratio(int32_t driver_sequence) const;
 
 private:
     std::mutex _mutex;
@@ -480,6 +529,11 @@ private:
     std::vector<OlapTuple> _range_start_key;
     std::vector<OlapTuple> _range_end_key;
 
+    /// Predicates to estimate the cost of the rows by the page zone maps.
+    std::vector<std::unique_ptr<ColumnPredicate>> _col_preds_owner;
+    std::vector<std::pair<TabletColumn, ColumnPredicates>> _zone_map_predicates;
+    OlapReaderStatistics _zone_map_stats;
+
     // _tablets[i] and _tablet_rowsets[i] represent the i-th tablet and its rowsets.
     bool _has_init_any_segment = false;
     bool _is_first_split_of_segment = true;
@@ -489,8 +543,14 @@ private:
     std::vector<SeekRange> _tablet_seek_ranges;
     SparseRange<> _segment_scan_range;
     SparseRangeIterator<> _segment_range_iter;
+    ScanCostPieces _segment_scan_costs;
     // The number of unprocessed rows of the current segment.
     size_t _num_segment_rest_rows = 0;
+    // The estimated cost of the unprocessed rows of all the tablets. The rows of the segments not initialized yet
+    // cost 1, and the rows out of the key ranges of the initialized segments cost nothing.
+    double _num_rest_cost = 0;
+    // The scanned cost per nanosecond of each driver, which is updated when a driver finishes a morsel.
+    std::unordered_map<int32_t, double> _driver_scan_speeds;
 
     MemPool _mempool;
 };
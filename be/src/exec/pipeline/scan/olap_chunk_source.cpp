@@ -14,13 +14,17 @@
 
 #include "exec/pipeline/scan/olap_chunk_source.h"
 
+#include <fmt/format.h>
+
 #include <cstdint>
 #include <string_view>
 #include <unordered_map>
 
 #include "column/column.h"
 #include "column/column_access_path.h"
+#include "column/datum_convert.h"
 #include "column/field.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -35,6 +39,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/column_predicate_rewriter.h"
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/predicate_parser.h"
@@ -55,11 +60,20 @@ OlapChunkSource::OlapChunkSource(ScanOperator* op, RuntimeProfile* runtime_profi
           _scan_range(down_cast<ScanMorsel*>(_morsel.get())->get_olap_scan_range()) {}
 
 OlapChunkSource::~OlapChunkSource() {
+    _shared_scan.reset();
     _reader.reset();
     _predicate_free_pool.clear();
 }
 
 void OlapChunkSource::close(RuntimeState* state) {
+    if (_shared_scan) {
+        // Detach from the shared scan before closing |_prj_iter|, which may be read by the other queries.
+        if (!_shared_scan->is_owner()) {
+            COUNTER_UPDATE(_shared_scan_rows_counter, _shared_scan->num_shared_rows());
+        }
+        _shared_scan->close();
+        _shared_scan.reset();
+    }
     if (_reader) {
         _update_counter();
     }
@@ -115,6 +129,7 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _raw_rows_counter = ADD_COUNTER(_runtime_profile, "RawRowsRead", TUnit::UNIT);
     _read_pages_num_counter = ADD_COUNTER(_runtime_profile, "ReadPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "CachedPagesNum", TUnit::UNIT);
+    _decoded_cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "DecodedCachedPagesNum", TUnit::UNIT);
     _pushdown_predicates_counter =
             ADD_COUNTER_SKIP_MERGE(_runtime_profile, "PushdownPredicates", TUnit::UNIT, TCounterMergeType::SKIP_ALL);
     _pushdown_access_paths_counter =
@@ -229,6 +244,9 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
                                     &pushdown_pred_root, &non_pushdown_pred_root);
     _params.pred_tree = PredicateTree::create(std::move(pushdown_pred_root));
     _non_pushdown_pred_tree = PredicateTree::create(std::move(non_pushdown_pred_root));
+    if (config::enable_segment_runtime_filter_pushdown) {
+        _init_runtime_filter_predicates(parser);
+    }
 
     {
         GlobalDictPredicatesRewriter not_pushdown_predicate_rewriter(*_params.global_dictmaps);
@@ -269,6 +287,41 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
     return Status::OK();
 }
 
+void OlapChunkSource::_init_runtime_filter_predicates(const PredicateParser* parser) {
+    const RuntimeFilterProbeCollector* runtime_filters = _scan_op->runtime_bloom_filters();
+    if (runtime_filters == nullptr) {
+        return;
+    }
+    for (const auto& [_, desc] : runtime_filters->descriptors()) {
+        SlotId slot_id;
+        if (desc->is_topn_filter() || !desc->is_probe_slot_ref(&slot_id) ||
+            !desc->partition_by_expr_contexts()->empty()) {
+            continue;
+        }
+        auto slot_iter = std::find_if(_slots->begin(), _slots->end(),
+                                      [slot_id](const SlotDescriptor* slot) { return slot->id() == slot_id; });
+        if (slot_iter == _slots->end()) {
+            continue;
+        }
+        const SlotDescriptor* slot = *slot_iter;
+        const int32_t index = _tablet_schema->field_index(slot->col_name());
+        // The global dict columns are read as codes, and the value columns of the aggregate tables are read before
+        // they are merged, so the runtime filters on them are only evaluated by the scan operator.
+        if (index < 0 || _params.global_dictmaps->count(index) > 0 || !parser->can_pushdown(slot)) {
+            continue;
+        }
+        const LogicalType type = _tablet_schema->column(index).type();
+        if (type != slot->type().type || !(is_integer_type(type) || is_decimalv3_field_type(type) ||
+                                           type == TYPE_VARCHAR || type == TYPE_DATE || type == TYPE_DATETIME)) {
+            continue;
+        }
+        _params.runtime_filter_preds.add(desc, index);
+    }
+    _params.runtime_filter_preds.driver_sequence = _scan_op->get_driver_sequence();
+    _params.runtime_filter_preds.compatibility =
+            _runtime_state->func_version() <= 3 || !_runtime_state->enable_pipeline_engine();
+}
+
 Status OlapChunkSource::_init_scanner_columns(std::vector<uint32_t>& scanner_columns) {
     for (auto slot : *_slots) {
         DCHECK(slot->is_materialized());
@@ -420,6 +473,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     }
 
     RETURN_IF_ERROR(_init_global_dicts(&_params));
+    _init_dict_code_columns();
     RETURN_IF_ERROR(_init_unused_output_columns(thrift_olap_scan_node.unused_output_column_name));
     RETURN_IF_ERROR(_init_scanner_columns(scanner_columns));
     RETURN_IF_ERROR(_init_reader_params(_scan_ctx->key_ranges(), scanner_columns, reader_columns));
@@ -467,14 +521,111 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_reader->prepare());
     RETURN_IF_ERROR(_reader->open(_params));
 
+    if (auto key = _shared_scan_key(reader_columns, scanner_columns); !key.empty()) {
+        _shared_scan = SharedScanManager::instance()->attach(key, _prj_iter, _params.chunk_size,
+                                                             config::shared_scan_max_buffered_chunks,
+                                                             config::shared_scan_max_wait_ms);
+        if (!_shared_scan->is_owner()) {
+            _shared_scan_rows_counter = ADD_COUNTER(_runtime_profile, "SharedScanRows", TUnit::UNIT);
+        }
+    }
+
     return Status::OK();
 }
 
+// Serialize the pushed-down predicates into the key of a shared scan by their types, columns and operands.
+// The debug strings can't be used, because they don't identify some predicates, e.g. the ones of expressions
+// don't print the functions. Return false if any predicate can't be identified in this way.
+struct SharedScanPredicateSerializer {
+    std::string* out;
+
+    bool operator()(const PredicateColumnNode& node) const {
+        const ColumnPredicate* pred = node.col_pred();
+        switch (pred->type()) {
+        case PredicateType::kEQ:
+        case PredicateType::kNE:
+        case PredicateType::kGT:
+        case PredicateType::kGE:
+        case PredicateType::kLT:
+        case PredicateType::kLE:
+        case PredicateType::kInList:
+        case PredicateType::kNotInList:
+        case PredicateType::kIsNull:
+        case PredicateType::kNotNull:
+            break;
+        default:
+            return false;
+        }
+        if (pred->is_expr_predicate() || pred->is_index_filter_only()) {
+            return false;
+        }
+        fmt::format_to(std::back_inserter(*out), "({}:{}:{}", static_cast<int>(pred->type()), pred->column_id(),
+                       static_cast<int>(pred->type_info()->type()));
+        auto* type_info = const_cast<TypeInfo*>(pred->type_info());
+        for (const Datum& value : pred->values()) {
+            if (value.is_null()) {
+                out->append(":N");
+                continue;
+            }
+            // Prefix the length, the operands may contain any characters.
+            std::string str = datum_to_string(type_info, value);
+            fmt::format_to(std::back_inserter(*out), ":{}:{}", str.size(), str);
+        }
+        out->append(")");
+        return true;
+    }
+
+    template <CompoundNodeType Type>
+    bool operator()(const PredicateCompoundNode<Type>& node) const {
+        out->append(Type == CompoundNodeType::AND ? "AND(" : "OR(");
+        for (const auto& child : node.children()) {
+            if (!child.visit(*this)) {
+                return false;
+            }
+        }
+        out->append(")");
+        return true;
+    }
+};
+
+std::string OlapChunkSource::_shared_scan_key(const std::vector<uint32_t>& reader_columns,
+                                              const std::vector<uint32_t>& scanner_columns) const {
+    // The consumers of a shared scan read the same rows in the same order as their own scans, so the scan
+    // depending on the query specific state, e.g. global dicts and runtime filters, can't be shared.
+    if (!config::enable_shared_scan || _limit != -1 || _params.rowid_range_option != nullptr ||
+        _params.short_key_ranges_option != nullptr || _params.use_pk_index || _params.sorted_by_keys_per_tablet ||
+        !_params.global_dictmaps->empty() || !_column_access_paths.empty() || !_unused_output_column_ids.empty() ||
+        !_scan_ctx->conjuncts_manager().unarrived_runtime_filters().unarrived_runtime_filters.empty() ||
+        !_params.runtime_filter_preds.empty()) {
+        return "";
+    }
+
+    std::vector<std::string> rowset_ids;
+    for (const auto& rowset : _morsel->rowsets()) {
+        rowset_ids.emplace_back(rowset->rowset_id().to_string());
+    }
+    std::string pushdown_predicates;
+    if (!_params.pred_tree.visit(SharedScanPredicateSerializer{&pushdown_predicates})) {
+        return "";
+    }
+    return fmt::format("{}|{}-{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}", _tablet->tablet_id(), _morsel->from_version(),
+                       _version, _tablet_schema->schema_version(), fmt::join(rowset_ids, ","),
+                       fmt::join(reader_columns, ","), fmt::join(scanner_columns, ","), _params.chunk_size,
+                       _scan_op->is_asc(), _params.prune_column_after_index_filter, _params.enable_gin_filter,
+                       _morsel->get_olap_scan_range()->__isset.gtid, _params.to_string(), pushdown_predicates);
+}
+
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
     chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size(),
                                                _runtime_state->use_column_pool()));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
-    return _read_chunk_from_storage(_runtime_state, (*chunk).get());
+    auto st = _read_chunk_from_storage(_runtime_state, (*chunk).get());
+    if (st.is_time_out()) {
+        // Waiting for the shared scan, yield the scan thread and output an empty chunk, see
+        // ChunkSource::buffer_next_batch_chunks_blocking.
+        chunk->reset();
+    }
+    return st;
 }
 
 const workgroup::WorkGroupScanSchedEntity* OlapChunkSource::_scan_sched_entity(const workgroup::WorkGroup* wg) const {
@@ -506,6 +657,24 @@ Status OlapChunkSource::_init_global_dicts(TabletReaderParams* params) {
     return Status::OK();
 }
 
+// The string columns read as the only key of the hash aggregations and the join probes keep their dict codes.
+void OlapChunkSource::_init_dict_code_columns() {
+    const auto& key_slots = _runtime_state->dict_code_key_slots();
+    if (key_slots.empty()) {
+        return;
+    }
+    for (auto slot : *_slots) {
+        if (key_slots.count(slot->id()) == 0 || !slot->type().is_string_type()) {
+            continue;
+        }
+        int32_t index = _tablet_schema->field_index(slot->col_name());
+        if (index >= 0) {
+            _dict_code_column_ids.insert(index);
+        }
+    }
+    _params.dict_code_column_ids = &_dict_code_column_ids;
+}
+
 Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, Chunk* chunk) {
     if (state->is_cancelled()) {
         return Status::Cancelled("canceled state");
@@ -513,7 +682,11 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, Chunk* chu
 
     do {
         RETURN_IF_ERROR(state->check_mem_limit("read chunk from storage"));
-        RETURN_IF_ERROR(_prj_iter->get_next(chunk));
+        if (_shared_scan) {
+            RETURN_IF_ERROR(_shared_scan->get_next(chunk));
+        } else {
+            RETURN_IF_ERROR(_prj_iter->get_next(chunk));
+        }
 
         TRY_CATCH_ALLOC_SCOPE_START()
 
@@ -613,6 +786,7 @@ void OlapChunkSource::_update_counter() {
 
     COUNTER_UPDATE(_read_pages_num_counter, _reader->stats().total_pages_num);
     COUNTER_UPDATE(_cached_pages_num_counter, _reader->stats().cached_pages_num);
+    COUNTER_UPDATE(_decoded_cached_pages_num_counter, _reader->stats().decoded_cached_pages_num);
 
     COUNTER_UPDATE(_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
@@ -642,6 +816,13 @@ void OlapChunkSource::_update_counter() {
         RuntimeProfile::Counter* c = ADD_CHILD_TIMER(_runtime_profile, "LateMaterialize", IO_TASK_EXEC_TIMER_NAME);
         COUNTER_UPDATE(c, _reader->stats().late_materialize_ns);
     }
+    if (_reader->stats().runtime_filter_evaluate_ns > 0) {
+        RuntimeProfile::Counter* c1 =
+                ADD_CHILD_TIMER(_runtime_profile, "SegmentRuntimeFilter", IO_TASK_EXEC_TIMER_NAME);
+        RuntimeProfile::Counter* c2 = ADD_COUNTER(_runtime_profile, "SegmentRuntimeFilterRows", TUnit::UNIT);
+        COUNTER_UPDATE(c1, _reader->stats().runtime_filter_evaluate_ns);
+        COUNTER_UPDATE(c2, _reader->stats().rows_runtime_filter_filtered);
+    }
     if (_reader->stats().del_filter_ns > 0) {
         RuntimeProfile::Counter* c1 = ADD_CHILD_TIMER(_runtime_profile, "DeleteFilter", IO_TASK_EXEC_TIMER_NAME);
         RuntimeProfile::Counter* c2 = ADD_COUNTER(_runtime_profile, "DeleteFilterRows", TUnit::UNIT);
@@ -20,6 +20,7 @@
 #include "exec/olap_scan_prepare.h"
 #include "exec/olap_utils.h"
 #include "exec/pipeline/scan/chunk_source.h"
+#include "exec/pipeline/scan/shared_scan.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
@@ -61,9 +62,14 @@ private:
     Status _init_scanner_columns(std::vector<uint32_t>& scanner_columns);
     Status _init_unused_output_columns(const std::vector<std::string>& unused_output_columns);
     Status _init_olap_reader(RuntimeState* state);
+    void _init_runtime_filter_predicates(const PredicateParser* parser);
+    // Return the key of the shared scan, or an empty string if the scan can't be shared with other queries.
+    std::string _shared_scan_key(const std::vector<uint32_t>& reader_columns,
+                                 const std::vector<uint32_t>& scanner_columns) const;
     TCounterMinMaxType::type _get_counter_min_max_type(const std::string& metric_name);
     void _init_counter(RuntimeState* state);
     Status _init_global_dicts(TabletReaderParams* params);
+    void _init_dict_code_columns();
     Status _read_chunk_from_storage([[maybe_unused]] RuntimeState* state, Chunk* chunk);
     void _update_counter();
     void _update_realtime_counter(Chunk* chunk);
@@ -98,8 +104,11 @@ private:
     std::shared_ptr<TabletReader> _reader;
     // projection iterator, doing the job of choosing |_scanner_columns| from |_reader_columns|.
     std::shared_ptr<ChunkIterator> _prj_iter;
+    // Read from the scan shared with the concurrent queries instead of |_prj_iter|, if it's not nullptr.
+    std::unique_ptr<SharedScanReader> _shared_scan;
 
     std::unordered_set<uint32_t> _unused_output_column_ids;
+    std::unordered_set<uint32_t> _dict_code_column_ids;
 
     // slot descriptors for each one of |output_columns|.
     std::vector<SlotDescriptor*> _query_slots;
@@ -146,6 +155,7 @@ private:
     RuntimeProfile::Counter* _block_fetch_timer = nullptr;
     RuntimeProfile::Counter* _read_pages_num_counter = nullptr;
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
+    RuntimeProfile::Counter* _decoded_cached_pages_num_counter = nullptr;
     RuntimeProfile::Counter* _bi_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bi_filter_timer = nullptr;
     RuntimeProfile::Counter* _gin_filtered_counter = nullptr;
@@ -160,6 +170,7 @@ private:
     RuntimeProfile::Counter* _json_flatten_timer = nullptr;
     RuntimeProfile::Counter* _access_path_hits_counter = nullptr;
     RuntimeProfile::Counter* _access_path_unhits_counter = nullptr;
+    RuntimeProfile::Counter* _shared_scan_rows_counter = nullptr;
 };
 } // namespace pipeline
 } // namespace starrocks
@@ -15,6 +15,8 @@
 #include "exec/pipeline/scan/olap_scan_prepare_operator.h"
 
 #include "exec/olap_scan_node.h"
+#include "exec/olap_scan_prepare.h"
+#include "storage/predicate_parser.h"
 #include "storage/storage_engine.h"
 
 namespace starrocks::pipeline {
@@ -82,6 +84,9 @@ StatusOr<ChunkPtr> OlapScanPrepareOperator::pull_chunk(RuntimeState* state) {
         }
     }
     _morsel_queue->set_tablet_rowsets(std::move(tablet_rowsets));
+    if (status.ok() && _morsel_queue->type() == MorselQueue::PHYSICAL_SPLIT && !_ctx->tablets().empty()) {
+        _set_morsel_queue_pred_tree();
+    }
 
     DeferOp defer([&]() {
         _ctx->set_prepare_finished();
@@ -104,6 +109,25 @@ StatusOr<ChunkPtr> OlapScanPrepareOperator::pull_chunk(RuntimeState* state) {
     }
 }
 
+void OlapScanPrepareOperator::_set_morsel_queue_pred_tree() {
+    auto tablet_schema = _ctx->tablets()[0]->tablet_schema();
+    PredicateParser parser(tablet_schema);
+    ColumnPredicatePtrs col_preds_owner;
+    auto pred_tree_or = _ctx->conjuncts_manager().get_predicate_tree(&parser, col_preds_owner);
+    if (!pred_tree_or.ok()) {
+        // The morsel queue only weights the rows by the predicates, and goes on without them.
+        VLOG_QUERY << "failed to get the predicates for the morsel queue: " << pred_tree_or.status();
+        return;
+    }
+
+    PredicateAndNode pushdown_pred_root;
+    PredicateAndNode non_pushdown_pred_root;
+    pred_tree_or.value().root().partition_copy([&parser](const auto& node) { return parser.can_pushdown(node); },
+                                               &pushdown_pred_root, &non_pushdown_pred_root);
+    _morsel_queue->set_pred_tree(tablet_schema, PredicateTree::create(std::move(pushdown_pred_root)),
+                                 std::move(col_preds_owner));
+}
+
 /// OlapScanPrepareOperatorFactory
 OlapScanPrepareOperatorFactory::OlapScanPrepareOperatorFactory(int32_t id, int32_t plan_node_id,
                                                                OlapScanNode* const scan_node,
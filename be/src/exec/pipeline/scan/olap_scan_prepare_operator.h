@@ -41,6 +41,9 @@ public:
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
 private:
+    // Pass the predicates pushed down to the storage layer to the morsel queue, to estimate the cost of the rows.
+    void _set_morsel_queue_pred_tree();
+
     OlapScanContextPtr _ctx;
 };
 
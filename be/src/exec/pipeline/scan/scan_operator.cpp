@@ -347,6 +347,9 @@ Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
 
 void ScanOperator::_close_chunk_source_unlocked(RuntimeState* state, int chunk_source_index) {
     if (_chunk_sources[chunk_source_index] != nullptr) {
+        if (_chunk_sources[chunk_source_index]->reach_eos() && !_chunk_sources[chunk_source_index]->reach_limit()) {
+            _morsel_queue->finish_morsel(_driver_sequence, _chunk_sources[chunk_source_index]->morsel());
+        }
         _chunk_sources[chunk_source_index]->close(state);
         _chunk_sources[chunk_source_index] = nullptr;
         detach_chunk_source(chunk_source_index);
@@ -489,7 +492,7 @@ Status ScanOperator::_pickup_morsel(RuntimeState* state, int chunk_source_index)
     ASSIGN_OR_RETURN(auto ready, _morsel_queue->ready_for_next());
     RETURN_IF(!ready, Status::OK());
 
-    ASSIGN_OR_RETURN(auto morsel, _morsel_queue->try_get());
+    ASSIGN_OR_RETURN(auto morsel, _morsel_queue->try_get_for_driver(_driver_sequence));
 
     if (_lane_arbiter != nullptr) {
         while (morsel != nullptr) {
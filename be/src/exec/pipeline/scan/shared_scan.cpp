@@ -0,0 +1,276 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/shared_scan.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "column/chunk.h"
+#include "common/logging.h"
+#include "storage/chunk_helper.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+SharedScanCursor::SharedScanCursor(SharedScanManager* manager, std::string key, ChunkIteratorPtr iter,
+                                   size_t chunk_size, size_t max_buffered_chunks, int64_t max_wait_ms)
+        : _manager(manager),
+          _key(std::move(key)),
+          _chunk_size(chunk_size),
+          _max_buffered_chunks(std::max<size_t>(max_buffered_chunks, 1)),
+          _max_wait_ns(max_wait_ms * 1000000L),
+          _iter(std::move(iter)),
+          _positions{0},
+          _wait_start_ns{0} {}
+
+SharedScanCursor::~SharedScanCursor() {
+    _manager->_remove(_key);
+}
+
+bool SharedScanCursor::try_attach(int* consumer_id, int64_t* start_row) {
+    std::lock_guard l(_mutex);
+    if (_iter == nullptr || !_status.ok()) {
+        return false;
+    }
+    *consumer_id = static_cast<int>(_positions.size());
+    *start_row = _first_row;
+    _positions.push_back(_first_seq);
+    _wait_start_ns.push_back(0);
+    return true;
+}
+
+void SharedScanCursor::detach(int consumer_id) {
+    std::lock_guard l(_mutex);
+    _positions[consumer_id] = -1;
+    if (consumer_id == kOwnerId) {
+        // Only the owner reads from the iterator, so nobody is using it now.
+        _iter.reset();
+    }
+    _trim_buffer();
+}
+
+size_t SharedScanCursor::num_consumers() const {
+    std::lock_guard l(_mutex);
+    return std::count_if(_positions.begin(), _positions.end(), [](int64_t pos) { return pos >= 0; });
+}
+
+void SharedScanCursor::_trim_buffer() {
+    int64_t min_pos = std::numeric_limits<int64_t>::max();
+    for (int64_t pos : _positions) {
+        if (pos >= 0) {
+            min_pos = std::min(min_pos, pos);
+        }
+    }
+    while (!_chunks.empty() && _first_seq < min_pos) {
+        _first_row += _chunks.front()->num_rows();
+        _chunks.pop_front();
+        ++_first_seq;
+    }
+}
+
+void SharedScanCursor::_detach_slowest_consumers() {
+    for (size_t i = 0; i < _positions.size(); i++) {
+        if (_positions[i] == _first_seq) {
+            DCHECK_NE(kOwnerId, static_cast<int>(i));
+            _positions[i] = -1;
+        }
+    }
+    _trim_buffer();
+}
+
+bool SharedScanCursor::_wait_timed_out(int consumer_id) {
+    const int64_t now = MonotonicNanos();
+    int64_t& start = _wait_start_ns[consumer_id];
+    if (start == 0) {
+        start = now;
+    }
+    return now - start >= _max_wait_ns;
+}
+
+StatusOr<ChunkPtr> SharedScanCursor::get_next(int consumer_id) {
+    std::unique_lock l(_mutex);
+    int64_t& pos = _positions[consumer_id];
+    if (pos < 0) {
+        return nullptr;
+    }
+    if (pos < _first_seq + static_cast<int64_t>(_chunks.size())) {
+        ChunkPtr chunk = _chunks[pos - _first_seq];
+        ++pos;
+        _wait_start_ns[consumer_id] = 0;
+        _trim_buffer();
+        return chunk;
+    }
+
+    // The consumer has consumed all the buffered chunks.
+    if (_status.is_end_of_file()) {
+        return _status;
+    }
+    if (!_status.ok() || _iter == nullptr) {
+        if (consumer_id == kOwnerId) {
+            return _status;
+        }
+        // The scan has failed or been abandoned by the owner, the others read by themselves.
+        pos = -1;
+        _trim_buffer();
+        return nullptr;
+    }
+    if (consumer_id == kOwnerId) {
+        return _read_by_owner(l);
+    }
+    if (_wait_timed_out(consumer_id)) {
+        // The owner is too slow, e.g. its query is throttled by its workgroup, so read the rest rows by itself
+        // instead of waiting for it any more.
+        pos = -1;
+        _trim_buffer();
+        return nullptr;
+    }
+    // Wait for the owner to read the next chunk, yield the scan thread instead of blocking it.
+    return Status::TimedOut("wait for the owner of the shared scan");
+}
+
+StatusOr<ChunkPtr> SharedScanCursor::_read_by_owner(std::unique_lock<std::mutex>& l) {
+    if (_chunks.size() >= _max_buffered_chunks) {
+        // Wait for the slow consumers for a while, then leave them behind.
+        // The owner has consumed all the buffered chunks, so it's never the slowest one.
+        if (!_wait_timed_out(kOwnerId)) {
+            return Status::TimedOut("wait for the slow consumers of the shared scan");
+        }
+        _detach_slowest_consumers();
+    }
+    _wait_start_ns[kOwnerId] = 0;
+
+    // The iterator is only used and released by the owner, so it's safe to read out of the lock.
+    ChunkIterator* iter = _iter.get();
+    l.unlock();
+    ChunkPtr chunk = ChunkHelper::new_chunk(iter->output_schema(), _chunk_size);
+    Status st = iter->get_next(chunk.get());
+    l.lock();
+
+    if (!st.ok()) {
+        _status = st;
+        return st;
+    }
+    _chunks.emplace_back(chunk);
+    ++_positions[kOwnerId];
+    _trim_buffer();
+    return chunk;
+}
+
+SharedScanReader::SharedScanReader(SharedScanCursorPtr cursor, int consumer_id, bool is_owner, int64_t start_row,
+                                   ChunkIterator* own_iter)
+        : _cursor(std::move(cursor)),
+          _consumer_id(consumer_id),
+          _is_owner(is_owner),
+          _start_row(start_row),
+          _own_iter(own_iter) {
+    DCHECK(!_is_owner || _start_row == 0);
+}
+
+SharedScanReader::~SharedScanReader() {
+    close();
+}
+
+void SharedScanReader::close() {
+    if (_cursor != nullptr) {
+        _cursor->detach(_consumer_id);
+        _cursor.reset();
+    }
+}
+
+Status SharedScanReader::get_next(Chunk* chunk) {
+    if (_cursor != nullptr) {
+        auto res = _cursor->get_next(_consumer_id);
+        if (res.ok() && res.value() != nullptr) {
+            const auto& shared_chunk = res.value();
+            chunk->append(*shared_chunk);
+            _num_shared_rows += shared_chunk->num_rows();
+            return Status::OK();
+        }
+        if (!res.ok() && !res.status().is_end_of_file()) {
+            return res.status();
+        }
+
+        // Read the rows not received from the cursor by the own iterator.
+        _skip_begin = _start_row;
+        _skip_end = res.ok() ? _start_row + _num_shared_rows : std::numeric_limits<int64_t>::max();
+        close();
+    }
+    return _get_next_from_own_iter(chunk);
+}
+
+Status SharedScanReader::_get_next_from_own_iter(Chunk* chunk) {
+    do {
+        if (_next_row >= _skip_begin && _skip_end == std::numeric_limits<int64_t>::max()) {
+            return Status::EndOfFile("end of shared scan");
+        }
+        RETURN_IF_ERROR(_own_iter->get_next(chunk));
+
+        const int64_t num_rows = chunk->num_rows();
+        const int64_t begin = std::max(_next_row, _skip_begin);
+        const int64_t end = std::min(_next_row + num_rows, _skip_end);
+        if (begin < end) {
+            _selection.assign(num_rows, 1);
+            std::fill(_selection.begin() + (begin - _next_row), _selection.begin() + (end - _next_row), 0);
+            chunk->filter(_selection);
+        }
+        _next_row += num_rows;
+    } while (chunk->num_rows() == 0);
+    return Status::OK();
+}
+
+SharedScanManager* SharedScanManager::instance() {
+    static SharedScanManager s_manager;
+    return &s_manager;
+}
+
+std::unique_ptr<SharedScanReader> SharedScanManager::attach(const std::string& key, const ChunkIteratorPtr& iter,
+                                                            size_t chunk_size, size_t max_buffered_chunks,
+                                                            int64_t max_wait_ms) {
+    // Release the finished cursor out of the lock, because its destructor removes it from _cursors.
+    SharedScanCursorPtr finished_cursor;
+    std::lock_guard l(_mutex);
+    auto it = _cursors.find(key);
+    if (it != _cursors.end()) {
+        if (auto cursor = it->second.lock(); cursor != nullptr) {
+            int consumer_id;
+            int64_t start_row;
+            if (cursor->try_attach(&consumer_id, &start_row)) {
+                return std::make_unique<SharedScanReader>(std::move(cursor), consumer_id, false, start_row,
+                                                          iter.get());
+            }
+            finished_cursor = std::move(cursor);
+        }
+    }
+
+    auto cursor = std::make_shared<SharedScanCursor>(this, key, iter, chunk_size, max_buffered_chunks, max_wait_ms);
+    _cursors[key] = cursor;
+    return std::make_unique<SharedScanReader>(std::move(cursor), 0, true, 0, iter.get());
+}
+
+size_t SharedScanManager::num_cursors() const {
+    std::lock_guard l(_mutex);
+    return _cursors.size();
+}
+
+void SharedScanManager::_remove(const std::string& key) {
+    std::lock_guard l(_mutex);
+    auto it = _cursors.find(key);
+    // The entry may have been replaced by a new cursor of the same key.
+    if (it != _cursors.end() && it->second.expired()) {
+        _cursors.erase(it);
+    }
+}
+
+} // namespace starrocks::pipeline
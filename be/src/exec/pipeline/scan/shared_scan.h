@@ -0,0 +1,165 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "storage/chunk_iterator.h"
+
+namespace starrocks::pipeline {
+
+class SharedScanManager;
+class SharedScanReader;
+
+// SharedScanCursor is a scan of a tablet shared by the concurrent OlapChunkSources, which read the same rowsets
+// with the same columns and the same pushed-down predicates, e.g. the identical queries of a dashboard.
+// The chunks read from the storage are buffered and consumed by every consumer, so the pages are read, decompressed
+// and decoded only once, and each consumer applies its own not pushed-down predicates to its copy of the chunks.
+//
+// The storage iterator belongs to the consumer which starts the scan (the owner), and only the owner reads the next
+// chunk from it, so the IO and the memory of the shared scan are charged to the query and the workgroup of the owner.
+// A consumer may attach to the cursor at any time before the scan finishes, it starts from the oldest buffered
+// chunk, and reads the skipped rows by its own iterator afterwards.
+//
+// When the buffer is full, the owner waits for the slowest consumers for a while, and then the slowest ones are
+// detached from the cursor. A consumer reaching the end of the buffer also waits for the owner for a while, and
+// is detached if the owner is too slow or has finished before the end of the scan. Then it reads the rest rows
+// by its own iterator, which outputs the same rows in the same order as the shared one.
+// The consumers don't block the scan threads, which are shared by the queries of all the workgroups, when they
+// wait, they get TimedOut to yield the thread and try again later.
+class SharedScanCursor {
+public:
+    SharedScanCursor(SharedScanManager* manager, std::string key, ChunkIteratorPtr iter, size_t chunk_size,
+                     size_t max_buffered_chunks, int64_t max_wait_ms);
+    ~SharedScanCursor();
+
+    const std::string& key() const { return _key; }
+
+    // Return false if the scan has been finished or abandoned, and a new consumer can't attach to it any more.
+    // Otherwise, |start_row| is the ordinal of the first row the new consumer will read from the cursor.
+    bool try_attach(int* consumer_id, int64_t* start_row);
+
+    // Once the owner is detached, the iterator is released and the others will read by themselves.
+    void detach(int consumer_id);
+
+    // Return the next chunk of the consumer, which is shared by the consumers and can't be modified.
+    // - nullptr: the consumer has been detached and should read the rest rows by itself.
+    // - EndOfFile: all the rows have been read.
+    // - TimedOut: the owner hasn't read the next chunk, or the slow consumers haven't made room in the buffer,
+    //   call it again later. The consumer waits at most max_wait_ms in total, then it gives up the waiting.
+    StatusOr<ChunkPtr> get_next(int consumer_id);
+
+    size_t num_consumers() const;
+
+private:
+    static constexpr int kOwnerId = 0;
+
+    void _trim_buffer();
+    // Start the waiting of the consumer if it's not started, and return whether it has waited for max_wait_ms.
+    bool _wait_timed_out(int consumer_id);
+    // Detach the consumers which hold the oldest buffered chunk.
+    void _detach_slowest_consumers();
+    // Read the next chunk from the storage by the owner.
+    StatusOr<ChunkPtr> _read_by_owner(std::unique_lock<std::mutex>& l);
+
+    SharedScanManager* const _manager;
+    const std::string _key;
+    const size_t _chunk_size;
+    const size_t _max_buffered_chunks;
+    const int64_t _max_wait_ns;
+
+    mutable std::mutex _mutex;
+    // Set nullptr once the owner is detached.
+    ChunkIteratorPtr _iter;
+    // EndOfFile or the error status of _iter.
+    Status _status;
+
+    std::deque<ChunkPtr> _chunks;
+    // The sequence of _chunks.front() and the ordinal of its first row.
+    int64_t _first_seq = 0;
+    int64_t _first_row = 0;
+    // The sequence of the next chunk of each consumer, -1 means the consumer has been detached.
+    std::vector<int64_t> _positions;
+    // When each consumer starts waiting, 0 if it's not waiting.
+    std::vector<int64_t> _wait_start_ns;
+};
+
+using SharedScanCursorPtr = std::shared_ptr<SharedScanCursor>;
+
+// SharedScanReader reads the rows of a consumer from SharedScanCursor, and the rows not received from the
+// cursor by the consumer's own iterator.
+class SharedScanReader {
+public:
+    SharedScanReader(SharedScanCursorPtr cursor, int consumer_id, bool is_owner, int64_t start_row,
+                     ChunkIterator* own_iter);
+    ~SharedScanReader();
+
+    // Append the next rows to |chunk|. Return TimedOut if it's waiting for the cursor, see SharedScanCursor::get_next.
+    Status get_next(Chunk* chunk);
+
+    // Detach from the cursor.
+    void close();
+
+    bool is_owner() const { return _is_owner; }
+    // The number of rows received from the cursor.
+    int64_t num_shared_rows() const { return _num_shared_rows; }
+
+private:
+    Status _get_next_from_own_iter(Chunk* chunk);
+
+    SharedScanCursorPtr _cursor;
+    const int _consumer_id;
+    const bool _is_owner;
+    const int64_t _start_row;
+    ChunkIterator* const _own_iter;
+
+    int64_t _num_shared_rows = 0;
+
+    // After detached from the cursor, the own iterator skips the rows in [_skip_begin, _skip_end),
+    // which have been received from the cursor.
+    int64_t _skip_begin = 0;
+    int64_t _skip_end = 0;
+    // The ordinal of the next row of the own iterator.
+    int64_t _next_row = 0;
+    Filter _selection;
+};
+
+class SharedScanManager {
+public:
+    static SharedScanManager* instance();
+
+    // Attach to the in-flight scan of |key|, or start a new scan reading from |iter| if there isn't one.
+    // |iter| must output the same rows in the same order for the same |key|.
+    std::unique_ptr<SharedScanReader> attach(const std::string& key, const ChunkIteratorPtr& iter, size_t chunk_size,
+                                             size_t max_buffered_chunks, int64_t max_wait_ms);
+
+    size_t num_cursors() const;
+
+private:
+    friend class SharedScanCursor;
+    void _remove(const std::string& key);
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::weak_ptr<SharedScanCursor>> _cursors;
+};
+
+} // namespace starrocks::pipeline
@@ -16,7 +16,9 @@
 
 #include <fmt/format.h>
 
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/pipeline/query_context.h"
 #include "gen_cpp/MVMaintenance_types.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/exec_env.h"
@@ -104,6 +106,24 @@ Status StreamEpochManager::prepare(const MVMaintenanceTaskInfo& maintenance_task
     for (auto* fragment_ctx : fragment_ctxs) {
         _enable_resource_group &= fragment_ctx->enable_resource_group();
         _num_drivers += fragment_ctx->total_dop();
+        _fragment_instance_ids.emplace_back(fragment_ctx->fragment_instance_id());
+    }
+    return Status::OK();
+}
+
+Status StreamEpochManager::publish_epoch(QueryContext* query_ctx, int64_t epoch_id) {
+    std::vector<TUniqueId> fragment_instance_ids;
+    {
+        std::shared_lock<std::shared_mutex> l(_epoch_lock);
+        fragment_instance_ids = _fragment_instance_ids;
+    }
+    for (auto& fragment_instance_id : fragment_instance_ids) {
+        auto fragment_ctx = query_ctx->fragment_mgr()->get(fragment_instance_id);
+        if (!fragment_ctx) {
+            return Status::InternalError(fmt::format("Publish epoch failed: fragment_instance_id {} is not found.",
+                                                     print_id(fragment_instance_id)));
+        }
+        RETURN_IF_ERROR(fragment_ctx->publish_epoch(epoch_id));
     }
     return Status::OK();
 }
@@ -113,7 +133,9 @@ const MVMaintenanceTaskInfo& StreamEpochManager::maintenance_task_info() const {
     return _maintenance_task_info;
 }
 
-Status StreamEpochManager::set_finished(ExecEnv* exec_env, const QueryContext* query_ctx) {
+Status StreamEpochManager::set_finished(ExecEnv* exec_env, const QueryContext* query_ctx, bool drop_state) {
+    // Must be set before `_is_finished`, which makes the drivers finish and close their operators.
+    _is_state_dropped.store(drop_state, std::memory_order_release);
     _is_finished.store(true, std::memory_order_release);
     // Activate parked drivers must be at the last!
     return activate_parked_driver(exec_env, query_ctx->query_id(), _num_drivers, _enable_resource_group);
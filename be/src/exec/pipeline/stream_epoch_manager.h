@@ -55,11 +55,14 @@ public:
                                      const ScanRangeInfo& scan_info);
     [[nodiscard]] Status prepare(const MVMaintenanceTaskInfo& maintenance_task_info,
                                  const std::vector<FragmentContext*>& fragment_ctxs);
+    // Publish the finished epoch to the fragment instances after FE commits it.
+    [[nodiscard]] Status publish_epoch(QueryContext* query_ctx, int64_t epoch_id);
     [[nodiscard]] Status update_binlog_offset(const TUniqueId& fragment_instance_id, int64_t scan_node_id,
                                               int64_t tablet_id, BinlogOffset binlog_offset);
     [[nodiscard]] Status activate_parked_driver(ExecEnv* exec_env, const TUniqueId& query_id,
                                                 int64_t expected_num_drivers, bool enable_resource_group);
-    [[nodiscard]] Status set_finished(ExecEnv* exec_env, const QueryContext* query_ctx);
+    // `drop_state` is true if the MV is dropped, then the operators remove their persistent states when closed.
+    [[nodiscard]] Status set_finished(ExecEnv* exec_env, const QueryContext* query_ctx, bool drop_state = false);
 
     const BinlogOffset* get_binlog_offset(const TUniqueId& fragment_instance_id, int64_t scan_node_id,
                                           int64_t tablet_id) const;
@@ -68,6 +71,7 @@ public:
     const MVMaintenanceTaskInfo& maintenance_task_info() const;
 
     bool is_finished() const { return _is_finished.load(std::memory_order_acquire); }
+    bool is_state_dropped() const { return _is_state_dropped.load(std::memory_order_acquire); }
     void count_down_fragment_ctx(RuntimeState* state, FragmentContext* fragment_ctx, size_t val = 1);
     bool enable_resource_group() const { return _enable_resource_group; }
 
@@ -78,10 +82,13 @@ private:
 private:
     mutable std::shared_mutex _epoch_lock;
     std::atomic_bool _is_finished{false};
+    std::atomic_bool _is_state_dropped{false};
     EpochInfo _epoch_info;
     MVMaintenanceTaskInfo _maintenance_task_info;
     std::unordered_map<TUniqueId, NodeId2ScanRanges> _fragment_id_to_node_id_scan_ranges;
     std::vector<FragmentContext*> _finished_fragment_ctxs;
+    // All the fragment instances of the MV job in this BE.
+    std::vector<TUniqueId> _fragment_instance_ids;
     bool _enable_resource_group = true;
     int64_t _num_drivers = 0;
 };
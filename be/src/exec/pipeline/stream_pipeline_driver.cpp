@@ -324,6 +324,13 @@ Status StreamPipelineDriver::reset_epoch(RuntimeState* runtime_state) {
     return Status::OK();
 }
 
+Status StreamPipelineDriver::publish_epoch(RuntimeState* runtime_state, int64_t epoch_id) {
+    for (auto& op : _operators) {
+        RETURN_IF_ERROR(op->publish_epoch(runtime_state, epoch_id));
+    }
+    return Status::OK();
+}
+
 void StreamPipelineDriver::epoch_finalize(RuntimeState* runtime_state, DriverState state) {
     int64_t time_spent = 0;
     DeferOp defer([this, &time_spent]() {
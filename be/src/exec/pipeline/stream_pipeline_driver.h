@@ -40,6 +40,7 @@ public:
 
     void epoch_finalize(RuntimeState* runtime_state, DriverState state);
     [[nodiscard]] Status reset_epoch(RuntimeState* state);
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id);
 
 private:
     StatusOr<DriverState> _handle_finish_operators(RuntimeState* runtime_state);
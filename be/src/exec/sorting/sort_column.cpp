@@ -17,6 +17,7 @@
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
+#include "column/binary_view.h"
 #include "column/chunk.h"
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -101,12 +102,13 @@ public:
     template <typename T>
     Status do_visit(const BinaryColumnBase<T>& column) {
         DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
+        // Inline the strings as BinaryView, most of the comparisons are decided by the prefixes.
+        using ItemType = InlinePermuteItem<BinaryView>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_proxy_data());
+        auto inlined = create_inline_permutation<BinaryView>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(
                 sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
         restore_inline_permutation(inlined, _permutation);
@@ -212,7 +214,7 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
+            using ItemType = CompactChunkItem<BinaryView>;
             using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
 
             auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
@@ -225,7 +227,7 @@ public:
                 containers.push_back(&real->get_proxy_data());
             }
 
-            auto inlined = _create_inlined_permutation<Slice>(containers);
+            auto inlined = _create_inlined_permutation<BinaryView>(containers);
             RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
                                                 _build_tie, _limit, &_pruned_limit));
             _restore_inlined_permutation(inlined);
@@ -476,6 +478,19 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
     return Status::OK();
 }
 
+// Stable sort need extra runs of sorting on permutation
+static void stable_sort_ties(const Tie& tie, SmallPermutation* small_perm) {
+    TieIterator ti(tie);
+    while (ti.next()) {
+        int range_first = ti.range_first, range_last = ti.range_last;
+        if (range_last - range_first > 1) {
+            ::pdqsort(
+                    small_perm->begin() + range_first, small_perm->begin() + range_last,
+                    [](SmallPermuteItem lhs, SmallPermuteItem rhs) { return lhs.index_in_chunk < rhs.index_in_chunk; });
+        }
+    }
+}
+
 Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                                    SmallPermutation* small_perm) {
     if (columns.size() < 1) {
@@ -492,17 +507,27 @@ Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Column
                                             range, true));
     }
 
-    // Stable sort need extra runs of sorting on permutation
-    TieIterator ti(tie);
-    while (ti.next()) {
-        int range_first = ti.range_first, range_last = ti.range_last;
-        if (range_last - range_first > 1) {
-            ::pdqsort(
-                    small_perm->begin() + range_first, small_perm->begin() + range_last,
-                    [](SmallPermuteItem lhs, SmallPermuteItem rhs) { return lhs.index_in_chunk < rhs.index_in_chunk; });
-        }
+    stable_sort_ties(tie, small_perm);
+    return Status::OK();
+}
+
+Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                                   std::pair<int, int> range, SmallPermutation* small_perm) {
+    *small_perm = create_small_permutation(range);
+    if (columns.size() < 1) {
+        return Status::OK();
+    }
+    int num_rows = range.second - range.first;
+    Tie tie(num_rows, 1);
+
+    for (int col_index = 0; col_index < columns.size(); col_index++) {
+        // Don't fill the nulls of the column, which is shared by the other ranges.
+        const ColumnPtr& column = columns[col_index];
+        RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), *small_perm, tie,
+                                            {0, num_rows}, true));
     }
 
+    stable_sort_ties(tie, small_perm);
     return Status::OK();
 }
 
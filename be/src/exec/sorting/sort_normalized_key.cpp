@@ -0,0 +1,388 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstring>
+
+#include "column/binary_column.h"
+#include "column/column_visitor_adapter.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/json_column.h"
+#include "column/nullable_column.h"
+#include "exec/sorting/sort_helper.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
+#include "runtime/decimalv2_value.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+#include "util/orlp/pdqsort.h"
+
+namespace starrocks {
+
+// Normalized key of a row is the concatenation of the sort columns encoded into bytes, so that comparing
+// the normalized keys with memcmp gives the same order as comparing the columns one by one.
+// For each column:
+//  - nullable column: one byte for null, 0 for the null at the head, 1 for the null at the tail.
+//  - integer, date, datetime and decimal: big-endian with the sign bit flipped.
+//  - float and double: the sign bit flipped for positive values, all bits flipped for negative values.
+//  - binary: the first kStringPrefixSize bytes padded with zeros, and one byte for the length, which is
+//    kStringPrefixSize + 1 for the longer strings. The columns after the first binary column are not encoded,
+//    otherwise they would order the rows tie on a truncated prefix. The rows tie on the normalized keys are
+//    compared on the columns afterwards.
+// The value bytes are inverted for descending order.
+static constexpr size_t kStringPrefixSize = 12;
+// Sorting by longer keys copies too much, leave them to the column-wise sort.
+static constexpr size_t kMaxNormalizedKeySize = 128;
+// Buckets smaller than this are sorted by insertion sort.
+static constexpr size_t kInsertionSortThreshold = 24;
+
+template <typename U>
+static inline void store_big_endian(U value, uint8_t* dst) {
+    if constexpr (sizeof(U) == 1) {
+        dst[0] = value;
+    } else if constexpr (sizeof(U) == 2) {
+        value = __builtin_bswap16(value);
+        memcpy(dst, &value, sizeof(U));
+    } else if constexpr (sizeof(U) == 4) {
+        value = __builtin_bswap32(value);
+        memcpy(dst, &value, sizeof(U));
+    } else if constexpr (sizeof(U) == 8) {
+        value = __builtin_bswap64(value);
+        memcpy(dst, &value, sizeof(U));
+    } else {
+        static_assert(sizeof(U) == 16);
+        store_big_endian<uint64_t>(static_cast<uint64_t>(value >> 64), dst);
+        store_big_endian<uint64_t>(static_cast<uint64_t>(value), dst + 8);
+    }
+}
+
+template <typename T>
+struct NormalizedKeyTraits {
+    static constexpr bool supported = false;
+    static constexpr size_t size = 0;
+};
+
+template <typename T>
+requires(std::is_integral_v<T> && sizeof(T) <= 8) struct NormalizedKeyTraits<T> {
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(T);
+
+    static void encode(T value, uint8_t* dst) {
+        auto bits = static_cast<std::make_unsigned_t<T>>(value);
+        if constexpr (std::is_signed_v<T>) {
+            bits ^= std::make_unsigned_t<T>(1) << (sizeof(T) * 8 - 1);
+        }
+        store_big_endian(bits, dst);
+    }
+};
+
+template <>
+struct NormalizedKeyTraits<int128_t> {
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(int128_t);
+
+    static void encode(int128_t value, uint8_t* dst) {
+        auto bits = static_cast<uint128_t>(value) ^ (static_cast<uint128_t>(1) << 127);
+        store_big_endian(bits, dst);
+    }
+};
+
+template <typename T>
+requires std::is_floating_point_v<T> struct NormalizedKeyTraits<T> {
+    using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(T);
+
+    static void encode(T value, uint8_t* dst) {
+        // Keep consistent with SorterComparator, NaN equals to 0, and -0.0 equals to 0.0.
+        if (std::isnan(value) || value == 0) {
+            value = 0;
+        }
+        UnsignedType bits;
+        memcpy(&bits, &value, sizeof(T));
+        constexpr UnsignedType sign = UnsignedType(1) << (sizeof(T) * 8 - 1);
+        bits = (bits & sign) ? ~bits : (bits | sign);
+        store_big_endian(bits, dst);
+    }
+};
+
+template <>
+struct NormalizedKeyTraits<DateValue> {
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(JulianDate);
+    static void encode(DateValue value, uint8_t* dst) { NormalizedKeyTraits<JulianDate>::encode(value.julian(), dst); }
+};
+
+template <>
+struct NormalizedKeyTraits<TimestampValue> {
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(Timestamp);
+    static void encode(TimestampValue value, uint8_t* dst) {
+        NormalizedKeyTraits<Timestamp>::encode(value.timestamp(), dst);
+    }
+};
+
+template <>
+struct NormalizedKeyTraits<DecimalV2Value> {
+    static constexpr bool supported = true;
+    static constexpr size_t size = sizeof(int128_t);
+    static void encode(const DecimalV2Value& value, uint8_t* dst) {
+        NormalizedKeyTraits<int128_t>::encode(value.value(), dst);
+    }
+};
+
+// Encode one sort column into the normalized keys, or only compute its size if keys is null.
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    NormalizedKeyEncoder(const SortDesc& sort_desc, uint8_t* keys, size_t key_stride, std::vector<uint8_t>* truncated)
+            : ColumnVisitorAdapter(this),
+              _sort_desc(sort_desc),
+              _keys(keys),
+              _key_stride(key_stride),
+              _truncated(truncated) {}
+
+    size_t size() const { return _size; }
+    // Whether the values may be truncated, then the columns after it can't be encoded.
+    bool is_truncatable() const { return _is_truncatable; }
+
+    Status do_visit(const NullableColumn& column) {
+        if (_keys != nullptr) {
+            const NullData& null_data = column.immutable_null_column_data();
+            uint8_t null_byte = _sort_desc.is_null_first() ? 0 : 1;
+            for (size_t i = 0; i < column.size(); i++) {
+                _keys[i * _key_stride] = null_data[i] ? null_byte : 1 - null_byte;
+            }
+            _null_data = column.has_null() ? null_data.data() : nullptr;
+            _keys++;
+        }
+        _size++;
+        return column.data_column_ref().accept(this);
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        _size += kStringPrefixSize + 1;
+        _is_truncatable = true;
+        if (_keys == nullptr) {
+            return Status::OK();
+        }
+        for (size_t i = 0; i < column.size(); i++) {
+            if (_is_null(i)) {
+                continue;
+            }
+            Slice value = column.get_slice(i);
+            uint8_t* dst = _keys + i * _key_stride;
+            memcpy(dst, value.data, std::min(value.size, kStringPrefixSize));
+            if (value.size > kStringPrefixSize) {
+                dst[kStringPrefixSize] = kStringPrefixSize + 1;
+                (*_truncated)[i] = 1;
+            } else {
+                dst[kStringPrefixSize] = value.size;
+            }
+            _invert_if_desc(dst, kStringPrefixSize + 1);
+        }
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        using Traits = NormalizedKeyTraits<T>;
+        if constexpr (!Traits::supported) {
+            return Status::NotSupported("normalized key is not supported");
+        } else {
+            _size += Traits::size;
+            if (_keys == nullptr) {
+                return Status::OK();
+            }
+            const auto& data = column.get_data();
+            for (size_t i = 0; i < column.size(); i++) {
+                if (_is_null(i)) {
+                    continue;
+                }
+                uint8_t* dst = _keys + i * _key_stride;
+                Traits::encode(data[i], dst);
+                _invert_if_desc(dst, Traits::size);
+            }
+            return Status::OK();
+        }
+    }
+
+    Status do_visit(const ConstColumn& column) { return Status::NotSupported("normalized key is not supported"); }
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("normalized key is not supported"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("normalized key is not supported"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("normalized key is not supported"); }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("normalized key is not supported");
+    }
+
+private:
+    bool _is_null(size_t row) const { return _null_data != nullptr && _null_data[row]; }
+
+    void _invert_if_desc(uint8_t* dst, size_t size) const {
+        if (!_sort_desc.asc_order()) {
+            for (size_t i = 0; i < size; i++) {
+                dst[i] = ~dst[i];
+            }
+        }
+    }
+
+    const SortDesc _sort_desc;
+    uint8_t* _keys;
+    const size_t _key_stride;
+    std::vector<uint8_t>* _truncated;
+    const uint8_t* _null_data = nullptr;
+    size_t _size = 0;
+    bool _is_truncatable = false;
+};
+
+// Sort the entries with the key in [offset, key_size) by insertion sort.
+static void insertion_sort(uint8_t* entries, size_t count, size_t entry_size, size_t key_size, size_t offset,
+                           uint8_t* swap) {
+    for (size_t i = 1; i < count; i++) {
+        memcpy(swap, entries + i * entry_size, entry_size);
+        size_t j = i;
+        while (j > 0 && memcmp(entries + (j - 1) * entry_size + offset, swap + offset, key_size - offset) > 0) {
+            memcpy(entries + j * entry_size, entries + (j - 1) * entry_size, entry_size);
+            j--;
+        }
+        memcpy(entries + j * entry_size, swap, entry_size);
+    }
+}
+
+// MSD radix sort of the entries by the key byte at offset, recursive into each bucket with the next byte.
+static Status msd_radix_sort(const std::atomic<bool>& cancel, uint8_t* entries, uint8_t* tmp, size_t count,
+                             size_t entry_size, size_t key_size, size_t offset, uint8_t* swap) {
+    uint32_t counts[256];
+    while (true) {
+        if (count <= kInsertionSortThreshold) {
+            insertion_sort(entries, count, entry_size, key_size, offset, swap);
+            return Status::OK();
+        }
+        if (offset >= key_size) {
+            return Status::OK();
+        }
+        memset(counts, 0, sizeof(counts));
+        for (size_t i = 0; i < count; i++) {
+            counts[entries[i * entry_size + offset]]++;
+        }
+        // All entries are in one bucket, go on with the next byte without moving them.
+        if (counts[entries[offset]] == count) {
+            offset++;
+            continue;
+        }
+        break;
+    }
+
+    uint32_t positions[256];
+    uint32_t start = 0;
+    for (size_t b = 0; b < 256; b++) {
+        positions[b] = start;
+        start += counts[b];
+    }
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* entry = entries + i * entry_size;
+        memcpy(tmp + positions[entry[offset]]++ * entry_size, entry, entry_size);
+    }
+    memcpy(entries, tmp, count * entry_size);
+
+    if (offset + 1 >= key_size) {
+        return Status::OK();
+    }
+    start = 0;
+    for (size_t b = 0; b < 256; b++) {
+        if (counts[b] > 1) {
+            if (cancel.load(std::memory_order_acquire)) {
+                return Status::Cancelled("Sort cancelled");
+            }
+            RETURN_IF_ERROR(msd_radix_sort(cancel, entries + start * entry_size, tmp + start * entry_size, counts[b],
+                                           entry_size, key_size, offset + 1, swap));
+        }
+        start += counts[b];
+    }
+    return Status::OK();
+}
+
+Status sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                               Permutation* permutation) {
+    if (columns.empty()) {
+        return Status::OK();
+    }
+    size_t num_rows = columns[0]->size();
+
+    // Layout of the normalized keys, which ends with the first truncatable column.
+    std::vector<size_t> offsets;
+    size_t key_size = 0;
+    for (size_t i = 0; i < columns.size(); i++) {
+        NormalizedKeyEncoder encoder(sort_desc.get_column_desc(i), nullptr, 0, nullptr);
+        RETURN_IF_ERROR(columns[i]->accept(&encoder));
+        offsets.push_back(key_size);
+        key_size += encoder.size();
+        if (encoder.is_truncatable()) {
+            break;
+        }
+    }
+    const size_t num_key_columns = offsets.size();
+    if (key_size > kMaxNormalizedKeySize) {
+        return Status::NotSupported("normalized key is too long");
+    }
+
+    // Each entry is the normalized key followed by the row index.
+    const size_t entry_size = key_size + sizeof(uint32_t);
+    std::vector<uint8_t> entries(num_rows * entry_size, 0);
+    std::vector<uint8_t> truncated(num_rows, 0);
+    for (size_t i = 0; i < num_key_columns; i++) {
+        NormalizedKeyEncoder encoder(sort_desc.get_column_desc(i), entries.data() + offsets[i], entry_size,
+                                     &truncated);
+        RETURN_IF_ERROR(columns[i]->accept(&encoder));
+    }
+    for (uint32_t row = 0; row < num_rows; row++) {
+        memcpy(entries.data() + row * entry_size + key_size, &row, sizeof(uint32_t));
+    }
+
+    std::vector<uint8_t> tmp(num_rows * entry_size);
+    std::vector<uint8_t> swap(entry_size);
+    RETURN_IF_ERROR(
+            msd_radix_sort(cancel, entries.data(), tmp.data(), num_rows, entry_size, key_size, 0, swap.data()));
+
+    permutation->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        uint32_t row;
+        memcpy(&row, entries.data() + i * entry_size + key_size, sizeof(uint32_t));
+        (*permutation)[i] = PermutationItem(0, row);
+    }
+
+    // The rows tie on the normalized keys with a truncated string, or on the encoded columns if not all the
+    // columns are encoded, are compared by columns.
+    const bool all_columns_encoded = num_key_columns == columns.size();
+    auto cmp = [&](const PermutationItem& lhs, const PermutationItem& rhs) {
+        return compare_chunk_row(sort_desc, columns, columns, lhs.index_in_chunk, rhs.index_in_chunk) < 0;
+    };
+    size_t first = 0;
+    while (first < num_rows) {
+        size_t last = first + 1;
+        const uint8_t* key = entries.data() + first * entry_size;
+        while (last < num_rows && memcmp(key, entries.data() + last * entry_size, key_size) == 0) {
+            last++;
+        }
+        if (last - first > 1 && (!all_columns_encoded || truncated[(*permutation)[first].index_in_chunk])) {
+            ::pdqsort(permutation->begin() + first, permutation->begin() + last, cmp);
+        }
+        first = last;
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -44,10 +44,21 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
                             Permutation* permutation, std::pair<int, int> range, size_t row,
                             const std::vector<std::shared_ptr<UInt32Column>>& key_offsets_columns);
 
+// Sort multiple columns by radix sorting their memcmp-comparable normalized keys, output the order in permutation
+// array. Returns NotSupported if any column can't be normalized, e.g. array column, then sort_and_tie_columns
+// should be used instead.
+Status sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                               Permutation* permutation);
+
 // Sort multiple columns, and stable
 Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                                    SmallPermutation* permutation);
 
+// Sort the rows in range of multiple columns, and stable, the permutation is built from the range.
+// The columns are read only, so different ranges of the same columns could be sorted concurrently.
+Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                                   std::pair<int, int> range, SmallPermutation* permutation);
+
 // Sort multiple columns in vertical
 Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<ColumnPtr>& columns,
                              const SortDesc& sort_desc, Permutation& permutation, Tie& tie, std::pair<int, int> range,
@@ -94,7 +94,8 @@ struct SpilledOptions {
 
     int32_t plan_node_id = 0;
 
-    CompressionTypePB compress_type = CompressionTypePB::LZ4;
+    // block compression applied on the encoded columns of each spilled chunk
+    CompressionTypePB compress_type = CompressionTypePB::NO_COMPRESSION;
 
     size_t min_spilled_size = 1 * 1024 * 1024;
 
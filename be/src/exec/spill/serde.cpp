@@ -23,6 +23,7 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
@@ -40,6 +41,12 @@ public:
             auto encode_level = _parent->options().encode_level;
             _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(column_number, encode_level);
         }
+        auto compress_type = _parent->options().compress_type;
+        if (compress_type != CompressionTypePB::NO_COMPRESSION &&
+            !get_block_compression_codec(compress_type, &_compress_codec).ok()) {
+            // unsupported codec, just spill the encoded data
+            _compress_codec = nullptr;
+        }
         return Status::OK();
     }
 
@@ -52,13 +59,26 @@ private:
     // header|encode levels|attachment...
     // header:
     // i32 sequence_id|i64 attachment size
+    // if the block is compressed, sequence_id is COMPRESSED_MAGIC_ID and the format is
+    // header|i32 compress type|i64 uncompressed size|i64 compressed size|compressed(encode levels|attachment...)
+    // the attachment size of a compressed block includes the alignment padding after the compressed data.
     static constexpr int32_t SEQUENCE_OFFSET = 0;
     static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
     static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
     static constexpr int32_t SEQUENCE_MAGIC_ID = 0xface;
+    static constexpr int32_t COMPRESSED_MAGIC_ID = 0xfacf;
+    static constexpr int32_t COMPRESS_TYPE_OFFSET = 0;
+    static constexpr int32_t UNCOMPRESSED_SIZE_OFFSET = COMPRESS_TYPE_OFFSET + sizeof(int32_t);
+    static constexpr int32_t COMPRESSED_SIZE_OFFSET = UNCOMPRESSED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESS_HEADER_SIZE = COMPRESSED_SIZE_OFFSET + sizeof(int64_t);
 
     size_t _max_serialized_size(const ChunkPtr& chunk) const;
 
+    // compress the encoded data in ctx.serialize_buffer into ctx.compress_buffer,
+    // return false if the compression doesn't save space
+    StatusOr<bool> _compress(SerdeContext& ctx, size_t content_length, size_t aligned_size);
+    Status _decompress(SerdeContext& ctx, size_t attachment_size);
+
     inline const std::vector<uint32_t>& _get_encode_levels() {
         DCHECK(_encode_context != nullptr);
         std::shared_lock l(_mutex);
@@ -80,6 +100,7 @@ private:
     // here a std::shared_mutex is used to ensure concurrency safety.
     std::shared_mutex _mutex;
     std::shared_ptr<serde::EncodeContext> _encode_context;
+    const BlockCompressionCodec* _compress_codec = nullptr;
     DECLARE_RACE_DETECTOR(detect_prepare)
 };
 
@@ -99,9 +120,59 @@ size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
     return total_size;
 }
 
+StatusOr<bool> ColumnarSerde::_compress(SerdeContext& ctx, size_t content_length, size_t aligned_size) {
+    DCHECK(_compress_codec != nullptr);
+    Slice input(ctx.serialize_buffer.data() + HEADER_SIZE, content_length - HEADER_SIZE);
+    size_t compressed_offset = HEADER_SIZE + COMPRESS_HEADER_SIZE;
+    ctx.compress_buffer.resize(compressed_offset + _compress_codec->max_compressed_len(input.size));
+    Slice output(ctx.compress_buffer.data() + compressed_offset, ctx.compress_buffer.size() - compressed_offset);
+    RETURN_IF_ERROR(_compress_codec->compress(input, &output));
+    if (ALIGN_UP(compressed_offset + output.size, aligned_size) >= ALIGN_UP(content_length, aligned_size)) {
+        return false;
+    }
+
+    uint8_t* buf = reinterpret_cast<uint8_t*>(ctx.compress_buffer.data()) + HEADER_SIZE;
+    UNALIGNED_STORE32(buf + COMPRESS_TYPE_OFFSET, static_cast<int32_t>(_compress_codec->type()));
+    UNALIGNED_STORE64(buf + UNCOMPRESSED_SIZE_OFFSET, input.size);
+    UNALIGNED_STORE64(buf + COMPRESSED_SIZE_OFFSET, output.size);
+    ctx.compress_buffer.resize(ALIGN_UP(compressed_offset + output.size, aligned_size));
+    return true;
+}
+
+Status ColumnarSerde::_decompress(SerdeContext& ctx, size_t attachment_size) {
+    if (attachment_size < COMPRESS_HEADER_SIZE) {
+        return Status::InternalError(fmt::format("invalid compressed spill block size {}", attachment_size));
+    }
+    const uint8_t* buf = reinterpret_cast<const uint8_t*>(ctx.compress_buffer.data());
+    auto compress_type = static_cast<CompressionTypePB>(UNALIGNED_LOAD32(buf + COMPRESS_TYPE_OFFSET));
+    int64_t uncompressed_size = UNALIGNED_LOAD64(buf + UNCOMPRESSED_SIZE_OFFSET);
+    int64_t compressed_size = UNALIGNED_LOAD64(buf + COMPRESSED_SIZE_OFFSET);
+    if (compressed_size < 0 || compressed_size > static_cast<int64_t>(attachment_size - COMPRESS_HEADER_SIZE)) {
+        return Status::InternalError(fmt::format("invalid compressed size {} of spill block with attachment size {}",
+                                                 compressed_size, attachment_size));
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(compress_type, &codec));
+    if (codec == nullptr) {
+        return Status::InternalError(fmt::format("unknown compress type {} of spill block", compress_type));
+    }
+    // streamvbyte may read a few bytes beyond the encoded data
+    ctx.serialize_buffer.resize(uncompressed_size + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE);
+    // the alignment padding after the compressed data is not a part of the input
+    Slice input(ctx.compress_buffer.data() + COMPRESS_HEADER_SIZE, compressed_size);
+    Slice output(ctx.serialize_buffer.data(), uncompressed_size);
+    RETURN_IF_ERROR(codec->decompress(input, &output));
+    if (output.size != uncompressed_size) {
+        return Status::InternalError(
+                fmt::format("spill block decompressed size mismatch {} vs {}", output.size, uncompressed_size));
+    }
+    return Status::OK();
+}
+
 Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                                 const SpillOutputDataStreamPtr& output, bool aligned) {
     raw::RawString& serialize_buffer = ctx.serialize_buffer;
+    bool compressed = false;
     {
         SCOPED_TIMER(_parent->metrics().serialize_timer);
         size_t ALIGNED_SIZE = 1;
@@ -150,14 +221,23 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
         _update_encode_stats(column_stats);
         // total serialized size
         size_t content_length = buf - head;
-        auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
-        serialize_buffer.resize(align_size);
-        UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
-        memcpy(serialize_buffer.data(), header_buffer, HEADER_SIZE);
+        if (_compress_codec != nullptr) {
+            ASSIGN_OR_RETURN(compressed, _compress(ctx, content_length, ALIGNED_SIZE));
+        }
+        if (compressed) {
+            UNALIGNED_STORE32(header_buffer + SEQUENCE_OFFSET, COMPRESSED_MAGIC_ID);
+            UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, ctx.compress_buffer.size() - HEADER_SIZE);
+            memcpy(ctx.compress_buffer.data(), header_buffer, HEADER_SIZE);
+        } else {
+            auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
+            serialize_buffer.resize(align_size);
+            UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
+            memcpy(serialize_buffer.data(), header_buffer, HEADER_SIZE);
+        }
     }
-    size_t written_bytes = serialize_buffer.size();
-    RETURN_IF_ERROR(
-            output->append(state, {Slice(serialize_buffer.data(), written_bytes)}, written_bytes, chunk->num_rows()));
+    auto& block = compressed ? ctx.compress_buffer : serialize_buffer;
+    size_t written_bytes = block.size();
+    RETURN_IF_ERROR(output->append(state, {Slice(block.data(), written_bytes)}, written_bytes, chunk->num_rows()));
     return Status::OK();
 }
 
@@ -167,8 +247,9 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     RETURN_IF_ERROR(reader->read_fully(header_buffer, HEADER_SIZE));
 
     int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
-    int32_t attachment_size = UNALIGNED_LOAD32(header_buffer + ATTACHMENT_SIZE_OFFSET);
-    if (sequence_id != SEQUENCE_MAGIC_ID) {
+    int64_t attachment_size = UNALIGNED_LOAD64(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    bool compressed = sequence_id == COMPRESSED_MAGIC_ID;
+    if (sequence_id != SEQUENCE_MAGIC_ID && !compressed) {
         return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, SEQUENCE_MAGIC_ID));
     }
 
@@ -176,14 +257,19 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     auto& columns = chunk->columns();
 
     auto& serialize_buffer = ctx.serialize_buffer;
-    serialize_buffer.resize(attachment_size);
-
-    auto buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
+    auto& read_buffer = compressed ? ctx.compress_buffer : serialize_buffer;
+    read_buffer.resize(attachment_size);
     {
-        auto st = reader->read_fully(buf, attachment_size);
+        auto st = reader->read_fully(read_buffer.data(), attachment_size);
         RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in block"));
         RETURN_IF_ERROR(st);
     }
+    if (compressed) {
+        SCOPED_TIMER(_parent->metrics().deserialize_timer);
+        RETURN_IF_ERROR(_decompress(ctx, attachment_size));
+    }
+
+    auto buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
 
     const uint32_t* encode_levels = nullptr;
     const uint8_t* read_cursor = buf;
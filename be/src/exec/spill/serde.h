@@ -85,6 +85,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // holds the compressed block when the spilled data is compressed
+    raw::RawString compress_buffer;
 };
 // Serde is used to serialize and deserialize spilled data.
 class Serde;
@@ -23,11 +23,13 @@
 namespace starrocks::stream {
 
 AggGroupState::AggGroupState(std::vector<AggStateDataUPtr>&& agg_states, const AggregatorParamsPtr& params,
-                             const TupleDescriptor* output_tuple_desc, const TupleDescriptor* intermediate_tuple_desc)
+                             const TupleDescriptor* output_tuple_desc, const TupleDescriptor* intermediate_tuple_desc,
+                             std::string state_table_dir)
         : _agg_states(std::move(agg_states)),
           _params(params),
           _output_tuple_desc(output_tuple_desc),
-          _intermediate_tuple_desc(intermediate_tuple_desc) {}
+          _intermediate_tuple_desc(intermediate_tuple_desc),
+          _state_table_dir(std::move(state_table_dir)) {}
 
 // initialize state tables
 Status AggGroupState::prepare(RuntimeState* state) {
@@ -56,22 +58,24 @@ Status AggGroupState::prepare(RuntimeState* state) {
         }
     }
 
+    return _prepare_state_tables(state, intermediate_agg_states, detail_agg_states);
+}
+
+std::unique_ptr<StateTable> AggGroupState::_new_state_table(std::vector<SlotDescriptor*> slots, size_t k_num,
+                                                           const std::string& name) const {
     if (_params->is_testing) {
-        RETURN_IF_ERROR(_prepare_mem_state_tables(state, intermediate_agg_states, detail_agg_states));
-    } else {
-        RETURN_IF_ERROR(_prepare_imt_state_tables(state, intermediate_agg_states, detail_agg_states));
+        return std::make_unique<MemStateTable>(std::move(slots), k_num);
     }
-
-    return Status::OK();
+    return std::make_unique<PersistentStateTable>(std::move(slots), k_num, _state_table_dir + "/" + name);
 }
 
-Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
+Status AggGroupState::_prepare_state_tables(RuntimeState* state,
+                                            const std::vector<AggStateData*>& intermediate_agg_states,
+                                            const std::vector<AggStateData*>& detail_agg_states) {
     auto key_size = _params->grouping_exprs.size();
     // result state table must be made!
     auto output_slots = _output_tuple_desc->slots();
-    _result_state_table = std::make_unique<MemStateTable>(output_slots, key_size);
+    _result_state_table = _new_state_table(output_slots, key_size, "result");
 
     // intermediate agg_state is created when intermediate/detail agg states are not empty.
     if (!intermediate_agg_states.empty()) {
@@ -84,7 +88,7 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             DCHECK_LT(agg_func_id + key_size, _intermediate_tuple_desc->slots().size());
             intermediate_slots.push_back(_intermediate_tuple_desc->slots()[agg_func_id + key_size]);
         }
-        _intermediate_state_table = std::make_unique<MemStateTable>(intermediate_slots, key_size);
+        _intermediate_state_table = _new_state_table(intermediate_slots, key_size, "intermediate");
     }
 
     if (!detail_agg_states.empty()) {
@@ -102,19 +106,14 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + agg_func_idx]);
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + count_agg_idx]);
             DCHECK_EQ(detail_table_slots.size(), key_size + 2);
-            auto detail_state_table = std::make_unique<MemStateTable>(detail_table_slots, key_size + 1);
+            auto detail_state_table = _new_state_table(detail_table_slots, key_size + 1,
+                                                       fmt::format("detail_{}", _detail_state_tables.size()));
             _detail_state_tables.emplace_back(std::move(detail_state_table));
         }
     }
     return Status::OK();
 }
 
-Status AggGroupState::_prepare_imt_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
-    return Status::InternalError("IMT state table is not supported yet.");
-}
-
 Status AggGroupState::open(RuntimeState* state) {
     // Update result table
     DCHECK(_result_state_table);
@@ -357,6 +356,24 @@ Status AggGroupState::commit_epoch(RuntimeState* state) {
     return Status::OK();
 }
 
+Status AggGroupState::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    // Update result table
+    DCHECK(_result_state_table);
+    RETURN_IF_ERROR(_result_state_table->publish_epoch(state, epoch_id));
+
+    // Update intermediate table
+    if (_intermediate_state_table) {
+        RETURN_IF_ERROR(_intermediate_state_table->publish_epoch(state, epoch_id));
+    }
+
+    // Update detail tables
+    for (auto i = 0; i < _detail_state_tables.size(); i++) {
+        auto& detail_state_table = _detail_state_tables[i];
+        RETURN_IF_ERROR(detail_state_table->publish_epoch(state, epoch_id));
+    }
+    return Status::OK();
+}
+
 Status AggGroupState::reset_epoch(RuntimeState* state) {
     // Update result table
     DCHECK(_result_state_table);
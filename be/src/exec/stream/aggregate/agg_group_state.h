@@ -19,6 +19,7 @@
 
 #include "exec/stream/aggregate/agg_state_data.h"
 #include "exec/stream/state/mem_state_table.h"
+#include "exec/stream/state/persistent_state_table.h"
 
 namespace starrocks::stream {
 
@@ -26,8 +27,10 @@ namespace starrocks::stream {
 // and the state table behind the single agg function.
 class AggGroupState {
 public:
+    // `state_table_dir` is the directory of the PersistentStateTables, which is not used in testing.
     AggGroupState(std::vector<AggStateDataUPtr>&& agg_states, const AggregatorParamsPtr& params,
-                  const TupleDescriptor* _output_tuple_desc, const TupleDescriptor* _intermediate_tuple_desc);
+                  const TupleDescriptor* _output_tuple_desc, const TupleDescriptor* _intermediate_tuple_desc,
+                  std::string state_table_dir);
     ~AggGroupState() = default;
 
     const std::vector<AggStateDataUPtr>& agg_states() const { return _agg_states; }
@@ -54,15 +57,16 @@ public:
     [[nodiscard]] Status write(RuntimeState* state, StreamChunkPtr* result_chunk, ChunkPtr* intermediate_chunk,
                                std::vector<ChunkPtr>& detail_chunk);
     [[nodiscard]] Status commit_epoch(RuntimeState* state);
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id);
     [[nodiscard]] Status reset_epoch(RuntimeState* state);
 
 private:
-    [[nodiscard]] Status _prepare_mem_state_tables(RuntimeState* state,
-                                                   const std::vector<AggStateData*>& intermediate_agg_states,
-                                                   const std::vector<AggStateData*>& detail_agg_states);
-    [[nodiscard]] Status _prepare_imt_state_tables(RuntimeState* state,
-                                                   const std::vector<AggStateData*>& intermediate_agg_states,
-                                                   const std::vector<AggStateData*>& detail_agg_states);
+    [[nodiscard]] Status _prepare_state_tables(RuntimeState* state,
+                                               const std::vector<AggStateData*>& intermediate_agg_states,
+                                               const std::vector<AggStateData*>& detail_agg_states);
+    // Use MemStateTable in testing, otherwise use PersistentStateTable named `name` in the state table directory.
+    std::unique_ptr<StateTable> _new_state_table(std::vector<SlotDescriptor*> slots, size_t k_num,
+                                                 const std::string& name) const;
     StateTable* _find_detail_state_table(const AggStateDataUPtr& agg_state) const;
     ChunkPtr _build_intermediate_chunk(const Columns& group_by_columns, const Columns& agg_intermediate_columns) const;
 
@@ -71,6 +75,7 @@ private:
     const AggregatorParamsPtr& _params;
     const TupleDescriptor* _output_tuple_desc;
     const TupleDescriptor* _intermediate_tuple_desc;
+    const std::string _state_table_dir;
 
     std::unique_ptr<StateTable> _result_state_table;
     std::unique_ptr<StateTable> _intermediate_state_table;
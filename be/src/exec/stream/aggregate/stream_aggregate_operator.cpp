@@ -17,7 +17,13 @@
 
 #include "exec/stream/aggregate/stream_aggregate_operator.h"
 
+#include "common/config.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/stream_epoch_manager.h"
+#include "fmt/format.h"
+#include "fs/fs_util.h"
+#include "gutil/strings/numbers.h"
 
 namespace starrocks::stream {
 
@@ -51,8 +57,10 @@ Status StreamAggregateOperator::set_epoch_finishing(RuntimeState* state) {
 Status StreamAggregateOperator::set_epoch_finished(RuntimeState* state) {
     // TODO:  async flush state
     // ATTENTION:
-    // 1. reset state to reduce memory usage.
-    // 2. reset state will change `_aggregator->is_ht_eos()`
+    // 1. commit the changes of the epoch into the state tables, which are checkpointed by `publish_epoch`.
+    // 2. reset state to reduce memory usage.
+    // 3. reset state will change `_aggregator->is_ht_eos()`
+    RETURN_IF_ERROR(_aggregator->commit_epoch(state));
     RETURN_IF_ERROR(_aggregator->reset_state(state));
     return Status::OK();
 }
@@ -60,17 +68,73 @@ Status StreamAggregateOperator::set_epoch_finished(RuntimeState* state) {
 Status StreamAggregateOperator::reset_epoch(RuntimeState* state) {
     _is_epoch_finished = false;
     _has_output = true;
-    return Status::OK();
+    return _aggregator->reset_epoch(state);
+}
+
+Status StreamAggregateOperator::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    return _aggregator->publish_epoch(state, epoch_id);
 }
 
 Status StreamAggregateOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     RETURN_IF_ERROR(_aggregator->prepare(state, state->obj_pool(), _unique_metrics.get()));
+    // Each driver keeps its state in its own directory of the MV. The directory is only keyed by the identities
+    // which are stable across the restarts of the maintenance job, so the state is recovered by the next job.
+    int64_t mv_id = 0;
+    if (state->query_ctx() != nullptr) {
+        mv_id = state->query_ctx()->stream_epoch_manager()->maintenance_task_info().mv_id;
+    }
+    _mv_state_dir = fmt::format("{}/{}", config::stream_state_table_dir, mv_id);
+    RETURN_IF_ERROR(_check_degree_of_parallelism());
+    _aggregator->set_state_table_dir(fmt::format("{}/{}_{}", _mv_state_dir, get_plan_node_id(), get_driver_sequence()));
     return _aggregator->open(state);
 }
 
+std::string StreamAggregateOperator::_dop_file_path() const {
+    return fmt::format("{}/{}.dop", _mv_state_dir, get_plan_node_id());
+}
+
+Status StreamAggregateOperator::_check_degree_of_parallelism() {
+    auto path = _dop_file_path();
+    if (fs::path_exist(path)) {
+        ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(path));
+        ASSIGN_OR_RETURN(auto content, file->read_all());
+        int32_t dop = 0;
+        if (!SimpleAtoi(content, &dop)) {
+            return Status::Corruption(
+                    fmt::format("invalid degree of parallelism of the MV state {}: {}", path, content));
+        }
+        if (dop != _degree_of_parallelism) {
+            return Status::NotSupported(fmt::format(
+                    "The state of the MV is kept by {} drivers of the plan node {}, and can't be recovered by {} "
+                    "drivers, the degree of parallelism of the MV can't be changed",
+                    dop, get_plan_node_id(), _degree_of_parallelism));
+        }
+        return Status::OK();
+    }
+
+    // The drivers write the same content, and the file is replaced atomically.
+    RETURN_IF_ERROR(fs::create_directories(_mv_state_dir));
+    auto tmp_path = fmt::format("{}.{}.tmp", path, get_driver_sequence());
+    ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(tmp_path));
+    RETURN_IF_ERROR(wf->append(std::to_string(_degree_of_parallelism)));
+    RETURN_IF_ERROR(wf->sync());
+    RETURN_IF_ERROR(wf->close());
+    RETURN_IF_ERROR(FileSystem::Default()->rename_file(tmp_path, path));
+    return FileSystem::Default()->sync_dir(_mv_state_dir);
+}
+
 void StreamAggregateOperator::close(RuntimeState* state) {
     _aggregator->unref(state);
+    // Remove the state of the dropped MV, otherwise it's kept for the next maintenance job.
+    if (state->query_ctx() != nullptr && state->query_ctx()->stream_epoch_manager()->is_state_dropped() &&
+        !_mv_state_dir.empty()) {
+        auto st = fs::remove_all(_aggregator->state_table_dir());
+        LOG_IF(WARNING, !st.ok()) << "Fail to remove the state of the dropped MV: " << st;
+        (void)fs::delete_file(_dop_file_path());
+        // The directory of the MV is removed by the last driver, and fails if others' states are still in it.
+        (void)fs::remove(_mv_state_dir);
+    }
     Operator::close(state);
 }
 
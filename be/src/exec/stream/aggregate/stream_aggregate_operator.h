@@ -31,8 +31,9 @@ using StreamAggregatorFactoryPtr = std::shared_ptr<StreamAggregatorFactory>;
 class StreamAggregateOperator : public pipeline::SourceOperator {
 public:
     StreamAggregateOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                            StreamAggregatorPtr aggregator)
+                            int32_t degree_of_parallelism, StreamAggregatorPtr aggregator)
             : pipeline::SourceOperator(factory, id, "stream_aggregate", plan_node_id, false, driver_sequence),
+              _degree_of_parallelism(degree_of_parallelism),
               _aggregator(std::move(aggregator)) {
         _aggregator->ref();
     }
@@ -49,6 +50,7 @@ public:
     [[nodiscard]] Status set_epoch_finishing(RuntimeState* state) override;
     [[nodiscard]] Status set_epoch_finished(RuntimeState* state) override;
     [[nodiscard]] Status reset_epoch(RuntimeState* state) override;
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id) override;
 
     [[nodiscard]] StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
     [[nodiscard]] Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
@@ -56,8 +58,16 @@ public:
     void close(RuntimeState* state) override;
 
 private:
+    // The group keys are shuffled to the drivers by their hashes, so the state of a driver only holds the keys of
+    // the same degree of parallelism. It's recorded with the state, and the state can't be recovered by another.
+    [[nodiscard]] Status _check_degree_of_parallelism();
+    std::string _dop_file_path() const;
+
+    const int32_t _degree_of_parallelism;
     StreamAggregatorPtr _aggregator = nullptr;
     ChunkPtr _epoch_chunk = nullptr;
+    // The directory of the states of all the drivers of the MV.
+    std::string _mv_state_dir;
     // Whether prev operator has no output
     bool _is_input_finished = false;
     // Mark whether aggregator is already epoch finished.
@@ -81,9 +91,11 @@ public:
 
     pipeline::OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
         if (_aggregator) {
-            return std::make_shared<StreamAggregateOperator>(this, _id, _plan_node_id, driver_sequence, _aggregator);
+            return std::make_shared<StreamAggregateOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                             degree_of_parallelism, _aggregator);
         } else {
             return std::make_shared<StreamAggregateOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                             degree_of_parallelism,
                                                              _aggregator_factory->get_or_create(driver_sequence));
         }
     }
@@ -101,7 +101,7 @@ Status StreamAggregator::_prepare_state_tables(RuntimeState* state) {
 
     // Prepare agg group state
     _agg_group_state = std::make_unique<AggGroupState>(std::move(agg_func_states), _params, _output_tuple_desc,
-                                                       _intermediate_tuple_desc);
+                                                       _intermediate_tuple_desc, _state_table_dir);
     RETURN_IF_ERROR(_agg_group_state->prepare(state));
 
     return Status::OK();
@@ -296,4 +296,8 @@ Status StreamAggregator::commit_epoch(RuntimeState* state) {
     return _agg_group_state->commit_epoch(state);
 }
 
+Status StreamAggregator::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    return _agg_group_state->publish_epoch(state, epoch_id);
+}
+
 } // namespace starrocks::stream
@@ -61,6 +61,10 @@ public:
 
     [[nodiscard]] Status open(RuntimeState* state);
 
+    // Set the directory of the persistent state tables before `open`.
+    void set_state_table_dir(std::string state_table_dir) { _state_table_dir = std::move(state_table_dir); }
+    const std::string& state_table_dir() const { return _state_table_dir; }
+
     // Process input's chunks util `Epoch` chunk is received.
     [[nodiscard]] Status process_chunk(StreamChunk* chunk);
 
@@ -77,6 +81,9 @@ public:
     // When the epoch is finished, commit the state table.
     [[nodiscard]] Status commit_epoch(RuntimeState* state);
 
+    // When the epoch is committed by FE, make the committed state tables the checkpoint.
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id);
+
     // When the epoch starts, reset stream aggreator's state in the new epoch.
     [[nodiscard]] Status reset_epoch(RuntimeState* state);
 
@@ -112,6 +119,7 @@ private:
     int32_t _count_agg_idx{0};
     // Store AggState group.
     std::unique_ptr<AggGroupState> _agg_group_state;
+    std::string _state_table_dir;
 };
 
 } // namespace starrocks::stream
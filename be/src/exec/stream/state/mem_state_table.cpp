@@ -55,6 +55,10 @@ void convert_datum_rows_to_chunk(const std::vector<DatumRow>& rows, Chunk* chunk
     return Status::OK();
 }
 
+[[nodiscard]] Status MemStateTable::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    return Status::OK();
+}
+
 bool MemStateTable::_equal_keys(const DatumKeyRow& m_k, const DatumKeyRow& keys) const {
     for (auto i = 0; i < keys.size(); i++) {
         Datum datum(keys[i]);
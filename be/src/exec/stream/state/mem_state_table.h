@@ -79,6 +79,7 @@ public:
 
     [[nodiscard]] Status write(RuntimeState* state, const StreamChunkPtr& chunk) override;
     [[nodiscard]] Status commit(RuntimeState* state) override;
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id) override;
     [[nodiscard]] Status reset_epoch(RuntimeState* state) override;
 
 private:
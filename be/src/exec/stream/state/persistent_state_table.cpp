@@ -0,0 +1,535 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/persistent_state_table.h"
+
+#include <fmt/format.h>
+
+#include <map>
+#include <set>
+#include <sstream>
+#include <unordered_set>
+
+#include "column/const_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/stream_epoch_manager.h"
+#include "fs/fs.h"
+#include "fs/fs_util.h"
+#include "gutil/casts.h"
+#include "storage/sstable/comparator.h"
+#include "storage/sstable/filter_policy.h"
+#include "storage/sstable/iterator.h"
+#include "storage/sstable/merger.h"
+#include "storage/sstable/options.h"
+#include "storage/sstable/table.h"
+#include "storage/sstable/table_builder.h"
+
+namespace starrocks::stream {
+namespace {
+
+constexpr char kManifestFileName[] = "MANIFEST";
+constexpr char kTmpManifestFileName[] = "MANIFEST.tmp";
+constexpr char kSstableSuffix[] = ".sst";
+
+// The first byte of the values in the write buffer and the sstables. The values are never empty, which
+// means not found in `sstable::Table::MultiGet`.
+constexpr char kValueTag = 1;
+constexpr char kTombstoneTag = 0;
+
+// Encode a datum as a null flag followed by the serialized data, the same as NullableColumn::serialize.
+// The encoding doesn't depend on the nullability of the columns, and the encoded datums are self-delimited,
+// so the encoded prefix columns of the primary keys are the prefix of the encoded primary keys.
+void encode_datum(Column* column, size_t row, std::string* buf) {
+    if (column->is_constant()) {
+        column = down_cast<ConstColumn*>(column)->data_column().get();
+        row = 0;
+    }
+    const bool is_null = column->is_null(row);
+    buf->push_back(static_cast<char>(is_null));
+    if (is_null) {
+        return;
+    }
+    if (column->is_nullable()) {
+        column = down_cast<NullableColumn*>(column)->mutable_data_column();
+    }
+    const size_t offset = buf->size();
+    buf->resize(offset + column->serialize_size(row));
+    column->serialize(row, reinterpret_cast<uint8_t*>(buf->data() + offset));
+}
+
+const uint8_t* decode_datum(const uint8_t* pos, Column* column) {
+    if (column->is_nullable()) {
+        return column->deserialize_and_append(pos);
+    }
+    const bool is_null = *pos++;
+    if (is_null) {
+        column->append_default();
+        return pos;
+    }
+    return column->deserialize_and_append(pos);
+}
+
+std::string encode_row(const Columns& columns, size_t start, size_t end, size_t row) {
+    std::string buf;
+    for (size_t i = start; i < end; i++) {
+        encode_datum(columns[i].get(), row, &buf);
+    }
+    return buf;
+}
+
+// NOTE: The result of `prefix_scan` is small enough to be output by one chunk.
+class StateChunkIterator final : public ChunkIterator {
+public:
+    StateChunkIterator(Schema schema, ChunkPtr chunk)
+            : ChunkIterator(std::move(schema), chunk->num_rows()), _chunk(std::move(chunk)) {}
+    void close() override {}
+
+protected:
+    [[nodiscard]] Status do_get_next(Chunk* chunk) override {
+        if (_chunk == nullptr) {
+            return Status::EndOfFile("end of state chunk iterator");
+        }
+        chunk->append(*_chunk);
+        _chunk.reset();
+        return Status::OK();
+    }
+    [[nodiscard]] Status do_get_next(Chunk* chunk, std::vector<uint32_t>* rowid) override {
+        return Status::EndOfFile("end of state chunk iterator");
+    }
+
+private:
+    ChunkPtr _chunk;
+};
+
+} // namespace
+
+struct PersistentStateTable::Sstable {
+    std::string name;
+    uint64_t file_size = 0;
+    std::unique_ptr<RandomAccessFile> file;
+    std::unique_ptr<sstable::Table> table;
+};
+
+PersistentStateTable::PersistentStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, std::string dir)
+        : _slots(std::move(slots)), _k_num(k_num), _cols_num(_slots.size()), _dir(std::move(dir)) {
+    _v_schema = _make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + _k_num, _slots.end()});
+    _filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+}
+
+PersistentStateTable::~PersistentStateTable() = default;
+
+Status PersistentStateTable::prepare(RuntimeState* state) {
+    return Status::OK();
+}
+
+Status PersistentStateTable::open(RuntimeState* state) {
+    RETURN_IF_ERROR(fs::create_directories(_dir));
+    RETURN_IF_ERROR(_load_manifest());
+    if (state != nullptr && state->query_ctx() != nullptr) {
+        // Otherwise the state doesn't match the MV, e.g. it misses the changes of the epochs committed by FE.
+        auto resume_epoch_id = state->query_ctx()->stream_epoch_manager()->maintenance_task_info().committed_epoch_id;
+        if (resume_epoch_id != _committed_epoch_id) {
+            return Status::InternalError(fmt::format(
+                    "The state table {} is checkpointed at the epoch {}, but the MV resumes from the epoch {}", _dir,
+                    _committed_epoch_id, resume_epoch_id));
+        }
+    }
+    RETURN_IF_ERROR(_remove_unused_files());
+    VLOG_ROW << "[PersistentStateTable] open " << _dir << ", epoch_id:" << _committed_epoch_id
+             << ", sstables:" << _sstables.size();
+    return Status::OK();
+}
+
+Status PersistentStateTable::seek(const Columns& keys, StateTableResult& values) const {
+    DCHECK_LT(0, keys.size());
+    std::vector<uint8_t> selection(keys[0]->size(), 1);
+    return seek(keys, selection, values);
+}
+
+Status PersistentStateTable::seek(const Columns& keys, const std::vector<uint8_t>& selection,
+                                  StateTableResult& values) const {
+    DCHECK_LT(0, keys.size());
+    DCHECK_EQ(_k_num, keys.size());
+    auto num_rows = keys[0]->size();
+    DCHECK_EQ(selection.size(), num_rows);
+
+    auto& found = values.found;
+    auto& result_chunk = values.result_chunk;
+    found.assign(num_rows, false);
+    result_chunk = ChunkHelper::new_chunk(_v_schema, num_rows);
+
+    // Look up the write buffer first, then the sstables from the newest one with the remaining keys.
+    std::vector<std::string> encoded_keys(num_rows);
+    std::vector<const std::string*> encoded_values(num_rows, nullptr);
+    std::set<size_t> pending_rows;
+    for (size_t i = 0; i < num_rows; i++) {
+        if (!selection[i]) {
+            continue;
+        }
+        encoded_keys[i] = encode_row(keys, 0, keys.size(), i);
+        if (auto iter = _write_buffer.find(encoded_keys[i]); iter != _write_buffer.end()) {
+            encoded_values[i] = &iter->second;
+        } else {
+            pending_rows.insert(i);
+        }
+    }
+
+    std::vector<std::string> fetched_values(num_rows);
+    if (!pending_rows.empty()) {
+        std::vector<Slice> key_slices(encoded_keys.begin(), encoded_keys.end());
+        sstable::ReadOptions read_options;
+        for (auto sst = _sstables.rbegin(); sst != _sstables.rend() && !pending_rows.empty(); ++sst) {
+            std::vector<std::string> sst_values(pending_rows.size());
+            RETURN_IF_ERROR((*sst)->table->MultiGet(read_options, key_slices.data(), pending_rows.begin(),
+                                                    pending_rows.end(), &sst_values));
+            size_t j = 0;
+            for (auto iter = pending_rows.begin(); iter != pending_rows.end(); j++) {
+                if (sst_values[j].empty()) {
+                    ++iter;
+                    continue;
+                }
+                fetched_values[*iter] = std::move(sst_values[j]);
+                encoded_values[*iter] = &fetched_values[*iter];
+                iter = pending_rows.erase(iter);
+            }
+        }
+    }
+
+    auto& columns = result_chunk->columns();
+    for (size_t i = 0; i < num_rows; i++) {
+        const std::string* value = encoded_values[i];
+        if (value == nullptr || (*value)[0] == kTombstoneTag) {
+            continue;
+        }
+        found[i] = true;
+        const auto* pos = reinterpret_cast<const uint8_t*>(value->data()) + 1;
+        for (auto& column : columns) {
+            pos = decode_datum(pos, column.get());
+        }
+    }
+    return Status::OK();
+}
+
+Status PersistentStateTable::seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                                  StateTableResult& values) const {
+    return Status::NotSupported("Seek with projection columns is not supported yet.");
+}
+
+ChunkIteratorPtrOr PersistentStateTable::prefix_scan(const Columns& keys, size_t row_idx) const {
+    DCHECK_LE(keys.size(), _k_num);
+    const std::string prefix = encode_row(keys, 0, keys.size(), row_idx);
+
+    // The newest version of each key with the prefix, from the write buffer to the oldest sstable.
+    std::map<std::string, std::string> rows;
+    for (auto iter = _write_buffer.lower_bound(prefix);
+         iter != _write_buffer.end() && Slice(iter->first).starts_with(prefix); ++iter) {
+        rows.emplace(iter->first, iter->second);
+    }
+    sstable::ReadOptions read_options;
+    for (auto sst = _sstables.rbegin(); sst != _sstables.rend(); ++sst) {
+        std::unique_ptr<sstable::Iterator> iter((*sst)->table->NewIterator(read_options));
+        for (iter->Seek(prefix); iter->Valid() && iter->key().starts_with(prefix); iter->Next()) {
+            rows.emplace(iter->key().to_string(), iter->value().to_string());
+        }
+        RETURN_IF_ERROR(iter->status());
+    }
+
+    // Output the rest key columns and the value columns.
+    auto schema = _make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + keys.size(), _slots.end()});
+    auto chunk = ChunkHelper::new_chunk(schema, rows.size());
+    auto& columns = chunk->columns();
+    for (auto& [key, value] : rows) {
+        if (value[0] == kTombstoneTag) {
+            continue;
+        }
+        const auto* key_pos = reinterpret_cast<const uint8_t*>(key.data()) + prefix.size();
+        const auto* value_pos = reinterpret_cast<const uint8_t*>(value.data()) + 1;
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (i + keys.size() < _k_num) {
+                key_pos = decode_datum(key_pos, columns[i].get());
+            } else {
+                value_pos = decode_datum(value_pos, columns[i].get());
+            }
+        }
+    }
+    if (chunk->num_rows() == 0) {
+        return Status::EndOfFile("");
+    }
+    return std::make_shared<StateChunkIterator>(std::move(schema), std::move(chunk));
+}
+
+ChunkIteratorPtrOr PersistentStateTable::prefix_scan(const std::vector<std::string>& projection_columns,
+                                                     const Columns& keys, size_t row_idx) const {
+    return Status::NotSupported("PrefixScan with projection columns is not supported yet.");
+}
+
+void PersistentStateTable::_put(std::string key, std::string value) {
+    auto [iter, inserted] = _write_buffer.try_emplace(std::move(key));
+    if (inserted) {
+        _write_buffer_bytes += iter->first.size();
+    } else {
+        _write_buffer_bytes -= iter->second.size();
+    }
+    _write_buffer_bytes += value.size();
+    iter->second = std::move(value);
+}
+
+Status PersistentStateTable::write(RuntimeState* state, const StreamChunkPtr& chunk) {
+    DCHECK(chunk);
+    DCHECK_LE(_cols_num, chunk->num_columns());
+    auto chunk_size = chunk->num_rows();
+    const StreamRowOp* ops = StreamChunkConverter::has_ops_column(chunk) ? StreamChunkConverter::ops(chunk) : nullptr;
+    auto& columns = chunk->columns();
+    for (size_t i = 0; i < chunk_size; i++) {
+        if (ops != nullptr && ops[i] == StreamRowOp::OP_UPDATE_BEFORE) {
+            continue;
+        }
+        auto key = encode_row(columns, 0, _k_num, i);
+        if (ops != nullptr && ops[i] == StreamRowOp::OP_DELETE) {
+            _put(std::move(key), std::string(1, kTombstoneTag));
+            continue;
+        }
+        std::string value(1, kValueTag);
+        value.append(encode_row(columns, _k_num, _cols_num, i));
+        _put(std::move(key), std::move(value));
+    }
+    _has_uncommitted_changes = true;
+    if (static_cast<int64_t>(_write_buffer_bytes) >= config::stream_state_table_write_buffer_size) {
+        RETURN_IF_ERROR(_flush_write_buffer());
+    }
+    return Status::OK();
+}
+
+Status PersistentStateTable::commit(RuntimeState* state) {
+    int64_t epoch_id = _committed_epoch_id + 1;
+    if (state != nullptr && state->query_ctx() != nullptr) {
+        epoch_id = state->query_ctx()->stream_epoch_manager()->epoch_info().epoch_id;
+    }
+    RETURN_IF_ERROR(_flush_write_buffer());
+    if (static_cast<int64_t>(_sstables.size()) > config::stream_state_table_max_sstables) {
+        RETURN_IF_ERROR(_compact());
+    }
+    // The manifest is only replaced after FE commits the epoch, see `publish_epoch`.
+    _finished_epoch_id = epoch_id;
+    return Status::OK();
+}
+
+Status PersistentStateTable::publish_epoch(RuntimeState* state, int64_t epoch_id) {
+    if (epoch_id == _committed_epoch_id) {
+        // The COMMIT_EPOCH is retried.
+        return Status::OK();
+    }
+    if (epoch_id != _finished_epoch_id) {
+        return Status::InternalError(
+                fmt::format("Fail to publish the epoch {} of the state table {}, the finished epoch is {}", epoch_id,
+                            _dir, _finished_epoch_id));
+    }
+    DCHECK(_write_buffer.empty());
+    RETURN_IF_ERROR(_write_manifest(epoch_id));
+    _committed_epoch_id = epoch_id;
+    _finished_epoch_id = -1;
+    _has_uncommitted_changes = false;
+
+    for (auto& name : _obsolete_files) {
+        WARN_IF_ERROR(fs::delete_file(_path(name)), "failed to remove the obsolete state table file");
+    }
+    _obsolete_files.clear();
+    return Status::OK();
+}
+
+Status PersistentStateTable::reset_epoch(RuntimeState* state) {
+    _finished_epoch_id = -1;
+    if (!_has_uncommitted_changes) {
+        return Status::OK();
+    }
+    // The last epoch is not published, e.g. it failed in some driver or FE failed to commit it, and will be
+    // retried, so discard its changes, including the sstables flushed or compacted in it, and go back to the
+    // last published epoch.
+    VLOG_ROW << "[PersistentStateTable] discard the uncommitted changes of " << _dir;
+    _write_buffer.clear();
+    _write_buffer_bytes = 0;
+    _sstables.clear();
+    _obsolete_files.clear();
+    _committed_epoch_id = -1;
+    RETURN_IF_ERROR(_load_manifest());
+    RETURN_IF_ERROR(_remove_unused_files());
+    _has_uncommitted_changes = false;
+    return Status::OK();
+}
+
+Status PersistentStateTable::_flush_write_buffer() {
+    if (_write_buffer.empty()) {
+        return Status::OK();
+    }
+    auto add_entries = [this](sstable::TableBuilder* builder) {
+        for (auto& [key, value] : _write_buffer) {
+            builder->Add(key, value);
+        }
+        return Status::OK();
+    };
+    ASSIGN_OR_RETURN(auto sst, _build_sstable(add_entries));
+    _sstables.emplace_back(std::move(sst));
+    _write_buffer.clear();
+    _write_buffer_bytes = 0;
+    return Status::OK();
+}
+
+Status PersistentStateTable::_compact() {
+    std::vector<sstable::Iterator*> children;
+    sstable::ReadOptions read_options;
+    // The merging iterator outputs the entry of the first child among the equal keys, so the newest one.
+    for (auto sst = _sstables.rbegin(); sst != _sstables.rend(); ++sst) {
+        children.push_back((*sst)->table->NewIterator(read_options));
+    }
+    std::unique_ptr<sstable::Iterator> iter(sstable::NewMergingIterator(sstable::BytewiseComparator(), children.data(),
+                                                                        static_cast<int>(children.size())));
+    auto add_entries = [&iter](sstable::TableBuilder* builder) {
+        std::string last_key;
+        bool has_last_key = false;
+        for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+            Slice key = iter->key();
+            if (has_last_key && key == Slice(last_key)) {
+                continue;
+            }
+            last_key.assign(key.data, key.size);
+            has_last_key = true;
+            // All the versions are merged, so the deleted rows can be dropped.
+            if (iter->value()[0] != kTombstoneTag) {
+                builder->Add(key, iter->value());
+            }
+        }
+        return iter->status();
+    };
+    ASSIGN_OR_RETURN(auto merged, _build_sstable(add_entries));
+    for (auto& sst : _sstables) {
+        _obsolete_files.emplace_back(sst->name);
+    }
+    _sstables.clear();
+    _sstables.emplace_back(std::move(merged));
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<PersistentStateTable::Sstable>> PersistentStateTable::_build_sstable(
+        const std::function<Status(sstable::TableBuilder*)>& add_entries) {
+    auto name = fmt::format("{}{}", _next_file_id++, kSstableSuffix);
+    ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(_path(name)));
+    sstable::Options options;
+    options.filter_policy = _filter_policy.get();
+    sstable::TableBuilder builder(options, wf.get());
+    auto st = add_entries(&builder);
+    if (!st.ok()) {
+        builder.Abandon();
+        return st;
+    }
+    RETURN_IF_ERROR(builder.Finish());
+    RETURN_IF_ERROR(wf->sync());
+    RETURN_IF_ERROR(wf->close());
+    return _open_sstable(name);
+}
+
+StatusOr<std::unique_ptr<PersistentStateTable::Sstable>> PersistentStateTable::_open_sstable(
+        const std::string& name) const {
+    auto sst = std::make_unique<Sstable>();
+    sst->name = name;
+    ASSIGN_OR_RETURN(sst->file, fs::new_random_access_file(_path(name)));
+    ASSIGN_OR_RETURN(sst->file_size, sst->file->get_size());
+    sstable::Options options;
+    options.filter_policy = _filter_policy.get();
+    sstable::Table* table = nullptr;
+    RETURN_IF_ERROR(sstable::Table::Open(options, sst->file.get(), sst->file_size, &table));
+    sst->table.reset(table);
+    return sst;
+}
+
+// The manifest is a text file:
+//   epoch_id <the last committed epoch id>
+//   next_file_id <the id of the next file>
+//   sstable <file name>
+//   ...
+Status PersistentStateTable::_load_manifest() {
+    auto manifest_path = _path(kManifestFileName);
+    if (!fs::path_exist(manifest_path)) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(manifest_path));
+    ASSIGN_OR_RETURN(auto content, file->read_all());
+
+    std::istringstream lines(content);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream fields(line);
+        std::string name;
+        fields >> name;
+        if (name == "epoch_id") {
+            fields >> _committed_epoch_id;
+        } else if (name == "next_file_id") {
+            fields >> _next_file_id;
+        } else if (name == "sstable") {
+            std::string sst_name;
+            fields >> sst_name;
+            ASSIGN_OR_RETURN(auto sst, _open_sstable(sst_name));
+            _sstables.emplace_back(std::move(sst));
+        } else {
+            fields.setstate(std::ios::failbit);
+        }
+        if (fields.fail()) {
+            return Status::Corruption(fmt::format("invalid state table manifest {}: {}", manifest_path, line));
+        }
+    }
+    return Status::OK();
+}
+
+Status PersistentStateTable::_write_manifest(int64_t epoch_id) {
+    std::string content = fmt::format("epoch_id {}\nnext_file_id {}\n", epoch_id, _next_file_id);
+    for (auto& sst : _sstables) {
+        content.append(fmt::format("sstable {}\n", sst->name));
+    }
+    auto tmp_path = _path(kTmpManifestFileName);
+    ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(tmp_path));
+    RETURN_IF_ERROR(wf->append(content));
+    RETURN_IF_ERROR(wf->sync());
+    RETURN_IF_ERROR(wf->close());
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(_dir));
+    RETURN_IF_ERROR(fs->rename_file(tmp_path, _path(kManifestFileName)));
+    return fs->sync_dir(_dir);
+}
+
+Status PersistentStateTable::_remove_unused_files() {
+    std::unordered_set<std::string> used_files{kManifestFileName};
+    for (auto& sst : _sstables) {
+        used_files.insert(sst->name);
+    }
+    std::vector<std::string> files;
+    RETURN_IF_ERROR(fs::get_children(_dir, &files));
+    for (auto& name : files) {
+        if (used_files.count(name) == 0) {
+            VLOG_ROW << "[PersistentStateTable] remove unused file " << _path(name);
+            RETURN_IF_ERROR(fs::delete_file(_path(name)));
+        }
+    }
+    return Status::OK();
+}
+
+Schema PersistentStateTable::_make_schema_from_slots(const std::vector<SlotDescriptor*>& slots) const {
+    Fields fields;
+    for (auto& slot : slots) {
+        auto field = std::make_shared<Field>(slot->id(), slot->col_name(), slot->type().type, slot->is_nullable());
+        fields.emplace_back(std::move(field));
+    }
+    return Schema(std::move(fields), KeysType::PRIMARY_KEYS, {});
+}
+
+} // namespace starrocks::stream
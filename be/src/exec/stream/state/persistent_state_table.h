@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/schema.h"
+#include "exec/stream/state/state_table.h"
+#include "util/phmap/btree.h"
+
+namespace starrocks::sstable {
+class FilterPolicy;
+class TableBuilder;
+} // namespace starrocks::sstable
+
+namespace starrocks::stream {
+
+/**
+ * `PersistentStateTable` is a `StateTable` backed by the sstables in a local directory, so the state of
+ * the Incremental MV is not limited by the memory and is recovered from the last committed epoch after restart.
+ *
+ * - `write` puts the rows, or the tombstones of the deleted rows, into an in-memory write buffer keyed by the
+ *   encoded primary keys. The write buffer is flushed into a new sstable when it's larger than
+ *   `config::stream_state_table_write_buffer_size`.
+ * - `seek` looks up the keys in the write buffer first, then in the sstables from the newest one, and each
+ *   sstable is probed by one batched `MultiGet` for all the keys not found yet.
+ * - `commit` is called when the epoch is finished in this driver, and only flushes the changes of the epoch into
+ *   a new sstable. All the sstables are merged into one when there are more than
+ *   `config::stream_state_table_max_sstables`.
+ * - `publish_epoch` checkpoints the epoch after FE commits it globally, by replacing the manifest of the
+ *   committed sstables atomically. So the epoch is still discarded if FE fails to commit it.
+ *
+ * The sstables of an epoch which is not published are not in the manifest, and are removed by `open`,
+ * or by `reset_epoch` before the epoch is retried. `open` fails if the manifest is not at the epoch which
+ * FE resumes the MV from, e.g. FE committed an epoch whose COMMIT_EPOCH didn't reach this BE.
+ */
+class PersistentStateTable : public StateTable {
+public:
+    // The columns of the written chunks are assigned as _k_num | _v_num, the same as MemStateTable.
+    PersistentStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, std::string dir);
+    ~PersistentStateTable() override;
+
+    [[nodiscard]] Status prepare(RuntimeState* state) override;
+    [[nodiscard]] Status open(RuntimeState* state) override;
+
+    [[nodiscard]] Status seek(const Columns& keys, StateTableResult& values) const override;
+    [[nodiscard]] Status seek(const Columns& keys, const std::vector<uint8_t>& selection,
+                              StateTableResult& values) const override;
+    [[nodiscard]] Status seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                              StateTableResult& values) const override;
+    ChunkIteratorPtrOr prefix_scan(const Columns& keys, size_t row_idx) const override;
+    ChunkIteratorPtrOr prefix_scan(const std::vector<std::string>& projection_columns, const Columns& keys,
+                                   size_t row_idx) const override;
+
+    [[nodiscard]] Status write(RuntimeState* state, const StreamChunkPtr& chunk) override;
+    // Flush the changes of the current epoch, whose id is from the `StreamEpochManager` of the query.
+    [[nodiscard]] Status commit(RuntimeState* state) override;
+    // Checkpoint the epoch flushed by `commit`.
+    [[nodiscard]] Status publish_epoch(RuntimeState* state, int64_t epoch_id) override;
+    // Discard the changes since the last published epoch, if any.
+    [[nodiscard]] Status reset_epoch(RuntimeState* state) override;
+
+    // -1 if no epoch is published.
+    int64_t committed_epoch_id() const { return _committed_epoch_id; }
+    // The epoch flushed by `commit` and not published yet, -1 if none.
+    int64_t finished_epoch_id() const { return _finished_epoch_id; }
+    size_t num_sstables() const { return _sstables.size(); }
+    size_t write_buffer_bytes() const { return _write_buffer_bytes; }
+
+private:
+    struct Sstable;
+
+    void _put(std::string key, std::string value);
+    [[nodiscard]] Status _flush_write_buffer();
+    // Merge all the sstables into one and drop the deleted rows.
+    [[nodiscard]] Status _compact();
+    [[nodiscard]] StatusOr<std::unique_ptr<Sstable>> _build_sstable(
+            const std::function<Status(sstable::TableBuilder*)>& add_entries);
+    [[nodiscard]] StatusOr<std::unique_ptr<Sstable>> _open_sstable(const std::string& name) const;
+
+    [[nodiscard]] Status _load_manifest();
+    [[nodiscard]] Status _write_manifest(int64_t epoch_id);
+    // Remove the files which are not in the manifest, e.g. the sstables of an epoch which failed to commit.
+    [[nodiscard]] Status _remove_unused_files();
+
+    Schema _make_schema_from_slots(const std::vector<SlotDescriptor*>& slots) const;
+    std::string _path(const std::string& name) const { return _dir + "/" + name; }
+
+    const std::vector<SlotDescriptor*> _slots;
+    const size_t _k_num;
+    const size_t _cols_num;
+    const std::string _dir;
+    // value's schema
+    Schema _v_schema;
+
+    // encoded keys -> value tag + encoded values
+    phmap::btree_map<std::string, std::string> _write_buffer;
+    size_t _write_buffer_bytes = 0;
+
+    std::unique_ptr<sstable::FilterPolicy> _filter_policy;
+    // From the oldest to the newest, including the ones flushed in the current epoch.
+    std::vector<std::unique_ptr<Sstable>> _sstables;
+    // The files replaced by the compaction, which are removed after the manifest is replaced.
+    std::vector<std::string> _obsolete_files;
+    int64_t _next_file_id = 0;
+    int64_t _committed_epoch_id = -1;
+    int64_t _finished_epoch_id = -1;
+    // Whether there are changes written since the last published epoch.
+    bool _has_uncommitted_changes = false;
+};
+
+} // namespace starrocks::stream
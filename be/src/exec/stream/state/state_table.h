@@ -71,6 +71,10 @@ public:
     // Commit the flushed state data to be used in the later transaction.
     [[nodiscard]] virtual Status commit(RuntimeState* state) = 0;
 
+    // Called after FE commits the epoch globally, then the data committed by `commit` in the epoch is the
+    // state to recover from. Until then, the epoch can still be discarded by `reset_epoch`.
+    [[nodiscard]] virtual Status publish_epoch(RuntimeState* state, int64_t epoch_id) = 0;
+
     [[nodiscard]] virtual Status reset_epoch(RuntimeState* state) = 0;
 };
 
@@ -18,6 +18,7 @@
 #include <type_traits>
 
 #include "column/column.h"
+#include "types/logical_type.h"
 
 namespace starrocks {
 class FunctionContext;
@@ -42,6 +43,29 @@ enum AggStateTableKind { RESULT = 0, INTERMEDIATE = 1, DETAIL_RESULT = 2, DETAIL
 using AggDataPtr = uint8_t*;
 using ConstAggDataPtr = const uint8_t*;
 
+// The description of how a simple aggregate function updates its state with a row, with which the updates of
+// several aggregate functions are compiled into one loop over the states by JIT.
+// See JITEngine::compile_aggregate_function.
+struct JITAggregateUpdate {
+    enum Kind : uint8_t { SUM = 0, COUNT = 1, MIN = 2, MAX = 3, AVG = 4 };
+
+    Kind kind = COUNT;
+    // The type of the argument, TYPE_NULL if the argument is not read, e.g. count(*).
+    LogicalType arg_type = TYPE_NULL;
+    // The type of the sum, min or max value in the state.
+    LogicalType value_type = TYPE_NULL;
+    // The offsets of the fields in the aggregate states of a group, -1 if the field doesn't exist.
+    int64_t value_offset = -1;
+    int64_t count_offset = -1;
+    // The is_null flag of the nullable aggregate function, which is cleared once the state is updated.
+    int64_t null_flag_offset = -1;
+    // Rows of null arguments don't update the state.
+    bool skip_null = false;
+
+    // Whether the argument column is an input of the compiled function.
+    bool has_input() const { return arg_type != TYPE_NULL || skip_null; }
+};
+
 // Aggregate function interface
 // Aggregate function instances don't contain aggregation state, the aggregation state is stored in
 // other objects
@@ -160,6 +184,10 @@ public:
     virtual void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                               AggDataPtr* states) const = 0;
 
+    // Describe the update of update_batch for the state at |state_offset|,
+    // return false if the update can't be compiled by JIT.
+    virtual bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const { return false; }
+
     // filter[i] = 0, will be update
     virtual void update_batch_selectively(FunctionContext* ctx, size_t chunk_size, size_t state_offset,
                                           const Column** columns, AggDataPtr* states,
@@ -309,6 +337,14 @@ public:
     size_t alignof_size() const final { return alignof(State); }
 
     bool is_pod_state() const override { return pod_state(); }
+
+protected:
+    // The offset of a field in the state, offsetof is not used since some states are not standard-layout.
+    template <typename Field>
+    static int64_t field_offset(Field State::*field) {
+        State state;
+        return reinterpret_cast<const uint8_t*>(&(state.*field)) - reinterpret_cast<const uint8_t*>(&state);
+    }
 };
 
 template <typename State, typename Derived>
@@ -119,6 +119,19 @@ public:
         do_update<true>(ctx, columns, state, row_num);
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        // the conversion from int128 to double needs the runtime library
+        if constexpr (lt_is_arithmetic<LT> && !lt_is_largeint<LT>) {
+            update->kind = JITAggregateUpdate::AVG;
+            update->arg_type = LT;
+            update->value_type = ImmediateLT;
+            update->value_offset = state_offset + this->field_offset(&AvgAggregateState<ImmediateType>::sum);
+            update->count_offset = state_offset + this->field_offset(&AvgAggregateState<ImmediateType>::count);
+            return true;
+        }
+        return false;
+    }
+
     AggStateTableKind agg_state_table_kind(bool is_append_only) const override {
         return AggStateTableKind::INTERMEDIATE;
     }
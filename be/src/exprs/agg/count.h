@@ -48,6 +48,12 @@ public:
         ++this->data(state).count;
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        update->kind = JITAggregateUpdate::COUNT;
+        update->count_offset = state_offset + this->field_offset(&AggregateCountFunctionState<IsWindowFunc>::count);
+        return true;
+    }
+
     AggStateTableKind agg_state_table_kind(bool is_append_only) const override { return AggStateTableKind::RESULT; }
 
     void retract(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
@@ -164,6 +170,13 @@ public:
         this->data(state).count += !columns[0]->is_null(row_num);
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        update->kind = JITAggregateUpdate::COUNT;
+        update->count_offset = state_offset + this->field_offset(&AggregateCountFunctionState<IsWindowFunc>::count);
+        update->skip_null = true;
+        return true;
+    }
+
     void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                       AggDataPtr* states) const override {
         if (columns[0]->has_null()) {
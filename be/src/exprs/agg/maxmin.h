@@ -151,6 +151,18 @@ public:
         OP()(this->data(state), value);
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        if constexpr (lt_is_arithmetic<LT>) {
+            constexpr bool is_max = std::is_same_v<OP, MaxElement<LT, State>>;
+            update->kind = is_max ? JITAggregateUpdate::MAX : JITAggregateUpdate::MIN;
+            update->arg_type = LT;
+            update->value_type = LT;
+            update->value_offset = state_offset + this->field_offset(&State::result);
+            return true;
+        }
+        return false;
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
@@ -285,6 +285,20 @@ public:
         this->nested_function->update(ctx, data_columns, this->data(state).mutable_nest_state(), row_num);
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        if constexpr (IgnoreNull) {
+            size_t nested_offset = state_offset + this->field_offset(&State::_nested_state);
+            // the nested function reads the data column of the nullable argument
+            if (!this->nested_function->get_jit_update(nested_offset, update) || update->skip_null) {
+                return false;
+            }
+            update->skip_null = true;
+            update->null_flag_offset = state_offset + this->field_offset(&State::is_null);
+            return true;
+        }
+        return false;
+    }
+
     // TODO(kks): abstract the AVX2 filter process later
     void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                       AggDataPtr* states) const override {
@@ -62,6 +62,17 @@ public:
         this->data(state).sum += column.get_data()[row_num];
     }
 
+    bool get_jit_update(size_t state_offset, JITAggregateUpdate* update) const override {
+        if constexpr (lt_is_arithmetic<LT>) {
+            update->kind = JITAggregateUpdate::SUM;
+            update->arg_type = LT;
+            update->value_type = ResultLT;
+            update->value_offset = state_offset + this->field_offset(&SumAggregateState<ResultType>::sum);
+            return true;
+        }
+        return false;
+    }
+
     AggStateTableKind agg_state_table_kind(bool is_append_only) const override { return AggStateTableKind::RESULT; }
 
     void retract(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
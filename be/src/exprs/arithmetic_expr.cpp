@@ -126,7 +126,13 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit(Type);
+        if constexpr (lt_is_decimal<Type>) {
+            // The overflowed results are null in the compiled code, which can't report overflow errors.
+            return state->can_jit_expr(CompilableExprType::ARITHMETIC) &&
+                   (is_add_op<OP> || is_sub_op<OP> || is_mul_op<OP>) && is_nullable() && !state->error_if_overflow();
+        } else {
+            return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit_number(Type);
+        }
     }
 
     std::string jit_func_name_impl(RuntimeState* state) const override {
@@ -140,8 +146,9 @@ public:
         ASSIGN_OR_RETURN(datums[1], _children[1]->generate_ir(context, jit_ctx))
 
         if constexpr (lt_is_decimal<Type>) {
-            // TODO(yueyang): Implement decimal arithmetic in LLVM IR.
-            return Status::NotSupported("JIT of decimal arithmetic not support");
+            using DecimalFunction = DecimalBinaryFunction<OverflowMode::OUTPUT_NULL, OP>;
+            return DecimalFunction::template generate_ir<Type>(jit_ctx->builder, datums, _children[0]->type().scale,
+                                                               _children[1]->type().scale);
         } else {
             using ArithmeticOp = ArithmeticBinaryOperator<OP, Type>;
             using CppType = RunTimeCppType<Type>;
@@ -197,7 +204,8 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::DIV) && Type != TYPE_LARGEINT && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::DIV) && Type != TYPE_LARGEINT &&
+               IRHelper::support_jit_number(Type);
     }
 
     JitScore compute_jit_score(RuntimeState* state) const override {
@@ -292,7 +300,8 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::MOD) && Type != TYPE_LARGEINT && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::MOD) && Type != TYPE_LARGEINT &&
+               IRHelper::support_jit_number(Type);
     }
 
     JitScore compute_jit_score(RuntimeState* state) const override {
@@ -352,7 +361,7 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit_number(Type);
     }
 
     JitScore compute_jit_score(RuntimeState* state) const override {
@@ -405,7 +414,7 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::ARITHMETIC) && IRHelper::support_jit_number(Type);
     }
 
     JitScore compute_jit_score(RuntimeState* state) const override {
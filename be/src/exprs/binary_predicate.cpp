@@ -133,7 +133,7 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit_compare(Type);
     }
 
     JitScore compute_jit_score(RuntimeState* state) const override {
@@ -152,62 +152,74 @@ public:
     }
 
     StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
-        if constexpr (lt_is_decimal<Type>) {
-            // TODO(yueyang): Implement decimal cmp in LLVM IR.
-            return Status::NotSupported("JIT of decimal cmp not support");
-        } else {
-            std::vector<LLVMDatum> datums(2);
-            ASSIGN_OR_RETURN(datums[0], _children[0]->generate_ir(context, jit_ctx))
-            ASSIGN_OR_RETURN(datums[1], _children[1]->generate_ir(context, jit_ctx))
-
-            auto* l = datums[0].value;
-            auto* r = datums[1].value;
-            auto& b = jit_ctx->builder;
-            LLVMDatum result(b);
-            if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalEq<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpOEQ(l, r);
-                } else {
-                    result.value = b.CreateICmpEQ(l, r);
-                }
-            } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalNe<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpUNE(l, r);
-                } else {
-                    result.value = b.CreateICmpNE(l, r);
-                }
-            } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalLt<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpOLT(l, r);
-                } else {
-                    result.value = b.CreateICmpSLT(l, r);
-                }
-            } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalLe<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpOLE(l, r);
-                } else {
-                    result.value = b.CreateICmpSLE(l, r);
-                }
-            } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalGt<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpOGT(l, r);
-                } else {
-                    result.value = b.CreateICmpSGT(l, r);
-                }
-            } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalGe<Type>>>) {
-                if constexpr (lt_is_float<Type>) {
-                    result.value = b.CreateFCmpOGE(l, r);
-                } else {
-                    result.value = b.CreateICmpSGE(l, r);
+        std::vector<LLVMDatum> datums(2);
+        ASSIGN_OR_RETURN(datums[0], _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(datums[1], _children[1]->generate_ir(context, jit_ctx))
+
+        auto* l = datums[0].value;
+        auto* r = datums[1].value;
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        if constexpr (lt_is_string<Type>) {
+            if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalEq<Type>>> ||
+                          std::is_same_v<OP, BinaryPredFunc<EvalNe<Type>>>) {
+                result.value = IRHelper::build_string_equal(b, jit_ctx->module, l, r);
+                if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalNe<Type>>>) {
+                    result.value = b.CreateNot(result.value);
                 }
+                result.value = b.CreateIntCast(result.value, b.getInt8Ty(), false);
+                result.null_flag = b.CreateOr(datums[0].null_flag, datums[1].null_flag);
+                return result;
+            }
+            // Compare the result of memcompare with 0.
+            l = IRHelper::build_string_compare(b, jit_ctx->module, l, r);
+            r = b.getInt32(0);
+        }
+
+        // Decimals of the same type, dates and datetimes are compared as signed integers.
+        if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalEq<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpOEQ(l, r);
+            } else {
+                result.value = b.CreateICmpEQ(l, r);
+            }
+        } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalNe<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpUNE(l, r);
+            } else {
+                result.value = b.CreateICmpNE(l, r);
+            }
+        } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalLt<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpOLT(l, r);
+            } else {
+                result.value = b.CreateICmpSLT(l, r);
+            }
+        } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalLe<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpOLE(l, r);
             } else {
-                LOG(WARNING) << "unsupported cmp op";
-                return Status::InternalError("unsupported cmp op");
+                result.value = b.CreateICmpSLE(l, r);
             }
-            result.value = b.CreateIntCast(result.value, b.getInt8Ty(), false);
-            result.null_flag = b.CreateOr(datums[0].null_flag, datums[1].null_flag);
-            return result;
+        } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalGt<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpOGT(l, r);
+            } else {
+                result.value = b.CreateICmpSGT(l, r);
+            }
+        } else if constexpr (std::is_same_v<OP, BinaryPredFunc<EvalGe<Type>>>) {
+            if constexpr (lt_is_float<Type>) {
+                result.value = b.CreateFCmpOGE(l, r);
+            } else {
+                result.value = b.CreateICmpSGE(l, r);
+            }
+        } else {
+            LOG(WARNING) << "unsupported cmp op";
+            return Status::InternalError("unsupported cmp op");
         }
+        result.value = b.CreateIntCast(result.value, b.getInt8Ty(), false);
+        result.null_flag = b.CreateOr(datums[0].null_flag, datums[1].null_flag);
+        return result;
     }
 
     std::string jit_func_name_impl(RuntimeState* state) const override {
@@ -428,7 +440,7 @@ public:
     }
 
     bool is_compilable(RuntimeState* state) const override {
-        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(Type);
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit_compare(Type);
     }
 
     StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
@@ -436,28 +448,25 @@ public:
         ASSIGN_OR_RETURN(datums[0], _children[0]->generate_ir(context, jit_ctx))
         ASSIGN_OR_RETURN(datums[1], _children[1]->generate_ir(context, jit_ctx))
         auto& b = jit_ctx->builder;
-        if constexpr (lt_is_decimal<Type>) {
-            // TODO(yueyang): Implement decimal cmp in LLVM IR.
-            return Status::NotSupported("JIT of decimal null eq not support");
+        LLVMDatum result(b);
+        auto* l = datums[0].value;
+        auto* r = datums[1].value;
+        auto* l_null = datums[0].null_flag;
+        auto* r_null = datums[1].null_flag;
+        auto* if_value = IRHelper::bool_to_cond(b, b.CreateAnd(l_null, r_null));
+        auto* elseif_value = IRHelper::bool_to_cond(b, b.CreateXor(l_null, r_null));
+        llvm::Value* cmp;
+        if constexpr (lt_is_string<Type>) {
+            cmp = IRHelper::build_string_equal(b, jit_ctx->module, l, r);
+        } else if constexpr (lt_is_float<Type>) {
+            cmp = b.CreateFCmpOEQ(l, r);
         } else {
-            LLVMDatum result(b);
-            auto* l = datums[0].value;
-            auto* r = datums[1].value;
-            auto* l_null = datums[0].null_flag;
-            auto* r_null = datums[1].null_flag;
-            auto* if_value = IRHelper::bool_to_cond(b, b.CreateAnd(l_null, r_null));
-            auto* elseif_value = IRHelper::bool_to_cond(b, b.CreateXor(l_null, r_null));
-            llvm::Value* cmp;
-            if constexpr (lt_is_float<Type>) {
-                cmp = b.CreateFCmpOEQ(l, r);
-            } else {
-                cmp = b.CreateICmpEQ(l, r);
-            }
-            cmp = b.CreateIntCast(cmp, b.getInt8Ty(), false);
-            result.value = b.CreateSelect(if_value, b.getInt8(1), b.CreateSelect(elseif_value, b.getInt8(0), cmp));
-            // always not null
-            return result;
+            cmp = b.CreateICmpEQ(l, r);
         }
+        cmp = b.CreateIntCast(cmp, b.getInt8Ty(), false);
+        result.value = b.CreateSelect(if_value, b.getInt8(1), b.CreateSelect(elseif_value, b.getInt8(0), cmp));
+        // always not null
+        return result;
     }
 
     std::string jit_func_name_impl(RuntimeState* state) const override {
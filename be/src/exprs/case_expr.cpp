@@ -118,10 +118,12 @@ public:
     }
 
     StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
-        if constexpr (lt_is_decimal<WhenType> || lt_is_decimal<ResultType>) {
-            // TODO(yueyang): Implement case...when in LLVM IR.
-            return Status::NotSupported("JIT of case..when..else...end not support");
-        } else if constexpr (lt_is_number<WhenType> && lt_is_number<ResultType>) {
+        // Decimals, dates and datetimes are stored and compared as integers.
+        constexpr bool when_type_supported =
+                lt_is_number<WhenType> || lt_is_decimal<WhenType> || lt_is_date_or_datetime<WhenType>;
+        constexpr bool result_type_supported =
+                lt_is_number<ResultType> || lt_is_decimal<ResultType> || lt_is_date_or_datetime<ResultType>;
+        if constexpr (when_type_supported && result_type_supported) {
             auto& b = jit_ctx->builder;
             auto* head = b.GetInsertBlock();
             auto* join = llvm::BasicBlock::Create(head->getContext(), "join_block", head->getParent());
@@ -151,7 +153,7 @@ public:
                         b.CreateBr(else_block);
                     } else { // if (whenExpr !=null & caseExpr = whenExpr), store the result
                         llvm::Value* cmp_eq = nullptr;
-                        if constexpr (lt_is_float<ResultType>) {
+                        if constexpr (lt_is_float<WhenType>) {
                             cmp_eq = b.CreateFCmpOEQ(datum_0.value, datum_i.value);
                         } else {
                             cmp_eq = b.CreateICmpEQ(datum_0.value, datum_i.value);
@@ -39,6 +39,7 @@
 #include "exprs/column_ref.h"
 #include "exprs/decimal_cast_expr.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/json_functions.h"
 #include "exprs/unary_function.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h"
@@ -144,7 +145,7 @@ DEFINE_UNARY_FN_WITH_IMPL(TimeToNumber, value) {
 }
 
 template <LogicalType FromType, LogicalType ToType, bool AllowThrowException>
-static ColumnPtr cast_to_json_fn(ColumnPtr& column) {
+static ColumnPtr cast_to_json_fn_impl(ColumnPtr& column) {
     ColumnViewer<FromType> viewer(column);
     ColumnBuilder<TYPE_JSON> builder(viewer.size());
 
@@ -204,6 +205,21 @@ static ColumnPtr cast_to_json_fn(ColumnPtr& column) {
     return {};
 }
 
+template <LogicalType FromType, LogicalType ToType, bool AllowThrowException>
+static ColumnPtr cast_to_json_fn(ColumnPtr& column) {
+    if constexpr (lt_is_string<FromType>) {
+        // The strings cast by many expressions, e.g. col->'$.a' and col->'$.b', are parsed once.
+        if (auto* cache = JsonParseCache::current(); cache != nullptr) {
+            constexpr auto kind = AllowThrowException ? JsonParseCache::ParseKind::CAST_TO_JSON_THROW_EXCEPTION
+                                                      : JsonParseCache::ParseKind::CAST_TO_JSON;
+            return cache->get_or_parse(column, kind, [&]() {
+                return cast_to_json_fn_impl<FromType, ToType, AllowThrowException>(column);
+            });
+        }
+    }
+    return cast_to_json_fn_impl<FromType, ToType, AllowThrowException>(column);
+}
+
 template <LogicalType FromType, LogicalType ToType, bool AllowThrowException>
 static ColumnPtr cast_from_json_fn(ColumnPtr& column) {
     ColumnViewer<TYPE_JSON> viewer(column);
@@ -1120,7 +1136,8 @@ public:
 
     bool is_compilable(RuntimeState* state) const override {
         return state->can_jit_expr(CompilableExprType::CAST) && !AllowThrowException && FromType != TYPE_LARGEINT &&
-               ToType != TYPE_LARGEINT && IRHelper::support_jit(FromType) && IRHelper::support_jit(ToType);
+               ToType != TYPE_LARGEINT && IRHelper::support_jit_number(FromType) &&
+               IRHelper::support_jit_number(ToType);
     }
 
     std::string jit_func_name_impl(RuntimeState* state) const override {
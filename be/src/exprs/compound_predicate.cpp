@@ -14,9 +14,16 @@
 
 #include "exprs/compound_predicate.h"
 
+#include <algorithm>
+#include <map>
+
+#include "column/column_viewer.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/like_predicate.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -123,7 +130,23 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    // The merged patterns refer to the children, which are copied separately, so they are merged again on prepare.
+    VectorizedOrCompoundPredicate(const VectorizedOrCompoundPredicate& other) : Predicate(other) {}
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        // The nested ORs are prepared after their parent, so they are skipped once merged into the parent.
+        if (!_pattern_matcher_checked) {
+            _pattern_matcher_checked = true;
+            RETURN_IF_ERROR(_prepare_pattern_matcher());
+        }
+        return Expr::prepare(state, context);
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_pattern_matcher != nullptr) {
+            return _evaluate_with_pattern_matcher(context, ptr);
+        }
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -178,9 +201,125 @@ public:
         out << "VectorizedOrCompoundPredicate ("
             << "lhs=" << _children[0]->type().debug_string() << ", rhs=" << _children[1]->type().debug_string()
             << ", result=" << this->type().debug_string() << ", lhs_is_constant=" << _children[0]->is_constant()
-            << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
+            << ", rhs_is_constant=" << _children[1]->is_constant() << ", merged_patterns="
+            << (_pattern_matcher != nullptr ? _pattern_matcher->num_patterns() : 0) << ", expr ("
+            << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    static constexpr int64_t LIKE_FUNCTION_ID = 60010;
+    static constexpr int64_t REGEXP_FUNCTION_ID = 60020;
+
+    // Collect the operands of this OR and the nested ORs.
+    void _collect_operands(std::vector<Expr*>* operands, std::vector<VectorizedOrCompoundPredicate*>* nested_ors) {
+        for (Expr* child : _children) {
+            auto* nested_or = dynamic_cast<VectorizedOrCompoundPredicate*>(child);
+            if (nested_or != nullptr) {
+                nested_ors->emplace_back(nested_or);
+                nested_or->_collect_operands(operands, nested_ors);
+            } else {
+                operands->emplace_back(child);
+            }
+        }
+    }
+
+    // Whether the expr is a LIKE or REGEXP on a string column with a constant pattern.
+    static bool _is_pattern_match_on_column(Expr* expr) {
+        if ((expr->node_type() != TExprNodeType::FUNCTION_CALL &&
+             expr->node_type() != TExprNodeType::COMPUTE_FUNCTION_CALL) ||
+            (expr->fn().fid != LIKE_FUNCTION_ID && expr->fn().fid != REGEXP_FUNCTION_ID) ||
+            expr->get_num_children() != 2) {
+            return false;
+        }
+        Expr* value = expr->get_child(0);
+        return value->node_type() == TExprNodeType::SLOT_REF &&
+               (value->type().type == TYPE_VARCHAR || value->type().type == TYPE_CHAR) &&
+               expr->get_child(1)->node_type() == TExprNodeType::STRING_LITERAL;
+    }
+
+    // Merge the LIKE and REGEXP patterns on the same column of the OR tree into one MultiPatternMatcher.
+    Status _prepare_pattern_matcher() {
+        const int min_patterns = config::like_multi_pattern_min_patterns;
+        if (min_patterns <= 0) {
+            return Status::OK();
+        }
+        std::vector<Expr*> operands;
+        std::vector<VectorizedOrCompoundPredicate*> nested_ors;
+        _collect_operands(&operands, &nested_ors);
+        // The nested ORs have no more patterns to merge than this one.
+        for (auto* nested_or : nested_ors) {
+            nested_or->_pattern_matcher_checked = true;
+        }
+        if (operands.size() < static_cast<size_t>(min_patterns)) {
+            return Status::OK();
+        }
+
+        // Only the column with the most patterns is merged.
+        std::map<SlotId, std::vector<Expr*>> slot_matches;
+        for (Expr* operand : operands) {
+            if (_is_pattern_match_on_column(operand)) {
+                auto* column_ref = down_cast<ColumnRef*>(operand->get_child(0));
+                slot_matches[column_ref->slot_id()].emplace_back(operand);
+            }
+        }
+        const std::vector<Expr*>* matches = nullptr;
+        for (const auto& [_, exprs] : slot_matches) {
+            if (matches == nullptr || exprs.size() > matches->size()) {
+                matches = &exprs;
+            }
+        }
+        if (matches == nullptr || matches->size() < static_cast<size_t>(min_patterns)) {
+            return Status::OK();
+        }
+
+        auto matcher = std::make_shared<MultiPatternMatcher>();
+        for (Expr* expr : *matches) {
+            ASSIGN_OR_RETURN(auto pattern_column, expr->get_child(1)->evaluate_checked(nullptr, nullptr));
+            ColumnViewer<TYPE_VARCHAR> pattern_viewer(pattern_column);
+            if (expr->fn().fid == LIKE_FUNCTION_ID) {
+                matcher->add_like_pattern(pattern_viewer.value(0));
+            } else {
+                matcher->add_regex_pattern(pattern_viewer.value(0));
+            }
+        }
+        if (Status st = matcher->compile(); !st.ok()) {
+            // Some patterns are not supported by Hyperscan, evaluate them one by one.
+            VLOG(2) << "Failed to merge the patterns of " << matches->size() << " predicates: " << st;
+            return Status::OK();
+        }
+
+        _pattern_matcher = std::move(matcher);
+        _pattern_value_expr = matches->front()->get_child(0);
+        for (Expr* operand : operands) {
+            if (std::find(matches->begin(), matches->end(), operand) == matches->end()) {
+                _other_operands.emplace_back(operand);
+            }
+        }
+        return Status::OK();
+    }
+
+    StatusOr<ColumnPtr> _evaluate_with_pattern_matcher(ExprContext* context, Chunk* ptr) {
+        ASSIGN_OR_RETURN(auto values, _pattern_value_expr->evaluate_checked(context, ptr));
+        ASSIGN_OR_RETURN(auto result, _pattern_matcher->match_any(values));
+        for (Expr* operand : _other_operands) {
+            // all true and not null
+            if (ColumnHelper::count_true_with_notnull(result) == result->size()) {
+                break;
+            }
+            ASSIGN_OR_RETURN(auto r, operand->evaluate_checked(context, ptr));
+            result = VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(
+                    result, r);
+        }
+        return result;
+    }
+
+    bool _pattern_matcher_checked = false;
+    // All the LIKE and REGEXP patterns on `_pattern_value_expr` in this OR and the nested ORs, which are evaluated
+    // by one scan of the values instead of the children, with `_other_operands`.
+    std::shared_ptr<MultiPatternMatcher> _pattern_matcher;
+    Expr* _pattern_value_expr = nullptr;
+    std::vector<Expr*> _other_operands;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
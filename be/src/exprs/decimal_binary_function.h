@@ -205,17 +205,44 @@ struct DecimalBinaryFunction {
         }
     }
 
-    template <LogicalType LhsType, LogicalType RhsType, LogicalType ResultType>
-    static llvm::Value* generate_ir(llvm::IRBuilder<>& b, llvm::Module& module, llvm::Value* l, llvm::Value* r,
-                                    int l_scale, int r_scale) {
-        using ResultCppType = RunTimeCppType<ResultType>;
+    // Generate the IR of AddOp, SubOp and MulOp of two decimals of the same type, the scales of operands are
+    // adjusted in the same way as evaluate(). The result is null if it overflows.
+    template <LogicalType Type>
+    static StatusOr<LLVMDatum> generate_ir(llvm::IRBuilder<>& b, const std::vector<LLVMDatum>& datums, int lhs_scale,
+                                           int rhs_scale) {
+        static_assert(null_if_overflow<overflow_mode>, "JIT only supports outputting null on overflow");
+        using CppType = RunTimeCppType<Type>;
+        [[maybe_unused]] auto [precision, scale, adjust_scale] =
+                compute_decimal_result_type<CppType, Op>(lhs_scale, rhs_scale);
+
+        if constexpr (!is_add_op<Op> && !is_sub_op<Op> && !is_mul_op<Op>) {
+            return Status::NotSupported(
+                    strings::Substitute("JIT of decimal '$0' operation not support", get_op_name<Op>()));
+        }
+        constexpr auto op = is_add_op<Op>   ? llvm::Intrinsic::sadd_with_overflow
+                            : is_sub_op<Op> ? llvm::Intrinsic::ssub_with_overflow
+                                            : llvm::Intrinsic::smul_with_overflow;
 
-        // TODO(Yueyang): handle scale.
-        auto [precision, scale, adjust_scale] = compute_decimal_result_type<ResultCppType, Op>(l_scale, r_scale);
+        auto* l = datums[0].value;
+        auto* r = datums[1].value;
+        llvm::Value* overflow = b.getFalse();
+        if ((is_add_op<Op> || is_sub_op<Op>) && adjust_scale != 0) {
+            // scale up the operand with the smaller scale
+            auto* scale_factor = b.CreateIntCast(IRHelper::create_ir_int128(b, get_scale_factor<CppType>(adjust_scale)),
+                                                 l->getType(), true);
+            auto& operand = lhs_scale < rhs_scale ? l : r;
+            std::tie(operand, overflow) =
+                    IRHelper::build_overflow_arithmetic(b, llvm::Intrinsic::smul_with_overflow, operand, scale_factor);
+        }
 
-        using BinaryOperator = ArithmeticBinaryOperator<Op, ResultType>;
+        auto [value, value_overflow] = IRHelper::build_overflow_arithmetic(b, op, l, r);
+        overflow = b.CreateOr(overflow, value_overflow);
 
-        return nullptr;
+        LLVMDatum result;
+        result.value = value;
+        result.null_flag = b.CreateOr(b.CreateOr(datums[0].null_flag, datums[1].null_flag),
+                                      b.CreateZExt(overflow, b.getInt8Ty()));
+        return result;
     }
 
     template <LogicalType LhsType, LogicalType RhsType, LogicalType ResultType>
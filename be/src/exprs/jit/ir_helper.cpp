@@ -18,16 +18,28 @@
 #include "common/status.h"
 #include "common/statusor.h"
 #include "types/logical_type.h"
+#include "util/unaligned_access.h"
 
 namespace starrocks {
 
 bool IRHelper::support_jit(const LogicalType& type) {
+    return support_jit_number(type) || type == TYPE_DECIMAL32 || type == TYPE_DECIMAL64 ||
+           type == TYPE_DECIMAL128                       // Decimal types, the scales are kept in the expr types;
+           || type == TYPE_DATE || type == TYPE_DATETIME // Date types, the julian day and the timestamp;
+            ;
+}
+
+bool IRHelper::support_jit_number(const LogicalType& type) {
     return type == TYPE_BOOLEAN || type == TYPE_TINYINT || type == TYPE_SMALLINT || type == TYPE_INT ||
            type == TYPE_BIGINT || type == TYPE_LARGEINT // Integer types;
            || type == TYPE_FLOAT || type == TYPE_DOUBLE // Floating point types;
             ;
 }
 
+bool IRHelper::support_jit_compare(const LogicalType& type) {
+    return support_jit(type) || is_string_type(type);
+}
+
 // This code should be synchronized with corresponding section in type_traits.h .
 StatusOr<llvm::Type*> IRHelper::logical_to_ir_type(llvm::IRBuilder<>& b, const LogicalType& type) {
     switch (type) {
@@ -50,11 +62,15 @@ StatusOr<llvm::Type*> IRHelper::logical_to_ir_type(llvm::IRBuilder<>& b, const L
         return b.getFloatTy();
     case TYPE_DOUBLE:
         return b.getDoubleTy();
+    case TYPE_DATE:
+        return b.getInt32Ty();
+    case TYPE_DATETIME:
+        return b.getInt64Ty();
     case TYPE_CHAR:
     case TYPE_VARCHAR:
+        // Same with Slice.
+        return llvm::StructType::get(b.getInt8PtrTy(), b.getInt64Ty());
     case TYPE_TIME:
-    case TYPE_DATE:
-    case TYPE_DATETIME:
     case TYPE_DECIMALV2:
     case TYPE_VARBINARY:
     default:
@@ -72,16 +88,15 @@ StatusOr<llvm::Value*> IRHelper::create_ir_number(llvm::IRBuilder<>& b, const Lo
         return b.getInt16(value);
     case TYPE_INT:
     case TYPE_DECIMAL32:
+    case TYPE_DATE:
         return b.getInt32(value);
     case TYPE_BIGINT:
     case TYPE_DECIMAL64:
+    case TYPE_DATETIME:
         return b.getInt64(value);
     case TYPE_LARGEINT:
-    case TYPE_DECIMAL128: {
-        // TODO(Yueyang): test this.
-        llvm::APInt value_128(128, value, true);
-        return llvm::ConstantInt::get(b.getContext(), value_128);
-    }
+    case TYPE_DECIMAL128:
+        return create_ir_int128(b, value);
     case TYPE_FLOAT:
         return llvm::ConstantFP::get(b.getFloatTy(), value);
     case TYPE_DOUBLE:
@@ -89,8 +104,6 @@ StatusOr<llvm::Value*> IRHelper::create_ir_number(llvm::IRBuilder<>& b, const Lo
     case TYPE_CHAR:
     case TYPE_VARCHAR:
     case TYPE_TIME:
-    case TYPE_DATE:
-    case TYPE_DATETIME:
     case TYPE_DECIMALV2:
     case TYPE_VARBINARY:
     default:
@@ -109,24 +122,23 @@ StatusOr<llvm::Value*> IRHelper::load_ir_number(llvm::IRBuilder<>& b, const Logi
         return b.getInt16(reinterpret_cast<const int16_t*>(value)[0]);
     case TYPE_INT:
     case TYPE_DECIMAL32:
+    case TYPE_DATE:
         return b.getInt32(reinterpret_cast<const int32_t*>(value)[0]);
     case TYPE_BIGINT:
     case TYPE_DECIMAL64:
+    case TYPE_DATETIME:
         return b.getInt64(reinterpret_cast<const int64_t*>(value)[0]);
     case TYPE_LARGEINT:
-    case TYPE_DECIMAL128: {
-        llvm::APInt value_128(128, reinterpret_cast<const int128_t*>(value)[0], true);
-        return llvm::ConstantInt::get(b.getContext(), value_128);
-    }
+    case TYPE_DECIMAL128:
+        return create_ir_int128(b, unaligned_load<int128_t>(value));
     case TYPE_FLOAT:
         return llvm::ConstantFP::get(b.getFloatTy(), reinterpret_cast<const float*>(value)[0]);
     case TYPE_DOUBLE:
         return llvm::ConstantFP::get(b.getDoubleTy(), reinterpret_cast<const double*>(value)[0]);
     case TYPE_CHAR:
     case TYPE_VARCHAR:
+        return create_ir_string(b, reinterpret_cast<const Slice*>(value)[0]);
     case TYPE_TIME:
-    case TYPE_DATE:
-    case TYPE_DATETIME:
     case TYPE_DECIMALV2:
     case TYPE_VARBINARY:
     default:
@@ -167,6 +179,83 @@ StatusOr<llvm::Value*> IRHelper::cast_to_type(llvm::IRBuilder<>& b, llvm::Value*
     return Status::NotSupported("JIT cast type not supported.");
 }
 
+llvm::Value* IRHelper::create_ir_int128(llvm::IRBuilder<>& b, int128_t value) {
+    auto unsigned_value = static_cast<unsigned __int128>(value);
+    uint64_t words[2] = {static_cast<uint64_t>(unsigned_value), static_cast<uint64_t>(unsigned_value >> 64)};
+    return llvm::ConstantInt::get(b.getContext(), llvm::APInt(128, words));
+}
+
+llvm::Value* IRHelper::create_ir_string(llvm::IRBuilder<>& b, const Slice& value) {
+    auto* data = b.CreateGlobalStringPtr(llvm::StringRef(value.data, value.size));
+    llvm::Value* str = llvm::UndefValue::get(llvm::StructType::get(b.getInt8PtrTy(), b.getInt64Ty()));
+    str = b.CreateInsertValue(str, data, {0});
+    return b.CreateInsertValue(str, b.getInt64(value.size), {1});
+}
+
+std::pair<llvm::Value*, llvm::Value*> IRHelper::build_overflow_arithmetic(llvm::IRBuilder<>& b, llvm::Intrinsic::ID op,
+                                                                          llvm::Value* l, llvm::Value* r) {
+    auto* type = l->getType();
+    if (op == llvm::Intrinsic::smul_with_overflow && type->getIntegerBitWidth() > 64) {
+        // smul.with.overflow.i128 is lowered to __muloti4 of compiler-rt, which may not exist in the process.
+        // Multiply the absolute values instead, same as int128_mul_overflow.
+        auto* zero = llvm::ConstantInt::get(type, 0);
+        auto* l_negative = b.CreateICmpSLT(l, zero);
+        auto* r_negative = b.CreateICmpSLT(r, zero);
+        auto* l_abs = b.CreateSelect(l_negative, b.CreateNeg(l), l);
+        auto* r_abs = b.CreateSelect(r_negative, b.CreateNeg(r), r);
+        auto* product = b.CreateBinaryIntrinsic(llvm::Intrinsic::umul_with_overflow, l_abs, r_abs);
+        auto* abs_value = b.CreateExtractValue(product, {0});
+        auto* negative = b.CreateXor(l_negative, r_negative);
+        // The absolute value of a negative result can be 2^(n-1), but a positive result can't.
+        auto* signed_max = llvm::ConstantInt::get(type, llvm::APInt::getSignedMaxValue(type->getIntegerBitWidth()));
+        auto* limit = b.CreateAdd(signed_max, b.CreateZExt(negative, type));
+        auto* overflow = b.CreateOr(b.CreateExtractValue(product, {1}), b.CreateICmpUGT(abs_value, limit));
+        return {b.CreateSelect(negative, b.CreateNeg(abs_value), abs_value), overflow};
+    }
+    auto* result = b.CreateBinaryIntrinsic(op, l, r);
+    return {b.CreateExtractValue(result, {0}), b.CreateExtractValue(result, {1})};
+}
+
+static llvm::FunctionCallee get_memcmp(llvm::IRBuilder<>& b, llvm::Module& module) {
+    // Resolved from the process symbols by the JIT engine.
+    auto* func_type =
+            llvm::FunctionType::get(b.getInt32Ty(), {b.getInt8PtrTy(), b.getInt8PtrTy(), b.getInt64Ty()}, false);
+    return module.getOrInsertFunction("memcmp", func_type);
+}
+
+llvm::Value* IRHelper::build_string_compare(llvm::IRBuilder<>& b, llvm::Module& module, llvm::Value* l,
+                                            llvm::Value* r) {
+    auto* l_data = b.CreateExtractValue(l, {0});
+    auto* l_size = b.CreateExtractValue(l, {1});
+    auto* r_data = b.CreateExtractValue(r, {0});
+    auto* r_size = b.CreateExtractValue(r, {1});
+
+    // Same with memcompare: compare the common prefix, then compare the sizes.
+    auto* min_size = b.CreateSelect(b.CreateICmpULT(l_size, r_size), l_size, r_size);
+    auto* res = b.CreateCall(get_memcmp(b, module), {l_data, r_data, min_size});
+    auto* zero = b.getInt32(0);
+    auto* res_sign = b.CreateSub(b.CreateZExt(b.CreateICmpSGT(res, zero), b.getInt32Ty()),
+                                 b.CreateZExt(b.CreateICmpSLT(res, zero), b.getInt32Ty()));
+    auto* size_sign = b.CreateSub(b.CreateZExt(b.CreateICmpUGT(l_size, r_size), b.getInt32Ty()),
+                                  b.CreateZExt(b.CreateICmpULT(l_size, r_size), b.getInt32Ty()));
+    return b.CreateSelect(b.CreateICmpEQ(res, zero), size_sign, res_sign);
+}
+
+llvm::Value* IRHelper::build_string_equal(llvm::IRBuilder<>& b, llvm::Module& module, llvm::Value* l, llvm::Value* r) {
+    auto* l_data = b.CreateExtractValue(l, {0});
+    auto* l_size = b.CreateExtractValue(l, {1});
+    auto* r_data = b.CreateExtractValue(r, {0});
+    auto* r_size = b.CreateExtractValue(r, {1});
+
+    // Only compare the data of the strings of the same size.
+    auto then_func = [&]() -> llvm::Value* {
+        auto* res = b.CreateCall(get_memcmp(b, module), {l_data, r_data, l_size});
+        return b.CreateICmpEQ(res, b.getInt32(0));
+    };
+    auto else_func = [&]() -> llvm::Value* { return b.getFalse(); };
+    return build_if_else(b.CreateICmpEQ(l_size, r_size), b.getInt1Ty(), then_func, else_func, &b);
+}
+
 llvm::Value* IRHelper::build_if_else(llvm::Value* condition, llvm::Type* return_type,
                                      const std::function<llvm::Value*()>& then_func,
                                      const std::function<llvm::Value*()>& else_func, llvm::IRBuilder<>* builder) {
@@ -15,12 +15,14 @@
 #pragma once
 
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Intrinsics.h>
 
 #include <cstdint>
 
 #include "column/type_traits.h"
 #include "common/statusor.h"
 #include "runtime/types.h"
+#include "util/slice.h"
 
 namespace starrocks {
 
@@ -81,15 +83,28 @@ enum CompilableExprType : int32_t {
     LOGICAL = 32,
     DIV = 64,
     MOD = 128,
+    AGGREGATE = 256, // fused update of aggregate functions
 };
 
 class IRHelper {
 public:
     /**
      * @brief Check if the logical type is supported by JIT.
+     * The values of these types are fixed-length, they can be the inputs and the result of JIT functions.
      */
     static bool support_jit(const LogicalType& type);
 
+    /**
+     * @brief Check if the logical type is a boolean, integer or floating point type supported by JIT.
+     */
+    static bool support_jit_number(const LogicalType& type);
+
+    /**
+     * @brief Check if the logical type can be compared in JIT functions, which includes the string types.
+     * Strings are represented as {i8*, i64} same as Slice, so they can only be the inputs of JIT functions.
+     */
+    static bool support_jit_compare(const LogicalType& type);
+
     /**
      * @brief Convert a logical type to its corresponding LLVM IR type.
      * Since the kinds of LLVM IR types can change depending on the hardware we use, we need a flexible method that can adapt to these differences.
@@ -108,6 +123,32 @@ public:
 
     static StatusOr<llvm::Value*> load_ir_number(llvm::IRBuilder<>& b, const LogicalType& type, const uint8_t* value);
 
+    static llvm::Value* create_ir_int128(llvm::IRBuilder<>& b, int128_t value);
+
+    /**
+     * @brief Create a LLVM IR string of {i8*, i64}, the data is copied into the module as a constant.
+     */
+    static llvm::Value* create_ir_string(llvm::IRBuilder<>& b, const Slice& value);
+
+    /**
+     * @brief Build the signed integer add, sub or mul with overflow checking.
+     * @param op llvm::Intrinsic::sadd_with_overflow, ssub_with_overflow or smul_with_overflow.
+     * @return the result and the overflow flag of i1.
+     */
+    static std::pair<llvm::Value*, llvm::Value*> build_overflow_arithmetic(llvm::IRBuilder<>& b, llvm::Intrinsic::ID op,
+                                                                           llvm::Value* l, llvm::Value* r);
+
+    /**
+     * @brief Compare two strings like Slice::compare, return an i32 of -1, 0 or 1.
+     */
+    static llvm::Value* build_string_compare(llvm::IRBuilder<>& b, llvm::Module& module, llvm::Value* l,
+                                             llvm::Value* r);
+
+    /**
+     * @brief Check whether two strings are equal, return an i1.
+     */
+    static llvm::Value* build_string_equal(llvm::IRBuilder<>& b, llvm::Module& module, llvm::Value* l, llvm::Value* r);
+
     /** 
      * @brief Convert a LLVM IR value from one type to another.
      */
@@ -61,6 +61,7 @@
 #include "common/compiler_util.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "exprs/agg/aggregate.h"
 #include "exprs/expr.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
@@ -164,6 +165,20 @@ Status JITEngine::init() {
 
 Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache* func_cache, Expr* expr,
                                           const std::vector<Expr*>& uncompilable_exprs) {
+    return compile_function(func_cache, [&](llvm::Module& module) {
+        return generate_scalar_function_ir(context, module, expr, uncompilable_exprs, func_cache);
+    });
+}
+
+Status JITEngine::compile_aggregate_function(JitObjectCache* func_cache,
+                                             const std::vector<JITAggregateUpdate>& updates) {
+    return compile_function(func_cache, [&](llvm::Module& module) {
+        return generate_aggregate_function_ir(module, updates, func_cache);
+    });
+}
+
+Status JITEngine::compile_function(JitObjectCache* func_cache,
+                                   const std::function<Status(llvm::Module&)>& generate_ir) {
     auto* instance = JITEngine::get_instance();
     if (UNLIKELY(!instance->initialized())) {
         return Status::JitCompileError("JIT engine is not initialized");
@@ -177,7 +192,7 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
     // TODO: check need set module?
     // generate ir to module
-    RETURN_IF_ERROR(generate_scalar_function_ir(context, *engine->module(), expr, uncompilable_exprs, func_cache));
+    RETURN_IF_ERROR(generate_ir(*engine->module()));
     // optimize module and add module
     RETURN_IF_ERROR(engine->optimize_and_finalize_module());
     cached = instance->lookup_function(func_cache);
@@ -271,6 +286,134 @@ Status JITEngine::generate_scalar_function_ir(ExprContext* context, llvm::Module
     return Status::OK();
 }
 
+Status JITEngine::generate_aggregate_function_ir(llvm::Module& module, const std::vector<JITAggregateUpdate>& updates,
+                                                 JitObjectCache* obj) {
+    llvm::IRBuilder<> b(module.getContext());
+
+    /// Create function type.
+    auto* size_type = b.getInt64Ty();
+    // Same with JITColumn.
+    auto* data_type = llvm::StructType::get(b.getInt8PtrTy(), b.getInt8PtrTy());
+    // Same with JITScalarFunction.
+    auto* func_type = llvm::FunctionType::get(b.getVoidTy(), {size_type, data_type->getPointerTo()}, false);
+
+    /// Create function in module.
+    // Pseudo code: void "name"(int64_t rows_count, JITColumn* columns);
+    auto* func = llvm::Function::Create(func_type, llvm::Function::ExternalLinkage, obj->get_func_name(), module);
+    auto* func_args = func->args().begin();
+    llvm::Value* rows_count_arg = func_args++;
+    llvm::Value* columns_arg = func_args++;
+
+    auto* entry = llvm::BasicBlock::Create(b.getContext(), "entry", func);
+    b.SetInsertPoint(entry);
+
+    // Extract the arguments of the updates, which is followed by the column of the aggregate states.
+    std::vector<LLVMColumn> columns(updates.size());
+    size_t num_inputs = 0;
+    for (size_t i = 0; i < updates.size(); ++i) {
+        if (!updates[i].has_input()) {
+            continue;
+        }
+        auto* jit_column = b.CreateLoad(data_type, b.CreateConstInBoundsGEP1_64(data_type, columns_arg, num_inputs++));
+        columns[i].values = b.CreateExtractValue(jit_column, {0});
+        columns[i].null_flags = b.CreateExtractValue(jit_column, {1});
+        if (updates[i].arg_type != TYPE_NULL) {
+            ASSIGN_OR_RETURN(columns[i].value_type, IRHelper::logical_to_ir_type(b, updates[i].arg_type));
+        }
+    }
+    auto* states_column = b.CreateLoad(data_type, b.CreateConstInBoundsGEP1_64(data_type, columns_arg, num_inputs));
+    auto* states = b.CreateExtractValue(states_column, {0});
+
+    /// Initialize loop.
+    auto* end = llvm::BasicBlock::Create(b.getContext(), "end", func);
+    auto* loop = llvm::BasicBlock::Create(b.getContext(), "loop", func);
+
+    b.CreateCondBr(b.CreateICmpEQ(rows_count_arg, llvm::ConstantInt::get(size_type, 0)), end, loop);
+    b.SetInsertPoint(loop);
+    /// Loop.
+    // Pseudo code: for (int64_t counter = 0; counter < rows_count; counter++)
+    auto* counter_phi = b.CreatePHI(rows_count_arg->getType(), 2);
+    counter_phi->addIncoming(llvm::ConstantInt::get(size_type, 0), entry);
+
+    // Pseudo code: AggDataPtr state = states[counter];
+    auto* state = b.CreateLoad(b.getInt8PtrTy(), b.CreateInBoundsGEP(b.getInt8PtrTy(), states, counter_phi));
+    auto field_ptr = [&](int64_t offset) { return b.CreateConstInBoundsGEP1_64(b.getInt8Ty(), state, offset); };
+
+    for (size_t i = 0; i < updates.size(); ++i) {
+        const auto& update = updates[i];
+        llvm::BasicBlock* next = nullptr;
+        if (update.skip_null) {
+            // Pseudo code: if (!null_flags[counter]) { update the state }
+            auto* null_flag = b.CreateLoad(b.getInt8Ty(),
+                                           b.CreateInBoundsGEP(b.getInt8Ty(), columns[i].null_flags, counter_phi));
+            auto* not_null = llvm::BasicBlock::Create(b.getContext(), "not_null", func);
+            next = llvm::BasicBlock::Create(b.getContext(), "next", func);
+            b.CreateCondBr(IRHelper::bool_to_cond(b, null_flag), next, not_null);
+            b.SetInsertPoint(not_null);
+        }
+
+        if (update.value_offset >= 0) {
+            ASSIGN_OR_RETURN(auto* value_type, IRHelper::logical_to_ir_type(b, update.value_type));
+            llvm::Value* arg = b.CreateLoad(
+                    columns[i].value_type, b.CreateInBoundsGEP(columns[i].value_type, columns[i].values, counter_phi));
+            ASSIGN_OR_RETURN(arg, IRHelper::cast_to_type(b, arg, update.arg_type, update.value_type));
+            auto* ptr = field_ptr(update.value_offset);
+            auto* current = b.CreateLoad(value_type, ptr);
+
+            bool is_float = is_float_type(update.value_type);
+            llvm::Value* result = nullptr;
+            switch (update.kind) {
+            case JITAggregateUpdate::SUM:
+            case JITAggregateUpdate::AVG:
+                result = is_float ? b.CreateFAdd(current, arg) : b.CreateAdd(current, arg);
+                break;
+            case JITAggregateUpdate::MAX: {
+                // Same with std::max(current, arg).
+                auto* less = is_float ? b.CreateFCmpOLT(current, arg) : b.CreateICmpSLT(current, arg);
+                result = b.CreateSelect(less, arg, current);
+                break;
+            }
+            case JITAggregateUpdate::MIN: {
+                // Same with std::min(current, arg).
+                auto* less = is_float ? b.CreateFCmpOLT(arg, current) : b.CreateICmpSLT(arg, current);
+                result = b.CreateSelect(less, arg, current);
+                break;
+            }
+            default:
+                return Status::NotSupported("JIT aggregate update not supported");
+            }
+            b.CreateStore(result, ptr);
+        }
+        if (update.count_offset >= 0) {
+            auto* ptr = field_ptr(update.count_offset);
+            b.CreateStore(b.CreateAdd(b.CreateLoad(b.getInt64Ty(), ptr), b.getInt64(1)), ptr);
+        }
+        if (update.null_flag_offset >= 0) {
+            b.CreateStore(b.getInt8(0), field_ptr(update.null_flag_offset));
+        }
+
+        if (next != nullptr) {
+            b.CreateBr(next);
+            b.SetInsertPoint(next);
+        }
+    }
+
+    /// End of loop.
+    auto* current_block = b.GetInsertBlock();
+    // Pseudo code: counter++;
+    auto* incremeted_counter = b.CreateAdd(counter_phi, llvm::ConstantInt::get(size_type, 1));
+    counter_phi->addIncoming(incremeted_counter, current_block);
+
+    // Pseudo code: if (counter == rows_count) goto end;
+    b.CreateCondBr(b.CreateICmpEQ(incremeted_counter, rows_count_arg), end, loop);
+
+    b.SetInsertPoint(end);
+    // Pseudo code: return;
+    b.CreateRetVoid();
+
+    return Status::OK();
+}
+
 bool JITEngine::lookup_function(JitObjectCache* const obj) {
     auto* handle = _func_cache->lookup(obj->get_func_name());
     if (handle == nullptr) {
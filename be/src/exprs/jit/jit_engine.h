@@ -22,6 +22,7 @@
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -34,6 +35,8 @@
 
 namespace starrocks {
 
+struct JITAggregateUpdate;
+
 // cache the compiled code, and register to the LRU cache
 class JitObjectCache : public llvm::ObjectCache {
 public:
@@ -90,6 +93,11 @@ public:
     static Status compile_scalar_function(ExprContext* context, JitObjectCache* obj, Expr* expr,
                                           const std::vector<Expr*>& uncompilable_exprs);
 
+    // Compile the updates of aggregate functions into one loop over the aggregate states,
+    // and register the compiled function into LRU cache.
+    // The columns of the compiled function are the inputs of the updates, followed by the array of the states.
+    static Status compile_aggregate_function(JitObjectCache* obj, const std::vector<JITAggregateUpdate>& updates);
+
     bool lookup_function(JitObjectCache* const obj);
 
     Cache* get_func_cache() const { return _func_cache; }
@@ -102,9 +110,14 @@ public:
         return _func_cache->get_memory_usage();
     }
 
+    static Status generate_aggregate_function_ir(llvm::Module& module, const std::vector<JITAggregateUpdate>& updates,
+                                                 JitObjectCache* obj);
+
     static std::string dump_module_ir(const llvm::Module& module);
 
 private:
+    static Status compile_function(JitObjectCache* obj, const std::function<Status(llvm::Module&)>& generate_ir);
+
     // make an engine instance for each time of JIT
     class Engine {
     public:
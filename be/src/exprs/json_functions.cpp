@@ -377,11 +377,45 @@ StatusOr<ColumnPtr> _string_json(FunctionContext* context, const Columns& column
 
 template <LogicalType ResultType>
 StatusOr<ColumnPtr> JsonFunctions::_get_json_value(FunctionContext* context, const Columns& columns) {
-    ASSIGN_OR_RETURN(auto jsons, _string_json(context, columns));
+    ColumnPtr jsons;
+    if (auto* cache = JsonParseCache::current(); cache != nullptr) {
+        ASSIGN_OR_RETURN(jsons, cache->get_or_parse(columns[0], JsonParseCache::ParseKind::PARSE_JSON,
+                                                    [&]() { return _string_json(context, columns); }));
+    } else {
+        ASSIGN_OR_RETURN(jsons, _string_json(context, columns));
+    }
     const auto& paths = columns[1];
     return _full_json_query_impl<ResultType>(context, Columns{jsons, paths});
 }
 
+static thread_local JsonParseCache* tls_json_parse_cache = nullptr;
+
+JsonParseCache::Scope::Scope() {
+    if (tls_json_parse_cache == nullptr) {
+        _cache = std::make_unique<JsonParseCache>();
+        tls_json_parse_cache = _cache.get();
+    }
+}
+
+JsonParseCache::Scope::~Scope() {
+    if (_cache != nullptr) {
+        tls_json_parse_cache = nullptr;
+    }
+}
+
+JsonParseCache* JsonParseCache::current() {
+    return tls_json_parse_cache;
+}
+
+ColumnPtr JsonParseCache::_lookup(const Column* source, ParseKind kind) const {
+    for (const auto& entry : _entries) {
+        if (entry.source.get() == source && entry.kind == kind) {
+            return entry.parsed;
+        }
+    }
+    return nullptr;
+}
+
 //////////////////////////// User visiable functions /////////////////////////////////
 struct NativeJsonState {
 public:
@@ -18,7 +18,10 @@
 #include <simdjson.h>
 #include <velocypack/vpack.h>
 
+#include <memory>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "column/column_builder.h"
 #include "column/vectorized_fwd.h"
@@ -233,4 +236,67 @@ private:
                                                   std::vector<SimpleJsonPath>* parsed_paths);
 };
 
+// Caches the JSON documents parsed from the string columns within a scope, e.g. evaluating all the expressions of a
+// projection on a chunk, so the document is parsed once even if many paths are extracted from the same column by
+// different expressions, e.g. get_json_string(col, '$.a'), get_json_string(col, '$.b') or col->'$.a'.
+// The parsed columns are keyed by the source column, which is kept alive and must not be modified in the scope.
+// The scopes are thread local, and a nested scope shares the outer one.
+class JsonParseCache {
+public:
+    // How the documents are parsed from the strings, which may produce different results.
+    enum class ParseKind {
+        // JsonValue::parse, null for the invalid documents.
+        PARSE_JSON,
+        // CAST(string AS JSON), which takes the invalid documents as strings.
+        CAST_TO_JSON,
+        CAST_TO_JSON_THROW_EXCEPTION,
+    };
+
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::unique_ptr<JsonParseCache> _cache;
+    };
+
+    // The cache of the current scope, nullptr if not in any scope.
+    static JsonParseCache* current();
+
+    // Get the parsed documents of `source`, or parse them by `parse` and cache them.
+    template <typename ParseFunc>
+    auto get_or_parse(const ColumnPtr& source, ParseKind kind, ParseFunc&& parse) -> decltype(parse());
+
+private:
+    ColumnPtr _lookup(const Column* source, ParseKind kind) const;
+
+    struct Entry {
+        ColumnPtr source;
+        ParseKind kind;
+        ColumnPtr parsed;
+    };
+    // There are a few entries in a scope.
+    std::vector<Entry> _entries;
+};
+
+template <typename ParseFunc>
+auto JsonParseCache::get_or_parse(const ColumnPtr& source, ParseKind kind, ParseFunc&& parse) -> decltype(parse()) {
+    if (ColumnPtr parsed = _lookup(source.get(), kind); parsed != nullptr) {
+        return parsed;
+    }
+    auto parsed = parse();
+    if constexpr (std::is_same_v<decltype(parsed), ColumnPtr>) {
+        _entries.push_back({source, kind, parsed});
+    } else {
+        if (parsed.ok()) {
+            _entries.push_back({source, kind, parsed.value()});
+        }
+    }
+    return parsed;
+}
+
 } // namespace starrocks
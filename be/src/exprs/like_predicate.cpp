@@ -543,12 +543,21 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
     return result.build(all_const);
 }
 
+std::string LikePredicate::like_pattern_to_regex(const Slice& pattern) {
+    return convert_like_pattern<true>('\\', pattern);
+}
+
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
     std::string re_pattern;
     re_pattern.clear();
 
-    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -561,7 +570,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -586,6 +595,121 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
     return re_pattern;
 }
 
+static const char* DUMMY_STRING_FOR_EMPTY_VALUE = "A";
+
+MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+void MultiPatternMatcher::add_like_pattern(const Slice& pattern) {
+    _patterns.emplace_back(LikePredicate::like_pattern_to_regex(pattern));
+}
+
+void MultiPatternMatcher::add_regex_pattern(const Slice& pattern) {
+    _patterns.emplace_back(pattern.to_string());
+}
+
+Status MultiPatternMatcher::compile() {
+    DCHECK(_database == nullptr);
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < _patterns.size(); i++) {
+        expressions.emplace_back(_patterns[i].c_str());
+        flags.emplace_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.emplace_back(i);
+    }
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK, nullptr,
+                         &_database, &compile_err) != HS_SUCCESS) {
+        std::string error = fmt::format("Invalid hyperscan expression: {}: {}",
+                                        compile_err->expression >= 0 ? _patterns[compile_err->expression] : "",
+                                        compile_err->message);
+        hs_free_compile_error(compile_err);
+        _database = nullptr;
+        return Status::NotSupported(error);
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        return Status::InternalError("unable to allocate hyperscan scratch space");
+    }
+    return Status::OK();
+}
+
+template <typename MatchCallback>
+Status MultiPatternMatcher::_scan(const ColumnViewer<TYPE_VARCHAR>& viewer, MatchCallback&& callback) const {
+    DCHECK(_database != nullptr);
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        hs_error_t st;
+        if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << st;
+        }
+    });
+
+    struct ScanContext {
+        MatchCallback* callback;
+        int row;
+    } ctx{&callback, 0};
+    for (; ctx.row < viewer.size(); ++ctx.row) {
+        if (viewer.is_null(ctx.row)) {
+            continue;
+        }
+        Slice value = viewer.value(ctx.row);
+        status = hs_scan(
+                // Use a dummy pointer instead of nullptr for the empty strings to avoid crash.
+                _database, value.size > 0 ? value.data : DUMMY_STRING_FOR_EMPTY_VALUE, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* scan_ctx) -> int {
+                    auto* c = static_cast<ScanContext*>(scan_ctx);
+                    return (*c->callback)(c->row, id);
+                },
+                &ctx);
+        if (status != HS_SUCCESS && status != HS_SCAN_TERMINATED) {
+            return Status::InternalError(fmt::format("hyperscan scan failure, status: {}", status));
+        }
+    }
+    return Status::OK();
+}
+
+StatusOr<ColumnPtr> MultiPatternMatcher::match_any(const ColumnPtr& values) const {
+    ColumnViewer<TYPE_VARCHAR> viewer(values);
+    const auto num_rows = static_cast<size_t>(viewer.size());
+    Filter matched(num_rows, 0);
+    // Stop scanning a string once it matches any pattern.
+    RETURN_IF_ERROR(_scan(viewer, [&](int row, unsigned int id) {
+        matched[row] = 1;
+        return 1;
+    }));
+
+    ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (viewer.is_null(row)) {
+            result.append_null();
+        } else {
+            result.append(matched[row]);
+        }
+    }
+    return result.build(values->is_constant());
+}
+
+Status MultiPatternMatcher::match_each(const ColumnPtr& values, std::vector<Filter>* matches) const {
+    ColumnViewer<TYPE_VARCHAR> viewer(values);
+    matches->assign(_patterns.size(), Filter(viewer.size(), 0));
+    return _scan(viewer, [&](int row, unsigned int id) {
+        (*matches)[id][row] = 1;
+        return 0;
+    });
+}
+
 void LikePredicate::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
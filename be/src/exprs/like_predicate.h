@@ -58,6 +58,10 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    /// Convert a LIKE pattern with the default escape character into the regular expression matching the
+    /// whole string.
+    static std::string like_pattern_to_regex(const Slice& pattern);
+
 private:
     /**
      * use for:
@@ -151,6 +155,9 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
@@ -219,4 +226,40 @@ private:
         }
     };
 };
+
+// Match the strings against many LIKE and REGEXP patterns with one Hyperscan multi-pattern database, which scans
+// every string once for all the patterns instead of once for each pattern, e.g. for
+// `col LIKE '%a%' OR col LIKE '%b%' OR col REGEXP 'c.*d'`.
+class MultiPatternMatcher {
+public:
+    MultiPatternMatcher() = default;
+    ~MultiPatternMatcher();
+
+    MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+    MultiPatternMatcher& operator=(const MultiPatternMatcher&) = delete;
+
+    void add_like_pattern(const Slice& pattern);
+    void add_regex_pattern(const Slice& pattern);
+
+    size_t num_patterns() const { return _patterns.size(); }
+
+    // Compile all the patterns into one database, fails if any of them is not supported by Hyperscan.
+    Status compile();
+
+    // Whether every string matches any of the patterns, null for the null strings.
+    StatusOr<ColumnPtr> match_any(const ColumnPtr& values) const;
+
+    // The strings matching each of the patterns, in the order of the patterns. The null strings match nothing.
+    Status match_each(const ColumnPtr& values, std::vector<Filter>* matches) const;
+
+private:
+    template <typename MatchCallback>
+    Status _scan(const ColumnViewer<TYPE_VARCHAR>& viewer, MatchCallback&& callback) const;
+
+    std::vector<std::string> _patterns;
+    hs_database_t* _database = nullptr;
+    // The prototype of the scratch, which is cloned for every scan to be used concurrently.
+    hs_scratch_t* _scratch = nullptr;
+};
+
 } // namespace starrocks
@@ -166,7 +166,7 @@ StatusOr<ColumnPtr> VectorizedLiteral::evaluate_checked(ExprContext* context, Ch
 }
 
 bool VectorizedLiteral::is_compilable(RuntimeState* state) const {
-    return IRHelper::support_jit(_type.type);
+    return IRHelper::support_jit_compare(_type.type);
 }
 
 JitScore VectorizedLiteral::compute_jit_score(RuntimeState* state) const {
@@ -180,7 +180,9 @@ std::string VectorizedLiteral::jit_func_name_impl(RuntimeState* state) const {
 StatusOr<LLVMDatum> VectorizedLiteral::generate_ir_impl(ExprContext* context, JITContext* jit_ctx) {
     bool only_null = _value->only_null();
     LLVMDatum datum(jit_ctx->builder, only_null);
-    if (only_null) {
+    if (only_null && is_string_type(_type.type)) {
+        datum.value = IRHelper::create_ir_string(jit_ctx->builder, Slice());
+    } else if (only_null) {
         ASSIGN_OR_RETURN(datum.value, IRHelper::create_ir_number(jit_ctx->builder, _type.type, 0));
     } else {
         ASSIGN_OR_RETURN(datum.value, IRHelper::load_ir_number(jit_ctx->builder, _type.type, _value->raw_data()));
@@ -14,6 +14,7 @@
 
 #include "exprs/runtime_filter.h"
 
+#include "common/config.h"
 #include "types/logical_type_infra.h"
 #include "util/compression/stream_compression.h"
 
@@ -156,6 +157,136 @@ void SimdBlockFilter::clear() {
     }
 }
 
+bool RuntimeFilterBitset::can_cover(int64_t min_value, int64_t max_value, size_t num_values) {
+    if (min_value > max_value || config::runtime_filter_exact_bitset_max_range <= 0) {
+        return false;
+    }
+    // the number of bits minus one, which doesn't overflow.
+    const uint64_t max_offset = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+    const uint64_t bloom_filter_bits = std::max<uint64_t>(num_values, 4096) * 8;
+    return max_offset < static_cast<uint64_t>(config::runtime_filter_exact_bitset_max_range) &&
+           max_offset < bloom_filter_bits;
+}
+
+void RuntimeFilterBitset::init(int64_t min_value, int64_t max_value) {
+    DCHECK_LE(min_value, max_value);
+    _min_value = min_value;
+    _num_bits = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value) + 1;
+    _words.assign((_num_bits + 63) / 64, 0);
+}
+
+void RuntimeFilterBitset::extend(int64_t min_value, int64_t max_value) {
+    DCHECK(can_use());
+    min_value = std::min(min_value, this->min_value());
+    max_value = std::max(max_value, this->max_value());
+    if (min_value == this->min_value() && max_value == this->max_value()) {
+        return;
+    }
+    std::vector<uint64_t> words = std::move(_words);
+    const uint64_t bit_offset = static_cast<uint64_t>(_min_value) - static_cast<uint64_t>(min_value);
+    init(min_value, max_value);
+    _or_words(words, bit_offset);
+}
+
+void RuntimeFilterBitset::clear() {
+    _min_value = 0;
+    _num_bits = 0;
+    std::vector<uint64_t>().swap(_words);
+}
+
+void RuntimeFilterBitset::merge(const RuntimeFilterBitset& other) {
+    if (!other.can_use()) {
+        return;
+    }
+    if (!can_use()) {
+        *this = other;
+        return;
+    }
+    extend(other.min_value(), other.max_value());
+    _or_words(other._words, _offset(other._min_value));
+}
+
+void RuntimeFilterBitset::_or_words(const std::vector<uint64_t>& words, uint64_t bit_offset) {
+    const size_t word_offset = bit_offset >> 6;
+    const uint64_t shift = bit_offset & 63;
+    for (size_t i = 0; i < words.size(); i++) {
+        if (words[i] == 0) {
+            continue;
+        }
+        _words[word_offset + i] |= words[i] << shift;
+        if (shift != 0 && word_offset + i + 1 < _words.size()) {
+            _words[word_offset + i + 1] |= words[i] >> (64 - shift);
+        }
+    }
+}
+
+size_t RuntimeFilterBitset::max_serialized_size() const {
+    return sizeof(_min_value) + sizeof(_num_bits) + alloc_size();
+}
+
+size_t RuntimeFilterBitset::serialize(uint8_t* data) const {
+    size_t offset = 0;
+    memcpy(data + offset, &_min_value, sizeof(_min_value));
+    offset += sizeof(_min_value);
+    memcpy(data + offset, &_num_bits, sizeof(_num_bits));
+    offset += sizeof(_num_bits);
+    if (_num_bits > 0) {
+        memcpy(data + offset, _words.data(), alloc_size());
+        offset += alloc_size();
+    }
+    return offset;
+}
+
+size_t RuntimeFilterBitset::deserialize(const uint8_t* data) {
+    size_t offset = 0;
+    memcpy(&_min_value, data + offset, sizeof(_min_value));
+    offset += sizeof(_min_value);
+    memcpy(&_num_bits, data + offset, sizeof(_num_bits));
+    offset += sizeof(_num_bits);
+    _words.assign((_num_bits + 63) / 64, 0);
+    if (_num_bits > 0) {
+        memcpy(_words.data(), data + offset, alloc_size());
+        offset += alloc_size();
+    }
+    return offset;
+}
+
+bool RuntimeFilterBitset::check_equal(const RuntimeFilterBitset& other) const {
+    return _min_value == other._min_value && _num_bits == other._num_bits && _words == other._words;
+}
+
+void JoinRuntimeFilter::prepare_concat(const std::vector<JoinRuntimeFilter*>& filters) {
+    bool use_bitset = false;
+    int64_t min_value = std::numeric_limits<int64_t>::max();
+    int64_t max_value = std::numeric_limits<int64_t>::lowest();
+    size_t num_values = 0;
+    for (const auto* rf : filters) {
+        if (rf->_size == 0) {
+            continue;
+        }
+        if (!rf->_bitset.can_use()) {
+            use_bitset = false;
+            break;
+        }
+        use_bitset = true;
+        min_value = std::min(min_value, rf->_bitset.min_value());
+        max_value = std::max(max_value, rf->_bitset.max_value());
+        num_values += rf->_size;
+    }
+
+    if (use_bitset && RuntimeFilterBitset::can_cover(min_value, max_value, num_values)) {
+        for (auto* rf : filters) {
+            if (!rf->_bitset.can_use()) {
+                rf->_bitset.init(min_value, min_value);
+            }
+        }
+    } else {
+        for (auto* rf : filters) {
+            rf->convert_bitset_to_bf();
+        }
+    }
+}
+
 size_t JoinRuntimeFilter::max_serialized_size() const {
     // todo(yan): noted that it's not serialize compatible with 32-bit and 64-bit.
     auto num_partitions = _hash_partition_bf.size();
@@ -167,6 +298,7 @@ size_t JoinRuntimeFilter::max_serialized_size() const {
             size += bf.max_serialized_size();
         }
     }
+    size += _bitset.max_serialized_size();
     return size;
 }
 
@@ -190,6 +322,9 @@ size_t JoinRuntimeFilter::serialize(int serialize_version, uint8_t* data) const
             offset += bf.serialize(data + offset);
         }
     }
+    if (serialize_version >= RF_VERSION_V3) {
+        offset += _bitset.serialize(data + offset);
+    }
     return offset;
 }
 
@@ -214,6 +349,9 @@ size_t JoinRuntimeFilter::deserialize(int serialize_version, const uint8_t* data
             _hash_partition_bf.emplace_back(std::move(bf));
         }
     }
+    if (serialize_version >= RF_VERSION_V3) {
+        offset += _bitset.deserialize(data + offset);
+    }
 
     return offset;
 }
@@ -224,6 +362,7 @@ bool JoinRuntimeFilter::check_equal(const JoinRuntimeFilter& rf) const {
     bool first = (_has_null == rf._has_null && _size == rf._size && lhs_num_partitions == rhs_num_partitions &&
                   _join_mode == rf._join_mode);
     if (!first) return false;
+    if (!_bitset.check_equal(rf._bitset)) return false;
     if (lhs_num_partitions == 0) {
         if (!_bf.check_equal(rf._bf)) return false;
     } else {
@@ -244,6 +383,7 @@ void JoinRuntimeFilter::clear_bf() {
             _hash_partition_bf[i].clear();
         }
     }
+    _bitset.clear();
     _size = 0;
 }
 
@@ -35,8 +35,10 @@ namespace starrocks {
 // 0x1. initial global runtime filter impl
 // 0x2. change simd-block-filter hash function.
 // 0x3. Fix serialize problem
+// 0x4. add exact bitset
 inline const constexpr uint8_t RF_VERSION = 0x2;
 inline const constexpr uint8_t RF_VERSION_V2 = 0x3;
+inline const constexpr uint8_t RF_VERSION_V3 = 0x4;
 static_assert(sizeof(RF_VERSION_V2) == sizeof(RF_VERSION));
 inline const constexpr int32_t RF_VERSION_SZ = sizeof(RF_VERSION_V2);
 
@@ -292,6 +294,84 @@ private:
     size_t _capacity = 0;
 };
 
+// RuntimeFilterBitset is the exact set of the integers in [min_value, max_value], one bit per value.
+// When the join keys are dense integers, e.g. surrogate keys of a dimension table, it's used in place
+// of the bloom filter: probing is a range check plus a bit test, and there is no false positive.
+class RuntimeFilterBitset {
+public:
+    // Whether [min_value, max_value] is small enough to build a bitset for `num_values` keys.
+    // The range is limited by config::runtime_filter_exact_bitset_max_range, and the bitset shouldn't be much
+    // larger than the bloom filter of the same keys, which takes about one byte per key.
+    static bool can_cover(int64_t min_value, int64_t max_value, size_t num_values);
+
+    bool can_use() const { return !_words.empty(); }
+
+    void init(int64_t min_value, int64_t max_value);
+    // Extend the range to cover [min_value, max_value], the values inserted are kept.
+    void extend(int64_t min_value, int64_t max_value);
+    void clear();
+
+    int64_t min_value() const { return _min_value; }
+    int64_t max_value() const { return static_cast<int64_t>(static_cast<uint64_t>(_min_value) + _num_bits - 1); }
+
+    bool in_range(int64_t value) const { return _offset(value) < _num_bits; }
+
+    void insert(int64_t value) {
+        const uint64_t offset = _offset(value);
+        DCHECK_LT(offset, _num_bits);
+        _words[offset >> 6] |= 1ull << (offset & 63);
+    }
+
+    bool test(int64_t value) const {
+        const uint64_t offset = _offset(value);
+        return offset < _num_bits && ((_words[offset >> 6] >> (offset & 63)) & 1);
+    }
+
+    // selection[i] = test(values[i]). The range check of all the values goes first, which is vectorized by
+    // the compiler, then the bits are tested without branches.
+    template <typename T>
+    void test_batch(const T* values, uint8_t* selection, size_t size) const {
+        for (size_t i = 0; i < size; i++) {
+            selection[i] = _offset(values[i]) < _num_bits;
+        }
+        for (size_t i = 0; i < size; i++) {
+            const uint64_t offset = selection[i] ? _offset(values[i]) : 0;
+            selection[i] &= (_words[offset >> 6] >> (offset & 63)) & 1;
+        }
+    }
+
+    // Union with other, the range is extended if needed.
+    void merge(const RuntimeFilterBitset& other);
+
+    template <typename Func>
+    void for_each(Func&& func) const {
+        for (size_t i = 0; i < _words.size(); i++) {
+            uint64_t word = _words[i];
+            while (word != 0) {
+                const uint64_t offset = i * 64 + __builtin_ctzll(word);
+                func(static_cast<int64_t>(static_cast<uint64_t>(_min_value) + offset));
+                word &= word - 1;
+            }
+        }
+    }
+
+    size_t alloc_size() const { return _words.size() * sizeof(uint64_t); }
+
+    size_t max_serialized_size() const;
+    size_t serialize(uint8_t* data) const;
+    size_t deserialize(const uint8_t* data);
+    bool check_equal(const RuntimeFilterBitset& other) const;
+
+private:
+    uint64_t _offset(int64_t value) const { return static_cast<uint64_t>(value) - static_cast<uint64_t>(_min_value); }
+    // _words |= words << bit_offset
+    void _or_words(const std::vector<uint64_t>& words, uint64_t bit_offset);
+
+    int64_t _min_value = 0;
+    uint64_t _num_bits = 0;
+    std::vector<uint64_t> _words;
+};
+
 // The runtime filter generated by join right small table
 class JoinRuntimeFilter;
 using JoinRuntimeFilterPtr = std::shared_ptr<const JoinRuntimeFilter>;
@@ -328,6 +408,9 @@ public:
     void clear_bf();
 
     bool can_use_bf() const {
+        if (_bitset.can_use()) {
+            return true;
+        }
         if (_hash_partition_bf.empty()) {
             return _bf.can_use();
         }
@@ -336,7 +419,7 @@ public:
 
     size_t bf_alloc_size() const {
         if (_hash_partition_bf.empty()) {
-            return _bf.get_alloc_size();
+            return _bf.get_alloc_size() + _bitset.alloc_size();
         }
         return std::accumulate(
                 _hash_partition_bf.begin(), _hash_partition_bf.end(), 0ull,
@@ -361,16 +444,40 @@ public:
 
     virtual void concat(JoinRuntimeFilter* rf) {
         _has_null |= rf->_has_null;
-        if (rf->_hash_partition_bf.empty()) {
-            _hash_partition_bf.emplace_back(std::move(rf->_bf));
+        if (rf->_bitset.can_use() && _hash_partition_bf.empty()) {
+            // The bitset is exact for the keys of all the partitions, so there is no need to keep the partitions.
+            _bitset.merge(rf->_bitset);
+            _bf.clear();
         } else {
-            for (auto&& bf : rf->_hash_partition_bf) {
-                _hash_partition_bf.emplace_back(std::move(bf));
+            if (UNLIKELY(_bitset.can_use())) {
+                // The keys of the partitions concatenated before are only in the bitset and can't be
+                // assigned back to the partitions, see prepare_concat(). Keep min/max filter only.
+                _bitset.clear();
+                _hash_partition_bf.emplace_back();
+            }
+            rf->convert_bitset_to_bf();
+            if (rf->_hash_partition_bf.empty()) {
+                _hash_partition_bf.emplace_back(std::move(rf->_bf));
+            } else {
+                for (auto&& bf : rf->_hash_partition_bf) {
+                    _hash_partition_bf.emplace_back(std::move(bf));
+                }
             }
         }
         _join_mode = rf->_join_mode;
         _size += rf->_size;
     }
+
+    // Make the filters to be concatenated agree on the representation: keep the bitsets if all of them
+    // have one and the union is still small enough, otherwise convert all of them to bloom filters.
+    // Empty filters don't matter, they are given an empty bitset in the former case.
+    static void prepare_concat(const std::vector<JoinRuntimeFilter*>& filters);
+
+    // Whether the keys are stored in an exact bitset instead of the bloom filter.
+    bool has_exact_bitset() const { return _bitset.can_use(); }
+    // Move the keys in the bitset to the bloom filter.
+    virtual void convert_bitset_to_bf() {}
+
     virtual bool check_equal(const JoinRuntimeFilter& rf) const;
     virtual JoinRuntimeFilter* create_empty(ObjectPool* pool) = 0;
     void set_global() { this->_global = true; }
@@ -389,6 +496,8 @@ protected:
     int8_t _join_mode = 0;
     SimdBlockFilter _bf;
     std::vector<SimdBlockFilter> _hash_partition_bf;
+    // Replaces _bf when the keys are dense integers, only used by the non-partitioned filters.
+    RuntimeFilterBitset _bitset;
     bool _always_true = false;
     size_t _rf_version = 0;
     // local colocate filters is local filter we don't have to serialize them
@@ -469,6 +578,8 @@ public:
     using ColumnType = RunTimeColumnType<Type>;
     using ContainerType = RunTimeProxyContainerType<Type>;
     using SelfType = RuntimeBloomFilter<Type>;
+    // Whether the keys can be stored in RuntimeFilterBitset.
+    static constexpr bool kSupportsBitset = std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(int64_t);
 
     RuntimeBloomFilter() { _init_min_max(); }
     ~RuntimeBloomFilter() override = default;
@@ -535,8 +646,41 @@ public:
         }
     }
 
+    // Store the keys in [min_value, max_value] to an exact bitset instead of the bloom filter, if the range is small
+    // enough. It's called before inserting a batch of keys, see RuntimeFilterHelper::fill_runtime_bloom_filter.
+    void prepare_bitset(CppType min_value, CppType max_value) {
+        if constexpr (kSupportsBitset) {
+            if (_bitset.can_use()) {
+                if (RuntimeFilterBitset::can_cover(std::min<int64_t>(min_value, _bitset.min_value()),
+                                                   std::max<int64_t>(max_value, _bitset.max_value()), _size)) {
+                    _bitset.extend(min_value, max_value);
+                } else {
+                    convert_bitset_to_bf();
+                }
+            } else if (_bf.can_use() && _hash_partition_bf.empty() && _min > _max &&
+                       RuntimeFilterBitset::can_cover(min_value, max_value, _size)) {
+                // Nothing is inserted yet, the bloom filter is only needed again if the range grows too large.
+                _bitset.init(min_value, max_value);
+                _bf.clear();
+            }
+        }
+    }
+
+    void convert_bitset_to_bf() override {
+        if constexpr (kSupportsBitset) {
+            if (!_bitset.can_use()) {
+                return;
+            }
+            _bf.init(_size);
+            _bitset.for_each([this](int64_t value) { _bf.insert_hash(compute_hash(static_cast<CppType>(value))); });
+            _bitset.clear();
+        }
+    }
+
     void insert(const CppType& value) {
-        if (LIKELY(_bf.can_use())) {
+        if (_bitset.can_use()) {
+            _insert_bitset(value);
+        } else if (LIKELY(_bf.can_use())) {
             size_t hash = compute_hash(value);
             _bf.insert_hash(hash);
         }
@@ -555,6 +699,11 @@ public:
     bool right_close_interval() const { return _right_close_interval; }
 
     void evaluate(Column* input_column, RunningContext* ctx) const override {
+        if constexpr (kSupportsBitset) {
+            if (_bitset.can_use()) {
+                return _evaluate_bitset(input_column, ctx);
+            }
+        }
         if (!_hash_partition_bf.empty()) {
             return _hash_partition_bf[0].can_use() ? _t_evaluate<true, true>(input_column, ctx)
                                                    : _t_evaluate<true, false>(input_column, ctx);
@@ -566,6 +715,7 @@ public:
 
     // this->max = std::max(other->max, this->max)
     void merge(const JoinRuntimeFilter* rf) override {
+        _merge_bitset(down_cast<const RuntimeBloomFilter*>(rf));
         JoinRuntimeFilter::merge(rf);
         _merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
     }
@@ -588,6 +738,9 @@ public:
         LogicalType ltype = Type;
         std::stringstream ss;
         ss << "RuntimeBF(type = " << ltype << ", bfsize = " << _size << ", has_null = " << _has_null;
+        if (_bitset.can_use()) {
+            ss << ", bitset = [" << _bitset.min_value() << ", " << _bitset.max_value() << "]";
+        }
         if constexpr (std::is_integral_v<CppType> || std::is_floating_point_v<CppType>) {
             if constexpr (!std::is_same_v<CppType, __int128>) {
                 ss << ", _min = " << _min << ", _max = " << _max;
@@ -734,7 +887,8 @@ public:
 
     void compute_partition_index(const RuntimeFilterLayout& layout, const std::vector<Column*>& columns,
                                  RunningContext* ctx) const override {
-        if (columns.empty() || _join_mode == TRuntimeFilterBuildJoinMode::NONE) return;
+        // the bitset doesn't depend on the partitions.
+        if (columns.empty() || _join_mode == TRuntimeFilterBuildJoinMode::NONE || _bitset.can_use()) return;
         size_t num_rows = columns[0]->size();
 
         // initialize hash_values.
@@ -820,6 +974,72 @@ private:
         }
     }
 
+    void _insert_bitset(const CppType& value) {
+        if constexpr (kSupportsBitset) {
+            if (LIKELY(_bitset.in_range(value))) {
+                _bitset.insert(value);
+                return;
+            }
+            // The key is out of the range prepared, fallback to the bloom filter.
+            convert_bitset_to_bf();
+            _bf.insert_hash(compute_hash(value));
+        }
+    }
+
+    void _merge_bitset(const RuntimeBloomFilter* other) {
+        if constexpr (kSupportsBitset) {
+            if (!_bitset.can_use() && !other->_bitset.can_use()) {
+                return;
+            }
+            if (_bitset.can_use() && other->_bitset.can_use() &&
+                RuntimeFilterBitset::can_cover(std::min(_bitset.min_value(), other->_bitset.min_value()),
+                                               std::max(_bitset.max_value(), other->_bitset.max_value()),
+                                               _size + other->_size)) {
+                _bitset.merge(other->_bitset);
+                return;
+            }
+            convert_bitset_to_bf();
+            if (_bf.can_use()) {
+                other->_bitset.for_each(
+                        [this](int64_t value) { _bf.insert_hash(compute_hash(static_cast<CppType>(value))); });
+            }
+        }
+    }
+
+    void _evaluate_bitset(Column* input_column, RunningContext* ctx) const {
+        size_t size = input_column->size();
+        Filter& _selection_filter = ctx->use_merged_selection ? ctx->merged_selection : ctx->selection;
+        _selection_filter.resize(size);
+        uint8_t* _selection = _selection_filter.data();
+
+        if (input_column->is_constant()) {
+            const auto* const_column = down_cast<const ConstColumn*>(input_column);
+            if (const_column->only_null()) {
+                _selection[0] = _has_null;
+            } else {
+                const auto& input_data = GetContainer<Type>().get_data(const_column->data_column());
+                _bitset.test_batch(input_data.data(), _selection, 1);
+            }
+            uint8_t sel = _selection[0];
+            memset(_selection, sel, size);
+        } else if (input_column->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(input_column);
+            const auto& input_data = GetContainer<Type>().get_data(nullable_column->data_column());
+            _bitset.test_batch(input_data.data(), _selection, size);
+            if (nullable_column->has_null()) {
+                const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
+                for (int i = 0; i < size; i++) {
+                    if (null_data[i]) {
+                        _selection[i] = _has_null;
+                    }
+                }
+            }
+        } else {
+            const auto& input_data = GetContainer<Type>().get_data(input_column);
+            _bitset.test_batch(input_data.data(), _selection, size);
+        }
+    }
+
     void _merge_min_max(const RuntimeBloomFilter* bf) {
         if (bf->_has_min_max) {
             _min = std::min(_min, bf->_min);
@@ -71,6 +71,11 @@ size_t RuntimeFilterHelper::serialize_runtime_filter(RuntimeState* state, const
     int32_t rf_version = RF_VERSION;
     if (state->func_version() >= TFunctionVersion::RUNTIME_FILTER_SERIALIZE_VERSION_2) {
         rf_version = RF_VERSION_V2;
+        // only the filters with bitset need the new format, so that they still work with the old receivers,
+        // which ignore the filters of unknown versions.
+        if (rf->has_exact_bitset()) {
+            rf_version = RF_VERSION_V3;
+        }
     }
     return serialize_runtime_filter(rf_version, rf, data);
 }
@@ -85,7 +90,7 @@ int RuntimeFilterHelper::deserialize_runtime_filter(ObjectPool* pool, JoinRuntim
     uint8_t version = 0;
     memcpy(&version, data, sizeof(version));
     offset += sizeof(version);
-    if (version != RF_VERSION && version != RF_VERSION_V2) {
+    if (version != RF_VERSION && version != RF_VERSION_V2 && version != RF_VERSION_V3) {
         // version mismatch and skip this chunk.
         LOG(WARNING) << "unrecognized version:" << version;
         return 0;
@@ -123,6 +128,10 @@ struct FilterIniter {
         using ColumnType = typename RunTimeTypeTraits<ltype>::ColumnType;
         auto* filter = (RuntimeBloomFilter<ltype>*)(expr);
 
+        if constexpr (RuntimeBloomFilter<ltype>::kSupportsBitset) {
+            _prepare_bitset<ltype>(column, column_offset, filter);
+        }
+
         if (column->is_nullable()) {
             auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
             const auto& data_array = GetContainer<ltype>().get_data(nullable_column->data_column().get());
@@ -143,6 +152,30 @@ struct FilterIniter {
         }
         return nullptr;
     }
+
+    // Compute the range of the keys to see whether the bitset can be used.
+    template <LogicalType ltype>
+    void _prepare_bitset(const ColumnPtr& column, size_t column_offset, RuntimeBloomFilter<ltype>* filter) {
+        using CppType = RunTimeCppType<ltype>;
+        const NullableColumn* nullable_column = nullptr;
+        const Column* data_column = column.get();
+        if (column->is_nullable()) {
+            nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
+            data_column = nullable_column->data_column().get();
+        }
+        const auto& data_array = GetContainer<ltype>().get_data(data_column);
+        CppType min_value = std::numeric_limits<CppType>::max();
+        CppType max_value = std::numeric_limits<CppType>::lowest();
+        for (size_t j = column_offset; j < data_array.size(); j++) {
+            if (nullable_column == nullptr || !nullable_column->is_null(j)) {
+                min_value = std::min(min_value, data_array[j]);
+                max_value = std::max(max_value, data_array[j]);
+            }
+        }
+        if (min_value <= max_value) {
+            filter->prepare_bitset(min_value, max_value);
+        }
+    }
 };
 
 Status RuntimeFilterHelper::fill_runtime_bloom_filter(const ColumnPtr& column, LogicalType type,
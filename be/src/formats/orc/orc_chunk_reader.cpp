@@ -26,6 +26,7 @@
 #include "column/array_column.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/cast_expr.h"
+#include "exprs/in_const_predicate.hpp"
 #include "exprs/literal.h"
 #include "formats/orc/orc_mapping.h"
 #include "formats/orc/orc_memory_pool.h"
@@ -35,6 +36,7 @@
 #include "orc_schema_builder.h"
 #include "simd/simd.h"
 #include "types/logical_type.h"
+#include "types/logical_type_infra.h"
 #include "util/timezone_utils.h"
 
 namespace starrocks {
@@ -717,6 +719,29 @@ bool OrcChunkReader::_ok_to_add_compound_conjunct(
     return true;
 }
 
+// The in predicates generated from runtime filters have no literal children, their values are kept in a hash set.
+// Return false if `conjunct` is not such a predicate, or null is one of its values. `values` may be nullptr to check
+// the predicate only.
+static bool get_in_const_values(const Expr* conjunct, ColumnPtr* values) {
+    switch (conjunct->get_child(0)->type().type) {
+#define M(NAME)                                                                                                \
+    case LogicalType::NAME: {                                                                                  \
+        const auto* in_filter = dynamic_cast<const VectorizedInConstPredicate<LogicalType::NAME>*>(conjunct); \
+        if (in_filter == nullptr || in_filter->null_in_set()) {                                                \
+            return false;                                                                                      \
+        }                                                                                                      \
+        if (values != nullptr) {                                                                               \
+            *values = in_filter->get_all_values();                                                             \
+        }                                                                                                      \
+        return true;                                                                                           \
+    }
+        APPLY_FOR_ALL_SCALAR_TYPE(M);
+#undef M
+    default:
+        return false;
+    }
+}
+
 bool OrcChunkReader::_ok_to_add_binary_in_conjunct(
         const Expr* conjunct, const std::unordered_map<SlotId, size_t>& slot_id_to_pos_in_src_slot_descriptors) {
     const TExprNodeType::type& node_type = conjunct->node_type();
@@ -752,7 +777,10 @@ bool OrcChunkReader::_ok_to_add_binary_in_conjunct(
     }
 
     if (conjunct->get_num_children() == 1) {
-        return false;
+        // Push down the in predicates generated from runtime filters, so the row groups are pruned by the min/max
+        // and the bloom filters in the row index.
+        return node_type == TExprNodeType::IN_PRED && _supported_logical_types.contains(c->type().type) &&
+               get_in_const_values(conjunct, nullptr);
     }
 
     for (int i = 1; i < conjunct->get_num_children(); i++) {
@@ -833,20 +861,8 @@ static inline orc::Int128 to_orc128(int128_t value) {
     return {int64_t(value >> 64), uint64_t(value)};
 }
 
-static StatusOr<orc::Literal> translate_to_orc_literal(Expr* lit, orc::PredicateDataType pred_type) {
-    TExprNodeType::type node_type = lit->node_type();
-    LogicalType ltype = lit->type().type;
-    if (node_type == TExprNodeType::type::NULL_LITERAL) {
-        return {pred_type};
-    }
-
-    auto* vlit = down_cast<VectorizedLiteral*>(lit);
-    ASSIGN_OR_RETURN(auto ptr, vlit->evaluate_checked(nullptr, nullptr));
-    if (ptr->only_null()) {
-        return {pred_type};
-    }
-
-    const Datum& datum = ptr->get(0);
+static StatusOr<orc::Literal> translate_datum_to_orc_literal(const Datum& datum, const TypeDescriptor& type) {
+    LogicalType ltype = type.type;
     switch (ltype) {
     case LogicalType::TYPE_BOOLEAN:
         return {bool(datum.get_int8())};
@@ -877,11 +893,11 @@ static StatusOr<orc::Literal> translate_to_orc_literal(Expr* lit, orc::Predicate
         return orc::Literal{to_orc128(value.value()), value.PRECISION, value.SCALE};
     }
     case LogicalType::TYPE_DECIMAL32:
-        return orc::Literal{orc::Int128(datum.get_int32()), lit->type().precision, lit->type().scale};
+        return orc::Literal{orc::Int128(datum.get_int32()), type.precision, type.scale};
     case LogicalType::TYPE_DECIMAL64:
-        return orc::Literal{orc::Int128(datum.get_int64()), lit->type().precision, lit->type().scale};
+        return orc::Literal{orc::Int128(datum.get_int64()), type.precision, type.scale};
     case LogicalType::TYPE_DECIMAL128:
-        return orc::Literal{to_orc128(datum.get_int128()), lit->type().precision, lit->type().scale};
+        return orc::Literal{to_orc128(datum.get_int128()), type.precision, type.scale};
     default:
         DCHECK(false);
     }
@@ -889,6 +905,20 @@ static StatusOr<orc::Literal> translate_to_orc_literal(Expr* lit, orc::Predicate
     return Status::InternalError("failed to handle logical type = " + std::to_string(ltype));
 }
 
+static StatusOr<orc::Literal> translate_to_orc_literal(Expr* lit, orc::PredicateDataType pred_type) {
+    TExprNodeType::type node_type = lit->node_type();
+    if (node_type == TExprNodeType::type::NULL_LITERAL) {
+        return {pred_type};
+    }
+
+    auto* vlit = down_cast<VectorizedLiteral*>(lit);
+    ASSIGN_OR_RETURN(auto ptr, vlit->evaluate_checked(nullptr, nullptr));
+    if (ptr->only_null()) {
+        return {pred_type};
+    }
+    return translate_datum_to_orc_literal(ptr->get(0), lit->type());
+}
+
 Status OrcChunkReader::_add_conjunct(const Expr* conjunct,
                                      const std::unordered_map<SlotId, size_t>& slot_id_to_pos_in_src_slot_descriptors,
                                      std::unique_ptr<orc::SearchArgumentBuilder>& builder) {
@@ -1018,6 +1048,16 @@ Status OrcChunkReader::_add_conjunct(const Expr* conjunct,
             builder->startNot();
         }
         std::vector<orc::Literal> literals;
+        if (conjunct->get_num_children() == 1) {
+            ColumnPtr values;
+            if (!get_in_const_values(conjunct, &values)) {
+                return Status::InternalError("unexpected in predicate without values");
+            }
+            for (size_t i = 0; i < values->size(); i++) {
+                ASSIGN_OR_RETURN(orc::Literal literal, translate_datum_to_orc_literal(values->get(i), slot->type()));
+                literals.emplace_back(literal);
+            }
+        }
         for (int i = 1; i < conjunct->get_num_children(); i++) {
             Expr* lit = conjunct->get_child(i);
             ASSIGN_OR_RETURN(orc::Literal literal, translate_to_orc_literal(lit, pred_type));
@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "gutil/strings/substitute.h"
+#include "util/thrift_util.h"
+#include "util/xxh3.h"
+
+namespace starrocks::parquet {
+
+// The header is tiny, it's enough to read it and the beginning of the bitset at once.
+static constexpr uint32_t kHeaderReadSize = 256;
+
+static constexpr uint32_t kSalts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                       0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+Status ParquetBloomFilter::init(uint32_t num_bytes) {
+    if (num_bytes < kMinimumBytes || num_bytes > kMaximumBytes || num_bytes % kBytesPerBlock != 0) {
+        return Status::InvalidArgument(strings::Substitute("invalid bloom filter size $0", num_bytes));
+    }
+    _num_blocks = num_bytes / kBytesPerBlock;
+    _bitset.assign(num_bytes / sizeof(uint32_t), 0);
+    return Status::OK();
+}
+
+Status ParquetBloomFilter::read(RandomAccessFile* file, int64_t offset, uint64_t file_size) {
+    if (offset < 0 || static_cast<uint64_t>(offset) >= file_size) {
+        return Status::Corruption(strings::Substitute("invalid bloom filter offset $0", offset));
+    }
+    std::vector<uint8_t> buffer(std::min<uint64_t>(kHeaderReadSize, file_size - offset));
+    RETURN_IF_ERROR(file->read_at_fully(offset, buffer.data(), buffer.size()));
+
+    tparquet::BloomFilterHeader header;
+    auto header_length = static_cast<uint32_t>(buffer.size());
+    RETURN_IF_ERROR(deserialize_thrift_msg(buffer.data(), &header_length, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("unsupported bloom filter algorithm, hash or compression");
+    }
+    if (header.numBytes < 0) {
+        return Status::Corruption(strings::Substitute("invalid bloom filter size $0", header.numBytes));
+    }
+    const auto num_bytes = static_cast<uint32_t>(header.numBytes);
+    if (static_cast<uint64_t>(header_length) + num_bytes > file_size - offset) {
+        return Status::Corruption(strings::Substitute("bloom filter size $0 exceeds the file", num_bytes));
+    }
+    RETURN_IF_ERROR(init(num_bytes));
+
+    auto* bitset = reinterpret_cast<uint8_t*>(_bitset.data());
+    const uint32_t buffered = std::min<uint32_t>(num_bytes, buffer.size() - header_length);
+    memcpy(bitset, buffer.data() + header_length, buffered);
+    if (buffered < num_bytes) {
+        RETURN_IF_ERROR(
+                file->read_at_fully(offset + header_length + buffered, bitset + buffered, num_bytes - buffered));
+    }
+    return Status::OK();
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::insert_hash(uint64_t hash) {
+    DCHECK_GT(_num_blocks, 0);
+    uint32_t* block = _bitset.data() + _block_index(hash) * (kBytesPerBlock / sizeof(uint32_t));
+    const auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < kBitsSetPerBlock; i++) {
+        block[i] |= 1U << ((key * kSalts[i]) >> 27);
+    }
+}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    DCHECK_GT(_num_blocks, 0);
+    const uint32_t* block = _bitset.data() + _block_index(hash) * (kBytesPerBlock / sizeof(uint32_t));
+    const auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < kBitsSetPerBlock; i++) {
+        if ((block[i] & (1U << ((key * kSalts[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+// The split block bloom filter of a column chunk, which is stored as a BloomFilterHeader followed by the bitset.
+// The values are hashed by XXH64 with seed 0 in their plain encoding.
+// See https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+class ParquetBloomFilter {
+public:
+    static constexpr uint32_t kBytesPerBlock = 32;
+    static constexpr uint32_t kMinimumBytes = kBytesPerBlock;
+    // The same limit as parquet-mr.
+    static constexpr uint32_t kMaximumBytes = 128 * 1024 * 1024;
+
+    ParquetBloomFilter() = default;
+
+    // Create an empty bloom filter of `num_bytes`, used to write the bloom filter.
+    Status init(uint32_t num_bytes);
+
+    // Read the bloom filter of a column chunk at `offset` of the file.
+    Status read(RandomAccessFile* file, int64_t offset, uint64_t file_size);
+
+    static uint64_t hash(const void* data, size_t size);
+
+    void insert_hash(uint64_t hash);
+
+    bool test_hash(uint64_t hash) const;
+
+    uint32_t num_bytes() const { return _num_blocks * kBytesPerBlock; }
+
+private:
+    static constexpr int kBitsSetPerBlock = 8;
+
+    uint32_t _block_index(uint64_t hash) const {
+        // The upper 32 bits of the hash select the block, and the lower 32 bits select the bits in the block.
+        return static_cast<uint32_t>(((hash >> 32) * _num_blocks) >> 32);
+    }
+
+    uint32_t _num_blocks = 0;
+    std::vector<uint32_t> _bitset;
+};
+
+} // namespace starrocks::parquet
@@ -44,6 +44,7 @@
 #include "exprs/expr_context.h"
 #include "exprs/runtime_filter.h"
 #include "exprs/runtime_filter_bank.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
@@ -512,6 +513,46 @@ bool FileReader::_filter_group_with_more_filter(const tparquet::RowGroup& row_gr
     return false;
 }
 
+bool FileReader::_filter_group_with_bloom_filter(const tparquet::RowGroup& row_group) {
+    SCOPED_RAW_TIMER(&_scanner_ctx->stats->bloom_filter_ns);
+    const TupleDescriptor& tuple_desc = *(_scanner_ctx->tuple_desc);
+    std::vector<uint64_t> hashes;
+    for (const auto& [slot_id, ctxs] : _scanner_ctx->conjunct_ctxs_by_slot) {
+        SlotDescriptor* slot = tuple_desc.get_slot_by_id(slot_id);
+        if (slot == nullptr) continue;
+        const ParquetField* field = _meta_helper->get_parquet_field(slot->col_name());
+        if (field == nullptr) continue;
+        std::unordered_map<std::string, size_t> column_name_2_pos_in_meta{};
+        std::vector<SlotDescriptor*> slot_v{slot};
+        _meta_helper->build_column_name_2_pos_in_meta(column_name_2_pos_in_meta, row_group, slot_v);
+        const tparquet::ColumnMetaData* column_meta =
+                _meta_helper->get_column_meta(column_name_2_pos_in_meta, row_group, slot->col_name());
+        if (column_meta == nullptr || !column_meta->__isset.bloom_filter_offset) continue;
+
+        // read the bloom filter only if there are predicates to check.
+        std::unique_ptr<ParquetBloomFilter> bloom_filter;
+        for (ExprContext* ctx : ctxs) {
+            if (!StatisticsHelper::get_bloom_filter_hashes(ctx, field, &hashes)) continue;
+            if (bloom_filter == nullptr) {
+                bloom_filter = std::make_unique<ParquetBloomFilter>();
+                auto st = bloom_filter->read(_file, column_meta->bloom_filter_offset, _file_size);
+                if (!st.ok()) {
+                    LOG(WARNING) << "failed to read the bloom filter of column " << slot->col_name() << " in "
+                                 << _file->filename() << ": " << st;
+                    break;
+                }
+                _scanner_ctx->stats->bloom_filter_bytes_read += bloom_filter->num_bytes();
+            }
+            bool matched = std::any_of(hashes.begin(), hashes.end(),
+                                       [&](uint64_t hash) { return bloom_filter->test_hash(hash); });
+            if (!matched) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 // when doing row group filter, there maybe some error, but we'd better just ignore it instead of returning the error
 // status and lead to the query failed.
 bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
@@ -527,6 +568,11 @@ bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         return true;
     }
 
+    if (config::parquet_bloom_filter_enable && _filter_group_with_bloom_filter(row_group)) {
+        _scanner_ctx->stats->bloom_filter_skip_groups += 1;
+        return true;
+    }
+
     return false;
 }
 
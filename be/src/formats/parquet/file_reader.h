@@ -106,6 +106,9 @@ private:
 
     bool _filter_group_with_more_filter(const tparquet::RowGroup& row_group);
 
+    // filter row group by the bloom filters of column chunks for equality and in predicates
+    bool _filter_group_with_bloom_filter(const tparquet::RowGroup& row_group);
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
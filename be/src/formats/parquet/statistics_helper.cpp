@@ -14,6 +14,7 @@
 
 #include "formats/parquet/statistics_helper.h"
 
+#include <limits>
 #include <string>
 
 #include "column/column_helper.h"
@@ -23,11 +24,13 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exprs/predicate.h"
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/schema.h"
 #include "gutil/casts.h"
 #include "runtime/large_int_value.h"
+#include "runtime/time_types.h"
 #include "runtime/types.h"
 #include "simd/simd.h"
 #include "storage/column_predicate.h"
@@ -274,4 +277,133 @@ Status StatisticsHelper::in_filter_on_min_max_stat(const std::vector<std::string
     return Status::OK();
 }
 
+// The values of the column are stored as they are, without the scale of decimal, unsigned or time unit conversions.
+static bool is_stored_as_is(const tparquet::SchemaElement& schema) {
+    if (schema.__isset.logicalType) {
+        const auto& logical_type = schema.logicalType;
+        if (logical_type.__isset.INTEGER) {
+            return logical_type.INTEGER.isSigned;
+        }
+        return logical_type.__isset.DATE || logical_type.__isset.STRING;
+    }
+    if (schema.__isset.converted_type) {
+        switch (schema.converted_type) {
+        case tparquet::ConvertedType::INT_8:
+        case tparquet::ConvertedType::INT_16:
+        case tparquet::ConvertedType::INT_32:
+        case tparquet::ConvertedType::INT_64:
+        case tparquet::ConvertedType::DATE:
+        case tparquet::ConvertedType::UTF8:
+            return true;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+// Append the hash of the plain encoded `datum` of the column `field`, return false if the value is not comparable
+// with the stored values. A value out of the range of the physical type is not appended, since it matches nothing.
+static bool append_bloom_filter_hash(const Datum& datum, LogicalType ltype, const ParquetField* field,
+                                     std::vector<uint64_t>* hashes) {
+    int64_t int_value = 0;
+    switch (ltype) {
+    case TYPE_TINYINT:
+        int_value = datum.get_int8();
+        break;
+    case TYPE_SMALLINT:
+        int_value = datum.get_int16();
+        break;
+    case TYPE_INT:
+        int_value = datum.get_int32();
+        break;
+    case TYPE_BIGINT:
+        int_value = datum.get_int64();
+        break;
+    case TYPE_DATE:
+        int_value = datum.get_date().julian() - date::UNIX_EPOCH_JULIAN;
+        break;
+    case TYPE_VARCHAR: {
+        if (field->physical_type != tparquet::Type::BYTE_ARRAY) {
+            return false;
+        }
+        const Slice& slice = datum.get_slice();
+        hashes->push_back(ParquetBloomFilter::hash(slice.data, slice.size));
+        return true;
+    }
+    default:
+        return false;
+    }
+
+    if (field->physical_type == tparquet::Type::INT32) {
+        if (int_value >= std::numeric_limits<int32_t>::min() && int_value <= std::numeric_limits<int32_t>::max()) {
+            auto value = static_cast<int32_t>(int_value);
+            hashes->push_back(ParquetBloomFilter::hash(&value, sizeof(value)));
+        }
+        return true;
+    }
+    if (field->physical_type == tparquet::Type::INT64 && ltype != TYPE_DATE) {
+        hashes->push_back(ParquetBloomFilter::hash(&int_value, sizeof(int_value)));
+        return true;
+    }
+    return false;
+}
+
+bool StatisticsHelper::get_bloom_filter_hashes(ExprContext* ctx, const ParquetField* field,
+                                               std::vector<uint64_t>* hashes) {
+    if (!field->children.empty() || !is_stored_as_is(field->schema_element)) {
+        return false;
+    }
+    Expr* root_expr = ctx->root();
+    Expr* c = root_expr->get_child(0);
+    if (c == nullptr || c->node_type() != TExprNodeType::type::SLOT_REF) {
+        return false;
+    }
+    LogicalType ltype = c->type().type;
+
+    ColumnPtr values;
+    if (root_expr->node_type() == TExprNodeType::IN_PRED && root_expr->op() == TExprOpcode::FILTER_IN) {
+        switch (ltype) {
+#define M(NAME)                                                                                                \
+    case LogicalType::NAME: {                                                                                  \
+        const auto* in_filter = dynamic_cast<const VectorizedInConstPredicate<LogicalType::NAME>*>(root_expr); \
+        if (in_filter == nullptr || in_filter->is_not_in() || in_filter->null_in_set()) {                      \
+            return false;                                                                                      \
+        }                                                                                                      \
+        values = in_filter->get_all_values();                                                                  \
+        break;                                                                                                 \
+    }
+            APPLY_FOR_ALL_SCALAR_TYPE(M);
+#undef M
+        default:
+            return false;
+        }
+    } else if (root_expr->node_type() == TExprNodeType::BINARY_PRED && root_expr->op() == TExprOpcode::EQ) {
+        Expr* value_expr = root_expr->get_child(1);
+        if (value_expr->type().type != ltype || !value_expr->is_constant()) {
+            return false;
+        }
+        auto res = ctx->evaluate(value_expr, nullptr);
+        if (!res.ok()) {
+            return false;
+        }
+        values = std::move(res).value();
+    } else {
+        return false;
+    }
+
+    hashes->clear();
+    for (size_t i = 0; i < values->size(); i++) {
+        Datum datum = values->get(i);
+        // null never equals to any value.
+        if (datum.is_null()) {
+            continue;
+        }
+        if (!append_bloom_filter_hash(datum, ltype, field, hashes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -36,6 +36,10 @@ public:
     static Status in_filter_on_min_max_stat(const std::vector<std::string>& min_values,
                                             const std::vector<std::string>& max_values, ExprContext* ctx,
                                             const ParquetField* field, const std::string& timezone, Filter& selected);
+
+    // Get the hashes of the values matched by the equality or in predicate `ctx` to probe the bloom filter of
+    // `field`, return false if the predicate can't be checked by the bloom filter.
+    static bool get_bloom_filter_hashes(ExprContext* ctx, const ParquetField* field, std::vector<uint64_t>* hashes);
 };
 
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -351,6 +351,11 @@ public:
 
     bool is_cache_hit() const override { return _is_cache_hit; }
 
+    // Reads are passed through as they are, let the stream serve the batch at once.
+    Status read_at_fully_batch(const std::vector<io::ReadRange>& ranges) override {
+        return _stream->read_at_fully_batch(ranges);
+    }
+
 private:
     std::shared_ptr<io::SeekableInputStream> _stream;
     std::string _name;
@@ -16,12 +16,17 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <utility>
 
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
+#include "runtime/current_thread.h"
 #include "util/hash_util.hpp"
+#include "util/raw_container.h"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -63,6 +68,10 @@ CacheInputStream::CacheInputStream(const std::shared_ptr<SharedBufferedInputStre
 }
 
 CacheInputStream::~CacheInputStream() {
+    if (_readahead_ctx != nullptr) {
+        _wait_readahead_blocks();
+        _release_readahead_blocks(0, -1);
+    }
     int64_t io_bytes = _sb_stream->shared_io_bytes() + _sb_stream->direct_io_bytes();
     if (_enable_cache_io_adaptor && io_bytes > 0) {
         int64_t latency_us_per_block = (_sb_stream->shared_io_timer() + _sb_stream->direct_io_timer()) / 1000;
@@ -94,6 +103,13 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
     DCHECK(size <= _block_size);
     int64_t block_id = offset / _block_size;
 
+    if (!_readahead_blocks.empty()) {
+        Status st = _read_block_from_readahead(offset, size, out);
+        if (!st.is_not_found()) {
+            return st;
+        }
+    }
+
     // check block map
     auto iter = _block_map.find(block_id);
     if (iter != _block_map.end()) {
@@ -312,6 +328,14 @@ struct ReadFromRemoteIORange {
 };
 
 Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    RETURN_IF_ERROR(_read_at_fully(offset, out, count));
+    if (_readahead_ctx != nullptr && count > 0) {
+        _readahead(offset, count);
+    }
+    return Status::OK();
+}
+
+Status CacheInputStream::_read_at_fully(int64_t offset, void* out, int64_t count) {
     const int64_t origin_offset = offset;
     count = std::min(_size - offset, count);
     if (count < 0) {
@@ -465,6 +489,211 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
     return;
 }
 
+void CacheInputStream::set_readahead_options(const ReadaheadOptions& options) {
+    DCHECK(_readahead_blocks.empty());
+    _readahead_options = options;
+    if (options.thread_pool != nullptr && options.max_blocks > 0 && options.open_stream != nullptr &&
+        _readahead_ctx == nullptr) {
+        _readahead_ctx = std::make_shared<ReadaheadContext>();
+    }
+}
+
+Status CacheInputStream::_read_block_from_readahead(const int64_t offset, const int64_t size, char* out) {
+    auto iter = _readahead_blocks.find(offset / _block_size);
+    if (iter == _readahead_blocks.end()) {
+        return Status::NotFound("Not Found");
+    }
+    ReadaheadBlock* block = iter->second.get();
+    {
+        std::unique_lock l(_readahead_ctx->mutex);
+        if (!block->ready) {
+            if (!block->started) {
+                // The task may be queued behind the readahead of the other streams for long, read the block
+                // by ourselves instead.
+                block->cancelled = true;
+                return Status::NotFound("Not Found");
+            }
+            // The block is being read, waiting for it is cheaper than reading it again.
+            SCOPED_RAW_TIMER(&_stats.readahead_wait_ns);
+            _readahead_ctx->cv.wait(l, [block] { return block->ready; });
+        }
+    }
+    if (!block->status.ok()) {
+        // Fall back to read it by ourselves, which reports the error if it's not transient.
+        return Status::NotFound("Not Found");
+    }
+    DCHECK(offset >= block->offset && offset + size <= block->offset + block->size);
+    strings::memcpy_inlined(out, block->buffer.data() + offset - block->offset, size);
+    _stats.readahead_hit_count += 1;
+    _stats.readahead_hit_bytes += size;
+    return Status::OK();
+}
+
+void CacheInputStream::_readahead(int64_t offset, int64_t count) {
+    const int64_t end_offset = std::min(offset + count, _size);
+    if (end_offset <= offset) {
+        return;
+    }
+    // The decoder does not read a file contiguously, e.g. it skips the pages or the column chunks that are
+    // filtered, so a read starting no further than one block after the end of the last read is sequential too.
+    if (_last_read_end_offset >= 0 && offset >= _last_read_end_offset &&
+        offset - _last_read_end_offset <= _block_size) {
+        _sequential_reads += 1;
+    } else {
+        _sequential_reads = 0;
+    }
+    _last_read_end_offset = end_offset;
+
+    // The last block may be read again by the next read, the blocks before it are not needed any more.
+    const int64_t last_block_id = (end_offset - 1) / _block_size;
+    const int64_t max_block_id =
+            std::min(last_block_id + _readahead_options.max_blocks, (_size - 1) / _block_size);
+    _release_readahead_blocks(last_block_id, max_block_id);
+
+    // Two sequential reads in a row trigger the readahead, a single one may be a coincidence.
+    static constexpr int32_t kReadaheadTriggerReads = 2;
+    if (_sequential_reads < kReadaheadTriggerReads || !config::datacache_readahead_enable) {
+        return;
+    }
+    for (int64_t block_id = last_block_id + 1; block_id <= max_block_id; block_id++) {
+        if (_readahead_blocks.count(block_id) > 0 || _block_map.count(block_id) > 0) {
+            continue;
+        }
+        const int64_t block_offset = block_id * _block_size;
+        const int64_t block_size = std::min(_block_size, _size - block_offset);
+        // The block will be read by the coalesced io ranges.
+        if (_sb_stream->find_shared_buffer(block_offset, block_size).ok()) {
+            continue;
+        }
+        auto* query_bytes = _readahead_options.query_bytes;
+        if (query_bytes != nullptr &&
+            query_bytes->fetch_add(block_size) + block_size > _readahead_options.max_query_bytes) {
+            query_bytes->fetch_sub(block_size);
+            break;
+        }
+
+        auto block = std::make_shared<ReadaheadBlock>();
+        block->offset = block_offset;
+        block->size = block_size;
+        block->status = Status::Cancelled("readahead task is not run");
+        // The block is marked ready once the task is destroyed, even if it's discarded by the thread pool
+        // without running. `this` may be destroyed after that, or once the block is cancelled, the task must
+        // not touch it any more.
+        auto ctx = _readahead_ctx;
+        std::shared_ptr<void> done(nullptr, [ctx, block](void*) {
+            std::lock_guard l(ctx->mutex);
+            block->ready = true;
+            ctx->cv.notify_all();
+        });
+        auto task = [this, ctx, block, done = std::move(done)]() mutable {
+            {
+                std::lock_guard l(ctx->mutex);
+                if (block->cancelled) {
+                    return;
+                }
+                block->started = true;
+            }
+            _do_readahead(block.get());
+            done.reset();
+        };
+        Status st = _readahead_options.thread_pool->submit_func(std::move(task));
+        if (!st.ok()) {
+            // The thread pool is busy, try it again with the next read.
+            if (query_bytes != nullptr) {
+                query_bytes->fetch_sub(block_size);
+            }
+            break;
+        }
+        _readahead_blocks.emplace(block_id, std::move(block));
+        _stats.readahead_count += 1;
+        _stats.readahead_bytes += block_size;
+    }
+}
+
+void CacheInputStream::_do_readahead(ReadaheadBlock* block) {
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_readahead_options.mem_tracker);
+    raw::stl_string_resize_uninitialized(&block->buffer, block->size);
+    char* data = block->buffer.data();
+
+    ReadCacheOptions read_options;
+    auto res = _cache->read_buffer(_cache_key, block->offset, block->size, data, &read_options);
+    if (res.ok()) {
+        block->status = Status::OK();
+        block->read_cache_bytes = block->size;
+        return;
+    }
+    block->status = _read_from_readahead_stream(block->offset, data, block->size);
+    if (block->status.ok() && _enable_populate_cache) {
+        // The block buffer is released once it's read, so populate it synchronously.
+        WriteCacheOptions write_options;
+        write_options.evict_probability = _datacache_evict_probability;
+        write_options.priority = _priority;
+        write_options.ttl_seconds = _ttl_seconds;
+        Status st = _cache->write_buffer(_cache_key, block->offset, block->size, data, &write_options);
+        if (st.ok() || st.is_already_exist()) {
+            block->write_cache_bytes = block->size;
+        }
+    }
+}
+
+Status CacheInputStream::_read_from_readahead_stream(int64_t offset, char* out, int64_t count) {
+    std::shared_ptr<SeekableInputStream> stream;
+    {
+        std::lock_guard l(_readahead_ctx->mutex);
+        if (!_readahead_ctx->idle_streams.empty()) {
+            stream = std::move(_readahead_ctx->idle_streams.back());
+            _readahead_ctx->idle_streams.pop_back();
+        }
+    }
+    if (stream == nullptr) {
+        ASSIGN_OR_RETURN(stream, _readahead_options.open_stream());
+    }
+    RETURN_IF_ERROR(stream->read_at_fully(offset, out, count));
+    std::lock_guard l(_readahead_ctx->mutex);
+    _readahead_ctx->idle_streams.emplace_back(std::move(stream));
+    return Status::OK();
+}
+
+void CacheInputStream::_release_readahead_blocks(int64_t begin_block_id, int64_t end_block_id) {
+    for (auto iter = _readahead_blocks.begin(); iter != _readahead_blocks.end();) {
+        ReadaheadBlock* block = iter->second.get();
+        if (iter->first >= begin_block_id && iter->first <= end_block_id) {
+            ++iter;
+            continue;
+        }
+        {
+            std::lock_guard l(_readahead_ctx->mutex);
+            if (!block->ready) {
+                if (block->started) {
+                    ++iter;
+                    continue;
+                }
+                block->cancelled = true;
+            }
+        }
+        _stats.readahead_cache_bytes += block->read_cache_bytes;
+        if (block->write_cache_bytes > 0) {
+            _stats.write_cache_count += 1;
+            _stats.write_cache_bytes += block->write_cache_bytes;
+        }
+        if (_readahead_options.query_bytes != nullptr) {
+            _readahead_options.query_bytes->fetch_sub(block->size);
+        }
+        iter = _readahead_blocks.erase(iter);
+    }
+}
+
+void CacheInputStream::_wait_readahead_blocks() {
+    std::unique_lock l(_readahead_ctx->mutex);
+    for (auto& [block_id, block] : _readahead_blocks) {
+        block->cancelled = block->cancelled || !block->started;
+    }
+    _readahead_ctx->cv.wait(l, [this] {
+        return std::all_of(_readahead_blocks.begin(), _readahead_blocks.end(),
+                           [](const auto& entry) { return entry.second->ready || entry.second->cancelled; });
+    });
+}
+
 bool CacheInputStream::_can_ignore_populate_error(const Status& status) const {
     if (status.is_resource_busy() || status.is_mem_limit_exceeded() || status.is_capacity_limit_exceeded()) {
         return true;
@@ -14,13 +14,24 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "block_cache/block_cache.h"
 #include "block_cache/io_buffer.h"
 #include "io/shared_buffered_input_stream.h"
 
+namespace starrocks {
+class MemTracker;
+class ThreadPool;
+} // namespace starrocks
+
 namespace starrocks::io {
 
 class CacheInputStream final : public SeekableInputStreamWrapper {
@@ -44,6 +55,27 @@ public:
         int64_t write_cache_fail_bytes = 0;
         int64_t read_block_buffer_bytes = 0;
         int64_t read_block_buffer_count = 0;
+        int64_t readahead_count = 0;
+        int64_t readahead_bytes = 0;
+        int64_t readahead_cache_bytes = 0;
+        int64_t readahead_hit_count = 0;
+        int64_t readahead_hit_bytes = 0;
+        int64_t readahead_wait_ns = 0;
+    };
+
+    struct ReadaheadOptions {
+        // The readahead is disabled if it is null.
+        ThreadPool* thread_pool = nullptr;
+        // The number of blocks read ahead of a sequential reader.
+        int32_t max_blocks = 0;
+        // The bytes being read ahead by all the streams of a query, and its limit.
+        std::atomic_int64_t* query_bytes = nullptr;
+        int64_t max_query_bytes = 0;
+        // The memory of the blocks read ahead is charged to it.
+        MemTracker* mem_tracker = nullptr;
+        // Open another stream of the file for a readahead task, the readahead is disabled if it is null.
+        // The readahead never reads the stream of the reader, so that the reader is not blocked by it.
+        std::function<StatusOr<std::shared_ptr<SeekableInputStream>>()> open_stream;
     };
 
     explicit CacheInputStream(const std::shared_ptr<SharedBufferedInputStream>& stream, const std::string& filename,
@@ -77,6 +109,10 @@ public:
 
     void set_ttl_seconds(const uint64_t ttl_seconds) { _ttl_seconds = ttl_seconds; }
 
+    // Read the next blocks of the file asynchronously when it's read sequentially, from the cache or the remote
+    // storage, and populate them to the cache if enabled.
+    void set_readahead_options(const ReadaheadOptions& options);
+
     int64_t get_align_size() const;
 
     StatusOr<std::string_view> peek(int64_t count) override;
@@ -92,6 +128,29 @@ private:
         IOBuffer buffer;
     };
     using SharedBufferPtr = SharedBufferedInputStream::SharedBufferPtr;
+    // A block read by the readahead thread pool. `started`, `cancelled`, `ready` and `status` are protected by
+    // the mutex of the `ReadaheadContext`, the others are only accessed by the reader once the block is ready.
+    struct ReadaheadBlock {
+        int64_t offset = 0;
+        int64_t size = 0;
+        // The task is running, it's not cancelled any more.
+        bool started = false;
+        // The task is not started yet, and will do nothing.
+        bool cancelled = false;
+        bool ready = false;
+        Status status;
+        std::string buffer;
+        int64_t read_cache_bytes = 0;
+        int64_t write_cache_bytes = 0;
+    };
+    using ReadaheadBlockPtr = std::shared_ptr<ReadaheadBlock>;
+    // Shared with the readahead tasks, so that they can be waited for safely.
+    struct ReadaheadContext {
+        std::mutex mutex;
+        std::condition_variable cv;
+        // The streams opened by the readahead tasks, reused by the following tasks.
+        std::vector<std::shared_ptr<SeekableInputStream>> idle_streams;
+    };
 
     // Read block from local, if not found, will return Status::NotFound();
     Status _read_block_from_local(const int64_t offset, const int64_t size, char* out);
@@ -101,6 +160,18 @@ private:
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
     bool _can_ignore_populate_error(const Status& status) const;
+    Status _read_at_fully(int64_t offset, void* out, int64_t count);
+    // Read block from the blocks read ahead, if not found, will return Status::NotFound();
+    Status _read_block_from_readahead(const int64_t offset, const int64_t size, char* out);
+    // Detect the sequential reads and issue the readahead of the blocks after [offset, offset + count).
+    void _readahead(int64_t offset, int64_t count);
+    // Run on the readahead thread pool.
+    void _do_readahead(ReadaheadBlock* block);
+    Status _read_from_readahead_stream(int64_t offset, char* out, int64_t count);
+    // Release the blocks out of [begin_block_id, end_block_id], cancel them if they are not started.
+    void _release_readahead_blocks(int64_t begin_block_id, int64_t end_block_id);
+    // Cancel the blocks not started, and wait for the running ones.
+    void _wait_readahead_blocks();
 
     std::string _cache_key;
     std::string _filename;
@@ -120,6 +191,12 @@ private:
     std::unordered_map<int64_t, BlockBuffer> _block_map;
     int8_t _priority = 0;
     uint64_t _ttl_seconds = 0;
+
+    ReadaheadOptions _readahead_options;
+    std::shared_ptr<ReadaheadContext> _readahead_ctx;
+    std::map<int64_t, ReadaheadBlockPtr> _readahead_blocks;
+    int64_t _last_read_end_offset = -1;
+    int32_t _sequential_reads = 0;
 };
 
 } // namespace starrocks::io
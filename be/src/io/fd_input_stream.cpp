@@ -18,9 +18,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "io/io_uring.h"
 #include "io_profiler.h"
 #include "util/stopwatch.hpp"
 
@@ -106,5 +108,25 @@ Status FdInputStream::seek(int64_t offset) {
     return Status::OK();
 }
 
+Status FdInputStream::read_at_fully_batch(const std::vector<ReadRange>& ranges) {
+    CHECK_IS_CLOSED(_is_closed);
+    IoUring* ring = nullptr;
+    if (ranges.size() > 1 && config::enable_io_uring_read) {
+        ring = IoUring::thread_local_instance();
+    }
+    if (ring == nullptr) {
+        return SeekableInputStream::read_at_fully_batch(ranges);
+    }
+    MonotonicStopWatch watch;
+    watch.start();
+    RETURN_IF_ERROR(ring->read(_fd, ranges));
+    int64_t bytes = 0;
+    for (const auto& range : ranges) {
+        bytes += range.size;
+    }
+    IOProfiler::add_read(bytes, watch.elapsed_time());
+    return Status::OK();
+}
+
 #undef CHECK_IS_CLOSED
 } // namespace starrocks::io
@@ -38,6 +38,9 @@ public:
 
     Status seek(int64_t offset) override;
 
+    // Submit all the reads at once through io_uring if enable_io_uring_read is on.
+    Status read_at_fully_batch(const std::vector<ReadRange>& ranges) override;
+
     // closes the underlying file.
     //
     // Returns error if an error occurs during the process;
@@ -0,0 +1,286 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_uring.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/io_error.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define STARROCKS_HAVE_IO_URING 1
+#endif
+
+namespace starrocks::io {
+
+#ifdef STARROCKS_HAVE_IO_URING
+
+// Set once the kernel refuses to create a ring, so that the other threads don't try again.
+static std::atomic<bool> g_io_uring_unsupported{false};
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring != nullptr && _cq_ring != _sq_ring) {
+        munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring != nullptr) {
+        munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+StatusOr<std::unique_ptr<IoUring>> IoUring::create(unsigned entries) {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    RETURN_IF_ERROR(ring->_init(entries));
+    return ring;
+}
+
+Status IoUring::_init(unsigned entries) {
+    io_uring_params params{};
+    _ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (_ring_fd < 0) {
+        return io_error("io_uring_setup", errno);
+    }
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+
+    _sq_ring = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                    IORING_OFF_SQ_RING);
+    if (_sq_ring == MAP_FAILED) {
+        _sq_ring = nullptr;
+        return io_error("mmap io_uring sq ring", errno);
+    }
+    if (single_mmap) {
+        _cq_ring = _sq_ring;
+    } else {
+        _cq_ring = mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                        IORING_OFF_CQ_RING);
+        if (_cq_ring == MAP_FAILED) {
+            _cq_ring = nullptr;
+            return io_error("mmap io_uring cq ring", errno);
+        }
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes =
+            mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        return io_error("mmap io_uring sqes", errno);
+    }
+    _sqes = static_cast<io_uring_sqe*>(sqes);
+
+    auto* sq = static_cast<char*>(_sq_ring);
+    _sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    _sq_entries = params.sq_entries;
+
+    auto* cq = static_cast<char*>(_cq_ring);
+    _cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+}
+
+IoUring* IoUring::thread_local_instance() {
+    if (g_io_uring_unsupported.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    thread_local std::unique_ptr<IoUring> tls_ring;
+    if (tls_ring == nullptr) {
+        auto ring_or = create(std::max(config::io_uring_queue_depth, 1));
+        if (!ring_or.ok()) {
+            // Mostly ENOSYS or EPERM, which won't change for the other threads.
+            if (!g_io_uring_unsupported.exchange(true)) {
+                LOG(WARNING) << "io_uring is unavailable, fallback to pread: " << ring_or.status();
+            }
+            return nullptr;
+        }
+        tls_ring = std::move(ring_or).value();
+    }
+    return tls_ring.get();
+}
+
+StatusOr<unsigned> IoUring::_submit_and_wait(unsigned to_submit, unsigned min_complete) {
+    unsigned submitted = 0;
+    while (true) {
+        int ret = static_cast<int>(syscall(__NR_io_uring_enter, _ring_fd, to_submit - submitted, min_complete,
+                                           IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (ret > 0 && submitted + ret < to_submit) {
+            // The kernel stops at the first sqe it fails to submit and doesn't wait, submit the rest.
+            submitted += ret;
+            continue;
+        }
+        if (ret >= 0) {
+            return submitted + ret;
+        }
+        if (errno == EAGAIN || errno == EBUSY) {
+            // Short of resources, or the completion queue is full, the caller reaps the completions and
+            // submits the rest again.
+            return submitted;
+        }
+        if (errno != EINTR) {
+            return io_error("io_uring_enter", errno);
+        }
+        // Interrupted while waiting, the sqes are consumed by the kernel already.
+        submitted = to_submit;
+    }
+}
+
+Status IoUring::read(int fd, const std::vector<ReadRange>& ranges) {
+    struct Request {
+        iovec iov;
+        int64_t offset;
+    };
+    std::vector<Request> requests(ranges.size());
+    // Each range is either pending, in flight or done, so `pending` never grows beyond the reserved
+    // capacity, and reaping the completions can't throw while the kernel still owns the buffers.
+    std::vector<size_t> pending;
+    pending.reserve(ranges.size());
+    for (size_t i = ranges.size(); i-- > 0;) {
+        requests[i].iov.iov_base = ranges[i].data;
+        requests[i].iov.iov_len = ranges[i].size;
+        requests[i].offset = ranges[i].offset;
+        if (ranges[i].size > 0) {
+            pending.push_back(i);
+        }
+    }
+
+    Status status;
+    size_t in_flight = 0;
+    auto reap_completions = [&]() {
+        unsigned head = *_cq_head;
+        unsigned cq_tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != cq_tail; ++head) {
+            const io_uring_cqe* cqe = &_cqes[head & *_cq_mask];
+            size_t index = cqe->user_data;
+            int res = cqe->res;
+            in_flight--;
+            auto& req = requests[index];
+            if (res == -EINTR || res == -EAGAIN) {
+                pending.push_back(index);
+            } else if (res < 0) {
+                if (status.ok()) status = io_error("io_uring read", -res);
+            } else if (res == 0) {
+                if (status.ok()) status = Status::EndOfFile("io_uring read: unexpected end of file");
+            } else if (static_cast<size_t>(res) < req.iov.iov_len) {
+                // Short read, read the rest.
+                req.iov.iov_base = static_cast<char*>(req.iov.iov_base) + res;
+                req.iov.iov_len -= res;
+                req.offset += res;
+                pending.push_back(index);
+            }
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    };
+    // The kernel may still write into the buffers and `requests` for the reads in flight, so this
+    // must not return before all of them complete.
+    auto drain_in_flight = [&]() {
+        while (in_flight > 0) {
+            if (auto st = _submit_and_wait(0, 1).status(); !st.ok()) {
+                // The completions are posted to the shared cq ring without io_uring_enter, poll it instead.
+                LOG_EVERY_N(WARNING, 100) << "failed to wait for " << in_flight << " in-flight io_uring reads, "
+                                          << "poll the completion queue: " << st;
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            reap_completions();
+        }
+    };
+
+    while (in_flight > 0 || (!pending.empty() && status.ok())) {
+        // Fill the submission queue, after the sqes left by the last submission if any.
+        unsigned tail = *_sq_tail;
+        while (status.ok() && !pending.empty() && in_flight < _sq_entries) {
+            size_t index = pending.back();
+            pending.pop_back();
+            unsigned slot = tail & *_sq_mask;
+            io_uring_sqe* sqe = &_sqes[slot];
+            memset(sqe, 0, sizeof(*sqe));
+            // READV is supported since the first version of io_uring.
+            sqe->opcode = IORING_OP_READV;
+            sqe->fd = fd;
+            sqe->off = requests[index].offset;
+            sqe->addr = reinterpret_cast<uint64_t>(&requests[index].iov);
+            sqe->len = 1;
+            sqe->user_data = index;
+            _sq_array[slot] = slot;
+            tail++;
+            in_flight++;
+        }
+        __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+        const unsigned to_submit = tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+        auto submitted = _submit_and_wait(to_submit, 1);
+        if (!submitted.ok()) {
+            // Withdraw the sqes the kernel hasn't consumed, and wait for the others before returning.
+            unsigned sq_head = __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+            in_flight -= tail - sq_head;
+            __atomic_store_n(_sq_tail, sq_head, __ATOMIC_RELEASE);
+            reap_completions();
+            drain_in_flight();
+            return submitted.status();
+        }
+        const size_t last_in_flight = in_flight;
+        reap_completions();
+        if (submitted.value() < to_submit && last_in_flight == in_flight) {
+            // The kernel is busy and no read completes, back off before submitting the rest again.
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    DCHECK_EQ(in_flight, 0);
+    return status;
+}
+
+#else
+
+IoUring::~IoUring() = default;
+
+StatusOr<std::unique_ptr<IoUring>> IoUring::create(unsigned entries) {
+    return Status::NotSupported("io_uring is not supported on this platform");
+}
+
+IoUring* IoUring::thread_local_instance() {
+    return nullptr;
+}
+
+Status IoUring::read(int fd, const std::vector<ReadRange>& ranges) {
+    return Status::NotSupported("io_uring is not supported on this platform");
+}
+
+#endif
+
+} // namespace starrocks::io
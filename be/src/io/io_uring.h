@@ -0,0 +1,81 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "common/statusor.h"
+#include "io/seekable_input_stream.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace starrocks::io {
+
+// IoUring is a minimal io_uring instance to submit many positional reads of a file at once
+// and wait for all of them, so one thread keeps the whole queue depth of a NVMe device busy
+// instead of issuing blocking preads one by one.
+//
+// It talks to the kernel through the raw syscalls, and is not thread safe. Use the instance of
+// the current thread returned by thread_local_instance().
+class IoUring {
+public:
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    static StatusOr<std::unique_ptr<IoUring>> create(unsigned entries);
+
+    // Returns the instance of the current thread, or nullptr if io_uring is not supported,
+    // e.g. an old kernel or io_uring is forbidden by seccomp.
+    static IoUring* thread_local_instance();
+
+    // Read all the ranges of fd, retrying the short reads. Returns only after all the submitted
+    // reads are completed, even on errors, so the buffers of the ranges can be released after it.
+    Status read(int fd, const std::vector<ReadRange>& ranges);
+
+private:
+    IoUring() = default;
+
+    Status _init(unsigned entries);
+    // Return the number of the sqes submitted, which is less than `to_submit` if the kernel is busy.
+    StatusOr<unsigned> _submit_and_wait(unsigned to_submit, unsigned min_complete);
+
+    int _ring_fd = -1;
+
+    void* _sq_ring = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ring = nullptr;
+    size_t _cq_ring_size = 0;
+    io_uring_sqe* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    unsigned* _sq_head = nullptr;
+    unsigned* _sq_tail = nullptr;
+    unsigned* _sq_mask = nullptr;
+    unsigned* _sq_array = nullptr;
+    unsigned _sq_entries = 0;
+
+    unsigned* _cq_head = nullptr;
+    unsigned* _cq_tail = nullptr;
+    unsigned* _cq_mask = nullptr;
+    io_uring_cqe* _cqes = nullptr;
+};
+
+} // namespace starrocks::io
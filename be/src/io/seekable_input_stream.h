@@ -14,10 +14,19 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/input_stream.h"
 
 namespace starrocks::io {
 
+// A range of the stream to read into |data|, which has room for at least |size| bytes.
+struct ReadRange {
+    int64_t offset;
+    int64_t size;
+    void* data;
+};
+
 class SeekableInputStream : public InputStream {
 public:
     ~SeekableInputStream() override = default;
@@ -57,6 +66,12 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Read all the |ranges| fully as read_at_fully() does, in no particular order.
+    //
+    // Default implementation calls read_at_fully() for each range. Streams which could
+    // serve many reads at once, e.g. local files read through io_uring, override it.
+    virtual Status read_at_fully_batch(const std::vector<ReadRange>& ranges);
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -126,6 +141,11 @@ public:
         return _impl->read_at_fully(offset, out, count);
     }
 
+    // read_at_fully_batch() is not forwarded to the wrapped stream, the default implementation
+    // calls read_at_fully() of this wrapper for each range, so that the wrappers overriding
+    // read_at_fully(), e.g. for throttling or caching, see every read. The wrappers which don't
+    // change how the data is read could override it to forward the batch.
+
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
     Status seek(int64_t offset) override { return _impl->seek(offset); }
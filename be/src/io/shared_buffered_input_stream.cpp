@@ -218,20 +218,63 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
-        _shared_io_count += 1;
-        _shared_io_bytes += sb.size;
-        if (sb.size > sb.raw_size) {
-            // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
-            // we will count how many extra bytes we read because of alignment.
-            _shared_align_io_bytes += sb.size - sb.raw_size;
+        if (config::enable_io_uring_read && config::io_uring_read_batch_size > 1) {
+            RETURN_IF_ERROR(_read_shared_buffers_batch(shared_buffer));
+        } else {
+            _update_shared_io_stats(sb);
+            sb.buffer.reserve(sb.size);
+            RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
         }
-        sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+void SharedBufferedInputStream::_update_shared_io_stats(const SharedBuffer& sb) {
+    _shared_io_count += 1;
+    _shared_io_bytes += sb.size;
+    if (sb.size > sb.raw_size) {
+        // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
+        // we will count how many extra bytes we read because of alignment.
+        _shared_align_io_bytes += sb.size - sb.raw_size;
+    }
+}
+
+Status SharedBufferedInputStream::_read_shared_buffers_batch(const SharedBufferPtr& first) {
+    // Read the following shared buffers together, they will be read soon by the column iterator,
+    // and the stream may serve them at once, e.g. local files read through io_uring.
+    std::vector<SharedBuffer*> buffers{first.get()};
+    int64_t batch_bytes = first->size;
+    for (auto iter = _map.upper_bound(first->raw_offset + first->raw_size - 1); iter != _map.end(); ++iter) {
+        SharedBuffer* sb = iter->second.get();
+        if (buffers.size() >= static_cast<size_t>(config::io_uring_read_batch_size) ||
+            batch_bytes + sb->size > _options.max_buffer_size + first->size) {
+            break;
+        }
+        if (sb == first.get() || sb->buffer.capacity() != 0) {
+            continue;
+        }
+        buffers.emplace_back(sb);
+        batch_bytes += sb->size;
+    }
+
+    std::vector<ReadRange> ranges;
+    ranges.reserve(buffers.size());
+    for (SharedBuffer* sb : buffers) {
+        _update_shared_io_stats(*sb);
+        sb->buffer.reserve(sb->size);
+        ranges.push_back(ReadRange{.offset = sb->offset, .size = sb->size, .data = sb->buffer.data()});
+    }
+    auto st = _stream->read_at_fully_batch(ranges);
+    if (!st.ok()) {
+        // release the buffers so that they will be read again
+        for (SharedBuffer* sb : buffers) {
+            std::vector<uint8_t>().swap(sb->buffer);
+        }
+    }
+    return st;
+}
+
 void SharedBufferedInputStream::release() {
     _map.clear();
 }
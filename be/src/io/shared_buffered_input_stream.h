@@ -99,6 +99,8 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    void _update_shared_io_stats(const SharedBuffer& sb);
+    Status _read_shared_buffers_batch(const SharedBufferPtr& first);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
@@ -43,6 +43,7 @@
 #include "column/chunk.h"
 #include "exec/sort_exec_exprs.h"
 #include "gen_cpp/data.pb.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/chunk_cursor.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
@@ -50,6 +51,7 @@
 #include "runtime/sender_queue.h"
 #include "runtime/sorted_chunks_merger.h"
 #include "util/compression/block_compression.h"
+#include "util/compression/zstd_dict_compression.h"
 #include "util/debug_util.h"
 #include "util/defer_op.h"
 #include "util/faststring.h"
@@ -237,6 +239,30 @@ bool DataStreamRecvr::is_data_ready() {
     }
 }
 
+Status DataStreamRecvr::_register_compress_dicts(const PTransmitChunkParams& request) {
+    for (const auto& pchunk : request.chunks()) {
+        if (!pchunk.has_compress_dict()) {
+            continue;
+        }
+        std::lock_guard<std::mutex> l(_compress_dicts_lock);
+        if (_compress_dicts.count(pchunk.compress_dict_id()) > 0) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(auto decompressor, ZstdDictDecompressor::create(pchunk.compress_dict()));
+        _compress_dicts.emplace(pchunk.compress_dict_id(), std::move(decompressor));
+    }
+    return Status::OK();
+}
+
+StatusOr<std::shared_ptr<ZstdDictDecompressor>> DataStreamRecvr::get_compress_dict(int64_t dict_id) {
+    std::lock_guard<std::mutex> l(_compress_dicts_lock);
+    auto iter = _compress_dicts.find(dict_id);
+    if (iter == _compress_dicts.end()) {
+        return Status::InternalError(strings::Substitute("compression dictionary $0 is not received", dict_id));
+    }
+    return iter->second;
+}
+
 Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
     MemTracker* prev_tracker = tls_thread_status.set_mem_tracker(_instance_mem_tracker.get());
     DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
@@ -245,6 +271,9 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     SCOPED_TIMER(metrics.process_total_timer);
     COUNTER_UPDATE(metrics.request_received_counter, 1);
     int use_sender_id = _is_merging ? request.sender_id() : 0;
+    // The chunks may be deserialized lazily and out of order by the consumers, so the dictionaries carried
+    // by the request must be ready before any of its chunks is enqueued.
+    RETURN_IF_ERROR(_register_compress_dicts(request));
     // Add all batches to the same queue if _is_merging is false.
 
     if (_keep_order) {
@@ -35,10 +35,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -60,7 +63,9 @@ class DataStreamMgr;
 class MemTracker;
 class RuntimeProfile;
 class PTransmitChunkParams;
+class ChunkPB;
 class SortExecExprs;
+class ZstdDictDecompressor;
 
 // Single receiver of an m:n data stream.
 // DataStreamRecvr maintains one or more queues of row batches received by a
@@ -159,6 +164,12 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    // Register the compression dictionaries carried by the chunks of the request.
+    Status _register_compress_dicts(const PTransmitChunkParams& request);
+
+    // Return the dictionary registered by the request carrying it.
+    StatusOr<std::shared_ptr<ZstdDictDecompressor>> get_compress_dict(int64_t dict_id);
+
     // Return a metrics for current rpc in round-robin manner.
     Metrics& get_metrics_round_robin() { return _metrics[_rpc_round_roubin_index++ % _metrics.size()]; }
 
@@ -248,6 +259,10 @@ private:
 
     int _encode_level;
     bool _closed = false;
+
+    // Compression dictionaries of all the senders, keyed by dictionary id.
+    std::mutex _compress_dicts_lock;
+    std::unordered_map<int64_t, std::shared_ptr<ZstdDictDecompressor>> _compress_dicts;
 };
 
 } // end namespace starrocks
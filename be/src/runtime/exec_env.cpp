@@ -34,6 +34,7 @@
 
 #include "runtime/exec_env.h"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 
@@ -256,7 +257,19 @@ void GlobalEnv::_reset_tracker() {
 void GlobalEnv::_init_storage_page_cache() {
     int64_t storage_cache_limit = get_storage_page_cache_size();
     storage_cache_limit = check_storage_page_cache_size(storage_cache_limit);
-    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit);
+    StoragePageCache::create_global_cache(page_cache_mem_tracker(), storage_cache_limit,
+                                          get_decoded_page_cache_size());
+}
+
+int64_t GlobalEnv::get_decoded_page_cache_size() {
+    if (config::disable_storage_page_cache) {
+        return 0;
+    }
+    int64_t mem_limit = MemInfo::physical_mem();
+    if (process_mem_tracker()->has_limit()) {
+        mem_limit = process_mem_tracker()->limit();
+    }
+    return std::max<int64_t>(ParseUtil::parse_mem_spec(config::decoded_page_cache_limit.value(), mem_limit), 0);
 }
 
 int64_t GlobalEnv::get_storage_page_cache_size() {
@@ -344,6 +357,24 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_automatic_partition_pool));
 
+    int num_memtable_sort_threads = config::memtable_sort_thread_num;
+    if (num_memtable_sort_threads <= 0) {
+        num_memtable_sort_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("memtable_sort") // parallel memtable sort pool
+                            .set_min_threads(0)
+                            .set_max_threads(num_memtable_sort_threads)
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_memtable_sort_thread_pool));
+
+    RETURN_IF_ERROR(ThreadPoolBuilder("datacache_readahead") // readahead pool of the remote data files
+                            .set_min_threads(0)
+                            .set_max_threads(std::max(1, config::datacache_readahead_thread_num))
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_datacache_readahead_pool));
+
     int num_prepare_threads = config::pipeline_prepare_thread_pool_thread_num;
     if (num_prepare_threads == 0) {
         num_prepare_threads = CpuInfo::num_cores();
@@ -630,6 +661,14 @@ void ExecEnv::stop() {
         _automatic_partition_pool->shutdown();
     }
 
+    if (_memtable_sort_thread_pool) {
+        _memtable_sort_thread_pool->shutdown();
+    }
+
+    if (_datacache_readahead_pool) {
+        _datacache_readahead_pool->shutdown();
+    }
+
     if (_query_rpc_pool) {
         _query_rpc_pool->shutdown();
     }
@@ -730,6 +769,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
     _automatic_partition_pool.reset();
+    _memtable_sort_thread_pool.reset();
+    _datacache_readahead_pool.reset();
     _metrics = nullptr;
 }
 
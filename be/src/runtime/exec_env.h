@@ -152,6 +152,7 @@ public:
 
     int64_t get_storage_page_cache_size();
     int64_t check_storage_page_cache_size(int64_t storage_cache_limit);
+    int64_t get_decoded_page_cache_size();
     static int64_t calc_max_query_memory(int64_t process_mem_limit, int64_t percent);
 
 private:
@@ -299,6 +300,10 @@ public:
 
     ThreadPool* automatic_partition_pool() { return _automatic_partition_pool.get(); }
 
+    ThreadPool* memtable_sort_thread_pool() { return _memtable_sort_thread_pool.get(); }
+
+    ThreadPool* datacache_readahead_pool() { return _datacache_readahead_pool.get(); }
+
     RuntimeFilterWorker* runtime_filter_worker() { return _runtime_filter_worker; }
 
     RuntimeFilterCache* runtime_filter_cache() { return _runtime_filter_cache; }
@@ -388,6 +393,8 @@ private:
     HeartbeatFlags* _heartbeat_flags = nullptr;
 
     std::unique_ptr<ThreadPool> _automatic_partition_pool;
+    std::unique_ptr<ThreadPool> _memtable_sort_thread_pool;
+    std::unique_ptr<ThreadPool> _datacache_readahead_pool;
 
     RuntimeFilterWorker* _runtime_filter_worker = nullptr;
     RuntimeFilterCache* _runtime_filter_cache = nullptr;
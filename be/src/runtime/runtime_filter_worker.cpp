@@ -367,8 +367,13 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     }
 
     out->set_global();
+    std::vector<JoinRuntimeFilter*> filters;
     for (auto it : status->filters) {
-        out->concat(it.second);
+        filters.emplace_back(it.second);
+    }
+    JoinRuntimeFilter::prepare_concat(filters);
+    for (auto* rf : filters) {
+        out->concat(rf);
     }
     // if well enough, then we send it out.
 
@@ -388,6 +393,13 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(out);
     send_data->resize(max_size);
 
+    // rf_version is the one of the last received partial filter, but the merged filter keeps the bitset only
+    // if all the partial filters have one, so the format of the merged filter is decided by itself.
+    if (out->has_exact_bitset()) {
+        rf_version = RF_VERSION_V3;
+    } else if (rf_version == RF_VERSION_V3) {
+        rf_version = RF_VERSION_V2;
+    }
     size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf_version, out,
                                                                        reinterpret_cast<uint8_t*>(send_data->data()));
     send_data->resize(actual_size);
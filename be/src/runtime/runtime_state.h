@@ -399,6 +399,11 @@ public:
     int32_t spill_encode_level() const {
         return EXTRACE_SPILL_PARAM(_query_options, _spill_options, spill_encode_level);
     }
+    TCompressionType::type spill_compression_type() const {
+        return _spill_options.has_value() && _spill_options->__isset.spill_compression_type
+                       ? _spill_options->spill_compression_type
+                       : TCompressionType::NO_COMPRESSION;
+    }
     bool spill_enable_compaction() const {
         return _spill_options.has_value() ? _spill_options->spill_enable_compaction : false;
     }
@@ -417,6 +422,20 @@ public:
         return _query_options.__isset.enable_hyperscan_vec && _query_options.enable_hyperscan_vec;
     }
 
+    bool enable_shared_agg_hash_table() const {
+        return _query_options.__isset.enable_shared_agg_hash_table && _query_options.enable_shared_agg_hash_table;
+    }
+
+    bool enable_transmission_compression_dict() const {
+        return _query_options.__isset.enable_transmission_compression_dict &&
+               _query_options.enable_transmission_compression_dict;
+    }
+
+    bool enable_adaptive_transmission_compression() const {
+        return _query_options.__isset.enable_adaptive_transmission_compression &&
+               _query_options.enable_adaptive_transmission_compression;
+    }
+
     const std::vector<TTabletCommitInfo>& tablet_commit_infos() const { return _tablet_commit_infos; }
 
     std::vector<TTabletCommitInfo>& tablet_commit_infos() { return _tablet_commit_infos; }
@@ -505,6 +524,7 @@ public:
     // logical -> 32
     // div -> 64
     // mod -> 128
+    // aggregate -> 256
     bool can_jit_expr(const int jit_label) {
         return (_query_options.jit_level == 1) || ((_query_options.jit_level & jit_label));
     }
@@ -517,6 +537,13 @@ public:
 
     const std::unordered_set<int32_t>& shuffle_hash_bucket_rf_ids() const { return this->_shuffle_hash_bucket_rf_ids; }
 
+    // The slots read as the only key of the hash aggregations and the join probes of the fragment.
+    void set_dict_code_key_slots(std::unordered_set<SlotId>&& slot_ids) {
+        this->_dict_code_key_slots = std::move(slot_ids);
+    }
+
+    const std::unordered_set<SlotId>& dict_code_key_slots() const { return this->_dict_code_key_slots; }
+
     void set_broadcast_join_right_offsprings(BroadcastJoinRightOffsprings&& broadcast_join_right_offsprings) {
         this->_broadcast_join_right_offsprings = std::move(broadcast_join_right_offsprings);
     }
@@ -666,6 +693,7 @@ private:
     bool _enable_pipeline_engine = false;
 
     std::unordered_set<int32_t> _shuffle_hash_bucket_rf_ids;
+    std::unordered_set<SlotId> _dict_code_key_slots;
     BroadcastJoinRightOffsprings _broadcast_join_right_offsprings;
 
     std::optional<TSpillOptions> _spill_options;
@@ -23,6 +23,7 @@
 #include "runtime/data_stream_recvr.h"
 #include "runtime/exec_env.h"
 #include "util/compression/block_compression.h"
+#include "util/compression/zstd_dict_compression.h"
 #include "util/faststring.h"
 #include "util/logging.h"
 #include "util/runtime_profile.h"
@@ -116,12 +117,17 @@ Status DataStreamRecvr::SenderQueue::_deserialize_chunk(const ChunkPB& pchunk, C
         size_t uncompressed_size = 0;
         {
             SCOPED_TIMER(metrics.decompress_chunk_timer);
-            const BlockCompressionCodec* codec = nullptr;
-            RETURN_IF_ERROR(get_block_compression_codec(pchunk.compress_type(), &codec));
             uncompressed_size = pchunk.uncompressed_size();
             TRY_CATCH_BAD_ALLOC(uncompressed_buffer->resize(uncompressed_size));
             Slice output{uncompressed_buffer->data(), uncompressed_size};
-            RETURN_IF_ERROR(codec->decompress(pchunk.data(), &output));
+            if (pchunk.has_compress_dict_id()) {
+                ASSIGN_OR_RETURN(auto dict, _recvr->get_compress_dict(pchunk.compress_dict_id()));
+                RETURN_IF_ERROR(dict->decompress(pchunk.data(), &output));
+            } else {
+                const BlockCompressionCodec* codec = nullptr;
+                RETURN_IF_ERROR(get_block_compression_codec(pchunk.compress_type(), &codec));
+                RETURN_IF_ERROR(codec->decompress(pchunk.data(), &output));
+            }
         }
         {
             SCOPED_TIMER(metrics.deserialize_chunk_timer);
@@ -985,14 +985,12 @@ Status PInternalServiceImplBase<T>::_submit_mv_maintenance_task(brpc::Controller
     //     break;
     // }
     case MVTaskType::STOP_MAINTENANCE: {
-        // Find the fragment context for the specific MV job
-        TUniqueId query_id;
-        auto&& existing_query_ctx = _exec_env->query_context_mgr()->get(query_id);
-        if (!existing_query_ctx) {
-            return Status::InternalError(fmt::format("MV Job has been cancelled: {}.", print_id(query_id)));
-        }
-        auto stream_epoch_manager = existing_query_ctx->stream_epoch_manager();
-        RETURN_IF_ERROR(stream_epoch_manager->set_finished(_exec_env, existing_query_ctx.get()));
+        // The maintenance is also stopped before ALTER, then the states are kept for the rebuilt job, and
+        // only dropped with the MV.
+        bool drop_state = t_request.__isset.stop_maintenance && t_request.stop_maintenance.__isset.drop_state &&
+                          t_request.stop_maintenance.drop_state;
+        auto stream_epoch_manager = query_ctx->stream_epoch_manager();
+        RETURN_IF_ERROR(stream_epoch_manager->set_finished(_exec_env, query_ctx.get(), drop_state));
         break;
     }
     default:
@@ -1006,10 +1004,13 @@ Status PInternalServiceImplBase<T>::_mv_start_maintenance(const TMVMaintenanceTa
     RETURN_IF(!task.__isset.start_maintenance, Status::InternalError("must be start_maintenance task"));
     auto& start_maintenance = task.start_maintenance;
     auto& fragments = start_maintenance.fragments;
+    // The operators read the maintenance task info when the drivers are prepared by `execute`, e.g. to check
+    // their states against the committed epoch, so the EpochManager is prepared before any fragment is executed.
+    std::vector<std::unique_ptr<pipeline::FragmentExecutor>> fragment_executors;
     for (const auto& fragment : fragments) {
-        pipeline::FragmentExecutor fragment_executor;
-        RETURN_IF_ERROR(fragment_executor.prepare(_exec_env, fragment, fragment));
-        RETURN_IF_ERROR(fragment_executor.execute(_exec_env));
+        auto fragment_executor = std::make_unique<pipeline::FragmentExecutor>();
+        RETURN_IF_ERROR(fragment_executor->prepare(_exec_env, fragment, fragment));
+        fragment_executors.emplace_back(std::move(fragment_executor));
     }
 
     // Prepare EpochManager
@@ -1035,6 +1036,10 @@ Status PInternalServiceImplBase<T>::_mv_start_maintenance(const TMVMaintenanceTa
     DCHECK(stream_epoch_manager);
     auto maintenance_task = MVMaintenanceTaskInfo::from_maintenance_task(task);
     RETURN_IF_ERROR(stream_epoch_manager->prepare(maintenance_task, fragment_ctxs));
+
+    for (auto& fragment_executor : fragment_executors) {
+        RETURN_IF_ERROR(fragment_executor->execute(_exec_env));
+    }
     return Status::OK();
 }
 
@@ -1075,6 +1080,17 @@ Status PInternalServiceImplBase<T>::_mv_commit_epoch(const pipeline::QueryContex
                                                      const TMVMaintenanceTasks& task) {
     RETURN_IF(!task.__isset.commit_epoch, Status::InternalError("must be commit_epoch task"));
     auto& commit_epoch_task = task.commit_epoch;
+    if (commit_epoch_task.__isset.partition_version_infos && !commit_epoch_task.partition_version_infos.empty()) {
+        RETURN_IF_ERROR(_mv_publish_version(commit_epoch_task));
+    }
+    // The states of the epoch are only checkpointed after FE commits it, otherwise they are discarded when
+    // the epoch is retried.
+    RETURN_IF(!commit_epoch_task.__isset.epoch, Status::InternalError("commit_epoch task must have epoch"));
+    return query_ctx->stream_epoch_manager()->publish_epoch(query_ctx.get(), commit_epoch_task.epoch.epoch_id);
+}
+
+template <typename T>
+Status PInternalServiceImplBase<T>::_mv_publish_version(const TMVCommitEpochTask& commit_epoch_task) {
     auto* agent_server = ExecEnv::GetInstance()->agent_server();
     auto token =
             agent_server->get_thread_pool(TTaskType::PUBLISH_VERSION)->new_token(ThreadPool::ExecutionMode::CONCURRENT);
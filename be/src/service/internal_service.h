@@ -222,6 +222,7 @@ private:
     Status _mv_start_maintenance(const TMVMaintenanceTasks& task);
     Status _mv_start_epoch(const pipeline::QueryContextPtr& query_ctx, const TMVMaintenanceTasks& task);
     Status _mv_commit_epoch(const pipeline::QueryContextPtr& query_ctx, const TMVMaintenanceTasks& task);
+    Status _mv_publish_version(const TMVCommitEpochTask& commit_epoch_task);
     Status _mv_abort_epoch(const pipeline::QueryContextPtr& query_ctx, const TMVMaintenanceTasks& task);
 
     // short circuit
@@ -16,6 +16,7 @@
 
 #include <bvar/bvar.h>
 
+#include "common/config.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/del_vector.h"
 #include "storage/lake/tablet_manager.h"
@@ -84,7 +85,8 @@ static bvar::PassiveStatus<size_t> g_metacache_capacity("lake", "metacache_capac
 static bvar::PassiveStatus<size_t> g_metacache_usage("lake", "metacache_usage", get_metacache_usage, nullptr);
 #endif
 
-Metacache::Metacache(int64_t cache_capacity) : _cache(new_lru_cache(cache_capacity)) {}
+Metacache::Metacache(int64_t cache_capacity)
+        : _cache(new_cache(config::lake_metadata_cache_eviction_policy, cache_capacity)) {}
 
 Metacache::~Metacache() = default;
 
@@ -71,7 +71,9 @@ StatusOr<std::vector<ChunkIteratorPtr>> Rowset::read(const Schema& schema, const
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
+    seg_options.dict_code_column_ids = options.dict_code_column_ids;
     seg_options.runtime_range_pruner = options.runtime_range_pruner;
+    seg_options.runtime_filter_preds = options.runtime_filter_preds;
     seg_options.tablet_schema = options.tablet_schema;
     seg_options.lake_io_opts = options.lake_io_opts;
     seg_options.asc_hint = options.asc_hint;
@@ -239,7 +239,9 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.tablet_schema = _tablet_schema;
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
+    rs_opts.dict_code_column_ids = params.dict_code_column_ids;
     rs_opts.runtime_range_pruner = params.runtime_range_pruner;
+    rs_opts.runtime_filter_preds = params.runtime_filter_preds;
     rs_opts.lake_io_opts = params.lake_io_opts;
 
     if (keys_type == KeysType::PRIMARY_KEYS) {
@@ -14,16 +14,21 @@
 
 #include "storage/memtable.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "column/binary_column.h"
 #include "column/json_column.h"
+#include "common/config.h"
 #include "common/logging.h"
+#include "exec/sorting/merge_path.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "storage/chunk_helper.h"
 #include "storage/memtable_sink.h"
 #include "storage/primary_key_encoder.h"
@@ -31,7 +36,9 @@
 #include "storage/row_store_encoder_factory.h"
 #include "storage/tablet_schema.h"
 #include "types/logical_type_infra.h"
+#include "util/countdown_latch.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 
 namespace starrocks {
@@ -39,6 +46,45 @@ namespace starrocks {
 // TODO(cbl): move to common space latter
 static const string LOAD_OP_COLUMN = "__op";
 
+// Run the tasks [0, num_tasks) on the memtable sort thread pool. The calling thread runs the tasks too, so it
+// never waits for a busy pool, and all the tasks run in the calling thread if there is no pool, e.g. in tests.
+static Status run_memtable_sort_tasks(MemTracker* mem_tracker, size_t num_tasks,
+                                      const std::function<Status(size_t)>& task) {
+    std::atomic<size_t> next_task{0};
+    std::mutex status_mutex;
+    Status status;
+    auto run_tasks = [&]() {
+        for (size_t i = next_task++; i < num_tasks; i = next_task++) {
+            Status st = task(i);
+            if (!st.ok()) {
+                std::lock_guard l(status_mutex);
+                status.update(st);
+            }
+        }
+    };
+
+    ThreadPool* pool = ExecEnv::GetInstance()->memtable_sort_thread_pool();
+    int num_workers = 0;
+    if (pool != nullptr && num_tasks > 1) {
+        num_workers = std::min<int>(num_tasks - 1, pool->max_threads());
+    }
+    CountDownLatch latch(num_workers);
+    for (int i = 0; i < num_workers; i++) {
+        auto st = pool->submit_func([&]() {
+            SCOPED_THREAD_LOCAL_MEM_SETTER(mem_tracker, false);
+            run_tasks();
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            latch.count_down(num_workers - i);
+            break;
+        }
+    }
+    run_tasks();
+    latch.wait();
+    return status;
+}
+
 Schema MemTable::convert_schema(const TabletSchemaCSPtr& tablet_schema,
                                 const std::vector<SlotDescriptor*>* slot_descs) {
     if (tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
@@ -265,7 +311,7 @@ Status MemTable::finalize() {
                 int64_t t1 = MonotonicMicros();
                 RETURN_IF_ERROR(_sort(true));
                 int64_t t2 = MonotonicMicros();
-                _aggregate(true);
+                RETURN_IF_ERROR(_aggregate(true));
                 int64_t t3 = MonotonicMicros();
                 VLOG(1) << strings::Substitute("memtable final sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
             } else {
@@ -361,16 +407,19 @@ Status MemTable::_merge() {
     int64_t t1 = MonotonicMicros();
     RETURN_IF_ERROR(_sort(false));
     int64_t t2 = MonotonicMicros();
-    _aggregate(false);
+    RETURN_IF_ERROR(_aggregate(false));
     int64_t t3 = MonotonicMicros();
     VLOG(1) << strings::Substitute("memtable sort:$0 agg:$1 total:$2", t2 - t1, t3 - t2, t3 - t1);
     ++_merge_count;
     return Status::OK();
 }
 
-void MemTable::_aggregate(bool is_final) {
+Status MemTable::_aggregate(bool is_final) {
+    if (!_sorted_segments.empty()) {
+        return _aggregate_sorted_segments();
+    }
     if (_result_chunk == nullptr || _result_chunk->num_rows() <= 0) {
-        return;
+        return Status::OK();
     }
 
     DCHECK(_result_chunk->num_rows() < INT_MAX);
@@ -387,18 +436,54 @@ void MemTable::_aggregate(bool is_final) {
     // impossible finish
     DCHECK(!_aggregator->is_finish());
     DCHECK(_aggregator->source_exhausted());
-    _merged_rows = _aggregator->merged_rows();
+    _merged_rows = _aggregator->merged_rows() + _segment_merged_rows;
 
     if (is_final) {
         _result_chunk.reset();
     } else {
         _result_chunk->reset();
     }
+    return Status::OK();
+}
+
+// Each sorted segment is aggregated by its own aggregator in parallel, and then the partial results are
+// aggregated by _aggregator in order. A key may span two adjacent segments, its partial results are merged
+// by _aggregator then, which is fine because the aggregation of all the aggregate methods is associative.
+Status MemTable::_aggregate_sorted_segments() {
+    size_t num_segments = _sorted_segments.size();
+    std::vector<ChunkPtr> partial_results(num_segments);
+    std::vector<size_t> partial_merged_rows(num_segments, 0);
+    RETURN_IF_ERROR(run_memtable_sort_tasks(_mem_tracker, num_segments, [&](size_t i) {
+        ChunkAggregator aggregator(_vectorized_schema, 0, INT_MAX, 0);
+        aggregator.update_source(_sorted_segments[i]);
+        aggregator.aggregate();
+        DCHECK(aggregator.source_exhausted());
+        partial_results[i] = aggregator.aggregate_result();
+        partial_merged_rows[i] = aggregator.merged_rows();
+        return Status::OK();
+    }));
+    _sorted_segments.clear();
+
+    DCHECK(_aggregator->source_exhausted());
+    for (size_t i = 0; i < num_segments; i++) {
+        _segment_merged_rows += partial_merged_rows[i];
+        if (partial_results[i]->num_rows() == 0) {
+            continue;
+        }
+        _aggregator->update_source(partial_results[i]);
+        _aggregator->aggregate();
+        DCHECK(_aggregator->source_exhausted());
+        partial_results[i].reset();
+    }
+    _aggregator_memory_usage = _aggregator->memory_usage();
+    _aggregator_bytes_usage = _aggregator->bytes_usage();
+    _merged_rows = _aggregator->merged_rows() + _segment_merged_rows;
+    return Status::OK();
 }
 
 Status MemTable::_sort(bool is_final, bool by_sort_key) {
-    SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
-    std::swap(perm, _permutations);
+    // The sorted data is aggregated next, except the re-sort of PK table by the sort key.
+    const bool to_aggregate = _aggregator != nullptr && !by_sort_key;
 
     // sort key column has some limitation right now:
     // 1. DUPLICATE TABLE and PRIMARY TABLE: no limitation
@@ -411,23 +496,149 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     if (_keys_type != KeysType::PRIMARY_KEYS) {
         by_sort_key = true;
     }
-    RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
-    if (is_final) {
-        // No need to reserve, it will be reserve in IColumn::append_selective(),
-        // Otherwise it will use more peak memory
-        _result_chunk = _chunk->clone_empty_with_schema(0);
-        _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), true);
-        _chunk.reset();
+    if (_use_parallel_sort()) {
+        RETURN_IF_ERROR(_parallel_sort(by_sort_key));
+        if (to_aggregate) {
+            // keep the sorted segments to aggregate them in parallel
+            _result_chunk.reset();
+        } else if (_sorted_segments.size() == 1) {
+            _result_chunk = std::move(_sorted_segments[0]);
+            _sorted_segments.clear();
+        } else {
+            _result_chunk = _chunk->clone_empty_with_schema(0);
+            for (auto& segment : _sorted_segments) {
+                _result_chunk->append(*segment);
+                segment.reset();
+            }
+            _sorted_segments.clear();
+        }
+        if (is_final) {
+            _chunk.reset();
+        } else {
+            _chunk->reset();
+        }
     } else {
-        _result_chunk = _chunk->clone_empty_with_schema();
-        _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), false);
-        _chunk->reset();
+        SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
+        std::swap(perm, _permutations);
+        RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
+        if (is_final) {
+            // No need to reserve, it will be reserve in IColumn::append_selective(),
+            // Otherwise it will use more peak memory
+            _result_chunk = _chunk->clone_empty_with_schema(0);
+            _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), true);
+            _chunk.reset();
+        } else {
+            _result_chunk = _chunk->clone_empty_with_schema();
+            _append_to_sorted_chunk(_chunk.get(), _result_chunk.get(), false);
+            _chunk->reset();
+        }
     }
     _chunk_memory_usage = 0;
     _chunk_bytes_usage = 0;
     return Status::OK();
 }
 
+bool MemTable::_use_parallel_sort() const {
+    return config::enable_memtable_parallel_sort && config::memtable_parallel_sort_dop > 1 &&
+           static_cast<int64_t>(_chunk->num_rows()) >= std::max<int64_t>(config::memtable_parallel_sort_min_rows, 2);
+}
+
+Status MemTable::_parallel_sort(bool by_sort_key) {
+    Columns columns;
+    std::vector<ColumnId> column_idxes;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_build_sort_columns(by_sort_key, &columns, &column_idxes, &sort_descs));
+
+    const size_t num_rows = _chunk->num_rows();
+    const size_t dop = std::min<size_t>(config::memtable_parallel_sort_dop, num_rows);
+
+    // The order by columns of a run refer to the columns of its chunk, so that merge path appends them once.
+    std::vector<int32_t> orderby_indexes;
+    for (auto idx : column_idxes) {
+        bool duplicated = std::find(orderby_indexes.begin(), orderby_indexes.end(), idx) != orderby_indexes.end();
+        orderby_indexes.push_back(duplicated ? -1 : idx);
+    }
+    auto to_sorted_run = [&](const ChunkPtr& chunk) {
+        Columns orderby;
+        for (auto idx : column_idxes) {
+            orderby.push_back(chunk->get_column_by_index(idx));
+        }
+        return SortedRun(chunk, std::move(orderby));
+    };
+    auto new_output_run = [&]() {
+        ChunkPtr chunk = _chunk->clone_empty_with_schema(0);
+        Columns orderby;
+        for (size_t i = 0; i < column_idxes.size(); i++) {
+            auto& column = chunk->get_column_by_index(column_idxes[i]);
+            if (orderby_indexes[i] >= 0) {
+                orderby.push_back(column);
+            } else {
+                orderby.emplace_back(column->clone_empty());
+            }
+        }
+        return SortedRun(chunk, std::move(orderby));
+    };
+
+    // Sort the runs in parallel.
+    std::vector<SortedRuns> runs(dop);
+    RETURN_IF_ERROR(run_memtable_sort_tasks(_mem_tracker, dop, [&](size_t i) {
+        std::pair<int, int> range(num_rows * i / dop, num_rows * (i + 1) / dop);
+        SmallPermutation perm;
+        RETURN_IF_ERROR(stable_sort_and_tie_columns(false, columns, sort_descs, range, &perm));
+        std::vector<uint32_t> selective_values;
+        permutate_to_selective(perm, &selective_values);
+        ChunkPtr chunk = _chunk->clone_empty_with_schema(selective_values.size());
+        chunk->append_selective(*_chunk, selective_values.data(), 0, selective_values.size());
+        runs[i].chunks.emplace_back(to_sorted_run(chunk));
+        return Status::OK();
+    }));
+
+    // Merge the runs pairwise until there is only one. Every merge is split into segments along the merge path,
+    // so all the threads are busy at each level. The left run is ahead of the right one in _chunk, and merge path
+    // takes the left row first for equal keys, so the result is the same as the serial stable sort.
+    while (runs.size() > 1) {
+        const size_t num_merges = runs.size() / 2;
+        const size_t merge_dop = std::max<size_t>(1, dop / num_merges);
+        std::vector<merge_path::InputSegmentPtr> inputs;
+        std::vector<merge_path::OutputSegmentPtr> outputs;
+        for (size_t m = 0; m < num_merges; m++) {
+            for (size_t side = 0; side < 2; side++) {
+                auto& run = runs[2 * m + side];
+                size_t len = run.num_rows();
+                inputs.emplace_back(std::make_unique<merge_path::InputSegment>(std::move(run), 0, len));
+            }
+            size_t total_len = inputs[2 * m]->len + inputs[2 * m + 1]->len;
+            for (size_t p = 0; p < merge_dop; p++) {
+                outputs.emplace_back(
+                        std::make_unique<merge_path::OutputSegment>(new_output_run(), orderby_indexes, total_len));
+            }
+        }
+        RETURN_IF_ERROR(run_memtable_sort_tasks(_mem_tracker, outputs.size(), [&](size_t i) {
+            size_t m = i / merge_dop;
+            merge_path::merge(sort_descs, *inputs[2 * m], *inputs[2 * m + 1], *outputs[i], i % merge_dop, merge_dop);
+            return Status::OK();
+        }));
+
+        std::vector<SortedRuns> merged_runs(num_merges);
+        for (size_t i = 0; i < outputs.size(); i++) {
+            ChunkPtr& chunk = outputs[i]->run.chunk;
+            if (chunk->num_rows() > 0) {
+                merged_runs[i / merge_dop].chunks.emplace_back(to_sorted_run(chunk));
+            }
+        }
+        if (runs.size() % 2 == 1) {
+            merged_runs.emplace_back(std::move(runs.back()));
+        }
+        runs = std::move(merged_runs);
+    }
+
+    _sorted_segments.clear();
+    for (auto& run : runs[0].chunks) {
+        _sorted_segments.emplace_back(std::move(run.chunk));
+    }
+    return Status::OK();
+}
+
 void MemTable::_append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final) {
     DCHECK_EQ(src->num_rows(), _permutations.size());
     permutate_to_selective(_permutations, &_selective_values);
@@ -488,6 +699,15 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
 
 Status MemTable::_sort_column_inc(bool by_sort_key) {
     Columns columns;
+    std::vector<ColumnId> column_idxes;
+    SortDescs sort_descs;
+    RETURN_IF_ERROR(_build_sort_columns(by_sort_key, &columns, &column_idxes, &sort_descs));
+    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
+    return st;
+}
+
+Status MemTable::_build_sort_columns(bool by_sort_key, Columns* columns, std::vector<ColumnId>* column_idxes,
+                                     SortDescs* sort_descs) {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -517,22 +737,22 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
     }
 
     for (auto sort_key_idx : sort_key_idxes) {
-        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+        columns->push_back(_chunk->get_column_by_index(sort_key_idx));
+        column_idxes->push_back(sort_key_idx);
     }
 
-    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    *sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
     if (!_merge_condition.empty()) {
         for (int i = 0; i < _vectorized_schema->num_fields(); ++i) {
             if (_vectorized_schema->field(i)->name() == _merge_condition) {
-                columns.push_back(_chunk->get_column_by_index(i));
-                sort_descs.descs.emplace_back(1, -1);
+                columns->push_back(_chunk->get_column_by_index(i));
+                column_idxes->push_back(i);
+                sort_descs->descs.emplace_back(1, -1);
                 break;
             }
         }
     }
-
-    Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
-    return st;
+    return Status::OK();
 }
 
 } // namespace starrocks
@@ -27,6 +27,7 @@ namespace starrocks {
 
 class SlotDescriptor;
 class TabletSchema;
+struct SortDescs;
 
 class MemTableSink;
 
@@ -76,10 +77,18 @@ private:
 
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    Status _build_sort_columns(bool by_sort_key, Columns* columns, std::vector<ColumnId>* column_idxes,
+                               SortDescs* sort_descs);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
+    bool _use_parallel_sort() const;
+    // Sort the runs of _chunk in parallel and merge them along the merge path, the sorted data is left
+    // in _sorted_segments in order.
+    Status _parallel_sort(bool by_sort_key);
+
     void _init_aggregator_if_needed();
-    void _aggregate(bool is_final);
+    Status _aggregate(bool is_final);
+    Status _aggregate_sorted_segments();
 
     Status _split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::unique_ptr<Column>* deletes);
 
@@ -89,6 +98,8 @@ private:
     // for sort by columns
     SmallPermutation _permutations;
     std::vector<uint32_t> _selective_values;
+    // output of the parallel sort, which are aggregated in parallel
+    std::vector<ChunkPtr> _sorted_segments;
 
     int64_t _tablet_id;
 
@@ -114,6 +125,8 @@ private:
     size_t _max_buffer_row = std::numeric_limits<size_t>::max();
     size_t _total_rows = 0;
     size_t _merged_rows = 0;
+    // rows merged by the aggregators of the sorted segments
+    size_t _segment_merged_rows = 0;
 
     // memory statistic
     MemTracker* _mem_tracker = nullptr;
@@ -259,6 +259,7 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    int64_t decoded_cached_pages_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -273,6 +274,9 @@ struct OlapReaderStatistics {
     int64_t total_columns_data_page_count = 0;
 
     int64_t runtime_stats_filtered = 0;
+    // rows filtered out by the join runtime filters evaluated in SegmentIterator
+    int64_t rows_runtime_filter_filtered = 0;
+    int64_t runtime_filter_evaluate_ns = 0;
 
     int64_t read_pk_index_ns = 0;
 
@@ -14,12 +14,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <vector>
 
 #include "common/status.h"
 #include "runtime/global_dict/types_fwd_decl.h"
+#include "storage/olap_common.h"
 #include "storage/range.h"
 
 namespace starrocks {
@@ -42,6 +44,26 @@ struct UnarrivedRuntimeFilterList {
     }
 };
 
+// The join runtime filters evaluated by SegmentIterator on the columns read before late materialization, so the
+// other columns of the filtered out rows are not decoded. The scan operator still evaluates them on the output.
+struct RuntimeFilterPredicates {
+    std::vector<const RuntimeFilterProbeDescriptor*> descs;
+    std::vector<ColumnId> column_ids;
+    int32_t driver_sequence = -1;
+    // See JoinRuntimeFilter::RunningContext::compatibility.
+    bool compatibility = true;
+
+    void add(const RuntimeFilterProbeDescriptor* desc, ColumnId column_id) {
+        descs.push_back(desc);
+        column_ids.push_back(column_id);
+    }
+    bool empty() const { return descs.empty(); }
+    size_t size() const { return descs.size(); }
+    bool contains_column(ColumnId cid) const {
+        return std::find(column_ids.begin(), column_ids.end(), cid) != column_ids.end();
+    }
+};
+
 class OlapRuntimeScanRangePruner {
 public:
     using PredicatesPtrs = std::vector<std::unique_ptr<ColumnPredicate>>;
@@ -36,6 +36,7 @@
 
 #include <malloc.h>
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
@@ -48,12 +49,17 @@ namespace starrocks {
 METRIC_DEFINE_UINT_GAUGE(page_cache_lookup_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_hit_count, MetricUnit::OPERATIONS);
 METRIC_DEFINE_UINT_GAUGE(page_cache_capacity, MetricUnit::BYTES);
+METRIC_DEFINE_DOUBLE_GAUGE(page_cache_hit_ratio, MetricUnit::PERCENT);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_lookup_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_hit_count, MetricUnit::OPERATIONS);
+METRIC_DEFINE_UINT_GAUGE(decoded_page_cache_capacity, MetricUnit::BYTES);
+METRIC_DEFINE_DOUBLE_GAUGE(decoded_page_cache_hit_ratio, MetricUnit::PERCENT);
 
 StoragePageCache* StoragePageCache::_s_instance = nullptr;
 
-void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+void StoragePageCache::create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity) {
     if (_s_instance == nullptr) {
-        _s_instance = new StoragePageCache(mem_tracker, capacity);
+        _s_instance = new StoragePageCache(mem_tracker, capacity, decoded_capacity);
     }
 }
 
@@ -66,6 +72,12 @@ void StoragePageCache::release_global_cache() {
 
 void StoragePageCache::prune() {
     _cache->prune();
+    _decoded_cache->prune();
+}
+
+// In percent, as the unit of the gauges.
+static double hit_ratio(uint64_t lookup_count, uint64_t hit_count) {
+    return lookup_count == 0 ? 0.0 : 100.0 * double(hit_count) / double(lookup_count);
 }
 
 static void init_metrics() {
@@ -83,10 +95,44 @@ static void init_metrics() {
     StarRocksMetrics::instance()->metrics()->register_hook("page_cache_capacity", []() {
         page_cache_capacity.set_value(StoragePageCache::instance()->get_capacity());
     });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("page_cache_hit_ratio", &page_cache_hit_ratio);
+    StarRocksMetrics::instance()->metrics()->register_hook("page_cache_hit_ratio", []() {
+        auto* cache = StoragePageCache::instance();
+        page_cache_hit_ratio.set_value(hit_ratio(cache->get_lookup_count(), cache->get_hit_count()));
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_lookup_count",
+                                                             &decoded_page_cache_lookup_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_lookup_count", []() {
+        decoded_page_cache_lookup_count.set_value(StoragePageCache::instance()->get_decoded_lookup_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_hit_count",
+                                                             &decoded_page_cache_hit_count);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_hit_count", []() {
+        decoded_page_cache_hit_count.set_value(StoragePageCache::instance()->get_decoded_hit_count());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_capacity",
+                                                             &decoded_page_cache_capacity);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_capacity", []() {
+        decoded_page_cache_capacity.set_value(StoragePageCache::instance()->get_decoded_capacity());
+    });
+
+    StarRocksMetrics::instance()->metrics()->register_metric("decoded_page_cache_hit_ratio",
+                                                             &decoded_page_cache_hit_ratio);
+    StarRocksMetrics::instance()->metrics()->register_hook("decoded_page_cache_hit_ratio", []() {
+        auto* cache = StoragePageCache::instance();
+        decoded_page_cache_hit_ratio.set_value(
+                hit_ratio(cache->get_decoded_lookup_count(), cache->get_decoded_hit_count()));
+    });
 }
 
-StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
+StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity)
+        : _mem_tracker(mem_tracker),
+          _cache(new_cache(config::storage_page_cache_eviction_policy, capacity, ChargeMode::MEMSIZE)),
+          _decoded_cache(new_cache(config::storage_page_cache_eviction_policy, decoded_capacity, ChargeMode::MEMSIZE)) {
     init_metrics();
 }
 
@@ -127,6 +173,10 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
     return true;
 }
 
+bool StoragePageCache::contains(const CacheKey& key) {
+    return _cache->contains(key.encode());
+}
+
 void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory) {
     // mem size should equals to data size when running UT
     int64_t mem_size = data.size;
@@ -149,4 +199,48 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
 
+void StoragePageCache::set_decoded_capacity(size_t capacity) {
+#ifndef BE_TEST
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+#endif
+    _decoded_cache->set_capacity(capacity);
+}
+
+size_t StoragePageCache::get_decoded_capacity() {
+    return _decoded_cache->get_capacity();
+}
+
+uint64_t StoragePageCache::get_decoded_lookup_count() {
+    return _decoded_cache->get_lookup_count();
+}
+
+uint64_t StoragePageCache::get_decoded_hit_count() {
+    return _decoded_cache->get_hit_count();
+}
+
+bool StoragePageCache::lookup_decoded(const DecodedCacheKey& key, PageCacheHandle* handle) {
+    auto* lru_handle = _decoded_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_decoded_cache.get(), lru_handle);
+    return true;
+}
+
+bool StoragePageCache::contains_decoded(const DecodedCacheKey& key) {
+    return _decoded_cache->contains(key.encode());
+}
+
+void StoragePageCache::insert_decoded(const DecodedCacheKey& key, void* page, size_t charge,
+                                      void (*deleter)(const starrocks::CacheKey& key, void* value),
+                                      PageCacheHandle* handle) {
+#ifndef BE_TEST
+    tls_thread_status.mem_release(charge);
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+#endif
+    auto* lru_handle = _decoded_cache->insert(key.encode(), page, charge, deleter, CachePriority::NORMAL, charge);
+    *handle = PageCacheHandle(_decoded_cache.get(), lru_handle);
+}
+
 } // namespace starrocks
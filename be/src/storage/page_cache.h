@@ -38,9 +38,11 @@
 #include <string>
 #include <utility>
 
+#include "gen_cpp/segment.pb.h"
 #include "gutil/macros.h" // for DISALLOW_COPY
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "types/logical_type.h"
 #include "util/defer_op.h"
 #include "util/lru_cache.h"
 
@@ -77,8 +79,26 @@ public:
         }
     };
 
+    // The key of a page in the decoded tier. The decoded column depends on the type and the encoding
+    // of the reader besides the page itself, so they are a part of the key.
+    struct DecodedCacheKey {
+        DecodedCacheKey(std::string fname_, int64_t offset_, LogicalType type_, EncodingTypePB encoding_)
+                : fname(std::move(fname_)), offset(offset_), type(type_), encoding(encoding_) {}
+        std::string fname;
+        int64_t offset;
+        LogicalType type;
+        EncodingTypePB encoding;
+
+        std::string encode() const {
+            std::string key_buf = CacheKey(fname, offset).encode();
+            key_buf.append((char*)&type, sizeof(type));
+            key_buf.append((char*)&encoding, sizeof(encoding));
+            return key_buf;
+        }
+    };
+
     // Create global instance of this class
-    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity = 0);
 
     static void release_global_cache();
 
@@ -86,7 +106,7 @@ public:
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return _s_instance; }
 
-    StoragePageCache(MemTracker* mem_tracker, size_t capacity);
+    StoragePageCache(MemTracker* mem_tracker, size_t capacity, size_t decoded_capacity = 0);
 
     // Lookup the given page in the cache.
     //
@@ -97,6 +117,10 @@ public:
     // Return true if entry is found, otherwise return false.
     bool lookup(const CacheKey& key, PageCacheHandle* handle);
 
+    // Return true if the page is in the cache, without pinning it, counting it as a lookup
+    // or refreshing its recency, e.g. to plan the reads of the pages not cached.
+    bool contains(const CacheKey& key);
+
     // Insert a page with key into this cache.
     // Given hanlde will be set to valid reference.
     // This function is thread-safe, and when two clients insert two same key
@@ -118,11 +142,35 @@ public:
 
     void prune();
 
+    // The decoded tier caches data pages decoded into columns, so that reading a hot page
+    // skips the decompression and the decoding. It has its own capacity, and 0 disables it.
+    // The column iterator only admits a page into this tier when the page is hit in the raw
+    // page cache, i.e. it has been read at least twice.
+    bool decoded_cache_enabled() const { return _decoded_cache->get_capacity() > 0; }
+
+    bool lookup_decoded(const DecodedCacheKey& key, PageCacheHandle* handle);
+
+    bool contains_decoded(const DecodedCacheKey& key);
+
+    // Insert a decoded page with its memory usage |charge|, the cache takes the ownership of
+    // |page| and releases it by |deleter|.
+    void insert_decoded(const DecodedCacheKey& key, void* page, size_t charge,
+                        void (*deleter)(const starrocks::CacheKey& key, void* value), PageCacheHandle* handle);
+
+    void set_decoded_capacity(size_t capacity);
+
+    size_t get_decoded_capacity();
+
+    uint64_t get_decoded_lookup_count();
+
+    uint64_t get_decoded_hit_count();
+
 private:
     static StoragePageCache* _s_instance;
 
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+    std::unique_ptr<Cache> _decoded_cache = nullptr;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
@@ -157,6 +205,7 @@ public:
 
     Cache* cache() const { return _cache; }
     Slice data() const { return _cache->value_slice(_handle); }
+    void* value() const { return _cache->value(_handle); }
 
 private:
     Cache* _cache = nullptr;
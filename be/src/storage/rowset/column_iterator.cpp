@@ -36,9 +36,15 @@
 
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
+#include "storage/page_cache.h"
 
 namespace starrocks {
 
+bool ColumnIterator::is_page_cached(const PagePointer& page) {
+    StoragePageCache::CacheKey cache_key(_opts.read_file->filename(), page.offset);
+    return StoragePageCache::instance()->contains(cache_key);
+}
+
 Status ColumnIterator::decode_dict_codes(const Column& codes, Column* words) {
     if (codes.is_nullable()) {
         const ColumnPtr& data_column = down_cast<const NullableColumn&>(codes).data_column();
@@ -58,6 +58,9 @@ struct ColumnIteratorOptions {
     //RandomAccessFile* read_file = nullptr;
     io::SeekableInputStream* read_file = nullptr;
     bool is_io_coalesce = false;
+    // The rows are read in ascending order and no other iterator shares `read_file`, so the coalesced
+    // buffers before the current page are released once it's read.
+    bool release_read_buffers = false;
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
@@ -65,6 +68,9 @@ struct ColumnIteratorOptions {
 
     // check whether column pages are all dictionary encoding.
     bool check_dict_encoding = false;
+    // If the column pages are all dictionary encoding, read the values by the dict codes, and keep the codes
+    // in the column for the operators, see BinaryColumn::set_dict_codes(). It needs `check_dict_encoding`.
+    bool read_dict_codes_with_values = false;
 
     void sanity_check() const {
         CHECK_NOTNULL(read_file);
@@ -140,14 +146,32 @@ public:
         }
 
         for (auto pair : page_index) {
-            OrdinalPageIndexIterator iter_start;
-            OrdinalPageIndexIterator iter_end;
-            RETURN_IF_ERROR(reader->seek_by_page_index(pair.first, &iter_start));
-            RETURN_IF_ERROR(reader->seek_by_page_index(pair.second, &iter_end));
-            auto offset = iter_start.page().offset;
-            auto size = iter_end.page().offset - offset + iter_end.page().size;
-            io::SharedBufferedInputStream::IORange io_range(offset, size);
-            result.emplace_back(io_range);
+            // The pages in the page cache won't be read from the file, only coalesce the others.
+            int64_t offset = -1;
+            int64_t end = -1;
+            for (int i = pair.first; i <= pair.second; i++) {
+                OrdinalPageIndexIterator iter;
+                RETURN_IF_ERROR(reader->seek_by_page_index(i, &iter));
+                const PagePointer& page = iter.page();
+                if (_opts.use_page_cache && is_page_cached(page)) {
+                    continue;
+                }
+                if (offset >= 0 && static_cast<int64_t>(page.offset) == end) {
+                    end += page.size;
+                    continue;
+                }
+                if (offset >= 0) {
+                    result.emplace_back(offset, end - offset);
+                }
+                offset = page.offset;
+                end = offset + page.size;
+            }
+            if (offset >= 0) {
+                result.emplace_back(offset, end - offset);
+            }
+        }
+        if (result.empty()) {
+            return Status::OK();
         }
 
         return dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file)->set_io_ranges(result);
@@ -257,6 +281,8 @@ public:
 protected:
     ColumnIteratorOptions _opts;
     virtual ColumnReader* get_column_reader() { return nullptr; };
+    // Whether the page would be served by the page cache without reading the file.
+    virtual bool is_page_cached(const PagePointer& page);
 };
 
 } // namespace starrocks
@@ -36,11 +36,13 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/nullable_column.h"
 #include "common/status.h"
 #include "gutil/strings/substitute.h"
+#include "simd/simd.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/encoding_info.h"
@@ -395,6 +397,65 @@ Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, con
     return Status::OK();
 }
 
+DecodedParsedPage::DecodedParsedPage(PageCacheHandle handle, const PagePointer& page_pointer, uint32_t page_index)
+        : _handle(std::move(handle)), _decoded(static_cast<const DecodedPage*>(_handle.value())) {
+    _first_ordinal = _decoded->first_ordinal;
+    _num_rows = _decoded->column->size();
+    _corresponding_element_ordinal = _decoded->corresponding_element_ordinal;
+    _page_pointer = page_pointer;
+    _page_index = page_index;
+}
+
+Status DecodedParsedPage::seek(ordinal_t offset) {
+    if (offset > _num_rows) {
+        return Status::InvalidArgument(fmt::format("seek to {} of decoded page with {} rows", offset, _num_rows));
+    }
+    _offset_in_page = offset;
+    return Status::OK();
+}
+
+Status DecodedParsedPage::_append(Column* column, size_t offset, size_t count) const {
+    const Column* src = _decoded->column.get();
+    if (src->is_nullable() && !column->is_nullable()) {
+        // The column is nullable, but the reader reads it as not nullable, e.g. no null in the rows read.
+        const auto* nullable = down_cast<const NullableColumn*>(src);
+        if (nullable->has_null() && SIMD::contain_nonzero(nullable->null_column()->get_data(), offset, count)) {
+            return Status::InternalError(fmt::format("read nulls of decoded page at offset {} into not nullable column",
+                                                     _page_pointer.offset));
+        }
+        column->append(*nullable->data_column(), offset, count);
+    } else if (!src->is_nullable() && column->is_nullable()) {
+        // The column is not nullable, but the reader reads it as nullable, e.g. after it's altered to nullable.
+        auto* nullable = down_cast<NullableColumn*>(column);
+        nullable->data_column()->append(*src, offset, count);
+        nullable->null_column()->resize(nullable->data_column()->size());
+    } else {
+        column->append(*src, offset, count);
+    }
+    return Status::OK();
+}
+
+Status DecodedParsedPage::read(Column* column, size_t* count) {
+    *count = std::min<size_t>(*count, remaining());
+    RETURN_IF_ERROR(_append(column, _offset_in_page, *count));
+    _offset_in_page += *count;
+    return Status::OK();
+}
+
+Status DecodedParsedPage::read(Column* column, const SparseRange<>& range) {
+    DCHECK_EQ(_offset_in_page, range.begin());
+    if (range.end() > _num_rows) {
+        return Status::InvalidArgument(
+                fmt::format("read range {} out of decoded page with {} rows", range.to_string(), _num_rows));
+    }
+    for (size_t i = 0; i < range.size(); ++i) {
+        const Range<>& r = range[i];
+        RETURN_IF_ERROR(_append(column, r.begin(), r.span_size()));
+    }
+    _offset_in_page = range.end();
+    return Status::OK();
+}
+
 Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index) {
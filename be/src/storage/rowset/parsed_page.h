@@ -36,6 +36,8 @@
 
 #include <memory>
 
+#include "column/column.h"
+#include "storage/page_cache.h"
 #include "storage/range.h"
 #include "storage/rowset/common.h" // ordinal_t
 #include "storage/rowset/page_decoder.h"
@@ -44,7 +46,6 @@
 namespace starrocks {
 class Slice;
 class Status;
-class Column;
 class DataPageFooterPB;
 class EncodingInfo;
 class PageHandle;
@@ -81,7 +82,7 @@ public:
     size_t remaining() const { return _num_rows - _offset_in_page; }
 
     // Return the encoding type of this page.
-    EncodingTypePB encoding_type() const { return _data_decoder->encoding_type(); }
+    virtual EncodingTypePB encoding_type() const { return _data_decoder->encoding_type(); }
 
     // Set the page offset indicator to the specified position |offset|.
     // The |offset| is relative to first_ordinal(), and it should less than num_rows().
@@ -126,6 +127,46 @@ protected:
     PagePointer _page_pointer;
 };
 
+// A data page decoded into a column, kept in the decoded tier of StoragePageCache.
+struct DecodedPage {
+    ColumnPtr column;
+    ordinal_t first_ordinal = 0;
+    ordinal_t corresponding_element_ordinal = 0;
+    EncodingTypePB encoding_type = UNKNOWN_ENCODING;
+};
+
+// DecodedParsedPage reads the rows from a DecodedPage pinned in the page cache, so no
+// decompression or decoding is needed. Dictionary codes are not kept, the caller must
+// not read dictionary codes from it.
+class DecodedParsedPage final : public ParsedPage {
+public:
+    DecodedParsedPage(PageCacheHandle handle, const PagePointer& page_pointer, uint32_t page_index);
+
+    ~DecodedParsedPage() override = default;
+
+    EncodingTypePB encoding_type() const override { return _decoded->encoding_type; }
+
+    Status seek(ordinal_t offset) override;
+
+    Status read(Column* column, size_t* count) override;
+
+    Status read(Column* column, const SparseRange<>& range) override;
+
+    Status read_dict_codes(Column* column, size_t* count) override {
+        return Status::NotSupported("read dict codes from decoded page");
+    }
+
+    Status read_dict_codes(Column* column, const SparseRange<>& range) override {
+        return Status::NotSupported("read dict codes from decoded page");
+    }
+
+private:
+    Status _append(Column* column, size_t offset, size_t count) const;
+
+    PageCacheHandle _handle;
+    const DecodedPage* _decoded;
+};
+
 Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index);
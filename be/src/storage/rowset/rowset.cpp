@@ -667,7 +667,9 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
     seg_options.chunk_size = options.chunk_size;
     seg_options.global_dictmaps = options.global_dictmaps;
     seg_options.unused_output_column_ids = options.unused_output_column_ids;
+    seg_options.dict_code_column_ids = options.dict_code_column_ids;
     seg_options.runtime_range_pruner = options.runtime_range_pruner;
+    seg_options.runtime_filter_preds = options.runtime_filter_preds;
     seg_options.column_access_paths = options.column_access_paths;
     seg_options.tablet_schema = options.tablet_schema;
     if (options.delete_predicates != nullptr) {
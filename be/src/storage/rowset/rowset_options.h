@@ -75,11 +75,13 @@ public:
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
+    const std::unordered_set<uint32_t>* dict_code_column_ids = nullptr;
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
     ShortKeyRangesOptionPtr short_key_ranges_option = nullptr;
 
     OlapRuntimeScanRangePruner runtime_range_pruner;
+    RuntimeFilterPredicates runtime_filter_preds;
 
     std::vector<ColumnAccessPathPtr>* column_access_paths = nullptr;
 
@@ -34,13 +34,18 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include <fmt/format.h>
+
+#include "column/nullable_column.h"
 #include "storage/column_predicate.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/dict_page.h"
 #include "storage/rowset/encoding_info.h"
 #include "util/bitmap.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -59,6 +64,11 @@ Status ScalarColumnIterator::init(const ColumnIteratorOptions& opts) {
     index_opts.stats = _opts.stats;
     RETURN_IF_ERROR(_reader->load_ordinal_index(index_opts));
     _opts.stats->total_columns_data_page_count += _reader->num_data_pages();
+    DeferOp init_decoded_page_cache([&]() {
+        auto cache = StoragePageCache::instance();
+        _use_decoded_page_cache = cache != nullptr && cache->decoded_cache_enabled() && _opts.use_page_cache &&
+                                  !_all_dict_encoded;
+    });
 
     if (_reader->encoding_info()->encoding() != DICT_ENCODING) {
         return Status::OK();
@@ -142,6 +152,7 @@ Status ScalarColumnIterator::init(const ColumnIteratorOptions& opts) {
         _next_batch_dict_codes_func = &ScalarColumnIterator::_do_next_batch_dict_codes<TYPE_VARCHAR>;
         _fetch_all_dict_words_func = &ScalarColumnIterator::_fetch_all_dict_words<TYPE_VARCHAR>;
     }
+    _read_dict_codes_with_values = _all_dict_encoded && opts.read_dict_codes_with_values;
     return Status::OK();
 }
 
@@ -198,6 +209,9 @@ Status ScalarColumnIterator::_seek_to_pos_in_page(ParsedPage* page, ordinal_t of
 }
 
 Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
+    if (_read_dict_codes_with_values) {
+        return _next_batch_with_dict_codes(dst, [&](Column* codes) { return next_dict_codes(n, codes); });
+    }
     size_t remaining = *n;
     size_t prev_bytes = dst->byte_size();
     bool contain_deleted_row = (dst->delete_state() != DEL_NOT_SATISFIED);
@@ -207,7 +221,7 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -220,6 +234,7 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
         contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
         // number of rows to be read from this page
         size_t nread = remaining;
+        RETURN_IF_ERROR(_decode_current_page(dst));
         RETURN_IF_ERROR(_page->read(dst, &nread));
         _current_ordinal += nread;
         remaining -= nread;
@@ -231,6 +246,9 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
 }
 
 Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
+    if (_read_dict_codes_with_values) {
+        return _next_batch_with_dict_codes(dst, [&](Column* codes) { return next_dict_codes(range, codes); });
+    }
     size_t prev_bytes = dst->byte_size();
     SparseRangeIterator<> iter = range.new_iterator();
     size_t end_ord = _page->first_ordinal() + _page->num_rows();
@@ -251,7 +269,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -282,6 +300,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             // current page have been added in read range
             // read current page data first
             contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
+            RETURN_IF_ERROR(_decode_current_page(dst));
             RETURN_IF_ERROR(_page->read(dst, read_range));
             read_range.clear();
         }
@@ -290,6 +309,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
     if (!read_range.empty()) {
         // read data left if read range is not empty
         contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
+        RETURN_IF_ERROR(_decode_current_page(dst));
         RETURN_IF_ERROR(_page->read(dst, read_range));
         read_range.clear();
     }
@@ -352,13 +372,47 @@ Status ScalarColumnIterator::_do_init_dict_decoder() {
     return Status::OK();
 }
 
+bool ScalarColumnIterator::is_page_cached(const PagePointer& page) {
+    if (_use_decoded_page_cache && StoragePageCache::instance()->contains_decoded(_decoded_cache_key(page))) {
+        return true;
+    }
+    return ColumnIterator::is_page_cached(page);
+}
+
+void ScalarColumnIterator::_release_read_buffers(const PagePointer& page) {
+    if (!_opts.release_read_buffers) {
+        return;
+    }
+    // The pages are copied out of the coalesced buffers when they are read, the buffers ending
+    // before the current page won't be read again.
+    if (auto* shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
+        shared_buffer_stream != nullptr) {
+        shared_buffer_stream->release_to_offset(page.offset);
+    }
+}
+
 Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
+    _decode_page_on_read = false;
+    _release_read_buffers(iter.page());
+    if (_use_decoded_page_cache) {
+        PageCacheHandle cache_handle;
+        if (StoragePageCache::instance()->lookup_decoded(_decoded_cache_key(iter.page()), &cache_handle)) {
+            _opts.stats->decoded_cached_pages_num++;
+            _page = std::make_unique<DecodedParsedPage>(std::move(cache_handle), iter.page(), iter.page_index());
+            return Status::OK();
+        }
+    }
+
     PageHandle handle;
     Slice page_body;
     PageFooterPB footer;
+    int64_t prev_cached_pages = _opts.stats->cached_pages_num;
     RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
     RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
                                _reader->encoding_info(), iter.page(), iter.page_index()));
+    // Only the pages read at least twice, i.e. hit in the raw page cache, are admitted into the
+    // decoded tier, so that a large scan doesn't flush the hot decoded pages.
+    _decode_page_on_read = _use_decoded_page_cache && _opts.stats->cached_pages_num > prev_cached_pages;
 
     // dictionary page is read when the first data page that uses it is read,
     // this is to optimize the memory usage: when there is no query on one column, we could
@@ -371,6 +425,49 @@ Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& ite
     return Status::OK();
 }
 
+StoragePageCache::DecodedCacheKey ScalarColumnIterator::_decoded_cache_key(const PagePointer& page) const {
+    return {_opts.read_file->filename(), static_cast<int64_t>(page.offset), _reader->column_type(),
+            _reader->encoding_info()->encoding()};
+}
+
+Status ScalarColumnIterator::_decode_current_page(const Column* dst) {
+    if (!_decode_page_on_read) {
+        return Status::OK();
+    }
+    _decode_page_on_read = false;
+
+    // The cached page is shared by all the readers of the column, decode it into the storage type of the column,
+    // nullable if the column is, instead of the column of this reader.
+    const Column* data = dst->is_nullable() ? down_cast<const NullableColumn*>(dst)->data_column().get() : dst;
+    ColumnPtr column = data->clone_empty();
+    if (_reader->is_nullable()) {
+        column = NullableColumn::create(std::move(column), NullColumn::create());
+    }
+    auto decoded = std::make_unique<DecodedPage>();
+    decoded->column = std::move(column);
+    decoded->first_ordinal = _page->first_ordinal();
+    decoded->corresponding_element_ordinal = _page->corresponding_element_ordinal();
+    decoded->encoding_type = _page->encoding_type();
+
+    ordinal_t offset = _page->offset();
+    RETURN_IF_ERROR(_page->seek(0));
+    size_t num_rows = _page->num_rows();
+    RETURN_IF_ERROR(_page->read(decoded->column.get(), &num_rows));
+    if (num_rows != _page->num_rows()) {
+        return Status::Corruption(fmt::format("decode page of {}: expect {} rows, got {}", _opts.read_file->filename(),
+                                              _page->num_rows(), num_rows));
+    }
+
+    size_t charge = decoded->column->memory_usage() + sizeof(DecodedPage);
+    PageCacheHandle cache_handle;
+    StoragePageCache::instance()->insert_decoded(
+            _decoded_cache_key(_page->page_pointer()), decoded.release(), charge,
+            [](const CacheKey& key, void* value) { delete static_cast<DecodedPage*>(value); }, &cache_handle);
+
+    _page = std::make_unique<DecodedParsedPage>(std::move(cache_handle), _page->page_pointer(), _page->page_index());
+    return _page->seek(offset);
+}
+
 Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
                                                         const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
                                                         CompoundNodeType pred_relation) {
@@ -478,6 +575,48 @@ Status ScalarColumnIterator::_fetch_all_dict_words(std::vector<Slice>* words) co
     return Status::OK();
 }
 
+template <LogicalType Type>
+Status ScalarColumnIterator::_build_dict_words() {
+    std::vector<Slice> words;
+    RETURN_IF_ERROR(_fetch_all_dict_words<Type>(&words));
+    auto dict_words = BinaryColumn::create();
+    dict_words->reserve(words.size() + 1);
+    for (const Slice& word : words) {
+        dict_words->append(word);
+    }
+    // The word of the null values.
+    dict_words->append(Slice());
+    _dict_words = std::move(dict_words);
+    return Status::OK();
+}
+
+template <typename ReadDictCodesFunc>
+Status ScalarColumnIterator::_next_batch_with_dict_codes(Column* dst, ReadDictCodesFunc&& read_dict_codes) {
+    if (_dict_codes_column == nullptr) {
+        _dict_codes_column = Int32Column::create();
+        if (dst->is_nullable()) {
+            _dict_codes_column = NullableColumn::create(_dict_codes_column, NullColumn::create());
+        }
+    }
+    _dict_codes_column->reset_column();
+    RETURN_IF_ERROR(read_dict_codes(_dict_codes_column.get()));
+    RETURN_IF_ERROR(ColumnIterator::decode_dict_codes(*_dict_codes_column, dst));
+    if (dst->is_nullable()) {
+        // The values are appended as not null, copy the null flags of the codes.
+        auto* nullable_dst = down_cast<NullableColumn*>(dst);
+        const auto* nullable_codes = down_cast<const NullableColumn*>(_dict_codes_column.get());
+        const auto& code_nulls = nullable_codes->immutable_null_column_data();
+        auto& nulls = nullable_dst->null_column_data();
+        DCHECK_GE(nulls.size(), code_nulls.size());
+        std::copy(code_nulls.begin(), code_nulls.end(), nulls.end() - code_nulls.size());
+        nullable_dst->set_has_null(nullable_codes->has_null());
+    }
+    if (_dict_codes_column->delete_state() != DEL_NOT_SATISFIED) {
+        dst->set_delete_state(DEL_PARTIAL_SATISFIED);
+    }
+    return Status::OK();
+}
+
 template <LogicalType Type>
 int ScalarColumnIterator::_do_dict_lookup(const Slice& word) {
     auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
@@ -562,6 +701,23 @@ Status ScalarColumnIterator::_do_next_batch_dict_codes(const SparseRange<>& rang
 template <LogicalType Type>
 Status ScalarColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t size, Column* words) {
     auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
+    // Keep the codes in the column if it's empty, or it has kept the codes of the same dictionary.
+    auto* binary = down_cast<BinaryColumn*>(words->is_nullable() ? down_cast<NullableColumn*>(words)->data_column().get()
+                                                                 : words);
+    const bool keep_codes = _read_dict_codes_with_values &&
+                            (binary->size() == 0 || (_dict_words != nullptr && binary->dict() == _dict_words));
+    Buffer<int32_t> dict_codes;
+    if (keep_codes) {
+        if (_dict_words == nullptr) {
+            RETURN_IF_ERROR(_build_dict_words<Type>());
+        }
+        dict_codes.reserve(binary->size() + size);
+        dict_codes.assign(binary->dict_codes().begin(), binary->dict_codes().end());
+        const auto null_code = static_cast<int32_t>(_dict_words->size() - 1);
+        for (size_t i = 0; i < size; i++) {
+            dict_codes.emplace_back(codes[i] >= 0 ? codes[i] : null_code);
+        }
+    }
     std::vector<Slice> slices;
     slices.reserve(size);
     for (size_t i = 0; i < size; i++) {
@@ -579,6 +735,9 @@ Status ScalarColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t
     }
     [[maybe_unused]] bool ok = words->append_strings(slices);
     DCHECK(ok);
+    if (keep_codes) {
+        binary->set_dict_codes(_dict_words, std::move(dict_codes));
+    }
     _opts.stats->bytes_read += static_cast<int64_t>(words->byte_size() + BitmapSize(slices.size()));
     return Status::OK();
 }
@@ -619,7 +778,10 @@ Status ScalarColumnIterator::_fetch_by_rowid(const rowid_t* rowids, size_t size,
 }
 
 Status ScalarColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) {
-    auto page_parse = [&](Column* column, size_t* count) { return _page->read(column, count); };
+    auto page_parse = [&](Column* column, size_t* count) {
+        RETURN_IF_ERROR(_decode_current_page(column));
+        return _page->read(column, count);
+    };
     return _fetch_by_rowid(rowids, size, values, page_parse);
 }
 
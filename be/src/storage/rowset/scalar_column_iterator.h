@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "storage/range.h"
 #include "storage/rowset/column_iterator.h"
@@ -94,6 +95,8 @@ public:
 
     ColumnReader* get_column_reader() override { return _reader; }
 
+    bool is_page_cached(const PagePointer& page) override;
+
     bool is_nullable();
 
     int64_t element_ordinal() const override { return _element_ordinal; }
@@ -106,6 +109,9 @@ private:
     static Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page);
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    void _release_read_buffers(const PagePointer& page);
+    Status _decode_current_page(const Column* dst);
+    StoragePageCache::DecodedCacheKey _decoded_cache_key(const PagePointer& page) const;
 
     template <LogicalType Type>
     int _do_dict_lookup(const Slice& word);
@@ -125,6 +131,13 @@ private:
     template <LogicalType Type>
     Status _fetch_all_dict_words(std::vector<Slice>* words) const;
 
+    template <LogicalType Type>
+    Status _build_dict_words();
+
+    // Read the dict codes by `read_dict_codes`, and decode them into `dst`, which keeps the codes.
+    template <typename ReadDictCodesFunc>
+    Status _next_batch_with_dict_codes(Column* dst, ReadDictCodesFunc&& read_dict_codes);
+
     template <typename ParseFunc>
     Status _fetch_by_rowid(const rowid_t* rowids, size_t size, Column* values, ParseFunc&& page_parse);
 
@@ -168,6 +181,20 @@ private:
     // whether all data pages are dict-encoded.
     bool _all_dict_encoded = false;
 
+    // Whether to read the values by the dict codes, and keep the codes in the column, see
+    // `ColumnIteratorOptions::read_dict_codes_with_values`.
+    bool _read_dict_codes_with_values = false;
+    ColumnPtr _dict_codes_column;
+    // All the words of the dictionary, and an empty word for the null values, which is shared by
+    // the columns decoded by the dictionary.
+    BinaryColumn::DictPtr _dict_words;
+
+    // whether to read the data pages through the decoded tier of StoragePageCache.
+    bool _use_decoded_page_cache = false;
+    // the current page is hit in the raw page cache, decode the whole page into the decoded
+    // tier before reading it.
+    bool _decode_page_on_read = false;
+
     // variable used for array column(offset, element)
     // It's used to get element ordinal for specfied offset value.
     int64_t _element_ordinal = 0;
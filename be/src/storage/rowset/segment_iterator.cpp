@@ -15,6 +15,7 @@
 #include "segment_iterator.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stack>
 #include <unordered_map>
@@ -25,6 +26,7 @@
 #include "column/datum_tuple.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "exprs/runtime_filter_bank.h"
 #include "fs/fs.h"
 #include "glog/logging.h"
 #include "gutil/casts.h"
@@ -201,6 +203,10 @@ private:
         // for inverted index.
         std::unordered_set<size_t> _prune_cols;
         bool _prune_column_after_index_filter = false;
+
+        // index: runtime filter index in |_opts.runtime_filter_preds|, value: the index of its column in
+        // |_dict_chunk|, or -1 if the column isn't read before late materialization or is read as dict codes.
+        std::vector<int> _runtime_filter_column_indexes;
     };
 
     Status _init();
@@ -227,6 +233,7 @@ private:
 
     StatusOr<uint16_t> _filter_by_non_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid, uint16_t from, uint16_t to);
     StatusOr<uint16_t> _filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid);
+    StatusOr<uint16_t> _filter_by_runtime_filters(Chunk* chunk, vector<rowid_t>* rowid);
 
     void _init_column_predicates();
 
@@ -331,9 +338,14 @@ private:
 
     ObjectPool _obj_pool;
 
-    // initial number of columns of |_opts.pred_tree|.
+    // initial number of columns of |_opts.pred_tree|, and the columns of |_opts.runtime_filter_preds| not in it.
     int _predicate_columns = 0;
 
+    JoinRuntimeFilter::RunningContext _rf_running_context;
+    // whether each runtime filter of |_opts.runtime_filter_preds| filtered out enough rows when last sampled.
+    std::vector<uint8_t> _rf_selective;
+    size_t _rf_evaluated_chunks = 0;
+
     // the next rowid to read
     rowid_t _cur_rowid = 0;
 
@@ -358,6 +370,15 @@ SegmentIterator::SegmentIterator(std::shared_ptr<Segment> segment, Schema schema
           _opts(std::move(options)),
           _bitmap_index_evaluator(_schema, _opts.pred_tree),
           _predicate_columns(_opts.pred_tree.num_columns()) {
+    // The columns of the runtime filters are read along with the predicate columns, see `new_segment_iterator`.
+    for (const auto& field : _schema.fields()) {
+        if (!_opts.pred_tree.contains_column(field->id()) && _opts.runtime_filter_preds.contains_column(field->id())) {
+            _predicate_columns++;
+        }
+    }
+    _rf_selective.assign(_opts.runtime_filter_preds.size(), true);
+    _rf_running_context.compatibility = _opts.runtime_filter_preds.compatibility;
+
     // For small segment file (the number of rows is less than chunk_size),
     // the segment iterator will reserve a large amount of memory,
     // especially when there are many columns, many small files, many versions,
@@ -564,13 +585,23 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
     }
     auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
     const auto& col = tablet_schema->column(cid);
+    // Keep the dict codes of the strings read as the only key of the hash aggregations and the join probes, the
+    // columns of global dictionary are read as codes.
+    iter_opts.read_dict_codes_with_values = config::enable_segment_dict_codes && _opts.reader_type == READER_QUERY &&
+                                            _opts.dict_code_column_ids != nullptr &&
+                                            _opts.dict_code_column_ids->count(cid) > 0 &&
+                                            (col.type() == TYPE_VARCHAR || col.type() == TYPE_CHAR) &&
+                                            _opts.global_dictmaps->count(cid) == 0;
+    iter_opts.check_dict_encoding = check_dict_enc || iter_opts.read_dict_codes_with_values;
     ASSIGN_OR_RETURN(auto col_iter, _new_dcg_column_iterator(col, &dcg_filename, access_path));
     if (col_iter == nullptr) {
         // not found in delta column group, create normal column iterator
         ASSIGN_OR_RETURN(_column_iterators[cid], _segment->new_column_iterator_or_default(col, access_path));
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        // local segments are coalesced to read the pages of a column in batches through io_uring
+        bool io_coalesce = _segment->lake_tablet_manager() != nullptr ? config::io_coalesce_lake_read_enable
+                                                                       : config::enable_io_uring_read;
+        if (io_coalesce && !_segment->is_default_column(col)) {
             ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
             auto shared_buffered_input_stream =
                     std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
@@ -580,6 +611,9 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
             shared_buffered_input_stream->set_coalesce_options(options);
             iter_opts.read_file = shared_buffered_input_stream.get();
             iter_opts.is_io_coalesce = true;
+            // the sub-column iterators of the complex types share the stream at different positions
+            iter_opts.release_read_buffers = _opts.asc_hint && col.type() != TYPE_ARRAY && col.type() != TYPE_MAP &&
+                                             col.type() != TYPE_STRUCT && col.type() != TYPE_JSON;
             _column_files[cid] = std::move(shared_buffered_input_stream);
             _io_coalesce_column_index.emplace_back(cid);
         } else {
@@ -1226,6 +1260,11 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
         RETURN_IF_ERROR(_decode_dict_codes(_context));
     }
 
+    // Filter by the runtime filters before late materialization, so the filtered out rows are not decoded.
+    if (chunk_size > 0 && !_opts.runtime_filter_preds.empty()) {
+        ASSIGN_OR_RETURN(chunk_size, _filter_by_runtime_filters(_context->_dict_chunk.get(), rowid));
+    }
+
     _build_final_chunk(_context);
     chunk = _context->_final_chunk.get();
 
@@ -1406,6 +1445,69 @@ StatusOr<uint16_t> SegmentIterator::_filter_by_expr_predicates(Chunk* chunk, vec
     return chunk_size;
 }
 
+StatusOr<uint16_t> SegmentIterator::_filter_by_runtime_filters(Chunk* chunk, vector<rowid_t>* rowid) {
+    // Like RuntimeFilterProbeCollector, evaluate all the arrived runtime filters every 32 chunks, and only the
+    // selective ones in between.
+    static constexpr size_t kSampleInterval = 32;
+    static constexpr double kMaxSelectivity = 0.5;
+
+    SCOPED_RAW_TIMER(&_opts.stats->runtime_filter_evaluate_ns);
+    const size_t chunk_size = chunk->num_rows();
+    const bool sample = (_rf_evaluated_chunks++ % kSampleInterval) == 0;
+    const auto& rf_preds = _opts.runtime_filter_preds;
+    bool evaluated = false;
+    for (size_t i = 0; i < rf_preds.size(); i++) {
+        const int column_index = _context->_runtime_filter_column_indexes[i];
+        if (column_index < 0 || (!sample && !_rf_selective[i])) {
+            continue;
+        }
+        const JoinRuntimeFilter* rf = rf_preds.descs[i]->runtime_filter(rf_preds.driver_sequence);
+        if (rf == nullptr || rf->always_true()) {
+            continue;
+        }
+        Column* column = chunk->get_column_by_index(column_index).get();
+        _rf_running_context.use_merged_selection = false;
+        if (rf->num_hash_partitions() > 0) {
+            rf->compute_partition_index(rf_preds.descs[i]->layout(), {column}, &_rf_running_context);
+        }
+        rf->evaluate(column, &_rf_running_context);
+
+        const uint8_t* rf_selection = _rf_running_context.selection.data();
+        if (sample) {
+            _rf_selective[i] = SIMD::count_nonzero(rf_selection, chunk_size) <= chunk_size * kMaxSelectivity;
+        }
+        if (!evaluated) {
+            memcpy(_selection.data(), rf_selection, chunk_size);
+            evaluated = true;
+        } else {
+            for (size_t j = 0; j < chunk_size; j++) {
+                _selection[j] &= rf_selection[j];
+            }
+        }
+    }
+    if (!evaluated) {
+        return chunk_size;
+    }
+
+    size_t hit_count = SIMD::count_nonzero(_selection.data(), chunk_size);
+    size_t new_size = chunk_size;
+    if (hit_count == 0) {
+        chunk->set_num_rows(0);
+        new_size = 0;
+        if (rowid != nullptr) {
+            rowid->resize(0);
+        }
+    } else if (hit_count != chunk_size) {
+        new_size = chunk->filter_range(_selection, 0, chunk_size);
+        if (rowid != nullptr) {
+            auto size = ColumnHelper::filter_range<uint32_t>(_selection, rowid->data(), 0, chunk_size);
+            rowid->resize(size);
+        }
+    }
+    _opts.stats->rows_runtime_filter_filtered += (chunk_size - new_size);
+    return new_size;
+}
+
 inline bool SegmentIterator::_can_using_dict_code(const FieldPtr& field) const {
     if (field->type()->type() == TYPE_ARRAY) {
         return false;
@@ -1525,6 +1627,18 @@ Status SegmentIterator::_build_context(ScanContext* ctx) {
         }
     }
 
+    // The runtime filters are evaluated on |_dict_chunk|, so the columns left as dict codes are skipped.
+    ctx->_runtime_filter_column_indexes.assign(_opts.runtime_filter_preds.size(), -1);
+    for (size_t i = 0; i < _opts.runtime_filter_preds.size(); i++) {
+        for (size_t j = 0; j < early_materialize_fields; j++) {
+            const FieldPtr& f = _schema.field(j);
+            if (f->id() == _opts.runtime_filter_preds.column_ids[i] && ctx->_dict_decode_schema.field(j) == f) {
+                ctx->_runtime_filter_column_indexes[i] = static_cast<int>(j);
+                break;
+            }
+        }
+    }
+
     size_t build_read_index_size = ctx->_read_schema.num_fields();
     if (late_materialization && (predicate_count < _schema.num_fields() || !ctx->_subfield_columns.empty())) {
         // ordinal column
@@ -1587,7 +1701,7 @@ Status SegmentIterator::_init_context() {
 
     RETURN_IF_ERROR(_init_global_dict_decoder());
 
-    if (_predicate_columns == 0 || _opts.pred_tree.empty() ||
+    if (_predicate_columns == 0 || (_opts.pred_tree.empty() && _opts.runtime_filter_preds.empty()) ||
         (_predicate_columns >= _schema.num_fields() && _predicate_column_access_paths.empty())) {
         // non or all field has predicate, disable late materialization.
         RETURN_IF_ERROR(_build_context<false>(&_context_list[0]));
@@ -1698,7 +1812,7 @@ Status SegmentIterator::_decode_dict_codes(ScanContext* ctx) {
 
 Status SegmentIterator::_check_low_cardinality_optimization() {
     _predicate_need_rewrite.resize(1 + ChunkHelper::max_column_id(_schema), false);
-    const size_t n = _opts.pred_tree.num_columns();
+    const size_t n = _predicate_columns;
     for (size_t i = 0; i < n; i++) {
         const FieldPtr& field = _schema.field(i);
         const LogicalType type = field->type()->type();
@@ -1802,7 +1916,7 @@ static void erase_column_pred_from_pred_tree(PredicateTree& pred_tree,
 Status SegmentIterator::_apply_bitmap_index() {
     RETURN_IF(!config::enable_index_bitmap_filter, Status::OK());
     RETURN_IF(_scan_range.empty(), Status::OK());
-    DCHECK_EQ(_predicate_columns, _opts.pred_tree.num_columns());
+    DCHECK_LE(_opts.pred_tree.num_columns(), _predicate_columns);
 
     {
         SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_iterator_init_ns);
@@ -2166,18 +2280,22 @@ void SegmentIterator::close() {
 
 // put the field that has predicated on it ahead of those without one, for handle late
 // materialization easier.
-inline Schema reorder_schema(const Schema& input, const PredicateTree& pred_tree) {
+inline bool is_predicate_column(const SegmentReadOptions& options, ColumnId cid) {
+    return options.pred_tree.contains_column(cid) || options.runtime_filter_preds.contains_column(cid);
+}
+
+inline Schema reorder_schema(const Schema& input, const SegmentReadOptions& options) {
     const std::vector<FieldPtr>& fields = input.fields();
 
     Schema output;
     output.reserve(fields.size());
     for (const auto& field : fields) {
-        if (pred_tree.contains_column(field->id())) {
+        if (is_predicate_column(options, field->id())) {
             output.append(field);
         }
     }
     for (const auto& field : fields) {
-        if (!pred_tree.contains_column(field->id())) {
+        if (!is_predicate_column(options, field->id())) {
             output.append(field);
         }
     }
@@ -2186,10 +2304,16 @@ inline Schema reorder_schema(const Schema& input, const PredicateTree& pred_tree
 
 ChunkIteratorPtr new_segment_iterator(const std::shared_ptr<Segment>& segment, const Schema& schema,
                                       const SegmentReadOptions& options) {
-    if (options.pred_tree.empty() || options.pred_tree.num_columns() >= schema.num_fields()) {
+    size_t num_predicate_columns = options.pred_tree.num_columns();
+    if (!options.runtime_filter_preds.empty()) {
+        num_predicate_columns = std::count_if(schema.fields().begin(), schema.fields().end(), [&](const auto& f) {
+            return is_predicate_column(options, f->id());
+        });
+    }
+    if (num_predicate_columns == 0 || num_predicate_columns >= schema.num_fields()) {
         return std::make_shared<SegmentIterator>(segment, schema, options);
     } else {
-        Schema ordered_schema = reorder_schema(schema, options.pred_tree);
+        Schema ordered_schema = reorder_schema(schema, options);
         auto seg_iter = std::make_shared<SegmentIterator>(segment, ordered_schema, options);
         return new_projection_iterator(schema, seg_iter);
     }
@@ -80,6 +80,7 @@ public:
 
     const ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
+    const std::unordered_set<uint32_t>* dict_code_column_ids = nullptr;
 
     bool has_delete_pred = false;
 
@@ -90,6 +91,7 @@ public:
     std::vector<ShortKeyRangeOptionPtr> short_key_ranges;
 
     OlapRuntimeScanRangePruner runtime_range_pruner;
+    RuntimeFilterPredicates runtime_filter_preds;
 
     const std::atomic<bool>* is_cancelled = nullptr;
 
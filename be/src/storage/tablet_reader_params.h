@@ -76,12 +76,16 @@ struct TabletReaderParams {
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = &EMPTY_FILTERED_COLUMN_IDS;
+    // The string columns read as the only key of the hash aggregations and the join probes, which keep the
+    // dict codes of the values read from the dict encoded pages.
+    const std::unordered_set<uint32_t>* dict_code_column_ids = nullptr;
 
     RowidRangeOptionPtr rowid_range_option = nullptr;
     ShortKeyRangesOptionPtr short_key_ranges_option = nullptr;
 
     bool sorted_by_keys_per_tablet = false;
     OlapRuntimeScanRangePruner runtime_range_pruner;
+    RuntimeFilterPredicates runtime_filter_preds;
 
     std::vector<ColumnAccessPathPtr>* column_access_paths = nullptr;
     bool use_pk_index = false;
@@ -0,0 +1,130 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/compression/zstd_dict_compression.h"
+
+#include <zstd/zdict.h>
+#include <zstd/zstd.h>
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "util/compression/compression_context_pool_singletons.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+// The trainer learns from many small samples better than from a few big ones,
+// so the sampled blocks are cut into pieces of this size.
+static constexpr size_t kSamplePieceSize = 4096;
+// zstd suggests about 100x of the dictionary size as the training samples, more samples just slow down training.
+static constexpr size_t kMaxSamplesToDictRatio = 100;
+
+ZstdDictCompressor::ZstdDictCompressor(int num_sample_blocks, size_t dict_capacity, int compression_level)
+        : _num_sample_blocks(num_sample_blocks), _dict_capacity(dict_capacity), _compression_level(compression_level) {
+    _failed = _num_sample_blocks <= 0 || _dict_capacity == 0;
+}
+
+ZstdDictCompressor::~ZstdDictCompressor() {
+    if (_cdict != nullptr) {
+        ZSTD_freeCDict(_cdict);
+    }
+}
+
+void ZstdDictCompressor::add_sample(const Slice& block) {
+    if (is_trained() || _failed) {
+        return;
+    }
+    const size_t max_samples_size = _dict_capacity * kMaxSamplesToDictRatio;
+    for (size_t offset = 0; offset < block.size && _samples.size() < max_samples_size; offset += kSamplePieceSize) {
+        size_t size = std::min(kSamplePieceSize, block.size - offset);
+        _samples.append(block.data + offset, size);
+        _sample_sizes.push_back(size);
+    }
+    if (++_num_collected_blocks >= _num_sample_blocks || _samples.size() >= max_samples_size) {
+        _train();
+    }
+}
+
+void ZstdDictCompressor::_train() {
+    _dict.resize(_dict_capacity);
+    size_t dict_size = ZDICT_trainFromBuffer(_dict.data(), _dict.size(), _samples.data(), _sample_sizes.data(),
+                                             _sample_sizes.size());
+    // The samples are useless from now on, whatever the training succeeds or not.
+    std::string().swap(_samples);
+    std::vector<size_t>().swap(_sample_sizes);
+
+    if (ZDICT_isError(dict_size)) {
+        VLOG(2) << "Failed to train zstd dictionary: " << ZDICT_getErrorName(dict_size);
+        _failed = true;
+        std::string().swap(_dict);
+        return;
+    }
+    _dict.resize(dict_size);
+    _cdict = ZSTD_createCDict(_dict.data(), _dict.size(), _compression_level);
+    if (_cdict == nullptr) {
+        _failed = true;
+        std::string().swap(_dict);
+        return;
+    }
+    _dict_id = HashUtil::hash64(_dict.data(), _dict.size(), 0);
+}
+
+Status ZstdDictCompressor::compress(const Slice& input, raw::RawString* output) const {
+    DCHECK(is_trained());
+    StatusOr<compression::ZSTD_CCtx_Pool::Ref> ref = compression::getZSTD_CCtx();
+    RETURN_IF_ERROR(ref.status());
+    compression::ZSTDCompressionContext* context = ref.value().get();
+
+    output->resize(ZSTD_compressBound(input.size));
+    size_t ret =
+            ZSTD_compress_usingCDict(context->ctx, output->data(), output->size(), input.data, input.size, _cdict);
+    if (ZSTD_isError(ret)) {
+        context->compression_fail = true;
+        return Status::InvalidArgument(
+                strings::Substitute("ZSTD compress with dictionary failed: $0", ZSTD_getErrorName(ret)));
+    }
+    output->resize(ret);
+    return Status::OK();
+}
+
+ZstdDictDecompressor::~ZstdDictDecompressor() {
+    ZSTD_freeDDict(_ddict);
+}
+
+StatusOr<std::unique_ptr<ZstdDictDecompressor>> ZstdDictDecompressor::create(const std::string& dict) {
+    ZSTD_DDict* ddict = ZSTD_createDDict(dict.data(), dict.size());
+    if (ddict == nullptr) {
+        return Status::InternalError("Failed to create zstd decompression dictionary");
+    }
+    return std::unique_ptr<ZstdDictDecompressor>(new ZstdDictDecompressor(ddict));
+}
+
+Status ZstdDictDecompressor::decompress(const Slice& input, Slice* output) const {
+    StatusOr<compression::ZSTD_DCtx_Pool::Ref> ref = compression::getZSTD_DCtx();
+    RETURN_IF_ERROR(ref.status());
+    compression::ZSTDDecompressContext* context = ref.value().get();
+
+    size_t ret = ZSTD_decompress_usingDDict(context->ctx, output->data, output->size, input.data, input.size, _ddict);
+    if (ZSTD_isError(ret)) {
+        context->decompression_fail = true;
+        return Status::InvalidArgument(
+                strings::Substitute("ZSTD decompress with dictionary failed: $0", ZSTD_getErrorName(ret)));
+    }
+    output->size = ret;
+    return Status::OK();
+}
+
+} // namespace starrocks
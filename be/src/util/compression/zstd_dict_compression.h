@@ -0,0 +1,103 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "common/statusor.h"
+#include "util/raw_container.h"
+#include "util/slice.h"
+
+typedef struct ZSTD_CDict_s ZSTD_CDict;
+typedef struct ZSTD_DDict_s ZSTD_DDict;
+
+namespace starrocks {
+
+// ZstdDictCompressor compresses a stream of small blocks, e.g. the serialized chunks of an exchange
+// channel, with a zstd dictionary trained on the first blocks of the stream. Small blocks share little
+// context with themselves, so a dictionary learned from their common content compresses them much better.
+//
+// Usage:
+//   while (!compressor.is_trained() && !compressor.is_failed()) compressor.add_sample(block) ...
+//   compressor.compress(block, &output) once is_trained() returns true.
+//
+// The dictionary must be delivered to the decompressor before the first block compressed with it.
+class ZstdDictCompressor {
+public:
+    ZstdDictCompressor(int num_sample_blocks, size_t dict_capacity, int compression_level = 1);
+    ~ZstdDictCompressor();
+
+    ZstdDictCompressor(const ZstdDictCompressor&) = delete;
+    ZstdDictCompressor& operator=(const ZstdDictCompressor&) = delete;
+
+    // Copy the block as a training sample, and train the dictionary once enough blocks are collected.
+    // If the training fails, e.g. the samples are too small or too random, is_failed() becomes true
+    // and the caller should fall back to the compression without dictionary.
+    void add_sample(const Slice& block);
+
+    bool is_trained() const { return _cdict != nullptr; }
+    bool is_failed() const { return _failed; }
+
+    // Identify the dictionary at the decompressor side, only valid after trained.
+    int64_t dict_id() const { return _dict_id; }
+    const std::string& dict() const { return _dict; }
+
+    // Whether the dictionary has been attached to a compressed block sent to the decompressor.
+    bool is_dict_delivered() const { return _dict_delivered; }
+    void set_dict_delivered() { _dict_delivered = true; }
+
+    // Compress input with the trained dictionary, the output is resized to the compressed size.
+    Status compress(const Slice& input, raw::RawString* output) const;
+
+private:
+    void _train();
+
+    const int _num_sample_blocks;
+    const size_t _dict_capacity;
+    const int _compression_level;
+
+    std::string _samples;
+    std::vector<size_t> _sample_sizes;
+    int _num_collected_blocks = 0;
+
+    bool _failed = false;
+    int64_t _dict_id = 0;
+    std::string _dict;
+    ZSTD_CDict* _cdict = nullptr;
+    bool _dict_delivered = false;
+};
+
+// ZstdDictDecompressor decompresses the blocks compressed by ZstdDictCompressor with the same dictionary.
+// It is immutable after creation and could be shared by threads.
+class ZstdDictDecompressor {
+public:
+    ~ZstdDictDecompressor();
+
+    static StatusOr<std::unique_ptr<ZstdDictDecompressor>> create(const std::string& dict);
+
+    // Output's capacity should be large enough for the decompressed data,
+    // and its size will be set to the size of the decompressed data.
+    Status decompress(const Slice& input, Slice* output) const;
+
+private:
+    explicit ZstdDictDecompressor(ZSTD_DDict* ddict) : _ddict(ddict) {}
+
+    ZSTD_DDict* _ddict;
+};
+
+} // namespace starrocks
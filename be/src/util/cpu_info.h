@@ -80,6 +80,23 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the number of NUMA nodes, 1 if the kernel has no NUMA support.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core.
+    static int get_numa_node_for_core(int core) {
+        DCHECK_GE(core, 0);
+        DCHECK_LT(core, max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the cores belonging to the NUMA node.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK_GE(node, 0);
+        DCHECK_LT(node, max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
     static std::string debug_string();
 
 private:
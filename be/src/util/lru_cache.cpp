@@ -234,6 +234,11 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
+bool LRUCache::contains(const CacheKey& key, uint32_t hash) {
+    std::lock_guard l(_mutex);
+    return _table.lookup(key, hash) != nullptr;
+}
+
 void LRUCache::release(Cache::Handle* handle) {
     if (handle == nullptr) {
         return;
@@ -446,6 +451,11 @@ Cache::Handle* ShardedLRUCache::lookup(const CacheKey& key) {
     return _shards[_shard(hash)].lookup(key, hash);
 }
 
+bool ShardedLRUCache::contains(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].contains(key, hash);
+}
+
 void ShardedLRUCache::release(Handle* handle) {
     auto* h = reinterpret_cast<LRUHandle*>(handle);
     _shards[_shard(h->hash)].release(handle);
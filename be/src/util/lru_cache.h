@@ -31,6 +31,10 @@ enum class ChargeMode {
 // of Cache uses a least-recently-used eviction policy.
 extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
 
+// Create a cache with the eviction policy named by |policy|, "lru" or "tinylfu".
+// Unknown names fall back to "lru".
+extern Cache* new_cache(std::string_view policy, size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+
 class CacheKey {
 public:
     CacheKey() = default;
@@ -150,6 +154,10 @@ public:
     // longer needed.
     virtual Handle* lookup(const CacheKey& key) = 0;
 
+    // Return true if the cache has a mapping for "key". Unlike lookup(), it
+    // neither pins the entry nor updates the stats and the recency of the cache.
+    virtual bool contains(const CacheKey& key) = 0;
+
     // Release a mapping returned by a previous Lookup().
     // REQUIRES: handle must not have been released yet.
     // REQUIRES: handle must have been returned by a method on *this.
@@ -209,7 +217,8 @@ typedef struct LRUHandle {
     LRUHandle* prev;
     size_t charge;
     size_t key_length;
-    bool in_cache; // Whether entry is in the cache.
+    bool in_cache;  // Whether entry is in the cache.
+    uint8_t region; // The segment the entry belongs to, only used by TinyLFUCache.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -281,6 +290,7 @@ public:
                           void (*deleter)(const CacheKey& key, void* value),
                           CachePriority priority = CachePriority::NORMAL, size_t value_size = 0);
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    bool contains(const CacheKey& key, uint32_t hash);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
     int prune();
@@ -327,6 +337,7 @@ public:
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
     Handle* lookup(const CacheKey& key) override;
+    bool contains(const CacheKey& key) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
     void* value(Handle* handle) override;
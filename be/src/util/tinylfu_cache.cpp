@@ -0,0 +1,555 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/tinylfu_cache.h"
+
+#include <rapidjson/document.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+static constexpr uint64_t kSketchSeeds[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                            0xcbf29ce484222325ULL};
+static constexpr uint64_t kCounterMask = 0xfULL;
+static constexpr uint64_t kResetMask = 0x7777777777777777ULL;
+
+void FrequencySketch::ensure_capacity(size_t num_entries) {
+    size_t num_words = kMinWords;
+    while (num_words < num_entries && num_words < kMaxWords) {
+        num_words *= 2;
+    }
+    if (num_words <= _table.size()) {
+        return;
+    }
+    _table.assign(num_words, 0);
+    _sample_size = 10 * num_words;
+    _size = 0;
+}
+
+// Locate the i-th counter of the hash, returns the index of the word and the shift of the counter in the word.
+static inline std::pair<size_t, uint32_t> locate_counter(uint32_t hash, int i, size_t num_words) {
+    uint64_t h = (hash + kSketchSeeds[i]) * kSketchSeeds[i];
+    h += h >> 32;
+    // Every word contains 16 counters, and the number of words is a power of 2.
+    size_t index = h & (num_words * 16 - 1);
+    return {index >> 4, (index & 15) << 2};
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    uint32_t frequency = kCounterMask;
+    for (int i = 0; i < 4; i++) {
+        auto [word, shift] = locate_counter(hash, i, _table.size());
+        frequency = std::min<uint32_t>(frequency, (_table[word] >> shift) & kCounterMask);
+    }
+    return frequency;
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    bool added = false;
+    for (int i = 0; i < 4; i++) {
+        auto [word, shift] = locate_counter(hash, i, _table.size());
+        if (((_table[word] >> shift) & kCounterMask) != kCounterMask) {
+            _table[word] += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_size >= _sample_size) {
+        _reset();
+    }
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & kResetMask;
+    }
+    _size /= 2;
+}
+
+TinyLFUCache::TinyLFUCache() {
+    // Make empty circular linked lists
+    for (auto& list : _lists) {
+        list.next = &list;
+        list.prev = &list;
+    }
+}
+
+TinyLFUCache::~TinyLFUCache() noexcept {
+    prune();
+}
+
+bool TinyLFUCache::_unref(LRUHandle* e) {
+    DCHECK(e->refs > 0);
+    e->refs--;
+    return e->refs == 0;
+}
+
+void TinyLFUCache::_list_remove(LRUHandle* e) {
+    e->next->prev = e->prev;
+    e->prev->next = e->next;
+    e->prev = e->next = nullptr;
+}
+
+void TinyLFUCache::_list_append(LRUHandle* list, LRUHandle* e) {
+    // Make "e" newest entry by inserting just before *list
+    e->next = list;
+    e->prev = list->prev;
+    e->prev->next = e;
+    e->next->prev = e;
+}
+
+void TinyLFUCache::_set_region(LRUHandle* e, Region region) {
+    _region_usage[e->region] -= e->charge;
+    _region_usage[region] += e->charge;
+    e->region = region;
+}
+
+LRUHandle* TinyLFUCache::_oldest(Region region) const {
+    LRUHandle* e = _lists[region].next;
+    return e == &_lists[region] ? nullptr : e;
+}
+
+void TinyLFUCache::set_capacity(size_t capacity) {
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        _capacity = capacity;
+        _window_capacity = capacity / 100;
+        _protected_capacity = (capacity - _window_capacity) * 8 / 10;
+        _demote_protected();
+        _evict(&last_ref_list);
+    }
+
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
+
+void TinyLFUCache::set_charge_mode(ChargeMode charge_mode) {
+    _charge_mode = charge_mode;
+}
+
+uint64_t TinyLFUCache::get_lookup_count() const {
+    std::lock_guard l(_mutex);
+    return _lookup_count;
+}
+
+uint64_t TinyLFUCache::get_hit_count() const {
+    std::lock_guard l(_mutex);
+    return _hit_count;
+}
+
+uint64_t TinyLFUCache::get_reject_count() const {
+    std::lock_guard l(_mutex);
+    return _reject_count;
+}
+
+size_t TinyLFUCache::get_usage() const {
+    std::lock_guard l(_mutex);
+    return _usage;
+}
+
+size_t TinyLFUCache::get_capacity() const {
+    std::lock_guard l(_mutex);
+    return _capacity;
+}
+
+Cache::Handle* TinyLFUCache::lookup(const CacheKey& key, uint32_t hash) {
+    std::lock_guard l(_mutex);
+    ++_lookup_count;
+    _sketch.increment(hash);
+    LRUHandle* e = _table.lookup(key, hash);
+    if (e != nullptr) {
+        // we get it from _table, so in_cache must be true
+        DCHECK(e->in_cache);
+        if (e->refs == 1) {
+            // only in the free list of its region, remove it from list
+            _list_remove(e);
+        }
+        e->refs++;
+        ++_hit_count;
+        if (e->region == PROBATION) {
+            _set_region(e, PROTECTED);
+            _demote_protected();
+        }
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+bool TinyLFUCache::contains(const CacheKey& key, uint32_t hash) {
+    std::lock_guard l(_mutex);
+    return _table.lookup(key, hash) != nullptr;
+}
+
+void TinyLFUCache::release(Cache::Handle* handle) {
+    if (handle == nullptr) {
+        return;
+    }
+    auto* e = reinterpret_cast<LRUHandle*>(handle);
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        if (_unref(e)) {
+            _usage -= e->charge;
+            last_ref_list.push_back(e);
+        } else if (e->in_cache && e->refs == 1) {
+            // only exists in cache, put it to the free list of its region
+            _list_append(&_lists[e->region], e);
+            if (_usage > _capacity) {
+                // take this opportunity and evict the entries
+                _evict(&last_ref_list);
+            }
+        }
+    }
+
+    // free handle out of mutex
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+}
+
+void TinyLFUCache::_demote_protected() {
+    while (_region_usage[PROTECTED] > _protected_capacity) {
+        LRUHandle* e = _oldest(PROTECTED);
+        if (e == nullptr) {
+            break;
+        }
+        _list_remove(e);
+        _set_region(e, PROBATION);
+        _list_append(&_lists[PROBATION], e);
+    }
+}
+
+void TinyLFUCache::_evict(std::vector<LRUHandle*>* deleted) {
+    // 1. move the overflow of the window to the probation segment, they are the candidates to admit
+    LRUHandle* candidate = nullptr;
+    while (_region_usage[WINDOW] > _window_capacity) {
+        LRUHandle* e = _oldest(WINDOW);
+        if (e == nullptr) {
+            break;
+        }
+        _list_remove(e);
+        _set_region(e, PROBATION);
+        _list_append(&_lists[PROBATION], e);
+        if (candidate == nullptr) {
+            candidate = e;
+        }
+    }
+
+    // 2. evict the less frequent one of the oldest candidate and the oldest entry of the probation segment
+    while (_usage > _capacity) {
+        LRUHandle* victim = _oldest(PROBATION);
+        if (victim == nullptr) {
+            // the probation segment is empty or all in use
+            victim = _oldest(WINDOW);
+            if (victim == nullptr) {
+                victim = _oldest(PROTECTED);
+            }
+            if (victim == nullptr) {
+                break;
+            }
+            _evict_one_entry(victim, deleted);
+            continue;
+        }
+        if (candidate != nullptr && candidate != victim &&
+            _sketch.frequency(candidate->hash) <= _sketch.frequency(victim->hash)) {
+            victim = candidate;
+            ++_reject_count;
+        }
+        if (victim == candidate) {
+            // the candidates are the newest entries of the probation segment
+            candidate = candidate->next == &_lists[PROBATION] ? nullptr : candidate->next;
+        }
+        _evict_one_entry(victim, deleted);
+    }
+}
+
+void TinyLFUCache::_evict_one_entry(LRUHandle* e, std::vector<LRUHandle*>* deleted) {
+    DCHECK(e->in_cache);
+    DCHECK(e->refs == 1); // the free lists contain elements which may be evicted
+    _list_remove(e);
+    _table.remove(e->key(), e->hash);
+    e->in_cache = false;
+    _region_usage[e->region] -= e->charge;
+    --_num_entries;
+    _unref(e);
+    _usage -= e->charge;
+    deleted->push_back(e);
+}
+
+Cache::Handle* TinyLFUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                                    void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
+                                    size_t value_size) {
+    auto* e = reinterpret_cast<LRUHandle*>(malloc(sizeof(LRUHandle) - 1 + key.size()));
+    e->value = value;
+    e->deleter = deleter;
+    e->charge = charge;
+    e->key_length = key.size();
+    e->hash = hash;
+    e->refs = 2; // one for the returned handle, one for TinyLFUCache.
+    e->next = e->prev = nullptr;
+    e->in_cache = true;
+    e->region = priority == CachePriority::DURABLE ? PROTECTED : WINDOW;
+    e->priority = priority;
+    e->value_size = value_size;
+    memcpy(e->key_data, key.data(), key.size());
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        _sketch.increment(hash);
+
+        auto old = _table.insert(e);
+        _usage += charge;
+        _region_usage[e->region] += charge;
+        if (old != nullptr) {
+            old->in_cache = false;
+            _region_usage[old->region] -= old->charge;
+            if (_unref(old)) {
+                _usage -= old->charge;
+                // old is on the free list because it's in cache and its reference count
+                // was just 1 (Unref returned 0)
+                _list_remove(old);
+                last_ref_list.push_back(old);
+            }
+        } else {
+            ++_num_entries;
+            _sketch.ensure_capacity(_num_entries);
+        }
+
+        if (e->region == PROTECTED) {
+            _demote_protected();
+        }
+        // note that the cache might get larger than its capacity if not enough
+        // space was freed
+        _evict(&last_ref_list);
+    }
+
+    // we free the entries here outside of mutex for
+    // performance reasons
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+void TinyLFUCache::erase(const CacheKey& key, uint32_t hash) {
+    LRUHandle* e = nullptr;
+    bool last_ref = false;
+    {
+        std::lock_guard l(_mutex);
+        e = _table.remove(key, hash);
+        if (e != nullptr) {
+            _region_usage[e->region] -= e->charge;
+            --_num_entries;
+            last_ref = _unref(e);
+            if (last_ref) {
+                _usage -= e->charge;
+                if (e->in_cache) {
+                    // locate in free list
+                    _list_remove(e);
+                }
+            }
+            e->in_cache = false;
+        }
+    }
+    // free handle out of mutex, when last_ref is true, e must not be nullptr
+    if (last_ref) {
+        e->free();
+    }
+}
+
+int TinyLFUCache::prune() {
+    std::vector<LRUHandle*> last_ref_list;
+    {
+        std::lock_guard l(_mutex);
+        for (auto& list : _lists) {
+            while (list.next != &list) {
+                _evict_one_entry(list.next, &last_ref_list);
+            }
+        }
+    }
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+    return last_ref_list.size();
+}
+
+inline uint32_t ShardedTinyLFUCache::_hash_slice(const CacheKey& s) {
+    return s.hash(s.data(), s.size(), 0);
+}
+
+uint32_t ShardedTinyLFUCache::_shard(uint32_t hash) {
+    return hash >> (32 - kNumShardBits);
+}
+
+ShardedTinyLFUCache::ShardedTinyLFUCache(size_t capacity, ChargeMode charge_mode)
+        : _last_id(0), _capacity(capacity), _charge_mode(charge_mode) {
+    const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
+    for (auto& shard : _shards) {
+        shard.set_capacity(per_shard);
+        shard.set_charge_mode(_charge_mode);
+    }
+}
+
+void ShardedTinyLFUCache::_set_capacity(size_t capacity) {
+    const size_t per_shard = (capacity + (kNumShards - 1)) / kNumShards;
+    for (auto& shard : _shards) {
+        shard.set_capacity(per_shard);
+    }
+    _capacity = capacity;
+}
+
+void ShardedTinyLFUCache::set_capacity(size_t capacity) {
+    std::lock_guard l(_mutex);
+    _set_capacity(capacity);
+}
+
+bool ShardedTinyLFUCache::adjust_capacity(int64_t delta, size_t min_capacity) {
+    std::lock_guard l(_mutex);
+    int64_t new_capacity = _capacity + delta;
+    if (new_capacity < static_cast<int64_t>(min_capacity)) {
+        return false;
+    }
+    _set_capacity(new_capacity);
+    return true;
+}
+
+Cache::Handle* ShardedTinyLFUCache::insert(const CacheKey& key, void* value, size_t charge,
+                                           void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
+                                           size_t value_size) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].insert(key, hash, value, charge, deleter, priority, value_size);
+}
+
+Cache::Handle* ShardedTinyLFUCache::lookup(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].lookup(key, hash);
+}
+
+bool ShardedTinyLFUCache::contains(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].contains(key, hash);
+}
+
+void ShardedTinyLFUCache::release(Handle* handle) {
+    auto* h = reinterpret_cast<LRUHandle*>(handle);
+    _shards[_shard(h->hash)].release(handle);
+}
+
+void ShardedTinyLFUCache::erase(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    _shards[_shard(hash)].erase(key, hash);
+}
+
+void* ShardedTinyLFUCache::value(Handle* handle) {
+    return reinterpret_cast<LRUHandle*>(handle)->value;
+}
+
+Slice ShardedTinyLFUCache::value_slice(Handle* handle) {
+    auto lru_handle = reinterpret_cast<LRUHandle*>(handle);
+    size_t record_size = _charge_mode == ChargeMode::VALUESIZE ? lru_handle->charge : lru_handle->value_size;
+    return {(char*)lru_handle->value, record_size};
+}
+
+uint64_t ShardedTinyLFUCache::new_id() {
+    std::lock_guard l(_mutex);
+    return ++(_last_id);
+}
+
+size_t ShardedTinyLFUCache::_get_stat(size_t (TinyLFUCache::*mem_fun)() const) const {
+    size_t n = 0;
+    for (auto& shard : _shards) {
+        n += (shard.*mem_fun)();
+    }
+    return n;
+}
+
+size_t ShardedTinyLFUCache::get_capacity() const {
+    return _get_stat(&TinyLFUCache::get_capacity);
+}
+
+void ShardedTinyLFUCache::prune() {
+    int num_prune = 0;
+    for (auto& shard : _shards) {
+        num_prune += shard.prune();
+    }
+    VLOG(7) << "Successfully prune cache, clean " << num_prune << " entries.";
+}
+
+size_t ShardedTinyLFUCache::get_memory_usage() const {
+    return _get_stat(&TinyLFUCache::get_usage);
+}
+
+uint64_t ShardedTinyLFUCache::get_lookup_count() const {
+    return _get_stat(&TinyLFUCache::get_lookup_count);
+}
+
+uint64_t ShardedTinyLFUCache::get_hit_count() const {
+    return _get_stat(&TinyLFUCache::get_hit_count);
+}
+
+uint64_t ShardedTinyLFUCache::get_reject_count() const {
+    return _get_stat(&TinyLFUCache::get_reject_count);
+}
+
+void ShardedTinyLFUCache::get_cache_status(rapidjson::Document* document) {
+    for (auto& shard : _shards) {
+        size_t capacity = shard.get_capacity();
+        size_t usage = shard.get_usage();
+        rapidjson::Value shard_info(rapidjson::kObjectType);
+        shard_info.AddMember("capacity", static_cast<double>(capacity), document->GetAllocator());
+        shard_info.AddMember("usage", static_cast<double>(usage), document->GetAllocator());
+
+        float usage_ratio = 0.0f;
+        if (0 != capacity) {
+            usage_ratio = static_cast<float>(usage) / static_cast<float>(capacity);
+        }
+        shard_info.AddMember("usage_ratio", usage_ratio, document->GetAllocator());
+
+        size_t lookup_count = shard.get_lookup_count();
+        size_t hit_count = shard.get_hit_count();
+        shard_info.AddMember("lookup_count", static_cast<double>(lookup_count), document->GetAllocator());
+        shard_info.AddMember("hit_count", static_cast<double>(hit_count), document->GetAllocator());
+
+        float hit_ratio = 0.0f;
+        if (0 != lookup_count) {
+            hit_ratio = static_cast<float>(hit_count) / static_cast<float>(lookup_count);
+        }
+        shard_info.AddMember("hit_ratio", hit_ratio, document->GetAllocator());
+        shard_info.AddMember("reject_count", static_cast<double>(shard.get_reject_count()), document->GetAllocator());
+        document->PushBack(shard_info, document->GetAllocator());
+    }
+}
+
+Cache* new_tinylfu_cache(size_t capacity, ChargeMode charge_mode) {
+    return new ShardedTinyLFUCache(capacity, charge_mode);
+}
+
+Cache* new_cache(std::string_view policy, size_t capacity, ChargeMode charge_mode) {
+    if (policy == "tinylfu") {
+        return new_tinylfu_cache(capacity, charge_mode);
+    }
+    if (policy != "lru") {
+        LOG(WARNING) << "unknown cache eviction policy " << policy << ", use lru instead";
+    }
+    return new_lru_cache(capacity, charge_mode);
+}
+
+} // namespace starrocks
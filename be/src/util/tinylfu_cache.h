@@ -0,0 +1,168 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+extern Cache* new_tinylfu_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+
+// A count-min sketch of 4-bit counters, which estimates the access frequency of the keys
+// in the recent past. All the counters are halved once the number of increments reaches
+// 10 times the number of counter words, so that the old popularity fades out.
+class FrequencySketch {
+public:
+    FrequencySketch() { ensure_capacity(0); }
+
+    // Resize the sketch for |num_entries| entries, the counters are cleared if it's resized.
+    void ensure_capacity(size_t num_entries);
+
+    // Return the estimated frequency of the hash, [0, 15].
+    uint32_t frequency(uint32_t hash) const;
+
+    void increment(uint32_t hash);
+
+    size_t num_words() const { return _table.size(); }
+
+private:
+    void _reset();
+
+    static constexpr size_t kMinWords = 64;
+    static constexpr size_t kMaxWords = 1 << 16;
+
+    // Every word contains 16 counters.
+    std::vector<uint64_t> _table;
+    size_t _size = 0;
+    size_t _sample_size = 0;
+};
+
+// A cache shard using W-TinyLFU (https://arxiv.org/abs/1512.00727) policy.
+//
+// New entries enter an admission window, a small LRU of 1% capacity. Entries evicted from the window
+// become candidates of the main space, a segmented LRU of a probation segment and a protected segment
+// of 80% capacity. When the cache is full, the frequency of the oldest candidate is compared with the
+// oldest entry of the probation segment, and the less frequent one is evicted. So a one-time scan
+// only churns the window and can't flush the frequently used entries from the main space.
+// An entry in the probation segment is promoted to the protected segment when it's accessed again.
+//
+// DURABLE entries skip the window and the admission, they enter the protected segment directly.
+//
+// Like LRUCache, entries referenced by handles are not in any list and can't be evicted.
+class TinyLFUCache {
+public:
+    TinyLFUCache();
+    ~TinyLFUCache() noexcept;
+
+    void set_capacity(size_t capacity);
+
+    void set_charge_mode(ChargeMode charge_mode);
+
+    Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                          void (*deleter)(const CacheKey& key, void* value),
+                          CachePriority priority = CachePriority::NORMAL, size_t value_size = 0);
+    Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    bool contains(const CacheKey& key, uint32_t hash);
+    void release(Cache::Handle* handle);
+    void erase(const CacheKey& key, uint32_t hash);
+    int prune();
+
+    uint64_t get_lookup_count() const;
+    uint64_t get_hit_count() const;
+    uint64_t get_reject_count() const;
+    size_t get_usage() const;
+    size_t get_capacity() const;
+
+private:
+    enum Region : uint8_t { WINDOW = 0, PROBATION = 1, PROTECTED = 2, NUM_REGIONS = 3 };
+
+    static void _list_remove(LRUHandle* e);
+    static void _list_append(LRUHandle* list, LRUHandle* e);
+    bool _unref(LRUHandle* e);
+    void _set_region(LRUHandle* e, Region region);
+    void _evict(std::vector<LRUHandle*>* deleted);
+    void _evict_one_entry(LRUHandle* e, std::vector<LRUHandle*>* deleted);
+    void _demote_protected();
+    LRUHandle* _oldest(Region region) const;
+
+    size_t _capacity{0};
+    size_t _window_capacity{0};
+    size_t _protected_capacity{0};
+
+    ChargeMode _charge_mode;
+
+    // _mutex protects the following state.
+    mutable std::mutex _mutex;
+    size_t _usage{0};
+    size_t _region_usage[NUM_REGIONS] = {0, 0, 0};
+
+    // Dummy heads of the LRU list of each region.
+    // list.prev is newest entry, list.next is oldest entry.
+    // Entries have refs==1 and in_cache==true.
+    LRUHandle _lists[NUM_REGIONS];
+
+    HandleTable _table;
+    size_t _num_entries{0};
+
+    FrequencySketch _sketch;
+
+    uint64_t _lookup_count{0};
+    uint64_t _hit_count{0};
+    uint64_t _reject_count{0};
+};
+
+class ShardedTinyLFUCache : public Cache {
+public:
+    explicit ShardedTinyLFUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    ~ShardedTinyLFUCache() override = default;
+    Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
+                   CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
+    Handle* lookup(const CacheKey& key) override;
+    bool contains(const CacheKey& key) override;
+    void release(Handle* handle) override;
+    void erase(const CacheKey& key) override;
+    void* value(Handle* handle) override;
+    Slice value_slice(Handle* handle) override;
+    uint64_t new_id() override;
+    void prune() override;
+    void get_cache_status(rapidjson::Document* document) override;
+    void set_capacity(size_t capacity) override;
+    size_t get_memory_usage() const override;
+    size_t get_capacity() const override;
+    uint64_t get_lookup_count() const override;
+    uint64_t get_hit_count() const override;
+    bool adjust_capacity(int64_t delta, size_t min_capacity = 0) override;
+
+    // The number of new entries not admitted to the main space of the cache.
+    uint64_t get_reject_count() const;
+
+private:
+    static uint32_t _hash_slice(const CacheKey& s);
+    static uint32_t _shard(uint32_t hash);
+    void _set_capacity(size_t capacity);
+    size_t _get_stat(size_t (TinyLFUCache::*mem_fun)() const) const;
+
+    TinyLFUCache _shards[kNumShards];
+    std::mutex _mutex;
+    uint64_t _last_id;
+    size_t _capacity;
+    ChargeMode _charge_mode;
+};
+
+} // namespace starrocks
@@ -659,4 +659,61 @@ PARALLEL_TEST(BinaryColumnTest, test_reference_memory_usage) {
     ASSERT_EQ(0, column->Column::reference_memory_usage());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_dict_codes) {
+    auto dict = BinaryColumn::create();
+    dict->append("a");
+    dict->append("bb");
+    dict->append("");
+    BinaryColumn::DictPtr dict_ptr = dict;
+
+    auto column = BinaryColumn::create();
+    column->append_strings({Slice("bb"), Slice("a"), Slice("bb"), Slice("")});
+    ASSERT_FALSE(column->has_dict_codes());
+    column->set_dict_codes(dict_ptr, {1, 0, 1, 2});
+    ASSERT_TRUE(column->has_dict_codes());
+    ASSERT_EQ(dict_ptr, column->dict());
+
+    // The codes are kept by copying, filtering and appending the values of the same dictionary.
+    auto copy = column->clone();
+    ASSERT_TRUE(down_cast<BinaryColumn*>(copy.get())->has_dict_codes());
+
+    Filter filter{1, 0, 1, 1};
+    column->filter(filter);
+    ASSERT_EQ(3, column->size());
+    ASSERT_TRUE(column->has_dict_codes());
+    ASSERT_EQ(std::vector<int32_t>({1, 1, 2}), std::vector<int32_t>(column->dict_codes().begin(),
+                                                                     column->dict_codes().end()));
+
+    column->append(*copy, 1, 2);
+    std::vector<uint32_t> indexes{0, 3};
+    column->append_selective(*copy, indexes.data(), 0, indexes.size());
+    ASSERT_EQ(7, column->size());
+    ASSERT_TRUE(column->has_dict_codes());
+    for (size_t i = 0; i < column->size(); i++) {
+        ASSERT_EQ(column->get_slice(i), dict->get_slice(column->dict_codes()[i]));
+    }
+
+    // The codes are dropped by the other modifications.
+    column->append(Slice("c"));
+    ASSERT_FALSE(column->has_dict_codes());
+    ASSERT_TRUE(column->dict_codes().empty());
+
+    auto other = BinaryColumn::create();
+    other->append("x");
+    other->append(*copy, 0, 1);
+    ASSERT_FALSE(other->has_dict_codes());
+
+    // The codes are dropped along with the values moved out by downgrade().
+    auto large_dict = LargeBinaryColumn::create();
+    large_dict->append("a");
+    auto large_column = LargeBinaryColumn::create();
+    large_column->append("a");
+    large_column->set_dict_codes(large_dict, {0});
+    auto ret = large_column->downgrade();
+    ASSERT_TRUE(ret.ok());
+    ASSERT_EQ(1, ret.value()->size());
+    ASSERT_FALSE(large_column->has_dict_codes());
+}
+
 } // namespace starrocks
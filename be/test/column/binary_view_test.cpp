@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/binary_view.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+TEST(BinaryViewTest, test_inline) {
+    std::string short_str = "abcdefghijkl";
+    BinaryView short_view(Slice(short_str));
+    ASSERT_TRUE(short_view.is_inlined());
+    ASSERT_EQ(short_str, short_view.to_slice().to_string());
+    // The inlined string doesn't refer to the original data.
+    short_str[0] = 'x';
+    ASSERT_EQ("abcdefghijkl", short_view.to_slice().to_string());
+
+    std::string long_str = "abcdefghijklm";
+    BinaryView long_view(Slice(long_str));
+    ASSERT_FALSE(long_view.is_inlined());
+    ASSERT_EQ(long_str.data(), long_view.data());
+    ASSERT_EQ(long_str, long_view.to_slice().to_string());
+
+    BinaryView empty;
+    ASSERT_EQ(0, empty.size());
+    ASSERT_EQ(BinaryView(Slice()), empty);
+}
+
+TEST(BinaryViewTest, test_compare) {
+    std::vector<std::string> strs = {"",
+                                     std::string("\0", 1),
+                                     std::string("a\0", 2),
+                                     "a",
+                                     "ab",
+                                     "abc",
+                                     "abcd",
+                                     "abcde",
+                                     "abcdefghijkl",
+                                     "abcdefghijklm",
+                                     "abcdefghijkln",
+                                     "abcdefghijklmnopq",
+                                     "abd",
+                                     "b",
+                                     "\xff",
+                                     "\xff\xff\xff\xff\xff"};
+    for (const auto& lhs : strs) {
+        for (const auto& rhs : strs) {
+            int expected = Slice(lhs).compare(Slice(rhs));
+            expected = expected < 0 ? -1 : (expected > 0 ? 1 : 0);
+            ASSERT_EQ(expected, BinaryView(Slice(lhs)).compare(BinaryView(Slice(rhs)))) << lhs << " vs " << rhs;
+            ASSERT_EQ(lhs == rhs, BinaryView(Slice(lhs)) == BinaryView(Slice(rhs))) << lhs << " vs " << rhs;
+        }
+    }
+}
+
+} // namespace starrocks
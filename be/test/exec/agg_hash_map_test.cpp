@@ -154,6 +154,66 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, OneStringKeyWithDictCodes) {
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    MemPool pool;
+    auto allocate_func = [&pool](const auto& key) { return pool.allocate(16); };
+
+    auto make_column = [](const std::vector<std::string>& words, const std::vector<int32_t>& codes) {
+        auto dict = BinaryColumn::create();
+        for (const auto& word : words) {
+            dict->append(Slice(word));
+        }
+        auto column = BinaryColumn::create();
+        for (auto code : codes) {
+            column->append(dict->get_slice(code));
+        }
+        column->set_dict_codes(std::move(dict), Buffer<int32_t>(codes.begin(), codes.end()));
+        return column;
+    };
+    const std::vector<int32_t> codes{1, 0, 1, 2, 0, 1};
+    const size_t chunk_size = codes.size();
+
+    {
+        OneStringAggHashMap<PhmapSeed1> key(chunk_size, &statis);
+        Buffer<AggDataPtr> agg_states(chunk_size);
+        key.build_hash_map(chunk_size, Columns{make_column({"a", "bb", ""}, codes)}, &pool, allocate_func,
+                           &agg_states);
+        ASSERT_EQ(3, key.hash_map.size());
+        ASSERT_EQ(key.hash_map.find(Slice("a"))->second, agg_states[1]);
+        ASSERT_EQ(key.hash_map.find(Slice("bb"))->second, agg_states[0]);
+        ASSERT_EQ(key.hash_map.find(Slice(""))->second, agg_states[3]);
+        ASSERT_EQ(agg_states[1], agg_states[4]);
+        ASSERT_EQ(agg_states[0], agg_states[2]);
+        ASSERT_EQ(agg_states[0], agg_states[5]);
+
+        // Only look up the keys of another dictionary.
+        std::vector<uint8_t> not_founds;
+        Buffer<AggDataPtr> selected_states(chunk_size, nullptr);
+        key.build_hash_map_with_selection(chunk_size, Columns{make_column({"bb", "zz", "a"}, codes)}, &pool,
+                                          allocate_func, &selected_states, &not_founds);
+        ASSERT_EQ(3, key.hash_map.size());
+        ASSERT_EQ((std::vector<uint8_t>{1, 0, 1, 0, 0, 1}), not_founds);
+        ASSERT_EQ(agg_states[0], selected_states[1]);
+        ASSERT_EQ(agg_states[1], selected_states[3]);
+    }
+
+    {
+        NullOneStringAggHashMap<PhmapSeed1> key(chunk_size, &statis);
+        Buffer<AggDataPtr> agg_states(chunk_size);
+        auto null_column = NullColumn::create(chunk_size, 0);
+        null_column->get_data()[3] = 1;
+        auto column = NullableColumn::create(make_column({"a", "bb", ""}, codes), std::move(null_column));
+        key.build_hash_map(chunk_size, Columns{column}, &pool, allocate_func, &agg_states);
+        ASSERT_EQ(2, key.hash_map.size());
+        ASSERT_NE(nullptr, key.null_key_data);
+        ASSERT_EQ(key.null_key_data, agg_states[3]);
+        ASSERT_EQ(key.hash_map.find(Slice("a"))->second, agg_states[1]);
+        ASSERT_EQ(key.hash_map.find(Slice("bb"))->second, agg_states[5]);
+    }
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -1126,6 +1126,66 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinProbeFuncWithDictCodes) {
+    auto dict = BinaryColumn::create();
+    for (const auto* word : {"a", "bb", "ccc", ""}) {
+        dict->append(Slice(word));
+    }
+    BinaryColumn::DictPtr dict_ptr = dict;
+    const std::vector<int32_t> codes{2, 0, 1, 3, 2, 2, 0, 3, 1, 1};
+    const size_t num_rows = codes.size();
+    auto plain_column = BinaryColumn::create();
+    for (auto code : codes) {
+        plain_column->append(dict->get_slice(code));
+    }
+    auto dict_codes_column = BinaryColumn::create();
+    dict_codes_column->append(*plain_column, 0, num_rows);
+    dict_codes_column->set_dict_codes(dict_ptr, Buffer<int32_t>(codes.begin(), codes.end()));
+
+    for (bool nullable : {false, true}) {
+        JoinHashTableItems table_items;
+        HashTableProbeState probe_state;
+        ColumnPtr build_column = BinaryColumn::create();
+        build_column->append_default();
+        build_column->append(*dict, 0, 2);
+        if (nullable) {
+            auto null_column = NullColumn::create(build_column->size(), 0);
+            null_column->get_data()[0] = 1;
+            build_column = NullableColumn::create(build_column, std::move(null_column));
+        }
+        table_items.first.resize(16, 0);
+        table_items.key_columns.emplace_back(build_column);
+        table_items.bucket_size = 16;
+        table_items.row_count = 2;
+        table_items.next.resize(3);
+        probe_state.probe_row_count = num_rows;
+        probe_state.buckets.resize(config::vector_chunk_size);
+        probe_state.next.resize(config::vector_chunk_size, 0);
+        JoinBuildFunc<TYPE_VARCHAR>::prepare(nullptr, &table_items);
+        JoinProbeFunc<TYPE_VARCHAR>::prepare(_runtime_state.get(), &probe_state);
+        JoinBuildFunc<TYPE_VARCHAR>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+
+        auto lookup = [&](const ColumnPtr& column) {
+            Columns probe_columns{column};
+            if (nullable) {
+                auto null_column = NullColumn::create(num_rows, 0);
+                null_column->get_data()[3] = 1;
+                probe_columns[0] = NullableColumn::create(column, std::move(null_column));
+            }
+            probe_state.key_columns = &probe_columns;
+            JoinProbeFunc<TYPE_VARCHAR>::lookup_init(table_items, &probe_state);
+            return std::make_pair(std::vector<uint32_t>(probe_state.buckets.begin(),
+                                                        probe_state.buckets.begin() + num_rows),
+                                  std::vector<uint32_t>(probe_state.next.begin(), probe_state.next.begin() + num_rows));
+        };
+        auto expected = lookup(plain_column);
+        auto actual = lookup(dict_codes_column);
+        ASSERT_EQ(expected.first, actual.first);
+        ASSERT_EQ(expected.second, actual.second);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -2082,6 +2142,142 @@ TEST_F(JoinHashMapTest, SerializeJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, OneNullableKeyJoinHashTablePartitioned) {
+    config::vector_chunk_size = 4096;
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, true);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, true);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+    hash_table.set_partition_cache_bytes(1);
+
+    auto build_chunk = create_int32_build_chunk(10, 0, true);
+    auto probe_chunk = create_int32_probe_chunk(5, 1, true);
+    Columns probe_key_columns;
+    probe_key_columns.emplace_back(probe_chunk->columns()[0]);
+
+    Columns build_key_columns;
+    build_key_columns.emplace_back(build_chunk->columns()[0]);
+    hash_table.append_chunk(build_chunk, build_key_columns);
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+
+    // the build rows are renumbered in bucket order, so every partition occupies a contiguous range of rows.
+    ASSERT_TRUE(hash_table.is_partitioned());
+    auto* table_items = hash_table.table_items();
+    ASSERT_EQ(table_items->build_chunk->num_rows(), 11);
+    ASSERT_EQ(table_items->num_partitions << table_items->partition_shift, table_items->bucket_size);
+    uint32_t expected_index = 1;
+    for (uint32_t bucket = 0; bucket < table_items->bucket_size; bucket++) {
+        for (uint32_t i = table_items->first[bucket]; i != 0; i = table_items->next[i]) {
+            ASSERT_EQ(i, expected_index++);
+        }
+    }
+
+    // the probe rows go to the partitions of their buckets.
+    Buffer<uint32_t> partitions;
+    hash_table.probe_partitions(_runtime_state.get(), probe_key_columns, probe_chunk->num_rows(), &partitions);
+    ASSERT_EQ(partitions.size(), 5);
+    auto* probe_keys = ColumnHelper::as_raw_column<NullableColumn>(probe_key_columns[0]);
+    const auto& probe_data = ColumnHelper::as_raw_column<Int32Column>(probe_keys->data_column())->get_data();
+    for (size_t i = 0; i < partitions.size(); i++) {
+        uint32_t bucket = JoinHashMapHelper::calc_bucket_num<int32_t>(probe_data[i], table_items->bucket_size);
+        ASSERT_EQ(partitions[i], bucket >> table_items->partition_shift);
+    }
+
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+
+    ColumnPtr column1 = result_chunk->get_column_by_slot_id(0);
+    check_int32_nullable_column(*column1, 5, 1);
+    ColumnPtr column2 = result_chunk->get_column_by_slot_id(1);
+    check_int32_nullable_column(*column2, 5, 11);
+    ColumnPtr column3 = result_chunk->get_column_by_slot_id(2);
+    check_int32_nullable_column(*column3, 5, 21);
+    ColumnPtr column4 = result_chunk->get_column_by_slot_id(3);
+    check_int32_nullable_column(*column4, 5, 1);
+    ColumnPtr column5 = result_chunk->get_column_by_slot_id(4);
+    check_int32_nullable_column(*column5, 5, 11);
+    ColumnPtr column6 = result_chunk->get_column_by_slot_id(5);
+    check_int32_nullable_column(*column6, 5, 21);
+
+    hash_table.close();
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, SerializeJoinHashTablePartitioned) {
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_VARCHAR, false);
+
+    auto probe_row_desc = create_probe_desc(&row_desc_builder);
+    auto build_row_desc = create_build_desc(&row_desc_builder);
+
+    HashTableParam param = create_table_param(TJoinOp::INNER_JOIN, 6);
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.join_keys.emplace_back(JoinKeyDesc{&_varchar_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+    hash_table.set_partition_cache_bytes(1);
+
+    auto build_chunk = create_binary_build_chunk(10, false);
+    auto probe_chunk = create_binary_probe_chunk(5, 1, false);
+    Columns probe_key_columns;
+    probe_key_columns.emplace_back(probe_chunk->columns()[0]);
+    probe_key_columns.emplace_back(probe_chunk->columns()[1]);
+
+    Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+    hash_table.append_chunk(build_chunk, build_key_columns);
+    ASSERT_OK(hash_table.build(_runtime_state.get()));
+    ASSERT_TRUE(hash_table.is_partitioned());
+
+    Buffer<uint32_t> partitions;
+    hash_table.probe_partitions(_runtime_state.get(), probe_key_columns, probe_chunk->num_rows(), &partitions);
+    ASSERT_EQ(partitions.size(), 5);
+    for (uint32_t partition : partitions) {
+        ASSERT_LT(partition, hash_table.get_num_partitions());
+    }
+
+    ChunkPtr result_chunk = std::make_shared<Chunk>();
+    bool eos = false;
+
+    ASSERT_OK(hash_table.probe(_runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos));
+
+    ASSERT_EQ(result_chunk->num_columns(), 6);
+
+    ColumnPtr column1 = result_chunk->get_column_by_slot_id(0);
+    check_binary_column(column1, 5, 1);
+    ColumnPtr column2 = result_chunk->get_column_by_slot_id(1);
+    check_binary_column(column2, 5, 11);
+    ColumnPtr column3 = result_chunk->get_column_by_slot_id(2);
+    check_binary_column(column3, 5, 21);
+    ColumnPtr column4 = result_chunk->get_column_by_slot_id(3);
+    check_binary_column(column4, 5, 1);
+    ColumnPtr column5 = result_chunk->get_column_by_slot_id(4);
+    check_binary_column(column5, 5, 11);
+    ColumnPtr column6 = result_chunk->get_column_by_slot_id(5);
+    check_binary_column(column6, 5, 21);
+
+    hash_table.close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, FixedSizeJoinBuildFuncForNotNullableColumn) {
     JoinHashTableItems table_items;
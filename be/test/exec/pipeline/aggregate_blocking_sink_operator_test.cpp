@@ -0,0 +1,166 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/aggregate/aggregate_blocking_sink_operator.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/query_context.h"
+#include "runtime/descriptors.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+
+namespace starrocks::pipeline {
+
+class AggregateBlockingSinkOperatorTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = CHUNK_SIZE;
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), query_options, TQueryGlobals(), nullptr));
+        _query_ctx.init_mem_tracker(-1, GlobalEnv::GetInstance()->process_mem_tracker());
+        _runtime_state->set_query_ctx(&_query_ctx);
+
+        // input slots, intermediate slots and result slots of `select k, count(k) group by k`.
+        std::vector<std::vector<SlotTypeInfo>> slot_infos{
+                {{"k", TYPE_BIGINT, false}},
+                {{"k", TYPE_BIGINT, false}, {"count_k", TYPE_BIGINT, false}},
+                {{"k", TYPE_BIGINT, false}, {"count_k", TYPE_BIGINT, false}},
+        };
+        auto* tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool,
+                                                     DescTblHelper::create_slot_type_desc_info_arrays(slot_infos));
+        _runtime_state->set_desc_tbl(tbl);
+
+        auto type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+        auto slot_ref = ExprsTestHelper::create_slot_expr_node(0, 0, type, false);
+        _tnode.node_id = 1;
+        _tnode.node_type = TPlanNodeType::AGGREGATION_NODE;
+        _tnode.limit = -1;
+        _tnode.agg_node.grouping_exprs = {ExprsTestHelper::create_slot_expr(slot_ref)};
+        auto count_fn = ExprsTestHelper::create_builtin_function("count", {type}, type, type);
+        _tnode.agg_node.aggregate_functions = {ExprsTestHelper::create_aggregate_expr(count_fn, {slot_ref})};
+        _tnode.agg_node.intermediate_tuple_id = 1;
+        _tnode.agg_node.output_tuple_id = 2;
+        _tnode.agg_node.need_finalize = true;
+        _tnode.agg_node.streaming_preaggregation_mode = TStreamingPreaggregationMode::AUTO;
+
+        _aggregator_factory = std::make_shared<AggregatorFactory>(_tnode);
+        _aggregator_factory->set_enable_shared_hash_table(true);
+        _sink_factory = std::make_unique<AggregateBlockingSinkOperatorFactory>(0, _tnode.node_id, _aggregator_factory,
+                                                                               nullptr);
+        ASSERT_OK(_sink_factory->prepare(_runtime_state));
+        for (int32_t i = 0; i < DOP; ++i) {
+            _sinks.emplace_back(_sink_factory->create(DOP, i));
+            ASSERT_OK(_sinks.back()->prepare(_runtime_state));
+        }
+    }
+
+    void TearDown() override {
+        for (auto& sink : _sinks) {
+            sink->close(_runtime_state);
+        }
+        _sink_factory->close(_runtime_state);
+    }
+
+protected:
+    static constexpr int32_t CHUNK_SIZE = 16;
+    static constexpr int32_t DOP = 2;
+
+    // The keys are 0, 1, ..., CHUNK_SIZE - 1.
+    ChunkPtr _make_chunk() {
+        auto column = Int64Column::create();
+        for (int64_t k = 0; k < CHUNK_SIZE; ++k) {
+            column->append(k);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    }
+
+    ObjectPool _obj_pool;
+    RuntimeState* _runtime_state = nullptr;
+    QueryContext _query_ctx;
+    TPlanNode _tnode;
+    AggregatorFactoryPtr _aggregator_factory;
+    std::unique_ptr<AggregateBlockingSinkOperatorFactory> _sink_factory;
+    std::vector<OperatorPtr> _sinks;
+};
+
+TEST_F(AggregateBlockingSinkOperatorTest, test_shared_hash_table) {
+    auto busy_aggregator = _aggregator_factory->get_or_create(1);
+    size_t num_pushed_rows = 0;
+    {
+        // The hash table of driver 1 is held by someone else, the rows of it are left pending instead of waiting.
+        std::lock_guard<std::mutex> l(busy_aggregator->shared_sink_mutex());
+        ASSERT_OK(_sinks[0]->push_chunk(_runtime_state, _make_chunk()));
+        num_pushed_rows += CHUNK_SIZE;
+        ASSERT_GT(busy_aggregator->num_pending_shared_rows(), 0);
+        ASSERT_EQ(0, busy_aggregator->num_input_rows());
+        ASSERT_TRUE(_sinks[0]->need_input());
+
+        // Stop pulling the input when there are too many pending rows.
+        while (_sinks[0]->need_input()) {
+            ASSERT_OK(_sinks[0]->push_chunk(_runtime_state, _make_chunk()));
+            num_pushed_rows += CHUNK_SIZE;
+            ASSERT_LE(num_pushed_rows, 100 * CHUNK_SIZE);
+        }
+        ASSERT_FALSE(_sinks[1]->need_input());
+    }
+
+    // The next driver locking the hash table aggregates the pending rows.
+    ASSERT_OK(_sinks[1]->push_chunk(_runtime_state, _make_chunk()));
+    num_pushed_rows += CHUNK_SIZE;
+    ASSERT_EQ(0, busy_aggregator->num_pending_shared_rows());
+    ASSERT_TRUE(_sinks[0]->need_input());
+    ASSERT_TRUE(_sinks[1]->need_input());
+
+    // Only the last finished driver completes the hash tables.
+    ASSERT_OK(_sinks[0]->set_finishing(_runtime_state));
+    ASSERT_FALSE(busy_aggregator->is_sink_complete());
+    ASSERT_OK(_sinks[1]->set_finishing(_runtime_state));
+
+    // Each key is in exactly one hash table.
+    size_t num_input_rows = 0;
+    size_t num_keys = 0;
+    for (int32_t i = 0; i < DOP; ++i) {
+        auto aggregator = _aggregator_factory->get_or_create(i);
+        ASSERT_TRUE(aggregator->is_sink_complete());
+        ASSERT_EQ(0, aggregator->num_pending_shared_rows());
+        num_input_rows += aggregator->num_input_rows();
+        num_keys += aggregator->hash_map_variant().size();
+    }
+    ASSERT_EQ(num_pushed_rows, num_input_rows);
+    ASSERT_EQ(CHUNK_SIZE, num_keys);
+}
+
+TEST_F(AggregateBlockingSinkOperatorTest, test_pending_rows_aggregated_at_finishing) {
+    auto busy_aggregator = _aggregator_factory->get_or_create(1);
+    {
+        std::lock_guard<std::mutex> l(busy_aggregator->shared_sink_mutex());
+        ASSERT_OK(_sinks[0]->push_chunk(_runtime_state, _make_chunk()));
+    }
+    ASSERT_GT(busy_aggregator->num_pending_shared_rows(), 0);
+
+    ASSERT_OK(_sinks[0]->set_finishing(_runtime_state));
+    ASSERT_OK(_sinks[1]->set_finishing(_runtime_state));
+    ASSERT_EQ(0, busy_aggregator->num_pending_shared_rows());
+    ASSERT_EQ(CHUNK_SIZE, _aggregator_factory->get_or_create(0)->num_input_rows() + busy_aggregator->num_input_rows());
+}
+
+} // namespace starrocks::pipeline
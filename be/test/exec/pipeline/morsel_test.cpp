@@ -0,0 +1,162 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/morsel.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks::pipeline {
+
+class PhysicalSplitMorselQueueTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _factor = config::tablet_internal_parallel_adaptive_split_factor;
+        _min_rows = config::tablet_internal_parallel_min_splitted_scan_rows;
+        config::tablet_internal_parallel_adaptive_split_factor = 2;
+        config::tablet_internal_parallel_min_splitted_scan_rows = 100;
+    }
+
+    void TearDown() override {
+        config::tablet_internal_parallel_adaptive_split_factor = _factor;
+        config::tablet_internal_parallel_min_splitted_scan_rows = _min_rows;
+    }
+
+protected:
+    static int64_t next_rows(int64_t num_rest_rows, int64_t dop, int64_t splitted_scan_rows,
+                             double driver_speed_ratio = 1) {
+        return static_cast<int64_t>(PhysicalSplitMorselQueue::next_splitted_scan_cost(
+                num_rest_rows, dop, splitted_scan_rows, driver_speed_ratio));
+    }
+
+private:
+    int64_t _factor = 0;
+    int64_t _min_rows = 0;
+};
+
+TEST_F(PhysicalSplitMorselQueueTest, test_next_splitted_scan_rows) {
+    // rest_rows / (factor * dop), bounded by [min_splitted_scan_rows, splitted_scan_rows].
+    ASSERT_EQ(1000, next_rows(1'000'000, 4, 1000));
+    ASSERT_EQ(1000, next_rows(8000, 4, 1000));
+    ASSERT_EQ(500, next_rows(4000, 4, 1000));
+    ASSERT_EQ(125, next_rows(1000, 4, 1000));
+    ASSERT_EQ(100, next_rows(500, 4, 1000));
+    ASSERT_EQ(100, next_rows(0, 4, 1000));
+    // The rest rows are estimated, and may be negative after the key ranges are pruned.
+    ASSERT_EQ(100, next_rows(-10, 4, 1000));
+    ASSERT_EQ(500, next_rows(1000, 0, 1000));
+}
+
+TEST_F(PhysicalSplitMorselQueueTest, test_next_splitted_scan_rows_bounds) {
+    // The lower bound never exceeds splitted_scan_rows.
+    ASSERT_EQ(50, next_rows(0, 4, 50));
+    ASSERT_EQ(50, next_rows(1'000'000, 4, 50));
+
+    // The adaptive split is disabled.
+    config::tablet_internal_parallel_adaptive_split_factor = 0;
+    ASSERT_EQ(1000, next_rows(0, 4, 1000));
+    ASSERT_EQ(1000, next_rows(1'000'000, 4, 1000));
+    config::tablet_internal_parallel_adaptive_split_factor = -1;
+    ASSERT_EQ(1000, next_rows(10, 4, 1000));
+
+    // A larger factor shrinks the morsels earlier.
+    config::tablet_internal_parallel_adaptive_split_factor = 8;
+    ASSERT_EQ(250, next_rows(8000, 4, 1000));
+}
+
+TEST_F(PhysicalSplitMorselQueueTest, test_splitted_scan_rows_progression) {
+    const int64_t splitted_scan_rows = 1000;
+    const int64_t dop = 4;
+    int64_t num_rest_rows = 100'000;
+    int64_t prev_rows = splitted_scan_rows;
+    size_t num_morsels = 0;
+    size_t num_shrunk_morsels = 0;
+    while (num_rest_rows > 0) {
+        int64_t rows = next_rows(num_rest_rows, dop, splitted_scan_rows);
+        // The morsels never grow as the scan drains, and stay in the bounds.
+        ASSERT_LE(rows, prev_rows);
+        ASSERT_GE(rows, config::tablet_internal_parallel_min_splitted_scan_rows);
+        ASSERT_LE(rows, splitted_scan_rows);
+        num_shrunk_morsels += rows < splitted_scan_rows;
+        prev_rows = rows;
+        num_rest_rows -= rows;
+        num_morsels++;
+    }
+    ASSERT_EQ(config::tablet_internal_parallel_min_splitted_scan_rows, prev_rows);
+    ASSERT_GT(num_shrunk_morsels, 0);
+    // Most rows are still taken by the full-sized morsels.
+    ASSERT_LT(num_morsels, 100'000 / splitted_scan_rows * 2);
+}
+
+TEST_F(PhysicalSplitMorselQueueTest, test_next_splitted_scan_cost_by_driver_speed) {
+    // A slow driver picks up a proportionally smaller morsel, no less than min_splitted_scan_rows.
+    ASSERT_EQ(1000, next_rows(1'000'000, 4, 1000, 1));
+    ASSERT_EQ(500, next_rows(1'000'000, 4, 1000, 0.5));
+    ASSERT_EQ(100, next_rows(1'000'000, 4, 1000, 0.01));
+    ASSERT_EQ(100, next_rows(1'000'000, 4, 1000, 0));
+    ASSERT_EQ(250, next_rows(4000, 4, 1000, 0.5));
+    // A fast driver doesn't pick up more than splitted_scan_rows.
+    ASSERT_EQ(1000, next_rows(1'000'000, 4, 1000, 4));
+    ASSERT_EQ(500, next_rows(4000, 4, 1000, 4));
+
+    config::tablet_internal_parallel_adaptive_split_factor = 0;
+    ASSERT_EQ(1000, next_rows(1'000'000, 4, 1000, 0.5));
+}
+
+TEST_F(PhysicalSplitMorselQueueTest, test_scan_cost_pieces) {
+    using Queue = PhysicalSplitMorselQueue;
+    constexpr double kFilteredCost = Queue::kZoneMapFilteredRowCost;
+
+    // Scan [0, 100) and [200, 300), where the zone maps hit [50, 250).
+    SparseRange<> scan_range;
+    scan_range.add(Range<>(0, 100));
+    scan_range.add(Range<>(200, 300));
+    auto pieces = Queue::build_scan_cost_pieces(scan_range, SparseRange<>(50, 250));
+    ASSERT_EQ(4, pieces.size());
+    ASSERT_EQ(50, pieces[0].first);
+    ASSERT_DOUBLE_EQ(50 * kFilteredCost, pieces[0].second);
+    ASSERT_EQ(100, pieces[1].first);
+    ASSERT_DOUBLE_EQ(50 * kFilteredCost + 50, pieces[1].second);
+    ASSERT_EQ(150, pieces[2].first);
+    ASSERT_DOUBLE_EQ(50 * kFilteredCost + 100, pieces[2].second);
+    ASSERT_EQ(200, pieces[3].first);
+    ASSERT_DOUBLE_EQ(100 * kFilteredCost + 100, pieces[3].second);
+
+    ASSERT_DOUBLE_EQ(0, Queue::scan_cost_of_rows(pieces, 0));
+    ASSERT_DOUBLE_EQ(10 * kFilteredCost, Queue::scan_cost_of_rows(pieces, 10));
+    ASSERT_DOUBLE_EQ(50 * kFilteredCost + 30, Queue::scan_cost_of_rows(pieces, 80));
+    ASSERT_DOUBLE_EQ(100 * kFilteredCost + 100, Queue::scan_cost_of_rows(pieces, 200));
+    ASSERT_DOUBLE_EQ(100 * kFilteredCost + 100, Queue::scan_cost_of_rows(pieces, 1000));
+
+    // The rows of a cost cover many more filtered rows than hit ones.
+    ASSERT_EQ(0, Queue::scan_rows_of_cost(pieces, 0));
+    ASSERT_EQ(16, Queue::scan_rows_of_cost(pieces, 1));
+    ASSERT_EQ(80, Queue::scan_rows_of_cost(pieces, 50 * kFilteredCost + 30));
+    ASSERT_EQ(200, Queue::scan_rows_of_cost(pieces, 1000));
+    for (size_t rows = 0; rows <= 200; rows++) {
+        ASSERT_EQ(rows, Queue::scan_rows_of_cost(pieces, Queue::scan_cost_of_rows(pieces, rows)));
+    }
+
+    // Without the zone maps, a row costs 1.
+    pieces = Queue::build_scan_cost_pieces(scan_range, SparseRange<>(0, 300));
+    ASSERT_DOUBLE_EQ(200, Queue::scan_cost_of_rows(pieces, 200));
+    ASSERT_EQ(120, Queue::scan_rows_of_cost(pieces, 120));
+
+    ASSERT_TRUE(Queue::build_scan_cost_pieces(SparseRange<>(), SparseRange<>(0, 300)).empty());
+    ASSERT_DOUBLE_EQ(0, Queue::scan_cost_of_rows({}, 10));
+    ASSERT_EQ(0, Queue::scan_rows_of_cost({}, 10));
+}
+
+} // namespace starrocks::pipeline
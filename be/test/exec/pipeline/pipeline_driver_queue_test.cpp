@@ -130,6 +130,46 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_cancel) {
     }
 }
 
+PARALLEL_TEST(QuerySharedDriverQueueTest, test_numa_node) {
+    QuerySharedDriverQueue queue;
+
+    // prepare drivers
+    QueryContext query_context;
+    std::vector<std::shared_ptr<PipelineDriver>> drivers;
+    for (int numa_node : {0, 1, 0, 1, 0}) {
+        auto driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+        _set_driver_level(driver.get(), 1);
+        driver->set_numa_node(numa_node);
+        drivers.emplace_back(std::move(driver));
+    }
+    for (auto& driver : drivers) {
+        queue.put_back(driver.get());
+    }
+    ASSERT_TRUE(queue.has_driver_of_numa_node(1));
+    ASSERT_FALSE(queue.has_driver_of_numa_node(2));
+
+    // The drivers of node 1 first, then steal the drivers of node 0.
+    std::vector<DriverRawPtr> out_drivers = {drivers[1].get(), drivers[3].get(), drivers[0].get(), drivers[2].get(),
+                                             drivers[4].get()};
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(false, 1);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_FALSE(queue.has_driver_of_numa_node(0));
+
+    // Without numa node, take the drivers of the node with the most drivers.
+    for (auto& driver : drivers) {
+        queue.put_back(driver.get());
+    }
+    for (int numa_node : {0, 0, 1, 0, 1}) {
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(numa_node, maybe_driver.value()->numa_node());
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
 PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_block) {
     QuerySharedDriverQueue queue;
 
@@ -269,6 +309,52 @@ TEST_F(WorkGroupDriverQueueTest, test_basic) {
     }
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_numa_node) {
+    QueryContext query_ctx;
+    WorkGroupDriverQueue queue;
+    auto* sched_entity3 = _wg3->driver_sched_entity();
+    auto* sched_entity4 = _wg4->driver_sched_entity();
+
+    auto local_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(local_driver.get(), 1);
+    local_driver->set_numa_node(1);
+    local_driver->set_workgroup(_wg3);
+    auto remote_driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(remote_driver.get(), 1);
+    remote_driver->set_numa_node(0);
+    remote_driver->set_workgroup(_wg4);
+
+    // The vruntime of _wg3 is far beyond the minimum one, so its local driver isn't preferred.
+    local_driver->driver_acct().update_last_time_spent(
+            std::max<int64_t>(sched_entity4->vruntime_ns() - sched_entity3->vruntime_ns(), 0) + 100'000'000L);
+    remote_driver->driver_acct().update_last_time_spent(0);
+    for (auto* driver : {remote_driver.get(), local_driver.get()}) {
+        queue.update_statistics(driver);
+        queue.put_back(driver);
+    }
+    ASSERT_GT(sched_entity3->vruntime_ns(), sched_entity4->vruntime_ns());
+    for (auto* out_driver : {remote_driver.get(), local_driver.get()}) {
+        auto maybe_driver = queue.take(true, 1);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+
+    // The vruntime of _wg3 is close to the minimum one, so its local driver is preferred.
+    local_driver->driver_acct().update_last_time_spent(0);
+    remote_driver->driver_acct().update_last_time_spent(sched_entity3->vruntime_ns() - sched_entity4->vruntime_ns() -
+                                                        1'000'000L);
+    for (auto* driver : {remote_driver.get(), local_driver.get()}) {
+        queue.update_statistics(driver);
+        queue.put_back(driver);
+    }
+    ASSERT_GT(sched_entity3->vruntime_ns(), sched_entity4->vruntime_ns());
+    for (auto* out_driver : {local_driver.get(), remote_driver.get()}) {
+        auto maybe_driver = queue.take(true, 1);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+}
+
 TEST_F(WorkGroupDriverQueueTest, test_take_block) {
     QueryContext query_ctx;
     WorkGroupDriverQueue queue;
@@ -0,0 +1,271 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/scan/shared_scan.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "column/schema.h"
+#include "storage/chunk_helper.h"
+
+namespace starrocks::pipeline {
+
+// Output the numbers [0, num_rows), 10 numbers every time.
+class SequenceIterator final : public ChunkIterator {
+public:
+    explicit SequenceIterator(int32_t num_rows) : ChunkIterator(schema()), _num_rows(num_rows) {}
+
+    Status do_get_next(Chunk* chunk) override {
+        if (_next >= _num_rows) {
+            return Status::EndOfFile("eof");
+        }
+        auto* column = down_cast<FixedLengthColumn<int32_t>*>(chunk->get_column_by_index(0).get());
+        for (int32_t end = std::min(_next + 10, _num_rows); _next < end; _next++) {
+            column->append(_next);
+        }
+        _num_reads++;
+        return Status::OK();
+    }
+
+    void close() override {}
+
+    int num_reads() const { return _num_reads; }
+
+    static Schema schema() {
+        FieldPtr f = std::make_shared<Field>(0, "c1", get_type_info(TYPE_INT), false);
+        return Schema(std::vector<FieldPtr>{f});
+    }
+
+private:
+    const int32_t _num_rows;
+    int32_t _next = 0;
+    int _num_reads = 0;
+};
+
+class SharedScanTest : public testing::Test {
+protected:
+    // Read a chunk, return false on the end of the scan.
+    static bool read_chunk(SharedScanReader* reader, std::vector<int32_t>* values) {
+        ChunkPtr chunk = ChunkHelper::new_chunk(SequenceIterator::schema(), 10);
+        Status st;
+        // The reader yields with TimedOut when it's waiting for the others.
+        while ((st = reader->get_next(chunk.get())).is_time_out()) {
+            std::this_thread::yield();
+        }
+        if (st.is_end_of_file()) {
+            return false;
+        }
+        EXPECT_TRUE(st.ok()) << st;
+        auto* column = down_cast<FixedLengthColumn<int32_t>*>(chunk->get_column_by_index(0).get());
+        values->insert(values->end(), column->get_data().begin(), column->get_data().end());
+        return true;
+    }
+
+    static std::vector<int32_t> read_all(SharedScanReader* reader, std::vector<int32_t> values = {}) {
+        while (read_chunk(reader, &values)) {
+        }
+        return values;
+    }
+
+    static std::vector<int32_t> sequence(int32_t begin, int32_t end) {
+        std::vector<int32_t> values(end - begin);
+        std::iota(values.begin(), values.end(), begin);
+        return values;
+    }
+
+    SharedScanManager _manager;
+    std::shared_ptr<SequenceIterator> _iter1 = std::make_shared<SequenceIterator>(100);
+    std::shared_ptr<SequenceIterator> _iter2 = std::make_shared<SequenceIterator>(100);
+};
+
+TEST_F(SharedScanTest, test_share_from_start) {
+    auto owner = _manager.attach("key", _iter1, 10, 32, 0);
+    auto follower = _manager.attach("key", _iter2, 10, 32, 0);
+    ASSERT_TRUE(owner->is_owner());
+    ASSERT_FALSE(follower->is_owner());
+    ASSERT_EQ(1, _manager.num_cursors());
+
+    std::vector<int32_t> owner_values;
+    std::vector<int32_t> follower_values;
+    bool owner_eof = false;
+    bool follower_eof = false;
+    while (!owner_eof || !follower_eof) {
+        owner_eof = owner_eof || !read_chunk(owner.get(), &owner_values);
+        follower_eof = follower_eof || !read_chunk(follower.get(), &follower_values);
+    }
+    ASSERT_EQ(sequence(0, 100), owner_values);
+    ASSERT_EQ(sequence(0, 100), follower_values);
+    ASSERT_EQ(100, follower->num_shared_rows());
+    // The rows are only read once.
+    ASSERT_EQ(10, _iter1->num_reads());
+    ASSERT_EQ(0, _iter2->num_reads());
+
+    owner.reset();
+    follower.reset();
+    ASSERT_EQ(0, _manager.num_cursors());
+}
+
+TEST_F(SharedScanTest, test_attach_late) {
+    auto owner = _manager.attach("key", _iter1, 10, 32, 0);
+    std::vector<int32_t> owner_values;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    }
+
+    // The follower starts from the 30th row, and reads the first 30 rows by itself at last.
+    auto follower = _manager.attach("key", _iter2, 10, 32, 0);
+    ASSERT_FALSE(follower->is_owner());
+    std::vector<int32_t> follower_values;
+    bool owner_eof = false;
+    bool follower_eof = false;
+    while (!owner_eof || !follower_eof) {
+        owner_eof = owner_eof || !read_chunk(owner.get(), &owner_values);
+        follower_eof = follower_eof || !read_chunk(follower.get(), &follower_values);
+    }
+    std::vector<int32_t> expected = sequence(30, 100);
+    auto prefix = sequence(0, 30);
+    expected.insert(expected.end(), prefix.begin(), prefix.end());
+    ASSERT_EQ(expected, follower_values);
+    ASSERT_EQ(70, follower->num_shared_rows());
+    ASSERT_EQ(3, _iter2->num_reads());
+
+    ASSERT_EQ(sequence(0, 100), owner_values);
+    ASSERT_EQ(10, _iter1->num_reads());
+
+    // A finished scan can't be attached.
+    auto iter3 = std::make_shared<SequenceIterator>(100);
+    auto reader = _manager.attach("key", iter3, 10, 32, 0);
+    ASSERT_TRUE(reader->is_owner());
+}
+
+TEST_F(SharedScanTest, test_detach_slow_consumer) {
+    auto owner = _manager.attach("key", _iter1, 10, 2, 0);
+    auto follower = _manager.attach("key", _iter2, 10, 2, 0);
+
+    std::vector<int32_t> owner_values;
+    std::vector<int32_t> follower_values;
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    ASSERT_TRUE(read_chunk(follower.get(), &follower_values));
+    // The follower falls behind by 2 chunks, and is detached when the owner reads the 4th chunk.
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    }
+
+    ASSERT_EQ(sequence(0, 100), read_all(follower.get(), follower_values));
+    ASSERT_EQ(10, follower->num_shared_rows());
+    ASSERT_EQ(sequence(0, 100), read_all(owner.get(), owner_values));
+    ASSERT_EQ(10, _iter1->num_reads());
+    ASSERT_EQ(10, _iter2->num_reads());
+}
+
+TEST_F(SharedScanTest, test_owner_finished_early) {
+    auto owner = _manager.attach("key", _iter1, 10, 32, 0);
+    auto follower = _manager.attach("key", _iter2, 10, 32, 0);
+
+    std::vector<int32_t> owner_values;
+    std::vector<int32_t> follower_values;
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    ASSERT_TRUE(read_chunk(follower.get(), &follower_values));
+    owner->close();
+
+    // The follower consumes the buffered chunk, then reads the rest rows by itself.
+    ASSERT_EQ(sequence(0, 100), read_all(follower.get(), follower_values));
+    ASSERT_EQ(20, follower->num_shared_rows());
+}
+
+TEST_F(SharedScanTest, test_different_keys) {
+    auto reader1 = _manager.attach("key1", _iter1, 10, 32, 0);
+    auto reader2 = _manager.attach("key2", _iter2, 10, 32, 0);
+    ASSERT_TRUE(reader1->is_owner());
+    ASSERT_TRUE(reader2->is_owner());
+    ASSERT_EQ(2, _manager.num_cursors());
+
+    // The reader is detached from the cursor at the end of the scan.
+    ASSERT_EQ(sequence(0, 100), read_all(reader1.get()));
+    ASSERT_EQ(1, _manager.num_cursors());
+    ASSERT_EQ(sequence(0, 100), read_all(reader2.get()));
+    ASSERT_EQ(0, _manager.num_cursors());
+}
+
+TEST_F(SharedScanTest, test_detach_from_slow_owner) {
+    auto owner = _manager.attach("key", _iter1, 10, 32, 0);
+    auto follower = _manager.attach("key", _iter2, 10, 32, 0);
+
+    std::vector<int32_t> owner_values;
+    std::vector<int32_t> follower_values;
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    ASSERT_TRUE(read_chunk(follower.get(), &follower_values));
+    // The follower never reads from the iterator of the owner, it's detached after waiting for the owner.
+    ASSERT_EQ(sequence(0, 100), read_all(follower.get(), follower_values));
+    ASSERT_EQ(10, follower->num_shared_rows());
+    ASSERT_EQ(1, _iter1->num_reads());
+    ASSERT_EQ(10, _iter2->num_reads());
+
+    ASSERT_EQ(sequence(0, 100), read_all(owner.get(), owner_values));
+    ASSERT_EQ(10, _iter1->num_reads());
+}
+
+TEST_F(SharedScanTest, test_yield_when_waiting) {
+    auto owner = _manager.attach("key", _iter1, 10, 1, 3600 * 1000);
+    auto follower = _manager.attach("key", _iter2, 10, 1, 3600 * 1000);
+
+    std::vector<int32_t> owner_values;
+    std::vector<int32_t> follower_values;
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    // The buffer is full, the owner returns at once to wait for the follower.
+    ChunkPtr chunk = ChunkHelper::new_chunk(SequenceIterator::schema(), 10);
+    ASSERT_TRUE(owner->get_next(chunk.get()).is_time_out());
+    ASSERT_EQ(0, chunk->num_rows());
+
+    ASSERT_TRUE(read_chunk(follower.get(), &follower_values));
+    // The follower has consumed the buffer, it returns at once to wait for the owner.
+    ASSERT_TRUE(follower->get_next(chunk.get()).is_time_out());
+    ASSERT_EQ(0, chunk->num_rows());
+
+    ASSERT_TRUE(read_chunk(owner.get(), &owner_values));
+    ASSERT_TRUE(read_chunk(follower.get(), &follower_values));
+    ASSERT_EQ(sequence(0, 20), owner_values);
+    ASSERT_EQ(sequence(0, 20), follower_values);
+    ASSERT_EQ(2, _iter1->num_reads());
+    ASSERT_EQ(0, _iter2->num_reads());
+}
+
+TEST_F(SharedScanTest, test_wait_each_other) {
+    // The owner waits for the follower when the buffer is full, and the follower waits for the owner when it has
+    // consumed all the buffered chunks.
+    auto owner = _manager.attach("key", _iter1, 10, 2, 3600 * 1000);
+    auto follower = _manager.attach("key", _iter2, 10, 2, 3600 * 1000);
+
+    std::vector<int32_t> owner_values;
+    std::thread owner_thread([&] { owner_values = read_all(owner.get()); });
+    auto follower_values = read_all(follower.get());
+    owner_thread.join();
+
+    ASSERT_EQ(sequence(0, 100), owner_values);
+    ASSERT_EQ(sequence(0, 100), follower_values);
+    ASSERT_EQ(100, follower->num_shared_rows());
+    ASSERT_EQ(10, _iter1->num_reads());
+    ASSERT_EQ(0, _iter2->num_reads());
+}
+
+} // namespace starrocks::pipeline
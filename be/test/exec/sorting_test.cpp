@@ -22,6 +22,7 @@
 
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/const_column.h"
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/merge_path.h"
@@ -247,6 +248,88 @@ TEST(SortingTest, materialize_by_permutation_int) {
     ASSERT_EQ(2048, merged->get(1).get_int32());
 }
 
+TEST(SortingTest, sort_by_normalized_keys) {
+    std::mt19937 rng(0);
+    const std::vector<std::string> strings{"", "a", "ab", std::string("ab\0", 3), "star", "rocks_normalized_1",
+                                           "rocks_normalized_2", "rocks_normali"};
+    const std::vector<double> doubles{-1.5, 0.0, -0.0, 2.5, -1e300, 1e300};
+    auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c1 = DoubleColumn::create();
+    auto c2 = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    for (int i = 0; i < 10000; i++) {
+        if (rng() % 10 == 0) {
+            c0->append_nulls(1);
+        } else {
+            c0->append_datum(Datum(static_cast<int32_t>(rng() % 7) - 3));
+        }
+        c1->append(doubles[rng() % doubles.size()]);
+        if (rng() % 10 == 0) {
+            c2->append_nulls(1);
+        } else {
+            c2->append_datum(Datum(Slice(strings[rng() % strings.size()])));
+        }
+    }
+    Columns columns{c0, c1, c2};
+
+    std::atomic<bool> cancel{false};
+    for (auto [orders, null_firsts] : std::vector<std::pair<std::vector<bool>, std::vector<bool>>>{
+                 {{true, true, true}, {true, true, true}},
+                 {{true, false, true}, {false, false, false}},
+                 {{false, true, false}, {true, false, true}}}) {
+        SortDescs sort_desc(orders, null_firsts);
+        Permutation perm;
+        ASSERT_OK(sort_by_normalized_keys(cancel, columns, sort_desc, &perm));
+        ASSERT_EQ(columns[0]->size(), perm.size());
+        for (size_t i = 1; i < perm.size(); i++) {
+            ASSERT_LE(compare_chunk_row(sort_desc, columns, columns, perm[i - 1].index_in_chunk,
+                                        perm[i].index_in_chunk),
+                      0);
+        }
+        std::vector<uint32_t> rows;
+        for (auto& item : perm) {
+            rows.push_back(item.index_in_chunk);
+        }
+        std::sort(rows.begin(), rows.end());
+        for (size_t i = 0; i < rows.size(); i++) {
+            ASSERT_EQ(i, rows[i]);
+        }
+    }
+
+    // Not supported column falls back to the column-wise sort.
+    Columns const_columns{ConstColumn::create(Int32Column::create(1, 1), 10)};
+    Permutation perm;
+    ASSERT_TRUE(sort_by_normalized_keys(cancel, const_columns, SortDescs::asc_null_first(1), &perm).is_not_supported());
+}
+
+TEST(SortingTest, sort_by_normalized_keys_truncated_string_first) {
+    // The strings tie on the prefix of the normalized key, but differ afterwards, while the second column
+    // is in the reverse order.
+    const std::vector<std::string> strings{"rocks_normalized_3", "rocks_normalized_2", "rocks_normalized_1",
+                                           "rocks_normali", "rocks"};
+    auto c0 = BinaryColumn::create();
+    auto c1 = Int32Column::create();
+    for (int i = 0; i < 100; i++) {
+        c0->append(strings[i % strings.size()]);
+        c1->append(100 - i);
+    }
+    Columns columns{c0, c1};
+
+    std::atomic<bool> cancel{false};
+    for (bool asc : {true, false}) {
+        SortDescs sort_desc(std::vector<bool>{asc, asc}, std::vector<bool>{true, true});
+        Permutation perm;
+        ASSERT_OK(sort_by_normalized_keys(cancel, columns, sort_desc, &perm));
+        ASSERT_EQ(columns[0]->size(), perm.size());
+        for (size_t i = 1; i < perm.size(); i++) {
+            ASSERT_LE(compare_chunk_row(sort_desc, columns, columns, perm[i - 1].index_in_chunk,
+                                        perm[i].index_in_chunk),
+                      0);
+        }
+        std::string first = asc ? "rocks" : "rocks_normalized_3";
+        ASSERT_EQ(Slice(first), c0->get_slice(perm[0].index_in_chunk));
+    }
+}
+
 TEST(SortingTest, steal_chunk) {
     ColumnPtr col1 = build_sorted_column(TypeDescriptor(TYPE_INT), 0, 100, 1);
     ColumnPtr col2 = build_sorted_column(TypeDescriptor(TYPE_INT), 0, 100, 1);
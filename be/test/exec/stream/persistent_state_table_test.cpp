@@ -0,0 +1,318 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/persistent_state_table.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/stream/stream_test.h"
+#include "fs/fs_util.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+#include "util/defer_op.h"
+
+namespace starrocks::stream {
+
+class PersistentStateTableTest : public StreamTestBase {
+public:
+    PersistentStateTableTest() = default;
+    ~PersistentStateTableTest() override = default;
+
+    void SetUp() override {
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr));
+        std::vector<SlotTypeInfo> src_slots = std::vector<SlotTypeInfo>{
+                {"col1", TYPE_INT, false},
+                {"col2", TYPE_INT, false},
+                {"col3", TYPE_INT, false},
+                {"agg1", TYPE_INT, true},
+        };
+        auto slot_type_info_arrays = DescTblHelper::create_slot_type_desc_info_arrays({src_slots});
+        _tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool, slot_type_info_arrays);
+        _runtime_state->set_desc_tbl(_tbl);
+        (void)fs::remove_all(_dir);
+    }
+    void TearDown() override { (void)fs::remove_all(_dir); }
+
+protected:
+    std::unique_ptr<PersistentStateTable> open_state_table(size_t k_num) {
+        auto tuple_desc = _tbl->get_tuple_descriptor(0);
+        auto state_table = std::make_unique<PersistentStateTable>(tuple_desc->slots(), k_num, _dir);
+        CHECK(state_table->prepare(_runtime_state).ok());
+        CHECK(state_table->open(_runtime_state).ok());
+        return state_table;
+    }
+
+    // Finish the epoch, and FE commits it.
+    void commit_and_publish(PersistentStateTable* state_table) {
+        ASSERT_OK(state_table->commit(_runtime_state));
+        ASSERT_OK(state_table->publish_epoch(_runtime_state, state_table->finished_epoch_id()));
+    }
+
+    void check_seek(StateTable* state_table, const std::vector<int32_t>& keys, const std::vector<int32_t>& ans) {
+        StateTableResult result;
+        ASSERT_OK(state_table->seek(_make_key_columns(keys), result));
+        ASSERT_EQ(1, result.found.size());
+        ASSERT_TRUE(result.found[0]);
+        ASSERT_EQ(1, result.result_chunk->num_rows());
+        _check_result(result.result_chunk, ans, 0);
+    }
+
+    void check_seek_not_found(StateTable* state_table, const std::vector<int32_t>& keys) {
+        StateTableResult result;
+        ASSERT_OK(state_table->seek(_make_key_columns(keys), result));
+        ASSERT_EQ(1, result.found.size());
+        ASSERT_FALSE(result.found[0]);
+        ASSERT_EQ(0, result.result_chunk->num_rows());
+    }
+
+    void check_prefix_scan(StateTable* state_table, const std::vector<int32_t>& keys,
+                           const std::vector<std::vector<int32_t>>& expect_rows) {
+        ASSIGN_OR_ABORT(auto chunk_iter, state_table->prefix_scan(_make_key_columns(keys), 0));
+        ChunkPtr chunk = ChunkHelper::new_chunk(chunk_iter->schema(), 1);
+        ASSERT_OK(chunk_iter->get_next(chunk.get()));
+        ASSERT_EQ(expect_rows.size(), chunk->num_rows());
+        for (auto i = 0; i < chunk->num_rows(); i++) {
+            _check_result(chunk, expect_rows[i], i);
+        }
+        ASSERT_TRUE(chunk_iter->get_next(chunk.get()).is_end_of_file());
+        chunk_iter->close();
+    }
+
+private:
+    void _check_result(const ChunkPtr& chunk, const std::vector<int32_t>& ans, int32_t row_idx) {
+        ASSERT_EQ(ans.size(), chunk->num_columns());
+        for (size_t i = 0; i < ans.size(); i++) {
+            ASSERT_EQ(ans[i], chunk->get_column_by_index(i)->get(row_idx).get_int32());
+        }
+    }
+
+    Columns _make_key_columns(const std::vector<int32_t>& keys) {
+        Columns cols;
+        for (auto& key : keys) {
+            cols.push_back(ColumnTestHelper::build_column<int32_t>({key}));
+        }
+        return cols;
+    }
+
+protected:
+    const std::string _dir = "./persistent_state_table_test";
+    RuntimeState* _runtime_state;
+    ObjectPool _obj_pool;
+    DescriptorTbl* _tbl;
+};
+
+TEST_F(PersistentStateTableTest, TestSeekKey) {
+    auto state_table = open_state_table(1);
+    check_seek_not_found(state_table.get(), {1});
+
+    // Seek in the write buffer.
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0})));
+    check_seek(state_table.get(), {1}, {1, 1, 11});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+
+    // Seek in the sstable.
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(0, state_table->write_buffer_bytes());
+    ASSERT_EQ(1, state_table->num_sstables());
+    check_seek(state_table.get(), {1}, {1, 1, 11});
+    check_seek(state_table.get(), {2}, {2, 2, 12});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+    check_seek_not_found(state_table.get(), {4});
+
+    // Update and delete keys, the newest version wins.
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {21, 22, 23}}, {0, 1, 0})));
+    check_seek(state_table.get(), {1}, {1, 1, 21});
+    check_seek_not_found(state_table.get(), {2});
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(2, state_table->num_sstables());
+    check_seek(state_table.get(), {1}, {1, 1, 21});
+    check_seek_not_found(state_table.get(), {2});
+    check_seek(state_table.get(), {3}, {3, 3, 23});
+
+    // Seek with selection.
+    StateTableResult result;
+    Columns keys{ColumnTestHelper::build_column<int32_t>({1, 2, 3})};
+    ASSERT_OK(state_table->seek(keys, std::vector<uint8_t>{1, 1, 0}, result));
+    ASSERT_EQ((std::vector<bool>{true, false, false}), result.found);
+    ASSERT_EQ(1, result.result_chunk->num_rows());
+}
+
+TEST_F(PersistentStateTableTest, TestPrefixScan) {
+    auto state_table = open_state_table(3);
+    ASSERT_TRUE(state_table->prefix_scan({ColumnTestHelper::build_column<int32_t>({1})}, 0).status().is_end_of_file());
+
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{1, 1, 1}, {1, 1, 2}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0})));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    // The rows with the prefix are both in the sstable and in the write buffer.
+    ASSERT_OK(state_table->write(_runtime_state,
+                                 MakeStreamChunk<int32_t>({{1, 1}, {1, 1}, {2, 4}, {22, 14}}, {0, 0})));
+    check_prefix_scan(state_table.get(), {1, 1},
+                      {
+                              {1, 11},
+                              {2, 22},
+                              {4, 14},
+                      });
+    check_prefix_scan(state_table.get(), {1},
+                      {
+                              {1, 1, 11},
+                              {1, 2, 22},
+                              {1, 4, 14},
+                              {2, 3, 13},
+                      });
+}
+
+TEST_F(PersistentStateTableTest, TestRecover) {
+    {
+        auto state_table = open_state_table(1);
+        ASSERT_OK(state_table->write(_runtime_state,
+                                     MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {11, 12}}, {0, 0})));
+        commit_and_publish(state_table.get());
+        ASSERT_EQ(0, state_table->committed_epoch_id());
+        ASSERT_OK(state_table->write(_runtime_state,
+                                     MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {21, 22}}, {1, 0})));
+        commit_and_publish(state_table.get());
+        ASSERT_EQ(1, state_table->committed_epoch_id());
+
+        // The epoch is finished in this driver, but not committed by FE.
+        ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{4}, {4}, {4}, {44}}, {0})));
+        ASSERT_OK(state_table->commit(_runtime_state));
+        ASSERT_EQ(1, state_table->committed_epoch_id());
+        ASSERT_EQ(2, state_table->finished_epoch_id());
+        ASSERT_EQ(3, state_table->num_sstables());
+
+        // The epoch fails before commit, even if its changes are flushed.
+        auto write_buffer_size = config::stream_state_table_write_buffer_size;
+        config::stream_state_table_write_buffer_size = 1;
+        ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{3}, {3}, {3}, {33}}, {0})));
+        config::stream_state_table_write_buffer_size = write_buffer_size;
+        ASSERT_EQ(4, state_table->num_sstables());
+        check_seek(state_table.get(), {3}, {3, 3, 33});
+    }
+
+    auto state_table = open_state_table(1);
+    ASSERT_EQ(1, state_table->committed_epoch_id());
+    ASSERT_EQ(2, state_table->num_sstables());
+    check_seek_not_found(state_table.get(), {1});
+    check_seek(state_table.get(), {2}, {2, 2, 22});
+    check_seek_not_found(state_table.get(), {3});
+    check_seek_not_found(state_table.get(), {4});
+}
+
+TEST_F(PersistentStateTableTest, TestOpenAtCommittedEpoch) {
+    {
+        auto state_table = open_state_table(1);
+        ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{1}, {1}, {1}, {11}}, {0})));
+        commit_and_publish(state_table.get());
+    }
+
+    pipeline::QueryContext query_ctx;
+    _runtime_state->set_query_ctx(&query_ctx);
+    DeferOp defer([&]() { _runtime_state->set_query_ctx(nullptr); });
+    auto tuple_desc = _tbl->get_tuple_descriptor(0);
+    MVMaintenanceTaskInfo maintenance_task_info;
+
+    // FE resumes the MV from the epoch which the state is checkpointed at.
+    maintenance_task_info.committed_epoch_id = 0;
+    ASSERT_OK(query_ctx.stream_epoch_manager()->prepare(maintenance_task_info, {}));
+    {
+        auto state_table = std::make_unique<PersistentStateTable>(tuple_desc->slots(), 1, _dir);
+        ASSERT_OK(state_table->open(_runtime_state));
+        check_seek(state_table.get(), {1}, {1, 1, 11});
+    }
+
+    // FE committed an epoch which is not published to the state.
+    maintenance_task_info.committed_epoch_id = 1;
+    ASSERT_OK(query_ctx.stream_epoch_manager()->prepare(maintenance_task_info, {}));
+    {
+        auto state_table = std::make_unique<PersistentStateTable>(tuple_desc->slots(), 1, _dir);
+        ASSERT_FALSE(state_table->open(_runtime_state).ok());
+    }
+}
+
+TEST_F(PersistentStateTableTest, TestResetEpoch) {
+    auto state_table = open_state_table(1);
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {11, 12}}, {0, 0})));
+    commit_and_publish(state_table.get());
+    // Nothing to discard after the epoch is committed by FE.
+    ASSERT_OK(state_table->reset_epoch(_runtime_state));
+    ASSERT_EQ(1, state_table->num_sstables());
+
+    // The epoch is finished in this driver, but FE fails to commit it, so it's discarded before the retry.
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{3}, {3}, {3}, {33}}, {0})));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(2, state_table->num_sstables());
+    ASSERT_OK(state_table->reset_epoch(_runtime_state));
+    ASSERT_EQ(0, state_table->committed_epoch_id());
+    ASSERT_EQ(-1, state_table->finished_epoch_id());
+    ASSERT_EQ(1, state_table->num_sstables());
+    check_seek_not_found(state_table.get(), {3});
+
+    // The epoch fails before commit, its flushed sstables and its write buffer are discarded before the retry.
+    auto write_buffer_size = config::stream_state_table_write_buffer_size;
+    config::stream_state_table_write_buffer_size = 1;
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{1}, {1}, {1}, {21}}, {1})));
+    config::stream_state_table_write_buffer_size = write_buffer_size;
+    ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({{3}, {3}, {3}, {33}}, {0})));
+    ASSERT_EQ(2, state_table->num_sstables());
+    check_seek_not_found(state_table.get(), {1});
+
+    ASSERT_OK(state_table->reset_epoch(_runtime_state));
+    ASSERT_EQ(0, state_table->committed_epoch_id());
+    ASSERT_EQ(1, state_table->num_sstables());
+    ASSERT_EQ(0, state_table->write_buffer_bytes());
+    check_seek(state_table.get(), {1}, {1, 1, 11});
+    check_seek(state_table.get(), {2}, {2, 2, 12});
+    check_seek_not_found(state_table.get(), {3});
+    std::vector<std::string> files;
+    ASSERT_OK(fs::get_children(_dir, &files));
+    ASSERT_EQ(state_table->num_sstables() + 1, files.size());
+}
+
+TEST_F(PersistentStateTableTest, TestCompaction) {
+    auto max_sstables = config::stream_state_table_max_sstables;
+    config::stream_state_table_max_sstables = 2;
+    DeferOp defer([&]() { config::stream_state_table_max_sstables = max_sstables; });
+
+    auto state_table = open_state_table(1);
+    for (int32_t i = 0; i < 5; i++) {
+        ASSERT_OK(state_table->write(_runtime_state,
+                                     MakeStreamChunk<int32_t>({{i, 100}, {i, 100}, {i, 100}, {i, i}}, {0, 0})));
+        // Delete the previous key.
+        if (i > 0) {
+            ASSERT_OK(state_table->write(_runtime_state,
+                                         MakeStreamChunk<int32_t>({{i - 1}, {i - 1}, {i - 1}, {0}}, {1})));
+        }
+        commit_and_publish(state_table.get());
+        ASSERT_LE(state_table->num_sstables(), 2);
+    }
+    for (int32_t i = 0; i < 4; i++) {
+        check_seek_not_found(state_table.get(), {i});
+    }
+    check_seek(state_table.get(), {4}, {4, 4, 4});
+    check_seek(state_table.get(), {100}, {100, 100, 4});
+
+    // The merged sstables are removed.
+    std::vector<std::string> files;
+    ASSERT_OK(fs::get_children(_dir, &files));
+    ASSERT_EQ(state_table->num_sstables() + 1, files.size());
+}
+
+} // namespace starrocks::stream
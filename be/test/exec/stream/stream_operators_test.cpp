@@ -24,6 +24,8 @@
 #include "exec/stream/aggregate/stream_aggregator.h"
 #include "exec/stream/stream_pipeline_test.h"
 #include "exec/stream/stream_test.h"
+#include "fs/fs_util.h"
+#include "util/defer_op.h"
 
 namespace starrocks::stream {
 
@@ -78,8 +80,17 @@ Status PrinterStreamSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr
 
 class StreamOperatorsTest : public StreamPipelineTest, public StreamTestBase {
 public:
-    void SetUp() override { StreamTestBase::SetUp(); }
-    void TearDown() override {}
+    void SetUp() override {
+        StreamTestBase::SetUp();
+        // The tests share the MV id, keep their states apart from the other tests.
+        _old_state_dir = config::stream_state_table_dir;
+        config::stream_state_table_dir = _state_dir;
+        (void)fs::remove_all(_state_dir);
+    }
+    void TearDown() override {
+        config::stream_state_table_dir = _old_state_dir;
+        (void)fs::remove_all(_state_dir);
+    }
 
     void CheckResult(std::vector<ChunkPtr> epoch_results,
                      std::vector<std::vector<std::vector<int64_t>>> expect_results) {
@@ -96,6 +107,8 @@ public:
     }
 
 protected:
+    const std::string _state_dir = "./stream_operators_test_states";
+    std::string _old_state_dir;
     DescriptorTbl* _tbl;
     std::vector<std::vector<SlotTypeInfo>> _slot_infos;
     std::vector<GroupByKeyInfo> _group_by_infos;
@@ -296,6 +309,82 @@ TEST_F(StreamOperatorsTest, Test_StreamAggregator_Dop1) {
     stop_mv();
 }
 
+TEST_F(StreamOperatorsTest, Test_StreamAggregator_RecoverState) {
+    const std::string state_dir = "./stream_operators_test_state";
+    auto old_state_dir = config::stream_state_table_dir;
+    config::stream_state_table_dir = state_dir;
+    (void)fs::remove_all(state_dir);
+    DeferOp defer([&]() {
+        config::stream_state_table_dir = old_state_dir;
+        (void)fs::remove_all(state_dir);
+    });
+
+    // The plan node id of the aggregator is the same in each maintenance job, so is its state directory.
+    const int32_t agg_plan_node_id = 100;
+    auto init_func = [&](auto* stream_ctx) {
+        auto exec_group = stream_ctx->exec_group.get();
+        _degree_of_parallelism = 1;
+        _pipeline_builder = [=](RuntimeState* state) {
+            _slot_infos = std::vector<std::vector<SlotTypeInfo>>{
+                    // input slots
+                    {
+                            {"col1", TYPE_BIGINT, false},
+                            {"col2", TYPE_BIGINT, false},
+                    },
+                    // intermediate slots
+                    {
+                            {"col1", TYPE_BIGINT, false},
+                            {"count_agg", TYPE_BIGINT, false},
+                    },
+                    // result slots
+                    {
+                            {"col1", TYPE_BIGINT, false},
+                            {"count_agg", TYPE_BIGINT, false},
+                    },
+            };
+            _group_by_infos = {0};
+            _agg_infos = std::vector<AggInfo>{// slot_index, agg_name, agg_intermediate_type, agg_result_type
+                                              {1, "count", TYPE_BIGINT, TYPE_BIGINT}};
+
+            _tbl = GenerateDescTbl(_runtime_state, (*_obj_pool), _slot_infos);
+            _runtime_state->set_desc_tbl(_tbl);
+            // Keep the state in the persistent state tables.
+            _stream_aggregator = _create_stream_aggregator(_slot_infos, _group_by_infos, _agg_infos, false, 0, false);
+            OpFactories op_factories{
+                    std::make_shared<GeneratorStreamSourceOperatorFactory>(
+                            next_operator_id(), next_plan_node_id(),
+                            GeneratorStreamSourceParam{
+                                    .num_column = 2, .start = 0, .step = 1, .chunk_size = 4, .ndv_count = 4}),
+                    std::make_shared<StreamAggregateOperatorFactory>(next_operator_id(), agg_plan_node_id,
+                                                                     _stream_aggregator),
+                    std::make_shared<PrinterStreamSinkOperatorFactory>(next_operator_id(), next_plan_node_id()),
+            };
+            _pipelines.push_back(std::make_shared<pipeline::Pipeline>(next_pipeline_id(), op_factories, exec_group));
+        };
+        return Status::OK();
+    };
+
+    int64_t epoch_id = 0;
+    // The state is kept when the MV is stopped, and recovered by the next maintenance job of the MV.
+    for (int64_t job = 0; job < 2; job++) {
+        _request.params.query_id.__set_lo(job);
+        _request.params.fragment_instance_id.__set_lo(job);
+        ASSERT_IF_ERROR(start_mv(init_func));
+        for (auto i = 0; i < 3; i++, epoch_id++) {
+            EpochInfo epoch_info{.epoch_id = epoch_id, .trigger_mode = TriggerMode::MANUAL};
+            ASSERT_IF_ERROR(start_epoch(_tablet_ids, epoch_info));
+            ASSERT_IF_ERROR(wait_until_epoch_finished(epoch_info));
+            ASSERT_IF_ERROR(commit_epoch(epoch_info));
+            CheckResult(fetch_results<PrinterStreamSinkOperator>(epoch_info),
+                        {{{1, 2, 3, 0}, {epoch_id + 1, epoch_id + 1, epoch_id + 1, epoch_id + 1}}});
+        }
+        ASSERT_TRUE(fs::path_exist(fmt::format("{}/0/{}_0", state_dir, agg_plan_node_id)));
+        // Drop the MV at the end of the last job, which removes its state.
+        stop_mv(job == 1);
+    }
+    ASSERT_FALSE(fs::path_exist(fmt::format("{}/0", state_dir)));
+}
+
 TEST_F(StreamOperatorsTest, Test_StreamAggregator_MultiDop) {
     ASSERT_IF_ERROR(start_mv([&](auto* stream_ctx) {
         auto exec_group = stream_ctx->exec_group.get();
@@ -101,6 +101,7 @@ Status StreamPipelineTest::prepare() {
     // prepare epoch manager
     auto stream_epoch_manager = _query_ctx->stream_epoch_manager();
     MVMaintenanceTaskInfo maintenance_task_info;
+    maintenance_task_info.committed_epoch_id = _committed_epoch_id;
     RETURN_IF_ERROR(stream_epoch_manager->prepare(maintenance_task_info, {_fragment_ctx}));
 
     return Status::OK();
@@ -160,10 +161,10 @@ Status StreamPipelineTest::start_mv(InitiliazeFunc&& init_func) {
     return Status::OK();
 }
 
-void StreamPipelineTest::stop_mv() {
+void StreamPipelineTest::stop_mv(bool drop_state) {
     VLOG_ROW << "StopMV";
     auto stream_epoch_manager = _query_ctx->stream_epoch_manager();
-    ASSERT_TRUE(stream_epoch_manager->set_finished(_exec_env, _query_ctx).ok());
+    ASSERT_TRUE(stream_epoch_manager->set_finished(_exec_env, _query_ctx, drop_state).ok());
     ASSERT_EQ(std::future_status::ready, _fragment_future.wait_for(std::chrono::seconds(15)));
 }
 
@@ -194,6 +195,13 @@ Status StreamPipelineTest::start_epoch(const std::vector<int64_t>& tablet_ids, c
     return Status::OK();
 }
 
+Status StreamPipelineTest::commit_epoch(const EpochInfo& epoch_info) {
+    VLOG_ROW << "CommitEpoch: " << epoch_info.debug_string();
+    RETURN_IF_ERROR(_query_ctx->stream_epoch_manager()->publish_epoch(_query_ctx, epoch_info.epoch_id));
+    _committed_epoch_id = epoch_info.epoch_id;
+    return Status::OK();
+}
+
 Status StreamPipelineTest::wait_until_epoch_finished(const EpochInfo& epoch_info) {
     VLOG_ROW << "WaitUntilEpochEnd: " << epoch_info.debug_string();
     auto are_all_drivers_parked_func = [=]() {
@@ -41,11 +41,14 @@ public:
     Status execute();
 
     Status start_mv(InitiliazeFunc&& init_func);
-    void stop_mv();
+    // `drop_state` is true to stop the MV as it is dropped.
+    void stop_mv(bool drop_state = false);
     void cancel_mv();
 
     Status start_epoch(const std::vector<int64_t>& tablet_ids, const EpochInfo& epoch_info);
     Status wait_until_epoch_finished(const EpochInfo& epoch_info);
+    // FE commits the finished epoch.
+    Status commit_epoch(const EpochInfo& epoch_info);
 
     template <typename T>
     std::vector<ChunkPtr> fetch_results(const EpochInfo& epoch_info);
@@ -73,6 +76,8 @@ protected:
     std::shared_ptr<starrocks::ConnectorScanNode> _connector_node;
     size_t _degree_of_parallelism;
     pipeline::PipelineBuilderContext* _pipeline_context = nullptr;
+    // The last epoch committed by `commit_epoch`, which the next maintenance job resumes from.
+    int64_t _committed_epoch_id = -1;
 
 private:
     size_t _next_operator_id = 0;
@@ -47,7 +47,8 @@ protected:
 
     std::shared_ptr<StreamAggregator> _create_stream_aggregator(
             const std::vector<std::vector<SlotTypeInfo>>& slot_infos, const std::vector<GroupByKeyInfo>& group_by_infos,
-            const std::vector<AggInfo>& agg_infos, bool is_generate_retract, int32_t count_agg_idx) {
+            const std::vector<AggInfo>& agg_infos, bool is_generate_retract, int32_t count_agg_idx,
+            bool is_testing = true) {
         auto params = std::make_shared<AggregatorParams>();
         params->needs_finalize = false;
         params->has_outer_join_child = false;
@@ -58,7 +59,7 @@ protected:
         params->sql_grouping_keys = "";
         params->sql_aggregate_functions = "";
         params->conjuncts = {};
-        params->is_testing = true;
+        params->is_testing = is_testing;
         // TODO: test more cases.
         params->is_append_only = false;
         params->is_generate_retract = is_generate_retract;
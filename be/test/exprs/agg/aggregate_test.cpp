@@ -32,6 +32,7 @@
 #include "exprs/anyval_util.h"
 #include "exprs/arithmetic_operation.h"
 #include "exprs/function_context.h"
+#include "exprs/jit/jit_engine.h"
 #include "gen_cpp/Data_types.h"
 #include "gen_cpp/Types_types.h"
 #include "gutil/casts.h"
@@ -2664,4 +2665,123 @@ TEST_F(AggregateTest, test_array_agg_nullable_distinct) {
     ASSERT_EQ(26, offsets->get_data().back());
 }
 
+TEST_F(AggregateTest, test_jit_fused_update) {
+    auto* jit_engine = JITEngine::get_instance();
+    if (!jit_engine->support_jit()) {
+        return;
+    }
+    std::vector<const AggregateFunction*> funcs = {
+            get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true),
+            get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, false),
+            get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true),
+            get_aggregate_function("min", TYPE_DOUBLE, TYPE_DOUBLE, false),
+            get_aggregate_function("max", TYPE_INT, TYPE_INT, true),
+            get_aggregate_function("avg", TYPE_SMALLINT, TYPE_DOUBLE, false),
+            get_aggregate_function("sum", TYPE_FLOAT, TYPE_DOUBLE, false)};
+    std::vector<LogicalType> result_types = {TYPE_BIGINT, TYPE_BIGINT, TYPE_BIGINT, TYPE_DOUBLE,
+                                             TYPE_INT,    TYPE_DOUBLE, TYPE_DOUBLE};
+
+    JITAggregateUpdate update;
+    ASSERT_FALSE(get_aggregate_function("sum", TYPE_DECIMALV2, TYPE_DECIMALV2, false)->get_jit_update(0, &update));
+    ASSERT_FALSE(get_aggregate_function("max", TYPE_VARCHAR, TYPE_VARCHAR, true)->get_jit_update(0, &update));
+
+    // lay out the states of a group like Aggregator
+    std::vector<size_t> offsets;
+    size_t total_size = 0;
+    size_t max_align = 1;
+    for (const auto* func : funcs) {
+        total_size = (total_size + func->alignof_size() - 1) / func->alignof_size() * func->alignof_size();
+        offsets.push_back(total_size);
+        total_size += func->size();
+        max_align = std::max(max_align, func->alignof_size());
+    }
+    std::vector<JITAggregateUpdate> updates(funcs.size());
+    for (size_t i = 0; i < funcs.size(); i++) {
+        ASSERT_TRUE(funcs[i]->get_jit_update(offsets[i], &updates[i]));
+    }
+
+    const size_t num_rows = 4093;
+    const size_t num_groups = 7;
+    auto int_column = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto double_column = DoubleColumn::create();
+    auto smallint_column = Int16Column::create();
+    auto float_column = FloatColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (i % 3 == 0) {
+            int_column->append_nulls(1);
+        } else {
+            int_column->append_datum(Datum(static_cast<int32_t>(i * 7 % 1000) - 500));
+        }
+        double_column->append(i * 0.25 - 100);
+        smallint_column->append(i % 100);
+        float_column->append(i * 0.1f);
+    }
+    const Column* columns[] = {int_column.get(), nullptr, int_column.get(), double_column.get(),
+                               int_column.get(), smallint_column.get(), float_column.get()};
+
+    MemPool mem_pool;
+    auto create_states = [&](std::vector<AggDataPtr>* groups, Buffer<AggDataPtr>* states) {
+        for (size_t g = 0; g < num_groups; g++) {
+            auto* group = mem_pool.allocate_aligned(total_size, max_align);
+            for (size_t i = 0; i < funcs.size(); i++) {
+                funcs[i]->create(ctx, group + offsets[i]);
+            }
+            groups->push_back(group);
+        }
+        for (size_t row = 0; row < num_rows; row++) {
+            states->push_back((*groups)[row * row % num_groups]);
+        }
+    };
+    std::vector<AggDataPtr> expected_groups;
+    Buffer<AggDataPtr> expected_states;
+    create_states(&expected_groups, &expected_states);
+    std::vector<AggDataPtr> jit_groups;
+    Buffer<AggDataPtr> jit_states;
+    create_states(&jit_groups, &jit_states);
+
+    for (size_t i = 0; i < funcs.size(); i++) {
+        funcs[i]->update_batch(ctx, num_rows, offsets[i], &columns[i], expected_states.data());
+    }
+
+    auto obj_cache = std::make_unique<JitObjectCache>("test_jit_fused_update", jit_engine->get_func_cache());
+    ASSERT_TRUE(JITEngine::compile_aggregate_function(obj_cache.get(), updates).ok());
+    ASSERT_NE(nullptr, obj_cache->get_func());
+    std::vector<uint8_t> zero_null_flags(num_rows, 0);
+    std::vector<JITColumn> jit_columns;
+    for (size_t i = 0; i < funcs.size(); i++) {
+        if (!updates[i].has_input()) {
+            continue;
+        }
+        const Column* column = columns[i];
+        const int8_t* null_flags = reinterpret_cast<const int8_t*>(zero_null_flags.data());
+        if (column->is_nullable()) {
+            ASSERT_TRUE(updates[i].skip_null);
+            const auto* nullable_column = down_cast<const NullableColumn*>(column);
+            null_flags = reinterpret_cast<const int8_t*>(nullable_column->null_column()->raw_data());
+        }
+        jit_columns.emplace_back(JITColumn{reinterpret_cast<const int8_t*>(column->raw_data()), null_flags});
+    }
+    jit_columns.emplace_back(JITColumn{reinterpret_cast<const int8_t*>(jit_states.data()), nullptr});
+    obj_cache->get_func()(num_rows, jit_columns.data());
+
+    for (size_t i = 0; i < funcs.size(); i++) {
+        bool is_nullable = updates[i].null_flag_offset >= 0;
+        auto expected = ColumnHelper::create_column(TypeDescriptor(result_types[i]), is_nullable);
+        auto actual = ColumnHelper::create_column(TypeDescriptor(result_types[i]), is_nullable);
+        for (size_t g = 0; g < num_groups; g++) {
+            funcs[i]->finalize_to_column(ctx, expected_groups[g] + offsets[i], expected.get());
+            funcs[i]->finalize_to_column(ctx, jit_groups[g] + offsets[i], actual.get());
+        }
+        for (size_t g = 0; g < num_groups; g++) {
+            ASSERT_EQ(expected->debug_item(g), actual->debug_item(g)) << "function " << i << " group " << g;
+        }
+    }
+    for (size_t g = 0; g < num_groups; g++) {
+        for (size_t i = 0; i < funcs.size(); i++) {
+            funcs[i]->destroy(ctx, expected_groups[g] + offsets[i]);
+            funcs[i]->destroy(ctx, jit_groups[g] + offsets[i]);
+        }
+    }
+}
+
 } // namespace starrocks
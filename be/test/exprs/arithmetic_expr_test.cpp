@@ -705,4 +705,109 @@ TEST_F(VectorizedArithmeticExprTest, constModN128Expr) {
     }
 }
 
+TEST_F(VectorizedArithmeticExprTest, decimalExprWithJit) {
+    auto decimal_type = [](LogicalType type, int precision, int scale) {
+        return TypeDescriptor::create_decimalv3_type(type, precision, scale).to_thrift();
+    };
+    expr_node.is_nullable = true;
+
+    // DECIMAL64(18, 2) + DECIMAL64(18, 4), the lhs is scaled up
+    {
+        expr_node.opcode = TExprOpcode::ADD;
+        expr_node.type = decimal_type(TYPE_DECIMAL64, 18, 4);
+        std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+        TExprNode lhs_node = expr_node;
+        lhs_node.type = decimal_type(TYPE_DECIMAL64, 18, 2);
+        MockVectorizedExpr<TYPE_DECIMAL64> col1(lhs_node, 10, 150);
+        MockVectorizedExpr<TYPE_DECIMAL64> col2(expr_node, 10, -25);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+            auto v = ColumnHelper::cast_to_raw<TYPE_DECIMAL64>(ColumnHelper::get_data_column(ptr.get()));
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_FALSE(ptr->is_null(j));
+                ASSERT_EQ(14975, v->get_data()[j]);
+            }
+        });
+    }
+
+    // DECIMAL64(18, 4) - DECIMAL64(18, 0), the rhs is scaled up
+    {
+        expr_node.opcode = TExprOpcode::SUBTRACT;
+        expr_node.type = decimal_type(TYPE_DECIMAL64, 18, 4);
+        std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+        TExprNode rhs_node = expr_node;
+        rhs_node.type = decimal_type(TYPE_DECIMAL64, 18, 0);
+        MockVectorizedExpr<TYPE_DECIMAL64> col1(expr_node, 10, 5);
+        MockNullVectorizedExpr<TYPE_DECIMAL64> col2(rhs_node, 10, 3);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+            ASSERT_TRUE(ptr->is_nullable());
+            auto v = ColumnHelper::cast_to_raw<TYPE_DECIMAL64>(ColumnHelper::get_data_column(ptr.get()));
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_EQ(j % 2 == 1, ptr->is_null(j));
+                if (!ptr->is_null(j)) {
+                    ASSERT_EQ(5 - 30000, v->get_data()[j]);
+                }
+            }
+        });
+    }
+
+    // DECIMAL64 multiplication overflows
+    {
+        expr_node.opcode = TExprOpcode::MULTIPLY;
+        expr_node.type = decimal_type(TYPE_DECIMAL64, 18, 0);
+        std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+        MockVectorizedExpr<TYPE_DECIMAL64> col1(expr_node, 10, 10000000000L);
+        MockVectorizedExpr<TYPE_DECIMAL64> col2(expr_node, 10, -10000000000L);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+            ASSERT_EQ(10, ptr->size());
+            for (int j = 0; j < ptr->size(); ++j) {
+                ASSERT_TRUE(ptr->is_null(j));
+            }
+        });
+    }
+
+    // DECIMAL128 multiplication, with and without overflow
+    for (int128_t rhs : {-100, 1000}) {
+        expr_node.opcode = TExprOpcode::MULTIPLY;
+        expr_node.type = decimal_type(TYPE_DECIMAL128, 38, 0);
+        std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+
+        int128_t lhs = int128_t(1000000000000000000L) * 1000000000000000000L;
+        MockVectorizedExpr<TYPE_DECIMAL128> col1(expr_node, 10, lhs);
+        MockVectorizedExpr<TYPE_DECIMAL128> col2(expr_node, 10, rhs);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        int128_t expected = 0;
+        bool overflow = __builtin_mul_overflow(lhs, rhs, &expected);
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [&](ColumnPtr const& ptr) {
+            auto v = ColumnHelper::cast_to_raw<TYPE_DECIMAL128>(ColumnHelper::get_data_column(ptr.get()));
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_EQ(overflow, ptr->is_null(j));
+                if (!overflow) {
+                    ASSERT_EQ(expected, v->get_data()[j]);
+                }
+            }
+        });
+    }
+}
+
 } // namespace starrocks
@@ -17,8 +17,10 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "exprs/exprs_test_helper.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
 
@@ -805,4 +807,133 @@ TEST_F(VectorizedBinaryPredicateMapTest, mapEqExpr2) {
     }
 }
 
+static bool expected_cmp_result(TExprOpcode::type opcode, int cmp) {
+    switch (opcode) {
+    case TExprOpcode::EQ:
+        return cmp == 0;
+    case TExprOpcode::NE:
+        return cmp != 0;
+    case TExprOpcode::LT:
+        return cmp < 0;
+    case TExprOpcode::LE:
+        return cmp <= 0;
+    case TExprOpcode::GT:
+        return cmp > 0;
+    default:
+        return cmp >= 0;
+    }
+}
+
+TEST_F(VectorizedBinaryPredicateTest, stringCmpExprWithJit) {
+    std::vector<std::pair<std::string, std::string>> cases = {{"abc", "abc"}, {"abc", "abd"}, {"abc", "ab"},
+                                                              {"", "a"},      {"b", "abc"},   {"", ""}};
+    auto lhs = BinaryColumn::create();
+    auto rhs = BinaryColumn::create();
+    for (auto& [l, r] : cases) {
+        lhs->append(l);
+        rhs->append(r);
+    }
+    expr_node.child_type = TPrimitiveType::VARCHAR;
+    TExprNode col_node = expr_node;
+    col_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+    MockColumnExpr col1(col_node, lhs);
+    MockColumnExpr col2(col_node, rhs);
+
+    for (auto opcode : {TExprOpcode::EQ, TExprOpcode::NE, TExprOpcode::LT, TExprOpcode::LE, TExprOpcode::GT,
+                        TExprOpcode::GE}) {
+        expr_node.opcode = opcode;
+        std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [&](ColumnPtr const& ptr) {
+            auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+            ASSERT_EQ(cases.size(), v->size());
+            for (size_t i = 0; i < cases.size(); ++i) {
+                int cmp = Slice(cases[i].first).compare(Slice(cases[i].second));
+                ASSERT_EQ(expected_cmp_result(opcode, cmp), v->get_data()[i]) << i;
+            }
+        });
+    }
+}
+
+TEST_F(VectorizedBinaryPredicateTest, stringLiteralCmpExprWithJit) {
+    auto column = BinaryColumn::create();
+    column->append("abc");
+    column->append("abcd");
+    column->append("");
+    expr_node.child_type = TPrimitiveType::VARCHAR;
+    TExprNode col_node = expr_node;
+    col_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+    MockColumnExpr col(col_node, column);
+    VectorizedLiteral literal(ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("abc"), 1),
+                              TypeDescriptor::create_varchar_type(10));
+
+    expr_node.opcode = TExprOpcode::EQ;
+    std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+    expr->_children.push_back(&col);
+    expr->_children.push_back(&literal);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+        auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+        ASSERT_EQ(3, v->size());
+        ASSERT_EQ(1, v->get_data()[0]);
+        ASSERT_EQ(0, v->get_data()[1]);
+        ASSERT_EQ(0, v->get_data()[2]);
+    });
+}
+
+TEST_F(VectorizedBinaryPredicateTest, dateAndDecimalCmpExprWithJit) {
+    // date
+    {
+        expr_node.opcode = TExprOpcode::LT;
+        expr_node.child_type = TPrimitiveType::DATE;
+        expr_node.is_nullable = true;
+        std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+        TExprNode col_node = expr_node;
+        col_node.type = gen_type_desc(TPrimitiveType::DATE);
+        MockVectorizedExpr<TYPE_DATE> col1(col_node, 10, DateValue::create(2023, 12, 31));
+        MockNullVectorizedExpr<TYPE_DATE> col2(col_node, 10, DateValue::create(2024, 1, 1));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+            ASSERT_TRUE(ptr->is_nullable());
+            auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ColumnHelper::get_data_column(ptr.get()));
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                if (ptr->is_null(j)) {
+                    continue;
+                }
+                ASSERT_EQ(1, v->get_data()[j]);
+            }
+        });
+    }
+    // decimal
+    {
+        expr_node.opcode = TExprOpcode::GE;
+        expr_node.child_type = TPrimitiveType::DECIMAL64;
+        expr_node.is_nullable = false;
+        std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+        TExprNode col_node = expr_node;
+        col_node.type = TypeDescriptor::create_decimalv3_type(TYPE_DECIMAL64, 18, 2).to_thrift();
+        MockVectorizedExpr<TYPE_DECIMAL64> col1(col_node, 10, 12345);
+        MockVectorizedExpr<TYPE_DECIMAL64> col2(col_node, 10, -12345);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [](ColumnPtr const& ptr) {
+            auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+            ASSERT_EQ(10, v->size());
+            for (int j = 0; j < v->size(); ++j) {
+                ASSERT_EQ(1, v->get_data()[j]);
+            }
+        });
+    }
+}
+
 } // namespace starrocks
@@ -17,7 +17,15 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <optional>
+
+#include "column/binary_column.h"
+#include "column/column_viewer.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exprs/expr_context.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
@@ -433,4 +441,183 @@ TEST_F(VectorizedCompoundPredicateTest, testOnlyNullAndZeroRow) {
     }
 }
 
+// The LIKE and REGEXP predicates on the same column of an OR tree are merged into one multi-pattern matcher.
+class OrPatternMatchPredicateTest : public ::testing::Test {
+public:
+    void SetUp() override { _min_patterns = config::like_multi_pattern_min_patterns; }
+    void TearDown() override { config::like_multi_pattern_min_patterns = _min_patterns; }
+
+protected:
+    static constexpr SlotId VALUE_SLOT = 1;
+    static constexpr SlotId PATTERN_SLOT = 2;
+    static constexpr int64_t LIKE_FUNCTION_ID = 60010;
+    static constexpr int64_t REGEXP_FUNCTION_ID = 60020;
+
+    static TTypeDesc varchar_type() {
+        auto type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::VARCHAR);
+        type.types[0].scalar_type.__set_len(TypeDescriptor::MAX_VARCHAR_LENGTH);
+        return type;
+    }
+
+    static TExprNode slot_node(SlotId slot_id) {
+        return ExprsTestHelper::create_slot_expr_node(0, slot_id, varchar_type(), true);
+    }
+
+    static TExprNode literal_node(const std::string& value) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        node.__set_type(varchar_type());
+        node.__set_num_children(0);
+        node.__set_is_nullable(false);
+        TStringLiteral literal;
+        literal.__set_value(value);
+        node.__set_string_literal(literal);
+        return node;
+    }
+
+    // The nodes of `value LIKE pattern` or `value REGEXP pattern`.
+    static std::vector<TExprNode> match_nodes(bool is_regexp, const TExprNode& value, const TExprNode& pattern) {
+        TFunction fn;
+        TFunctionName fn_name;
+        fn_name.__set_function_name(is_regexp ? "regexp" : "like");
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_arg_types({varchar_type(), varchar_type()});
+        fn.__set_ret_type(ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BOOLEAN));
+        fn.__set_has_var_args(false);
+        fn.__set_fid(is_regexp ? REGEXP_FUNCTION_ID : LIKE_FUNCTION_ID);
+
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_type(ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BOOLEAN));
+        node.__set_num_children(2);
+        node.__set_is_nullable(true);
+        node.__set_fn(fn);
+        return {node, value, pattern};
+    }
+
+    static std::vector<TExprNode> like(const std::string& pattern) {
+        return match_nodes(false, slot_node(VALUE_SLOT), literal_node(pattern));
+    }
+
+    static std::vector<TExprNode> regexp(const std::string& pattern) {
+        return match_nodes(true, slot_node(VALUE_SLOT), literal_node(pattern));
+    }
+
+    // ((operands[0] OR operands[1]) OR operands[2]) OR ...
+    static TExpr or_expr(const std::vector<std::vector<TExprNode>>& operands) {
+        TExpr expr;
+        for (size_t i = 1; i < operands.size(); i++) {
+            TExprNode node;
+            node.__set_node_type(TExprNodeType::COMPOUND_PRED);
+            node.__set_opcode(TExprOpcode::COMPOUND_OR);
+            node.__set_type(ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BOOLEAN));
+            node.__set_num_children(2);
+            node.__set_is_nullable(true);
+            expr.nodes.emplace_back(node);
+        }
+        for (const auto& operand : operands) {
+            expr.nodes.insert(expr.nodes.end(), operand.begin(), operand.end());
+        }
+        return expr;
+    }
+
+    static ColumnPtr string_column(const std::vector<std::optional<std::string>>& values) {
+        auto data = BinaryColumn::create();
+        auto nulls = NullColumn::create();
+        for (const auto& value : values) {
+            data->append(value.value_or(""));
+            nulls->append(!value.has_value());
+        }
+        return NullableColumn::create(std::move(data), std::move(nulls));
+    }
+
+    // Evaluate the expr, the debug string of the root tells the number of the merged patterns.
+    ColumnPtr evaluate(const TExpr& texpr, std::string* debug_string) {
+        ExprContext* ctx = nullptr;
+        CHECK(Expr::create_expr_tree(&_pool, texpr, &ctx, &_runtime_state).ok());
+        CHECK(ctx->prepare(&_runtime_state).ok());
+        CHECK(ctx->open(&_runtime_state).ok());
+        auto result = ctx->evaluate(_chunk.get());
+        CHECK(result.ok()) << result.status();
+        *debug_string = ctx->root()->debug_string();
+        ctx->close(&_runtime_state);
+        return std::move(result).value();
+    }
+
+    void check(const TExpr& texpr, int num_merged_patterns, const std::vector<std::optional<bool>>& expected) {
+        std::string debug_string;
+        auto result = evaluate(texpr, &debug_string);
+        ASSERT_NE(std::string::npos,
+                  debug_string.find("merged_patterns=" + std::to_string(num_merged_patterns) + ","))
+                << debug_string;
+        ASSERT_EQ(expected.size(), result->size());
+        ColumnViewer<TYPE_BOOLEAN> viewer(result);
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(!expected[i].has_value(), viewer.is_null(i)) << i;
+            if (expected[i].has_value()) {
+                ASSERT_EQ(expected[i].value(), viewer.value(i)) << i;
+            }
+        }
+
+        // The same result as evaluating the predicates one by one.
+        config::like_multi_pattern_min_patterns = 0;
+        auto unmerged_result = evaluate(texpr, &debug_string);
+        ASSERT_NE(std::string::npos, debug_string.find("merged_patterns=0,")) << debug_string;
+        ColumnViewer<TYPE_BOOLEAN> unmerged_viewer(unmerged_result);
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(viewer.is_null(i), unmerged_viewer.is_null(i)) << i;
+            if (!viewer.is_null(i)) {
+                ASSERT_EQ(viewer.value(i), unmerged_viewer.value(i)) << i;
+            }
+        }
+    }
+
+    void set_chunk(const std::vector<std::optional<std::string>>& values,
+                   const std::vector<std::optional<std::string>>& patterns) {
+        _chunk = std::make_shared<Chunk>();
+        _chunk->append_column(string_column(values), VALUE_SLOT);
+        _chunk->append_column(string_column(patterns), PATTERN_SLOT);
+    }
+
+    ObjectPool _pool;
+    RuntimeState _runtime_state;
+    ChunkPtr _chunk;
+    int32_t _min_patterns = 0;
+};
+
+TEST_F(OrPatternMatchPredicateTest, mixedLikeAndRegexp) {
+    config::like_multi_pattern_min_patterns = 3;
+    set_chunk({"apple", "banana", std::nullopt, "cherry", "date", "xyz"}, {"", "", "", "", "", ""});
+    check(or_expr({like("%an%"), like("ch%"), regexp("^d.t")}), 3, {false, true, std::nullopt, true, true, false});
+}
+
+TEST_F(OrPatternMatchPredicateTest, otherOperandsAndNulls) {
+    config::like_multi_pattern_min_patterns = 3;
+    set_chunk({"apple", "banana", std::nullopt, "cherry", std::nullopt, "xyz"},
+              {"zzz", "zzz", "x1", "zzz", "zzz", "x%"});
+    // `value LIKE pattern` has a non-constant pattern, and `pattern LIKE 'x%'` is on another column, so they are
+    // evaluated one by one and ORed with the merged patterns. NULL OR TRUE is TRUE, and NULL OR FALSE is NULL.
+    auto texpr = or_expr({like("%an%"), match_nodes(false, slot_node(VALUE_SLOT), slot_node(PATTERN_SLOT)),
+                          like("ch%"), match_nodes(false, slot_node(PATTERN_SLOT), literal_node("x%")),
+                          regexp("^d.t")});
+    check(texpr, 3, {false, true, true, true, std::nullopt, true});
+}
+
+TEST_F(OrPatternMatchPredicateTest, minPatterns) {
+    set_chunk({"apple", "banana", std::nullopt}, {"", "", ""});
+    auto texpr = or_expr({like("%an%"), regexp("^ap")});
+    const std::vector<std::optional<bool>> expected{true, true, std::nullopt};
+
+    config::like_multi_pattern_min_patterns = 3;
+    check(texpr, 0, expected);
+    config::like_multi_pattern_min_patterns = 2;
+    check(texpr, 2, expected);
+
+    // The patterns on different columns are not merged together.
+    config::like_multi_pattern_min_patterns = 2;
+    auto other_column_texpr = or_expr({like("%an%"), match_nodes(false, slot_node(PATTERN_SLOT), literal_node("%"))});
+    check(other_column_texpr, 0, {true, true, true});
+}
+
 } // namespace starrocks
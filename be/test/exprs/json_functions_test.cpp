@@ -1635,4 +1635,58 @@ TEST_F(JsonFunctionsTest, map_to_json) {
     }
 }
 
+TEST_F(JsonFunctionsTest, json_parse_cache) {
+    ASSERT_EQ(nullptr, JsonParseCache::current());
+    auto strings = BinaryColumn::create();
+    strings->append(R"({"a": 1, "b": "x"})");
+    strings->append(R"({"a": 2, "b": "y"})");
+    strings->append("invalid");
+    ColumnPtr source = strings;
+
+    {
+        JsonParseCache::Scope scope;
+        auto* cache = JsonParseCache::current();
+        ASSERT_NE(nullptr, cache);
+        {
+            // The nested scope shares the outer one.
+            JsonParseCache::Scope nested_scope;
+            ASSERT_EQ(cache, JsonParseCache::current());
+        }
+        ASSERT_EQ(cache, JsonParseCache::current());
+
+        int num_parses = 0;
+        auto parse = [&]() {
+            num_parses++;
+            return ColumnPtr(BinaryColumn::create());
+        };
+        auto parsed = cache->get_or_parse(source, JsonParseCache::ParseKind::PARSE_JSON, parse);
+        ASSERT_EQ(parsed, cache->get_or_parse(source, JsonParseCache::ParseKind::PARSE_JSON, parse));
+        ASSERT_EQ(1, num_parses);
+        ASSERT_NE(parsed, cache->get_or_parse(source, JsonParseCache::ParseKind::CAST_TO_JSON, parse));
+        ASSERT_EQ(2, num_parses);
+    }
+    ASSERT_EQ(nullptr, JsonParseCache::current());
+
+    // Extract different paths from the documents parsed once.
+    JsonParseCache::Scope scope;
+    auto get_json = [&](const std::string& path, auto func) {
+        std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+        Columns columns{source, ColumnHelper::create_const_column<TYPE_VARCHAR>(path, source->size())};
+        ctx->set_constant_columns(columns);
+        auto state_scope = FunctionContext::FunctionStateScope::FRAGMENT_LOCAL;
+        EXPECT_OK(JsonFunctions::native_json_path_prepare(ctx.get(), state_scope));
+        ColumnPtr result = func(ctx.get(), columns).value();
+        EXPECT_OK(JsonFunctions::native_json_path_close(ctx.get(), state_scope));
+        return result;
+    };
+    auto a = get_json("$.a", JsonFunctions::get_json_int);
+    auto b = get_json("$.b", JsonFunctions::get_json_string);
+    ASSERT_EQ(1, a->get(0).get_int32());
+    ASSERT_EQ(2, a->get(1).get_int32());
+    ASSERT_TRUE(a->is_null(2));
+    ASSERT_EQ("x", b->get(0).get_slice().to_string());
+    ASSERT_EQ("y", b->get(1).get_slice().to_string());
+    ASSERT_TRUE(b->is_null(2));
+}
+
 } // namespace starrocks
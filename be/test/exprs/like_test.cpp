@@ -20,6 +20,7 @@
 #include "exprs/like_predicate.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "storage/rowset/bloom_filter.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -695,4 +696,44 @@ TEST_F(LikeTest, splitLikePatternIntoNgramSet) {
     ASSERT_EQ(0, ngram_set.size());
 }
 
+TEST_F(LikeTest, multiPatternMatcher) {
+    MultiPatternMatcher matcher;
+    matcher.add_like_pattern("%error%");
+    matcher.add_like_pattern("warn_");
+    matcher.add_regex_pattern("time(out|d)");
+    ASSERT_EQ(3, matcher.num_patterns());
+    ASSERT_OK(matcher.compile());
+
+    auto str = BinaryColumn::create();
+    str->append("an error occurs");
+    str->append("warn1");
+    str->append("warn12");
+    str->append("it's timed out");
+    str->append("");
+    str->append("info");
+    auto null = NullColumn::create(str->size(), 0);
+    null->get_data()[5] = 1;
+    ColumnPtr values = NullableColumn::create(str, null);
+
+    ASSIGN_OR_ABORT(auto result, matcher.match_any(values));
+    ASSERT_EQ(6, result->size());
+    std::vector<uint8_t> expected = {1, 1, 0, 1, 0};
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expected[i], result->get(i).get_uint8());
+    }
+    ASSERT_TRUE(result->is_null(5));
+
+    std::vector<Filter> matches;
+    ASSERT_OK(matcher.match_each(values, &matches));
+    ASSERT_EQ(3, matches.size());
+    ASSERT_EQ(Filter({1, 0, 0, 0, 0, 0}), matches[0]);
+    ASSERT_EQ(Filter({0, 1, 0, 0, 0, 0}), matches[1]);
+    ASSERT_EQ(Filter({0, 0, 0, 1, 0, 0}), matches[2]);
+
+    MultiPatternMatcher invalid;
+    invalid.add_regex_pattern("(abc");
+    ASSERT_FALSE(invalid.compile().ok());
+}
+
 } // namespace starrocks
@@ -23,6 +23,7 @@
 #include "column/column_helper.h"
 #include "exprs/runtime_filter_bank.h"
 #include "simd/simd.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -385,6 +386,137 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterMerge3) {
 
 typedef std::function<void(BinaryColumn*, std::vector<uint32_t>&, std::vector<size_t>&)> PartitionByFunc;
 typedef std::function<PartitionByFunc(bool)> PartitionByFuncGen;
+static ColumnPtr gen_int_column(int begin, int end, int step) {
+    ColumnPtr column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+    auto* col = ColumnHelper::as_raw_column<Int32Column>(column);
+    for (int i = begin; i < end; i += step) {
+        col->append(i);
+    }
+    return column;
+}
+
+static size_t count_selected(const JoinRuntimeFilter* rf, const ColumnPtr& column) {
+    JoinRuntimeFilter::RunningContext ctx;
+    ctx.use_merged_selection = false;
+    ctx.selection.assign(column->size(), 1);
+    rf->evaluate(column.get(), &ctx);
+    return SIMD::count_nonzero(ctx.selection);
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitset) {
+    RuntimeBloomFilter<TYPE_INT> bf;
+    JoinRuntimeFilter* rf = &bf;
+    bf.init(1000);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(1000, 3000, 2), TYPE_INT, rf, 0, false));
+    ASSERT_TRUE(rf->has_exact_bitset());
+    EXPECT_EQ(bf.min_value(), 1000);
+    EXPECT_EQ(bf.max_value(), 2998);
+
+    // no false positive.
+    EXPECT_EQ(count_selected(rf, gen_int_column(0, 4000, 1)), 1000);
+    EXPECT_EQ(count_selected(rf, gen_int_column(1001, 3000, 2)), 0);
+
+    // nulls
+    ColumnPtr nullable = NullableColumn::create(gen_int_column(1000, 1004, 1), NullColumn::create(4, 0));
+    ASSERT_TRUE(nullable->set_null(0));
+    EXPECT_EQ(count_selected(rf, nullable), 1);
+    bf.insert_null();
+    EXPECT_EQ(count_selected(rf, nullable), 2);
+
+    // serialize
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(rf);
+    std::vector<uint8_t> buffer(max_size, 0);
+    size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V3, rf, buffer.data());
+    buffer.resize(actual_size);
+    // only the bitset is sent.
+    EXPECT_LT(actual_size, 1024);
+    JoinRuntimeFilter* rf1 = nullptr;
+    ObjectPool pool;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf1, buffer.data(), actual_size);
+    ASSERT_TRUE(rf1->has_exact_bitset());
+    EXPECT_TRUE(rf1->check_equal(*rf));
+    EXPECT_EQ(count_selected(rf1, gen_int_column(0, 4000, 1)), 1000);
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetFallback) {
+    RuntimeBloomFilter<TYPE_INT> bf;
+    JoinRuntimeFilter* rf = &bf;
+    bf.init(200);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(0, 100, 1), TYPE_INT, rf, 0, false));
+    ASSERT_TRUE(rf->has_exact_bitset());
+    // the range is extended.
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(200, 300, 1), TYPE_INT, rf, 0, false));
+    ASSERT_TRUE(rf->has_exact_bitset());
+    EXPECT_EQ(count_selected(rf, gen_int_column(0, 300, 1)), 200);
+
+    // the range is too large, fallback to bloom filter.
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(100000000, 100000010, 1), TYPE_INT, rf,
+                                                             0, false));
+    ASSERT_FALSE(rf->has_exact_bitset());
+    ASSERT_TRUE(rf->can_use_bf());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(bf._test_data(i));
+        EXPECT_TRUE(bf._test_data(i + 200));
+    }
+    for (int i = 100000000; i < 100000010; i++) {
+        EXPECT_TRUE(bf._test_data(i));
+    }
+
+    // merge a bitset into a bloom filter.
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    bf1.init(200);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(500, 600, 1), TYPE_INT, &bf1, 0, false));
+    ASSERT_TRUE(bf1.has_exact_bitset());
+    bf.merge(&bf1);
+    for (int i = 500; i < 600; i++) {
+        EXPECT_TRUE(bf._test_data(i));
+    }
+    EXPECT_EQ(bf.min_value(), 0);
+    EXPECT_EQ(bf.max_value(), 100000009);
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetConcat) {
+    ObjectPool pool;
+    auto create_partial_rf = [&pool](int begin, int end) {
+        auto* rf = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, TYPE_INT);
+        rf->set_join_mode(TRuntimeFilterBuildJoinMode::PARTITIONED);
+        rf->init(end - begin);
+        CHECK(RuntimeFilterHelper::fill_runtime_bloom_filter(gen_int_column(begin, end, 1), TYPE_INT, rf, 0, false)
+                      .ok());
+        return rf;
+    };
+    auto* empty_rf = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, TYPE_INT);
+
+    // all the partial filters are merged into one bitset.
+    {
+        std::vector<JoinRuntimeFilter*> partial_rfs = {create_partial_rf(0, 100), empty_rf,
+                                                       create_partial_rf(1000, 1100)};
+        JoinRuntimeFilter::prepare_concat(partial_rfs);
+        auto* rf = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, TYPE_INT);
+        for (auto* partial_rf : partial_rfs) {
+            rf->concat(partial_rf);
+        }
+        ASSERT_TRUE(rf->has_exact_bitset());
+        EXPECT_EQ(rf->num_hash_partitions(), 0);
+        EXPECT_EQ(count_selected(rf, gen_int_column(0, 2000, 1)), 200);
+    }
+
+    // the union is too large, all the partial filters fallback to bloom filters.
+    {
+        std::vector<JoinRuntimeFilter*> partial_rfs = {create_partial_rf(0, 100),
+                                                       create_partial_rf(100000000, 100000100)};
+        JoinRuntimeFilter::prepare_concat(partial_rfs);
+        auto* rf = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, TYPE_INT);
+        for (auto* partial_rf : partial_rfs) {
+            ASSERT_FALSE(partial_rf->has_exact_bitset());
+            rf->concat(partial_rf);
+        }
+        ASSERT_FALSE(rf->has_exact_bitset());
+        EXPECT_EQ(rf->num_hash_partitions(), 2);
+        EXPECT_TRUE(rf->can_use_bf());
+    }
+}
+
 typedef std::function<void(JoinRuntimeFilter*, JoinRuntimeFilter::RunningContext*)> GrfConfigFunc;
 
 using TestHelper = std::function<void(size_t, size_t, PartitionByFunc, GrfConfigFunc, const RuntimeFilterLayout&)>;
@@ -24,6 +24,8 @@
 
 #include "column/struct_column.h"
 #include "common/object_pool.h"
+#include "exprs/column_ref.h"
+#include "exprs/in_const_predicate.hpp"
 #include "exprs/is_null_predicate.h"
 #include "formats/orc/memory_stream/MemoryInputStream.hh"
 #include "formats/orc/memory_stream/MemoryOutputStream.hh"
@@ -3067,4 +3069,54 @@ TEST_F(OrcChunkReaderTest, TestORCIntToSRFloat) {
     }
 }
 
+TEST_F(OrcChunkReaderTest, TestRuntimeInFilterSearchArgument) {
+    MemoryOutputStream buffer(1024000);
+    {
+        orc::WriterOptions writerOptions;
+        writerOptions.setRowIndexStride(128);
+        writerOptions.setColumnsUseBloomFilter({1});
+        ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<col1:int>"));
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        size_t batch_size = 1024;
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batch_size);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* col1 = dynamic_cast<orc::LongVectorBatch*>(root->fields[0]);
+        for (size_t i = 0; i < batch_size; i++) {
+            col1->data[i] = i;
+        }
+        col1->numElements = batch_size;
+        root->numElements = batch_size;
+        writer->add(*batch);
+        writer->close();
+    }
+
+    SlotDesc slot_descs[] = {{"col1", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)}, {""}};
+    std::vector<SlotDescriptor*> src_slot_descriptors;
+    create_slot_descriptors(_runtime_state.get(), &_pool, &src_slot_descriptors, slot_descs);
+
+    // The in predicate generated from a runtime filter has no literal children.
+    ColumnRef column_ref(src_slot_descriptors[0]);
+    VectorizedInConstPredicateBuilder builder(_runtime_state.get(), &_pool, &column_ref);
+    builder.use_as_join_runtime_filter();
+    ASSERT_OK(builder.create());
+    auto values = Int32Column::create();
+    values->append(1000);
+    builder.add_values(values, 0);
+    Expr* in_pred = builder.get_in_const_predicate()->root();
+    ASSERT_EQ(1, in_pred->get_num_children());
+
+    std::vector<Expr*> conjuncts = {in_pred};
+    OrcPredicates predicates{&conjuncts, nullptr};
+    OrcChunkReader reader(_runtime_state->chunk_size(), src_slot_descriptors);
+    reader.set_use_orc_column_names(true);
+    auto input_stream = ORC_UNIQUE_PTR<orc::InputStream>(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+    ASSERT_OK(reader.init(std::move(input_stream), &predicates));
+    ASSERT_NE(std::string::npos, reader.get_search_argument_string().find("column(id=1) in"))
+            << reader.get_search_argument_string();
+
+    // Only the row group containing 1000 is read.
+    EXPECT_EQ(128, get_hit_rows(&reader));
+}
+
 } // namespace starrocks
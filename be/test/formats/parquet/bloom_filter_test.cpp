@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include "fs/fs.h"
+#include "gen_cpp/parquet_types.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+TEST(ParquetBloomFilterTest, TestHash) {
+    // The well known XXH64 hashes with seed 0.
+    ASSERT_EQ(0xef46db3751d8e999ULL, ParquetBloomFilter::hash("", 0));
+    int32_t value = 0;
+    ASSERT_EQ(ParquetBloomFilter::hash("\0\0\0\0", 4), ParquetBloomFilter::hash(&value, sizeof(value)));
+}
+
+TEST(ParquetBloomFilterTest, TestInsertAndTest) {
+    ParquetBloomFilter bloom_filter;
+    ASSERT_FALSE(bloom_filter.init(0).ok());
+    ASSERT_FALSE(bloom_filter.init(100).ok());
+    ASSERT_OK(bloom_filter.init(1024));
+    ASSERT_EQ(1024, bloom_filter.num_bytes());
+
+    for (int64_t i = 0; i < 100; i++) {
+        bloom_filter.insert_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+    }
+    for (int64_t i = 0; i < 100; i++) {
+        ASSERT_TRUE(bloom_filter.test_hash(ParquetBloomFilter::hash(&i, sizeof(i))));
+    }
+    int false_positives = 0;
+    for (int64_t i = 100; i < 10100; i++) {
+        false_positives += bloom_filter.test_hash(ParquetBloomFilter::hash(&i, sizeof(i)));
+    }
+    ASSERT_LT(false_positives, 100);
+}
+
+TEST(ParquetBloomFilterTest, TestRead) {
+    tparquet::BloomFilterHeader header;
+    header.numBytes = 512;
+    header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(tparquet::XxHash());
+    header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+    ThriftSerializer ser(true, 100);
+    uint32_t len = 0;
+    uint8_t* header_ser = nullptr;
+    ASSERT_OK(ser.serialize(&header, &len, &header_ser));
+
+    // Some bytes of other data, an empty bloom filter, then a full bloom filter.
+    std::string buffer(100, 'x');
+    buffer.append(reinterpret_cast<char*>(header_ser), len);
+    buffer.append(512, '\0');
+    size_t full_offset = buffer.size();
+    buffer.append(reinterpret_cast<char*>(header_ser), len);
+    buffer.append(512, '\xff');
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(buffer), "string-file");
+
+    int32_t value = 1;
+    uint64_t hash = ParquetBloomFilter::hash(&value, sizeof(value));
+    ParquetBloomFilter empty;
+    ASSERT_OK(empty.read(&file, 100, buffer.size()));
+    ASSERT_EQ(512, empty.num_bytes());
+    ASSERT_FALSE(empty.test_hash(hash));
+
+    ParquetBloomFilter full;
+    ASSERT_OK(full.read(&file, full_offset, buffer.size()));
+    ASSERT_EQ(512, full.num_bytes());
+    ASSERT_TRUE(full.test_hash(hash));
+
+    // Corrupted offset and size.
+    ParquetBloomFilter bloom_filter;
+    ASSERT_FALSE(bloom_filter.read(&file, buffer.size(), buffer.size()).ok());
+    ASSERT_FALSE(bloom_filter.read(&file, full_offset, buffer.size() - 1).ok());
+}
+
+} // namespace starrocks::parquet
@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
+#include "formats/parquet/bloom_filter.h"
 #include "formats/parquet/parquet_test_util/util.h"
 #include "formats/parquet/parquet_ut_base.h"
 #include "formats/parquet/schema.h"
@@ -170,4 +173,59 @@ TEST_F(StatisticsHelperTest, TestInFilterDatetime) {
     ASSERT_FALSE(selected[1]);
 }
 
+TEST_F(StatisticsHelperTest, TestBloomFilterHashes) {
+    auto int_hash = [](auto value) { return ParquetBloomFilter::hash(&value, sizeof(value)); };
+    ParquetField field;
+    field.physical_type = tparquet::Type::type::INT32;
+
+    std::set<int32_t> in_oprands{2, 3, 7};
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::create_in_predicate_int_conjunct_ctxs(TExprOpcode::FILTER_IN, 0, in_oprands, &t_conjuncts);
+    ParquetUTBase::append_int_conjunct(TExprOpcode::EQ, 0, 5, &t_conjuncts);
+    ParquetUTBase::append_int_conjunct(TExprOpcode::LT, 0, 5, &t_conjuncts);
+    std::vector<ExprContext*> ctxs;
+    ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctxs);
+    ASSERT_EQ(3, ctxs.size());
+
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(StatisticsHelper::get_bloom_filter_hashes(ctxs[0], &field, &hashes));
+    std::sort(hashes.begin(), hashes.end());
+    std::vector<uint64_t> expected{int_hash(int32_t(2)), int_hash(int32_t(3)), int_hash(int32_t(7))};
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(expected, hashes);
+
+    ASSERT_TRUE(StatisticsHelper::get_bloom_filter_hashes(ctxs[1], &field, &hashes));
+    ASSERT_EQ(std::vector<uint64_t>{int_hash(int32_t(5))}, hashes);
+    ASSERT_FALSE(StatisticsHelper::get_bloom_filter_hashes(ctxs[2], &field, &hashes));
+
+    // The values are hashed in the physical type of the column.
+    field.physical_type = tparquet::Type::type::INT64;
+    ASSERT_TRUE(StatisticsHelper::get_bloom_filter_hashes(ctxs[1], &field, &hashes));
+    ASSERT_EQ(std::vector<uint64_t>{int_hash(int64_t(5))}, hashes);
+
+    // Neither the decimal nor the unsigned values are stored as they are.
+    field.schema_element.__set_converted_type(tparquet::ConvertedType::DECIMAL);
+    ASSERT_FALSE(StatisticsHelper::get_bloom_filter_hashes(ctxs[1], &field, &hashes));
+    field.schema_element.__set_converted_type(tparquet::ConvertedType::UINT_64);
+    ASSERT_FALSE(StatisticsHelper::get_bloom_filter_hashes(ctxs[1], &field, &hashes));
+}
+
+TEST_F(StatisticsHelperTest, TestBloomFilterHashesString) {
+    ParquetField field;
+    field.physical_type = tparquet::Type::type::BYTE_ARRAY;
+
+    std::set<std::string> in_oprands{"abc"};
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::create_in_predicate_string_conjunct_ctxs(TExprOpcode::FILTER_IN, 0, in_oprands, &t_conjuncts);
+    ParquetUTBase::create_in_predicate_string_conjunct_ctxs(TExprOpcode::FILTER_NOT_IN, 0, in_oprands, &t_conjuncts);
+    std::vector<ExprContext*> ctxs;
+    ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctxs);
+    ASSERT_EQ(2, ctxs.size());
+
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(StatisticsHelper::get_bloom_filter_hashes(ctxs[0], &field, &hashes));
+    ASSERT_EQ(std::vector<uint64_t>{ParquetBloomFilter::hash("abc", 3)}, hashes);
+    ASSERT_FALSE(StatisticsHelper::get_bloom_filter_hashes(ctxs[1], &field, &hashes));
+}
+
 } // namespace starrocks::parquet
\ No newline at end of file
@@ -16,9 +16,12 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
+
 #include "block_cache/block_cache.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -478,4 +481,114 @@ TEST_F(CacheInputStreamTest, test_peek) {
     }
 }
 
+TEST_F(CacheInputStreamTest, test_readahead) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 8;
+    const int64_t data_size = block_size * block_count;
+    std::vector<char> data(data_size);
+    gen_test_data(data.data(), data_size, block_size);
+
+    std::unique_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPoolBuilder("readahead").set_max_threads(2).build(&thread_pool));
+
+    for (int64_t max_query_bytes : {block_size * block_count, block_size}) {
+        const std::string file_name = "test_file_readahead_" + std::to_string(max_query_bytes);
+        std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data.data(), data_size));
+        std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+                new io::SharedBufferedInputStream(stream, file_name, data_size));
+        std::atomic_int64_t query_bytes = 0;
+        {
+            io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+            io::CacheInputStream::ReadaheadOptions readahead_options;
+            readahead_options.thread_pool = thread_pool.get();
+            readahead_options.max_blocks = 2;
+            readahead_options.query_bytes = &query_bytes;
+            readahead_options.max_query_bytes = max_query_bytes;
+            readahead_options.open_stream = [&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+                return std::make_shared<MockSeekableInputStream>(data.data(), data_size);
+            };
+            cache_stream.set_readahead_options(readahead_options);
+            auto& stats = cache_stream.stats();
+
+            for (int i = 0; i < block_count; ++i) {
+                std::vector<char> buffer(block_size);
+                read_stream_data(&cache_stream, i * block_size, block_size, buffer.data());
+                ASSERT_TRUE(check_data_content(buffer.data(), block_size, 'a' + i));
+                ASSERT_LE(query_bytes, max_query_bytes);
+                // Let the readahead finish, otherwise the blocks not started are read by the reader.
+                thread_pool->wait();
+            }
+            if (max_query_bytes > block_size) {
+                // The readahead starts after reading the first three blocks sequentially.
+                ASSERT_EQ(block_count - 3, stats.readahead_count);
+                ASSERT_EQ(block_count - 3, stats.readahead_hit_count);
+                ASSERT_EQ((block_count - 3) * block_size, stats.readahead_hit_bytes);
+            } else {
+                ASSERT_GT(stats.readahead_hit_count, 0);
+                ASSERT_LT(stats.readahead_hit_count, block_count - 3);
+            }
+            ASSERT_EQ(0, stats.readahead_cache_bytes);
+        }
+        ASSERT_EQ(0, query_bytes);
+    }
+    thread_pool->shutdown();
+}
+
+TEST_F(CacheInputStreamTest, test_readahead_not_started) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 8;
+    const int64_t data_size = block_size * block_count;
+    std::vector<char> data(data_size);
+    gen_test_data(data.data(), data_size, block_size);
+
+    // The only thread of the pool is busy, the readahead tasks are queued.
+    std::unique_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPoolBuilder("readahead").set_max_threads(1).build(&thread_pool));
+    std::promise<void> busy;
+    ASSERT_OK(thread_pool->submit_func([future = busy.get_future().share()] { future.wait(); }));
+
+    const std::string file_name = "test_file_readahead_not_started";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data.data(), data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    std::atomic_int64_t query_bytes = 0;
+    int num_opened_streams = 0;
+    {
+        io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+        io::CacheInputStream::ReadaheadOptions readahead_options;
+        readahead_options.thread_pool = thread_pool.get();
+        readahead_options.max_blocks = 2;
+        readahead_options.query_bytes = &query_bytes;
+        readahead_options.max_query_bytes = data_size;
+        readahead_options.open_stream = [&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+            num_opened_streams++;
+            return std::make_shared<MockSeekableInputStream>(data.data(), data_size);
+        };
+        cache_stream.set_readahead_options(readahead_options);
+        auto& stats = cache_stream.stats();
+
+        // The reader never waits for the queued tasks, it reads the blocks by itself.
+        for (int i = 0; i < block_count; ++i) {
+            std::vector<char> buffer(block_size);
+            read_stream_data(&cache_stream, i * block_size, block_size, buffer.data());
+            ASSERT_TRUE(check_data_content(buffer.data(), block_size, 'a' + i));
+        }
+        ASSERT_GT(stats.readahead_count, 0);
+        ASSERT_EQ(0, stats.readahead_hit_count);
+        ASSERT_EQ(0, stats.readahead_wait_ns);
+        // Nor does the destructor.
+    }
+    ASSERT_EQ(0, query_bytes);
+
+    busy.set_value();
+    thread_pool->wait();
+    // The cancelled tasks do nothing.
+    ASSERT_EQ(0, num_opened_streams);
+    thread_pool->shutdown();
+}
+
 } // namespace starrocks::io
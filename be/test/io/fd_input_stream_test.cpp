@@ -21,6 +21,7 @@
 
 #include <cstdlib>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
@@ -155,6 +156,41 @@ PARALLEL_TEST(FdInputStreamTest, test_skip) {
     ASSERT_EQ(0, in.get_errno());
 }
 
+// NOLINTNEXTLINE
+TEST(FdInputStreamTest, test_read_at_fully_batch) {
+    int fd = open_temp_file();
+    std::string content;
+    for (int i = 0; i < 10000; i++) {
+        content.append(std::to_string(i));
+    }
+    pwrite_or_die(fd, content.data(), content.size(), 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    bool old_enable = config::enable_io_uring_read;
+    for (bool enable_io_uring : {false, true}) {
+        // io_uring falls back to pread if it's not supported
+        config::enable_io_uring_read = enable_io_uring;
+        std::vector<std::string> buffs(200);
+        std::vector<ReadRange> ranges;
+        for (int i = 0; i < buffs.size(); i++) {
+            buffs[i].resize(1 + i * 13);
+            ranges.push_back(ReadRange{.offset = i * 97, .size = (int64_t)buffs[i].size(), .data = buffs[i].data()});
+        }
+        ASSERT_OK(in.read_at_fully_batch(ranges));
+        for (int i = 0; i < buffs.size(); i++) {
+            ASSERT_EQ(content.substr(i * 97, buffs[i].size()), buffs[i]);
+        }
+
+        char buff[10];
+        std::vector<ReadRange> eof_ranges{{.offset = 0, .size = 10, .data = buff},
+                                          {.offset = (int64_t)content.size() - 5, .size = 10, .data = buff}};
+        ASSERT_FALSE(in.read_at_fully_batch(eof_ranges).ok());
+    }
+    config::enable_io_uring_read = old_enable;
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(FdInputStreamTest, test_op_after_close) {
     int fd = open_temp_file();
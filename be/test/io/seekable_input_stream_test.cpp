@@ -101,4 +101,34 @@ PARALLEL_TEST(SeekableInputStreamTest, test_read_at_fully) {
     ASSERT_ERROR(in.read_at_fully(1, buff, 10));
 }
 
+class CountingInputStreamWrapper : public io::SeekableInputStreamWrapper {
+public:
+    explicit CountingInputStreamWrapper(SeekableInputStream* stream)
+            : io::SeekableInputStreamWrapper(stream, kDontTakeOwnership) {}
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        _read_count++;
+        return io::SeekableInputStreamWrapper::read_at_fully(offset, out, count);
+    }
+
+    int read_count() const { return _read_count; }
+
+private:
+    int _read_count{0};
+};
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(SeekableInputStreamTest, test_wrapper_read_at_fully_batch) {
+    TestInputStream in("0123456789", 5);
+    CountingInputStreamWrapper wrapper(&in);
+    char buff1[3];
+    char buff2[4];
+    std::vector<ReadRange> ranges{{.offset = 1, .size = 3, .data = buff1}, {.offset = 6, .size = 4, .data = buff2}};
+    ASSERT_OK(wrapper.read_at_fully_batch(ranges));
+    // the batch goes through read_at_fully() of the wrapper
+    ASSERT_EQ(2, wrapper.read_count());
+    ASSERT_EQ("123", std::string_view(buff1, 3));
+    ASSERT_EQ("6789", std::string_view(buff2, 4));
+}
+
 } // namespace starrocks::io
@@ -431,6 +431,70 @@ TEST_F(SpillTest, unsorted_process) {
     }
 }
 
+TEST_F(SpillTest, compressed_process) {
+    ObjectPool pool;
+
+    std::vector<bool> nullables = {false, true};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT << TYPE_SMALLINT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    auto ctx_st = no_partition_context(&pool, &dummy_rt_st, {}, tuple_slots);
+    ASSERT_OK(ctx_st.status());
+    auto ctx = ctx_st.value();
+    auto& tuple = ctx->sort_exprs.sort_tuple_slot_expr_ctxs();
+
+    RandomChunkBuilder chunk_builder;
+    auto factory = spill::make_spilled_factory();
+
+    // With direct io, the compressed blocks are padded to the page size.
+    std::vector<std::pair<CompressionTypePB, bool>> cases = {{CompressionTypePB::LZ4, false},
+                                                             {CompressionTypePB::ZSTD, false},
+                                                             {CompressionTypePB::LZ4, true},
+                                                             {CompressionTypePB::ZSTD, true}};
+    for (auto [compress_type, enable_direct_io] : cases) {
+        TQueryOptions query_options;
+        query_options.__set_spill_enable_direct_io(enable_direct_io);
+        RuntimeState rt_st(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+        rt_st.set_chunk_size(config::vector_chunk_size);
+
+        SpilledOptions spill_options;
+        spill_options.mem_table_pool_size = 4;
+        spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+        spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        spill_options.encode_level = 7;
+        spill_options.compress_type = compress_type;
+        spill_options.block_manager = dummy_block_mgr.get();
+
+        auto spiller = factory->create(spill_options);
+        spiller->set_metrics(metrics);
+        SpillerCaller<spill::RawSpillerWriter*, spill::SpillerReader*> caller(spiller.get());
+        ASSERT_OK(spiller->prepare(&rt_st));
+
+        size_t input_rows = 0;
+        for (size_t i = 0; i < 256; ++i) {
+            auto chunk = chunk_builder.gen(tuple, nullables);
+            input_rows += chunk->num_rows();
+            ASSERT_OK(caller.spill<SyncExecutor>(&rt_st, chunk, EmptyMemGuard{}));
+            ASSERT_OK(spiller->_spilled_task_status);
+        }
+        ASSERT_OK(caller.flush<SyncExecutor>(&rt_st, EmptyMemGuard{}));
+
+        size_t output_rows = 0;
+        ASSERT_OK(caller.trigger_restore<SyncExecutor>(&rt_st, EmptyMemGuard{}));
+        for (size_t i = 0; i < 256; ++i) {
+            auto chunk_st = caller.restore<SyncExecutor>(&rt_st, EmptyMemGuard{});
+            ASSERT_OK(chunk_st.status());
+            ASSERT_OK(spiller->_spilled_task_status);
+            if (chunk_st.value() != nullptr) {
+                output_rows += chunk_st.value()->num_rows();
+            }
+        }
+        ASSERT_TRUE(caller.restore<SyncExecutor>(&rt_st, EmptyMemGuard{}).status().is_end_of_file());
+        ASSERT_EQ(input_rows, output_rows);
+    }
+}
+
 TEST_F(SpillTest, order_by_process) {
     ObjectPool pool;
     // order by id_int
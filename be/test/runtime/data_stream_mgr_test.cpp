@@ -16,6 +16,16 @@
 
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "runtime/data_stream_recvr.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+#include "util/compression/zstd_dict_compression.h"
+#include "util/random.h"
+
 namespace starrocks {
 
 TEST(DataStreamMgr, pass_through_buffer_test) {
@@ -39,4 +49,100 @@ TEST(DataStreamMgr, pass_through_buffer_test) {
     mgr.reset();
 }
 
+// The chunks of a request are deserialized lazily and maybe out of order, so the chunks compressed with
+// a dictionary must be decoded even if they are fetched before the chunk carrying the dictionary.
+TEST(DataStreamMgr, compress_dict_received_after_chunk) {
+    TUniqueId query_id;
+    query_id.lo = 1122;
+    query_id.hi = 2023;
+    TUniqueId fragment_instance_id;
+    fragment_instance_id.lo = 1123;
+    fragment_instance_id.hi = 2023;
+
+    RuntimeState state(query_id, fragment_instance_id, TQueryOptions(), TQueryGlobals(), nullptr);
+    state.init_instance_mem_tracker();
+    ObjectPool obj_pool;
+    auto slot_infos = DescTblHelper::create_slot_type_desc_info_arrays({{{"c1", TYPE_VARCHAR, false}}});
+    DescriptorTbl* desc_tbl = DescTblHelper::generate_desc_tbl(&state, obj_pool, slot_infos);
+    TupleDescriptor* tuple_desc = desc_tbl->get_tuple_descriptor(0);
+    SlotId slot_id = tuple_desc->slots()[0]->id();
+    RowDescriptor row_desc(tuple_desc);
+
+    static const std::vector<std::string> kValues = {"warehouse-shanghai-pudong-0001", "status=DELIVERED;carrier=SF",
+                                                     "warehouse-beijing-chaoyang-0002", "status=IN_TRANSIT;carrier=JD"};
+    Random rnd(0);
+    auto make_chunk = [&](size_t num_rows) {
+        auto column = BinaryColumn::create();
+        for (size_t i = 0; i < num_rows; ++i) {
+            column->append(kValues[rnd.Uniform(kValues.size())] + std::to_string(rnd.Next()));
+        }
+        auto chunk = std::make_unique<Chunk>();
+        chunk->append_column(std::move(column), slot_id);
+        return chunk;
+    };
+
+    ZstdDictCompressor compressor(4, 16 * 1024);
+    while (!compressor.is_trained()) {
+        ASSERT_FALSE(compressor.is_failed());
+        ASSIGN_OR_ABORT(auto sample, serde::ProtobufChunkSerde::serialize_without_meta(*make_chunk(2048)));
+        compressor.add_sample(Slice(sample.data()));
+    }
+    auto compress_chunk = [&](const Chunk& chunk, bool with_dict, ChunkPB* pchunk) {
+        ASSIGN_OR_ABORT(*pchunk, serde::ProtobufChunkSerde::serialize_without_meta(chunk));
+        raw::RawString compressed;
+        ASSERT_OK(compressor.compress(Slice(pchunk->data()), &compressed));
+        pchunk->mutable_data()->assign(compressed.data(), compressed.size());
+        pchunk->set_compress_type(CompressionTypePB::ZSTD);
+        pchunk->set_compress_dict_id(compressor.dict_id());
+        if (with_dict) {
+            pchunk->set_compress_dict(compressor.dict());
+        }
+    };
+
+    auto mgr = std::make_unique<DataStreamMgr>();
+    mgr->prepare_pass_through_chunk_buffer(query_id);
+    auto recvr = mgr->create_recvr(&state, row_desc, fragment_instance_id, 1, 1, 1024 * 1024, false, nullptr, true,
+                                   1, false);
+
+    auto init_request = [&](PTransmitChunkParams* request) {
+        request->mutable_finst_id()->set_hi(fragment_instance_id.hi);
+        request->mutable_finst_id()->set_lo(fragment_instance_id.lo);
+        request->set_node_id(1);
+        request->set_sender_id(0);
+        request->set_be_number(0);
+    };
+
+    // The first request carries the chunk meta.
+    auto chunk0 = make_chunk(16);
+    PTransmitChunkParams request0;
+    init_request(&request0);
+    ASSIGN_OR_ABORT(*request0.add_chunks(), serde::ProtobufChunkSerde::serialize(*chunk0));
+    ::google::protobuf::Closure* done = nullptr;
+    ASSERT_OK(mgr->transmit_chunk(request0, &done));
+
+    // The chunk compressed with the dictionary is ahead of the chunk carrying the dictionary.
+    auto chunk1 = make_chunk(16);
+    auto chunk2 = make_chunk(16);
+    PTransmitChunkParams request1;
+    init_request(&request1);
+    compress_chunk(*chunk1, false, request1.add_chunks());
+    compress_chunk(*chunk2, true, request1.add_chunks());
+    ASSERT_OK(mgr->transmit_chunk(request1, &done));
+
+    for (const auto* expected : {chunk0.get(), chunk1.get(), chunk2.get()}) {
+        std::unique_ptr<Chunk> chunk;
+        ASSERT_OK(recvr->get_chunk_for_pipeline(&chunk, 0));
+        ASSERT_TRUE(chunk != nullptr);
+        ASSERT_EQ(expected->num_rows(), chunk->num_rows());
+        for (size_t i = 0; i < expected->num_rows(); ++i) {
+            ASSERT_EQ(expected->get_column_by_index(0)->get(i).get_slice(),
+                      chunk->get_column_by_slot_id(slot_id)->get(i).get_slice());
+        }
+    }
+
+    recvr->close();
+    mgr->destroy_pass_through_chunk_buffer(query_id);
+    mgr->close();
+}
+
 } // namespace starrocks
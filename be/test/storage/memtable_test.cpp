@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -35,6 +36,7 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -528,4 +530,50 @@ TEST_F(MemTableTest, test_metrics) {
     ASSERT_TRUE(StarRocksMetrics::instance()->memtable_flush_disk_bytes_total.value() > 0);
 }
 
+TEST_F(MemTableTest, test_parallel_sort) {
+    const string path = "./MemTableTest_test_parallel_sort";
+    const size_t n = 10000;
+    auto sort_and_get_result = [&](KeysType keys_type, bool parallel, int dop) -> ChunkPtr {
+        MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, keys_type), "pk int,name varchar,pv int", path);
+        // many duplicated keys with different values, to check the result is the same as the serial stable sort
+        ChunkPtr chunk = ChunkHelper::new_chunk(*_slots, n);
+        for (size_t i = 0; i < n; i++) {
+            std::string name = StringPrintf("str%d", static_cast<int>(i % 7));
+            chunk->get_column_by_index(0)->append_datum(Datum(static_cast<int32_t>(i % 100)));
+            chunk->get_column_by_index(1)->append_datum(Datum(Slice(name)));
+            chunk->get_column_by_index(2)->append_datum(Datum(static_cast<int32_t>(i)));
+        }
+        vector<uint32_t> indexes(n);
+        std::iota(indexes.begin(), indexes.end(), 0);
+        std::shuffle(indexes.begin(), indexes.end(), std::mt19937(42));
+
+        config::enable_memtable_parallel_sort = parallel;
+        config::memtable_parallel_sort_min_rows = 1;
+        config::memtable_parallel_sort_dop = dop;
+        EXPECT_TRUE(_mem_table->insert(*chunk, indexes.data(), 0, indexes.size()).ok());
+        EXPECT_OK(_mem_table->finalize());
+        return _mem_table->get_result_chunk();
+    };
+    auto old_enable = config::enable_memtable_parallel_sort;
+    auto old_min_rows = config::memtable_parallel_sort_min_rows;
+    auto old_dop = config::memtable_parallel_sort_dop;
+    DeferOp defer([&]() {
+        config::enable_memtable_parallel_sort = old_enable;
+        config::memtable_parallel_sort_min_rows = old_min_rows;
+        config::memtable_parallel_sort_dop = old_dop;
+    });
+
+    for (auto keys_type : {KeysType::DUP_KEYS, KeysType::UNIQUE_KEYS}) {
+        ChunkPtr expected = sort_and_get_result(keys_type, false, 1);
+        ASSERT_EQ(keys_type == KeysType::DUP_KEYS ? n : 100, expected->num_rows());
+        for (int dop : {2, 3, 4, 8}) {
+            ChunkPtr result = sort_and_get_result(keys_type, true, dop);
+            ASSERT_EQ(expected->num_rows(), result->num_rows());
+            for (size_t i = 0; i < expected->num_rows(); i++) {
+                ASSERT_EQ(expected->debug_row(i), result->debug_row(i)) << "keys_type=" << keys_type << " dop=" << dop;
+            }
+        }
+    }
+}
+
 } // namespace starrocks
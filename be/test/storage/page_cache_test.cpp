@@ -36,7 +36,11 @@
 
 #include <gtest/gtest.h>
 
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "runtime/mem_tracker.h"
+#include "storage/rowset/parsed_page.h"
+#include "testutil/assert.h"
 
 namespace starrocks {
 
@@ -184,4 +188,137 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+TEST_F(StoragePageCacheTest, contains) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+
+    StoragePageCache::CacheKey key("abc", 0);
+    {
+        char* buf = new char[1024];
+        PageCacheHandle handle;
+        cache.insert(key, Slice(buf, 1024), &handle, false);
+    }
+    ASSERT_TRUE(cache.contains(key));
+    ASSERT_FALSE(cache.contains(StoragePageCache::CacheKey("abc", 1024)));
+    // The probes are not counted as the lookups.
+    ASSERT_EQ(0, cache.get_lookup_count());
+    ASSERT_EQ(0, cache.get_hit_count());
+}
+
+TEST_F(StoragePageCacheTest, decoded_page) {
+    StoragePageCache disabled(_mem_tracker.get(), kNumShards * 2048);
+    ASSERT_FALSE(disabled.decoded_cache_enabled());
+
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048, kNumShards * 1024 * 1024);
+    ASSERT_TRUE(cache.decoded_cache_enabled());
+
+    StoragePageCache::DecodedCacheKey key("abc", 0, TYPE_INT, BIT_SHUFFLE);
+    {
+        auto page = std::make_unique<DecodedPage>();
+        auto data = Int32Column::create();
+        auto nulls = NullColumn::create();
+        for (int i = 0; i < 100; i++) {
+            data->append(i);
+            nulls->append(i % 10 == 0);
+        }
+        page->column = NullableColumn::create(std::move(data), std::move(nulls));
+        page->first_ordinal = 1000;
+        page->encoding_type = BIT_SHUFFLE;
+        size_t charge = page->column->memory_usage();
+        PageCacheHandle handle;
+        cache.insert_decoded(
+                key, page.release(), charge,
+                [](const CacheKey& key, void* value) { delete static_cast<DecodedPage*>(value); }, &handle);
+    }
+
+    // The same page decoded as another type or by another encoding is another entry.
+    PageCacheHandle other_handle;
+    ASSERT_FALSE(cache.lookup_decoded(StoragePageCache::DecodedCacheKey("abc", 0, TYPE_BIGINT, BIT_SHUFFLE),
+                                      &other_handle));
+    ASSERT_FALSE(cache.lookup_decoded(StoragePageCache::DecodedCacheKey("abc", 0, TYPE_INT, PLAIN_ENCODING),
+                                      &other_handle));
+
+    ASSERT_TRUE(cache.contains_decoded(key));
+    ASSERT_EQ(2, cache.get_decoded_lookup_count());
+    PageCacheHandle handle;
+    ASSERT_TRUE(cache.lookup_decoded(key, &handle));
+    // The raw cache and the decoded tier don't share the entries.
+    PageCacheHandle raw_handle;
+    ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey("abc", 0), &raw_handle));
+
+    DecodedParsedPage page(std::move(handle), PagePointer(0, 4096), 3);
+    ASSERT_EQ(1000, page.first_ordinal());
+    ASSERT_EQ(100, page.num_rows());
+    ASSERT_EQ(BIT_SHUFFLE, page.encoding_type());
+    ASSERT_TRUE(page.contains(1099));
+
+    // read into a nullable column
+    auto nullable = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    ASSERT_OK(page.seek(5));
+    size_t count = 10;
+    ASSERT_OK(page.read(nullable.get(), &count));
+    ASSERT_EQ(10, count);
+    ASSERT_EQ(15, page.offset());
+    ASSERT_EQ(10, nullable->size());
+    ASSERT_TRUE(nullable->is_null(5));
+    ASSERT_EQ(6, nullable->get(1).get_int32());
+
+    // read sparse ranges into a not nullable column
+    auto column = Int32Column::create();
+    SparseRange<> range;
+    range.add(Range<>(15, 18));
+    range.add(Range<>(95, 100));
+    ASSERT_OK(page.read(column.get(), range));
+    ASSERT_EQ(100, page.offset());
+    ASSERT_EQ(8, column->size());
+    ASSERT_EQ(15, column->get_data()[0]);
+    ASSERT_EQ(99, column->get_data()[7]);
+
+    // read at the end of page
+    count = 10;
+    ASSERT_OK(page.read(column.get(), &count));
+    ASSERT_EQ(0, count);
+    ASSERT_FALSE(page.read_dict_codes(column.get(), &count).ok());
+
+    // the nulls can't be read into a not nullable column
+    ASSERT_OK(page.seek(10));
+    count = 1;
+    ASSERT_FALSE(page.read(column.get(), &count).ok());
+
+    ASSERT_EQ(3, cache.get_decoded_lookup_count());
+    ASSERT_EQ(1, cache.get_decoded_hit_count());
+}
+
+TEST_F(StoragePageCacheTest, decoded_page_read_as_nullable) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048, kNumShards * 1024 * 1024);
+
+    // A page of a not nullable column.
+    StoragePageCache::DecodedCacheKey key("abc", 0, TYPE_INT, BIT_SHUFFLE);
+    PageCacheHandle handle;
+    {
+        auto page = std::make_unique<DecodedPage>();
+        auto data = Int32Column::create();
+        for (int i = 0; i < 100; i++) {
+            data->append(i);
+        }
+        page->column = std::move(data);
+        page->encoding_type = BIT_SHUFFLE;
+        size_t charge = page->column->memory_usage();
+        cache.insert_decoded(
+                key, page.release(), charge,
+                [](const CacheKey& key, void* value) { delete static_cast<DecodedPage*>(value); }, &handle);
+    }
+
+    // read it into a nullable column, e.g. by the reader of a column altered to nullable
+    DecodedParsedPage page(std::move(handle), PagePointer(0, 4096), 0);
+    auto nullable = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    SparseRange<> range;
+    range.add(Range<>(0, 3));
+    range.add(Range<>(50, 52));
+    ASSERT_OK(page.read(nullable.get(), range));
+    ASSERT_EQ(5, nullable->size());
+    ASSERT_FALSE(nullable->has_null());
+    ASSERT_EQ(nullable->data_column()->size(), nullable->null_column()->size());
+    ASSERT_EQ(51, nullable->get(4).get_int32());
+}
+
 } // namespace starrocks
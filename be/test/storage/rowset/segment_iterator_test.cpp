@@ -22,6 +22,7 @@
 #include <unordered_map>
 
 #include "common/object_pool.h"
+#include "exprs/runtime_filter_bank.h"
 #include "fs/fs_memory.h"
 #include "gen_cpp/tablet_schema.pb.h"
 #include "gtest/gtest.h"
@@ -530,4 +531,90 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentIteratorTest, TestRuntimeFilterPushdown) {
+    using namespace starrocks::test;
+
+    std::string file_name = kSegmentDir + "/runtime_filter";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+    TabletSchemaBuilder builder;
+    std::shared_ptr<TabletSchema> tablet_schema = builder.create(1, false, TYPE_INT, true)
+                                                          .create(2, false, TYPE_INT)
+                                                          .create(3, false, TYPE_VARCHAR)
+                                                          .build();
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    const size_t num_rows = 10000;
+    std::vector<std::string> values(64);
+    for (int i = 0; i < values.size(); ++i) {
+        values[i] = fmt::format("prefix-{}", i);
+    }
+    TabletDataBuilder segment_data_builder(writer, tablet_schema, chunk_size, num_rows);
+    ASSERT_OK(segment_data_builder.append(0, [](int32_t i) { return i; }));
+    ASSERT_OK(segment_data_builder.append(1, [](int32_t i) { return i * 10; }));
+    ASSERT_OK(segment_data_builder.append(2, [&values](int32_t i) { return Slice(values[i % values.size()]); }));
+    ASSERT_OK(segment_data_builder.finalize_footer());
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+
+    // c1 in (50, 5000, 50000)
+    ObjectPool pool;
+    JoinRuntimeFilter* rf = RuntimeFilterHelper::create_join_runtime_filter(&pool, TYPE_INT);
+    rf->init(3);
+    auto rf_column = Int32Column::create();
+    rf_column->append(50);
+    rf_column->append(5000);
+    rf_column->append(50000);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(rf_column, TYPE_INT, rf, 0, false));
+    RuntimeFilterProbeDescriptor arrived_desc;
+    arrived_desc.set_runtime_filter(rf);
+    RuntimeFilterProbeDescriptor unarrived_desc;
+
+    VecSchemaBuilder schema_builder;
+    schema_builder.add(0, "c0", TYPE_INT).add(1, "c1", TYPE_INT).add(2, "c2", TYPE_VARCHAR);
+    auto vec_schema = schema_builder.build();
+
+    auto read = [&](const RuntimeFilterProbeDescriptor* desc, OlapReaderStatistics* stats) {
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = stats;
+        seg_opts.tablet_schema = tablet_schema;
+        seg_opts.runtime_filter_preds.add(desc, 1);
+
+        auto chunk_iter = new_segment_iterator(segment, vec_schema, seg_opts);
+        CHECK(chunk_iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS).ok());
+        CHECK(chunk_iter->init_output_schema(std::unordered_set<uint32_t>()).ok());
+        auto chunk = ChunkHelper::new_chunk(chunk_iter->output_schema(), chunk_size);
+        std::vector<int32_t> rows;
+        while (chunk_iter->get_next(chunk.get()).ok()) {
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                int32_t c0 = chunk->get_column_by_index(0)->get(i).get_int32();
+                // the late materialized columns are of the same rows
+                CHECK_EQ(c0 * 10, chunk->get_column_by_index(1)->get(i).get_int32());
+                CHECK_EQ(values[c0 % values.size()], chunk->get_column_by_index(2)->get(i).get_slice().to_string());
+                rows.push_back(c0);
+            }
+            chunk->reset();
+        }
+        return rows;
+    };
+
+    OlapReaderStatistics stats;
+    auto rows = read(&arrived_desc, &stats);
+    for (int32_t row : {5, 500, 5000}) {
+        ASSERT_TRUE(std::find(rows.begin(), rows.end(), row) != rows.end()) << row;
+    }
+    // the bloom filter may have false positives
+    ASSERT_LT(rows.size(), 100);
+    ASSERT_EQ(num_rows - rows.size(), stats.rows_runtime_filter_filtered);
+
+    // the runtime filter hasn't arrived
+    OlapReaderStatistics unarrived_stats;
+    rows = read(&unarrived_desc, &unarrived_stats);
+    ASSERT_EQ(num_rows, rows.size());
+    ASSERT_EQ(0, unarrived_stats.rows_runtime_filter_filtered);
+}
+
 } // namespace starrocks
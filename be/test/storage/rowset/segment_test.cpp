@@ -39,6 +39,8 @@
 #include <functional>
 #include <iostream>
 
+#include "column/binary_column.h"
+#include "column/column_helper.h"
 #include "column/datum_tuple.h"
 #include "common/logging.h"
 #include "fs/fs_memory.h"
@@ -477,6 +479,51 @@ TEST_F(SegmentReaderWriterTest, TestReadMultipleTypesColumn) {
     EXPECT_EQ(count, num_rows);
 }
 
+// Only the string columns read as the only key of the hash aggregations and the join probes keep their dict codes.
+TEST_F(SegmentReaderWriterTest, TestReadDictCodesOfKeyColumns) {
+    static const std::vector<std::string> words{"apple", "banana", "cherry", "durian"};
+    ColumnPB c1 = create_int_key_pb(1);
+    ColumnPB c2 = create_with_default_value_pb("VARCHAR", "");
+    c2.set_length(65535);
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema({c1, c2});
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    const size_t num_rows = 1000;
+    shared_ptr<Segment> segment;
+    build_segment(opts, tablet_schema, tablet_schema, num_rows,
+                  [](size_t rid, int cid, int block_id) {
+                      return cid == 0 ? Datum(static_cast<int32_t>(rid)) : Datum(Slice(words[rid % words.size()]));
+                  },
+                  &segment);
+
+    auto read_column = [&](const std::unordered_set<uint32_t>* dict_code_column_ids) {
+        SegmentReadOptions seg_options;
+        seg_options.fs = _fs;
+        OlapReaderStatistics stats;
+        seg_options.stats = &stats;
+        seg_options.dict_code_column_ids = dict_code_column_ids;
+        auto schema = ChunkHelper::convert_schema(tablet_schema);
+        auto seg_iterator = segment->new_iterator(schema, seg_options).value();
+        auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+        EXPECT_OK(seg_iterator->get_next(chunk.get()));
+        return chunk->get_column_by_index(1);
+    };
+
+    auto column = read_column(nullptr);
+    EXPECT_FALSE(ColumnHelper::get_binary_column(column.get())->has_dict_codes());
+
+    std::unordered_set<uint32_t> dict_code_column_ids{1};
+    column = read_column(&dict_code_column_ids);
+    const auto* binary = ColumnHelper::get_binary_column(column.get());
+    ASSERT_TRUE(binary->has_dict_codes());
+    ASSERT_EQ(binary->size(), binary->dict_codes().size());
+    for (size_t i = 0; i < binary->size(); i++) {
+        EXPECT_EQ(words[i % words.size()], binary->get_slice(i).to_string());
+        EXPECT_EQ(binary->get_slice(i), binary->dict()->get_slice(binary->dict_codes()[i]));
+    }
+}
+
 TEST_F(SegmentReaderWriterTest, TestTypeConversion) {
     auto tablet_schema = std::shared_ptr<TabletSchema>{
             TabletSchemaHelper::create_tablet_schema({create_int_key_pb(0), create_int_value_pb(1)})};
@@ -0,0 +1,199 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/tinylfu_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+class TinyLFUCacheTest : public testing::Test {
+public:
+    static std::vector<std::string>* s_deleted_keys;
+
+    static void deleter(const CacheKey& key, void* value) { s_deleted_keys->push_back(key.to_string()); }
+
+    void SetUp() override { s_deleted_keys = &_deleted_keys; }
+
+    static void insert(TinyLFUCache* cache, const std::string& key, size_t charge,
+                       CachePriority priority = CachePriority::NORMAL) {
+        CacheKey cache_key(key);
+        uint32_t hash = cache_key.hash(key.data(), key.size(), 0);
+        cache->release(cache->insert(cache_key, hash, nullptr, charge, &deleter, priority));
+    }
+
+    static bool lookup(TinyLFUCache* cache, const std::string& key) {
+        CacheKey cache_key(key);
+        uint32_t hash = cache_key.hash(key.data(), key.size(), 0);
+        auto* handle = cache->lookup(cache_key, hash);
+        cache->release(handle);
+        return handle != nullptr;
+    }
+
+    // Lookup the key, and insert it on miss, which is how the page cache is used.
+    static void access(TinyLFUCache* cache, const std::string& key, size_t charge) {
+        if (!lookup(cache, key)) {
+            insert(cache, key, charge);
+        }
+    }
+
+    std::vector<std::string> _deleted_keys;
+};
+
+std::vector<std::string>* TinyLFUCacheTest::s_deleted_keys = nullptr;
+
+TEST_F(TinyLFUCacheTest, test_frequency_sketch) {
+    FrequencySketch sketch;
+    ASSERT_EQ(0, sketch.frequency(1));
+    for (int i = 0; i < 5; i++) {
+        sketch.increment(1);
+    }
+    ASSERT_EQ(5, sketch.frequency(1));
+    for (int i = 0; i < 20; i++) {
+        sketch.increment(2);
+    }
+    // 4-bit counters saturate
+    ASSERT_EQ(15, sketch.frequency(2));
+
+    sketch.ensure_capacity(1000);
+    ASSERT_EQ(1024, sketch.num_words());
+    ASSERT_EQ(0, sketch.frequency(1));
+
+    // the counters are halved after 10 * num_words increments
+    for (int i = 0; i < 8; i++) {
+        sketch.increment(1);
+    }
+    for (uint32_t i = 0; i < 10 * 1024; i++) {
+        sketch.increment(1000000 + i);
+    }
+    ASSERT_LE(sketch.frequency(1), 4);
+}
+
+TEST_F(TinyLFUCacheTest, test_hit_and_erase) {
+    TinyLFUCache cache;
+    cache.set_capacity(1000);
+    insert(&cache, "a", 100);
+    insert(&cache, "b", 200);
+    ASSERT_EQ(300, cache.get_usage());
+    ASSERT_TRUE(lookup(&cache, "a"));
+    ASSERT_TRUE(lookup(&cache, "b"));
+    ASSERT_FALSE(lookup(&cache, "c"));
+    ASSERT_EQ(3, cache.get_lookup_count());
+    ASSERT_EQ(2, cache.get_hit_count());
+
+    // replace
+    insert(&cache, "a", 300);
+    ASSERT_EQ(500, cache.get_usage());
+    ASSERT_EQ(std::vector<std::string>{"a"}, _deleted_keys);
+
+    cache.erase(CacheKey("b"), CacheKey("b").hash("b", 1, 0));
+    ASSERT_EQ(300, cache.get_usage());
+    ASSERT_FALSE(lookup(&cache, "b"));
+
+    ASSERT_EQ(1, cache.prune());
+    ASSERT_EQ(0, cache.get_usage());
+}
+
+TEST_F(TinyLFUCacheTest, test_pinned_entry) {
+    TinyLFUCache cache;
+    cache.set_capacity(100);
+    CacheKey key("pinned");
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    auto* handle = cache.insert(key, hash, nullptr, 60, &deleter);
+    for (int i = 0; i < 100; i++) {
+        insert(&cache, std::to_string(i), 10);
+    }
+    // the entry in use can't be evicted
+    ASSERT_TRUE(lookup(&cache, "pinned"));
+    ASSERT_LE(cache.get_usage(), 100);
+    cache.release(handle);
+    ASSERT_LE(cache.get_usage(), 100);
+}
+
+TEST_F(TinyLFUCacheTest, test_usage_within_capacity) {
+    TinyLFUCache cache;
+    cache.set_capacity(1000);
+    for (int i = 0; i < 10000; i++) {
+        access(&cache, std::to_string(i % 1500), 1 + i % 7);
+        ASSERT_LE(cache.get_usage(), 1000);
+    }
+    cache.set_capacity(100);
+    ASSERT_LE(cache.get_usage(), 100);
+}
+
+TEST_F(TinyLFUCacheTest, test_scan_resistance) {
+    const size_t kCapacity = 1000;
+    const int kHotKeys = 500;
+    auto run = [&](auto* cache) {
+        for (int round = 0; round < 5; round++) {
+            for (int i = 0; i < kHotKeys; i++) {
+                access(cache, "hot" + std::to_string(i), 1);
+            }
+        }
+        // a large scan touches every key once
+        for (int i = 0; i < 100 * kCapacity; i++) {
+            access(cache, "scan" + std::to_string(i), 1);
+        }
+        int hot_keys_in_cache = 0;
+        for (int i = 0; i < kHotKeys; i++) {
+            hot_keys_in_cache += lookup(cache, "hot" + std::to_string(i));
+        }
+        return hot_keys_in_cache;
+    };
+
+    TinyLFUCache cache;
+    cache.set_capacity(kCapacity);
+    int tinylfu_hot_keys = run(&cache);
+    ASSERT_GT(cache.get_reject_count(), 0);
+    // the working set survives the scan
+    ASSERT_GE(tinylfu_hot_keys, kHotKeys * 9 / 10);
+}
+
+TEST_F(TinyLFUCacheTest, test_durable) {
+    TinyLFUCache cache;
+    cache.set_capacity(1000);
+    insert(&cache, "durable", 100, CachePriority::DURABLE);
+    for (int i = 0; i < 10000; i++) {
+        access(&cache, std::to_string(i), 10);
+    }
+    ASSERT_TRUE(lookup(&cache, "durable"));
+}
+
+TEST_F(TinyLFUCacheTest, test_new_cache) {
+    std::unique_ptr<Cache> cache(new_cache("tinylfu", 32 * 1000));
+    ASSERT_NE(nullptr, dynamic_cast<ShardedTinyLFUCache*>(cache.get()));
+    auto* handle = cache->insert(CacheKey("a"), nullptr, 10, &deleter);
+    cache->release(handle);
+    handle = cache->lookup(CacheKey("a"));
+    ASSERT_NE(nullptr, handle);
+    cache->release(handle);
+    ASSERT_EQ(10, cache->get_memory_usage());
+    ASSERT_EQ(1, cache->get_hit_count());
+
+    rapidjson::Document document;
+    document.SetArray();
+    cache->get_cache_status(&document);
+    ASSERT_EQ(kNumShards, document.Size());
+
+    std::unique_ptr<Cache> lru_cache(new_cache("lru", 1000));
+    ASSERT_NE(nullptr, dynamic_cast<ShardedLRUCache*>(lru_cache.get()));
+    std::unique_ptr<Cache> default_cache(new_cache("unknown", 1000));
+    ASSERT_NE(nullptr, dynamic_cast<ShardedLRUCache*>(default_cache.get()));
+}
+
+} // namespace starrocks
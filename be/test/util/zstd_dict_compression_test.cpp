@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/compression/zstd_dict_compression.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/assert.h"
+#include "util/compression/block_compression.h"
+#include "util/random.h"
+
+namespace starrocks {
+
+// Build a block which looks like a serialized string column with a small set of repeated values.
+static std::string make_block(Random* rnd, size_t num_values) {
+    static const std::vector<std::string> kValues = {
+            "warehouse-shanghai-pudong-0001", "warehouse-beijing-chaoyang-0002", "warehouse-shenzhen-nanshan-0003",
+            "status=DELIVERED;carrier=SF",    "status=IN_TRANSIT;carrier=JD",    "status=RETURNED;carrier=ZTO"};
+    std::string block;
+    for (size_t i = 0; i < num_values; ++i) {
+        block.append(kValues[rnd->Uniform(kValues.size())]);
+        uint32_t id = rnd->Next();
+        block.append(reinterpret_cast<const char*>(&id), sizeof(id));
+    }
+    return block;
+}
+
+TEST(ZstdDictCompressionTest, compress_and_decompress) {
+    Random rnd(0);
+    ZstdDictCompressor compressor(8, 16 * 1024);
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_FALSE(compressor.is_trained());
+        compressor.add_sample(make_block(&rnd, 2048));
+    }
+    ASSERT_FALSE(compressor.is_failed());
+    ASSERT_TRUE(compressor.is_trained());
+    ASSERT_FALSE(compressor.dict().empty());
+    ASSERT_FALSE(compressor.is_dict_delivered());
+
+    ASSIGN_OR_ABORT(auto decompressor, ZstdDictDecompressor::create(compressor.dict()));
+
+    const BlockCompressionCodec* codec = nullptr;
+    ASSERT_OK(get_block_compression_codec(CompressionTypePB::ZSTD, &codec));
+
+    size_t dict_compressed_bytes = 0;
+    size_t plain_compressed_bytes = 0;
+    for (int i = 0; i < 16; ++i) {
+        std::string block = make_block(&rnd, 64);
+
+        raw::RawString compressed;
+        ASSERT_OK(compressor.compress(block, &compressed));
+        dict_compressed_bytes += compressed.size();
+
+        std::string uncompressed(block.size(), '\0');
+        Slice output(uncompressed.data(), uncompressed.size());
+        ASSERT_OK(decompressor->decompress(Slice(compressed.data(), compressed.size()), &output));
+        ASSERT_EQ(block.size(), output.size);
+        ASSERT_EQ(block, uncompressed);
+
+        std::string plain(codec->max_compressed_len(block.size()), '\0');
+        Slice plain_output(plain.data(), plain.size());
+        ASSERT_OK(codec->compress(block, &plain_output));
+        plain_compressed_bytes += plain_output.size;
+    }
+    // The dictionary should help on the small blocks.
+    ASSERT_LT(dict_compressed_bytes, plain_compressed_bytes);
+}
+
+TEST(ZstdDictCompressionTest, train_failed) {
+    ZstdDictCompressor compressor(1, 16 * 1024);
+    // Too few samples to train a dictionary.
+    compressor.add_sample(Slice("abc"));
+    ASSERT_TRUE(compressor.is_failed());
+    ASSERT_FALSE(compressor.is_trained());
+
+    ZstdDictCompressor disabled(0, 16 * 1024);
+    ASSERT_TRUE(disabled.is_failed());
+}
+
+} // namespace starrocks
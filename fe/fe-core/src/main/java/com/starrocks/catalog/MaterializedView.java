@@ -60,6 +60,7 @@ import com.starrocks.scheduler.TableWithPartitions;
 import com.starrocks.scheduler.Task;
 import com.starrocks.scheduler.TaskBuilder;
 import com.starrocks.scheduler.TaskManager;
+import com.starrocks.scheduler.mv.MaterializedViewMgr;
 import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.server.RunMode;
 import com.starrocks.server.WarehouseManager;
@@ -932,6 +933,15 @@ public class MaterializedView extends OlapTable implements GsonPreProcessable, G
         if (refreshTask != null) {
             taskManager.dropTasks(Lists.newArrayList(refreshTask.getId()), replay);
         }
+
+        // 4. Stop the maintenance job of the incremental MV, and drop its states
+        if (!replay && refreshScheme != null && refreshScheme.isIncremental()) {
+            try {
+                MaterializedViewMgr.getInstance().dropMaintainMV(this);
+            } catch (Exception e) {
+                LOG.warn("failed to stop the maintenance job of the dropped mv {}", getName(), e);
+            }
+        }
     }
 
     @Override
@@ -381,6 +381,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // higher compression ratio may be chosen to use more CPU and make the overall query time lower.
     public static final String TRANSMISSION_COMPRESSION_TYPE = "transmission_compression_type";
     public static final String LOAD_TRANSMISSION_COMPRESSION_TYPE = "load_transmission_compression_type";
+    public static final String ENABLE_TRANSMISSION_COMPRESSION_DICT = "enable_transmission_compression_dict";
+    public static final String ENABLE_ADAPTIVE_TRANSMISSION_COMPRESSION = "enable_adaptive_transmission_compression";
 
     public static final String RUNTIME_JOIN_FILTER_PUSH_DOWN_LIMIT = "runtime_join_filter_push_down_limit";
     public static final String ENABLE_GLOBAL_RUNTIME_FILTER = "enable_global_runtime_filter";
@@ -525,6 +527,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
 
     public static final String ENABLE_ICEBERG_IDENTITY_COLUMN_OPTIMIZE = "enable_iceberg_identity_column_optimize";
     public static final String ENABLE_PIPELINE_LEVEL_SHUFFLE = "enable_pipeline_level_shuffle";
+    public static final String ENABLE_SHARED_AGG_HASH_TABLE = "enable_shared_agg_hash_table";
 
     public static final String ENABLE_PLAN_SERIALIZE_CONCURRENTLY = "enable_plan_serialize_concurrently";
 
@@ -635,6 +638,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // only used in test. spill_mode="RANDOM"
     public static final String SPILL_RAND_RATIO = "spill_rand_ratio";
     public static final String SPILL_ENCODE_LEVEL = "spill_encode_level";
+    public static final String SPILL_COMPRESSION_TYPE = "spill_compression_type";
     public static final String SPILL_STORAGE_VOLUME = "spill_storage_volume";
 
     // full_sort_max_buffered_{rows,bytes} are thresholds that limits input size of partial_sort
@@ -1138,6 +1142,11 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = SPILL_ENCODE_LEVEL)
     private int spillEncodeLevel = 7;
 
+    // the block compression of spilled data, applied to the whole block after the column encoding.
+    // supported: NO_COMPRESSION, LZ4, ZSTD. zstd costs more cpu but writes much less when spilling is disk bound.
+    @VarAttr(name = SPILL_COMPRESSION_TYPE)
+    private String spillCompressionType = "LZ4";
+
     @VarAttr(name = SPILL_ENABLE_DIRECT_IO)
     private boolean spillEnableDirectIO = false;
 
@@ -1282,6 +1291,16 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VariableMgr.VarAttr(name = TRANSMISSION_COMPRESSION_TYPE)
     private String transmissionCompressionType = "NO_COMPRESSION";
 
+    // Only works with transmission_compression_type = zstd. If true, each exchange channel trains a zstd dictionary
+    // on its first chunks, and compresses the following chunks with it.
+    @VariableMgr.VarAttr(name = ENABLE_TRANSMISSION_COMPRESSION_DICT)
+    private boolean enableTransmissionCompressionDict = false;
+
+    // If true, each exchange channel switches among no compression, lz4 and zstd at runtime,
+    // according to the measured compression ratio, compression speed and network throughput.
+    @VariableMgr.VarAttr(name = ENABLE_ADAPTIVE_TRANSMISSION_COMPRESSION)
+    private boolean enableAdaptiveTransmissionCompression = false;
+
     // if a packet's size is larger than RPC_HTTP_MIN_SIZE, it will use RPC via http, as the std rpc has 2GB size limit.
     // the setting size is a bit smaller than 2GB, as the pre-computed serialization size of packets may not accurate.
     // no need to change it in general.
@@ -2172,6 +2191,11 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = ENABLE_PIPELINE_LEVEL_SHUFFLE, flag = VariableMgr.INVISIBLE)
     private boolean enablePipelineLevelShuffle = true;
 
+    // If true, all the drivers of a blocking aggregation with group by keys insert into the same partitioned
+    // hash tables, instead of shuffling the input by a local exchange.
+    @VarAttr(name = ENABLE_SHARED_AGG_HASH_TABLE)
+    private boolean enableSharedAggHashTable = false;
+
     @VarAttr(name = ENABLE_CONSTANT_EXECUTE_IN_FE)
     private boolean enableConstantExecuteInFE = true;
 
@@ -2691,6 +2715,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         return this.spillEncodeLevel;
     }
 
+    public String getSpillCompressionType() {
+        return this.spillCompressionType;
+    }
+
     public boolean getForwardToLeader() {
         return forwardToLeader;
     }
@@ -4002,6 +4030,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
             spillOptions.setSpill_operator_max_bytes(spillOperatorMaxBytes);
             spillOptions.setSpill_revocable_max_bytes(spillRevocableMaxBytes);
             spillOptions.setSpill_encode_level(spillEncodeLevel);
+            TCompressionType spillCompression = CompressionUtils.findTCompressionByName(spillCompressionType);
+            if (spillCompression != null) {
+                spillOptions.setSpill_compression_type(spillCompression);
+            }
             spillOptions.setSpillable_operator_mask(spillableOperatorMask);
             spillOptions.setEnable_agg_spill_preaggregation(enableAggSpillPreaggregation);
             spillOptions.setSpill_enable_direct_io(spillEnableDirectIO);
@@ -4035,6 +4067,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
             tResult.setTransmission_compression_type(compressionType);
         }
 
+        tResult.setEnable_transmission_compression_dict(enableTransmissionCompressionDict);
+        tResult.setEnable_adaptive_transmission_compression(enableAdaptiveTransmissionCompression);
         tResult.setTransmission_encode_level(transmissionEncodeLevel);
         tResult.setGroup_concat_max_len(groupConcatMaxLen);
         tResult.setRpc_http_min_size(rpcHttpMinSize);
@@ -4094,6 +4128,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         tResult.setScan_use_query_mem_ratio(scanUseQueryMemRatio);
         tResult.setEnable_collect_table_level_scan_stats(enableCollectTableLevelScanStats);
         tResult.setEnable_pipeline_level_shuffle(enablePipelineLevelShuffle);
+        tResult.setEnable_shared_agg_hash_table(enableSharedAggHashTable);
         tResult.setEnable_hyperscan_vec(enableHyperscanVec);
         tResult.setJit_level(jitLevel);
         tResult.setEnable_result_sink_accumulate(enableResultSinkAccumulate);
@@ -61,6 +61,9 @@ public class MVEpoch implements Writable {
     private long startTimeMilli;
     @SerializedName("commitTimeMilli")
     private long commitTimeMilli;
+    // Id of the last committed epoch, which the states of the MV in BE are recovered from, 0 if none
+    @SerializedName("committedEpochId")
+    private long committedEpochId;
 
     // Ephemeral states
     private transient long txnId;
@@ -249,6 +252,14 @@ public class MVEpoch implements Writable {
         this.commitTimeMilli = commitTimeMilli;
     }
 
+    public long getCommittedEpochId() {
+        return committedEpochId;
+    }
+
+    public void setCommittedEpochId(long committedEpochId) {
+        this.committedEpochId = committedEpochId;
+    }
+
     public long getTxnId() {
         return txnId;
     }
@@ -285,6 +296,7 @@ public class MVEpoch implements Writable {
                 ", binlogState=" + binlogState +
                 ", startTimeMilli=" + startTimeMilli +
                 ", commitTimeMilli=" + commitTimeMilli +
+                ", committedEpochId=" + committedEpochId +
                 ", txnId=" + txnId +
                 ", numEpochFinished=" + numEpochFinished +
                 '}';
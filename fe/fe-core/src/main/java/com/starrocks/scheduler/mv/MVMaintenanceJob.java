@@ -143,11 +143,19 @@ public class MVMaintenanceJob implements Writable, GsonPreProcessable, GsonPostP
 
     // TODO(murphy) make it a thread-safe with JobExecutor, what if it's under scheduling ?
     public void stopJob() {
+        stopJob(false);
+    }
+
+    /**
+     * Stop the job, and drop the persistent states of the tasks if {@code dropState}, which is only done when the MV
+     * is dropped. Otherwise, the states are recovered by the next job of the MV, e.g. after ALTER.
+     */
+    public void stopJob(boolean dropState) {
         if (!inSchedule.compareAndSet(false, true)) {
             throw UnsupportedException.unsupportedException("TODO: not support stop job running job");
         }
         try {
-            stopTasks();
+            stopTasks(dropState);
         } catch (Exception e) {
             LOG.warn("stop job failed", e);
         } finally {
@@ -375,7 +383,7 @@ public class MVMaintenanceJob implements Writable, GsonPreProcessable, GsonPostP
         request.setTask_id(task.getTaskId());
     }
 
-    private void stopTasks() throws Exception {
+    private void stopTasks(boolean dropState) throws Exception {
         QeProcessorImpl.INSTANCE.unregisterQuery(connectContext.getExecutionId());
 
         List<Future<PMVMaintenanceTaskResult>> results = new ArrayList<>();
@@ -385,7 +393,9 @@ public class MVMaintenanceJob implements Writable, GsonPreProcessable, GsonPostP
             request.setQuery_id(connectContext.getExecutionId());
             request.setTask_type(MVTaskType.STOP_MAINTENANCE);
             setMVMaintenanceTasksInfo(request, task);
-            request.setStop_maintenance(new TMVMaintenanceStopTask());
+            TMVMaintenanceStopTask stopTask = new TMVMaintenanceStopTask();
+            stopTask.setDrop_state(dropState);
+            request.setStop_maintenance(stopTask);
             TNetworkAddress address = task.getBeRpcAddr();
 
             try {
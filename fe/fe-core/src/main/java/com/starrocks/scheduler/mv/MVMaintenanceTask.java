@@ -78,6 +78,10 @@ public class MVMaintenanceTask {
         request.setDb_name(dbName);
         request.setMv_name(job.getView().getName());
         task.setFragments(fragmentInstances);
+        long committedEpochId = job.getEpoch().getCommittedEpochId();
+        if (committedEpochId > 0) {
+            task.setCommitted_epoch_id(committedEpochId);
+        }
 
         return request;
     }
@@ -207,9 +207,20 @@ public class MaterializedViewMgr {
     }
 
     /**
-     * Stop the maintenance job for MV after dropped
+     * Stop the maintenance job for MV, e.g. before ALTER, the states of the job are kept for the rebuilt job
      */
     public void stopMaintainMV(MaterializedView view) {
+        stopMaintainMV(view, false);
+    }
+
+    /**
+     * Stop the maintenance job for MV after dropped, and drop the states of the job
+     */
+    public void dropMaintainMV(MaterializedView view) {
+        stopMaintainMV(view, true);
+    }
+
+    private void stopMaintainMV(MaterializedView view, boolean dropState) {
         MaterializedView.MvRefreshScheme refreshScheme = view.getRefreshScheme();
         if (refreshScheme != null && !refreshScheme.isIncremental()) {
             return;
@@ -219,7 +230,7 @@ public class MaterializedViewMgr {
             LOG.warn("MV job not exists {}", view.getName());
             return;
         }
-        job.stopJob();
+        job.stopJob(dropState);
         jobMap.remove(view.getMvId());
         LOG.info("Remove maintenance job for mv: {}", view.getName());
     }
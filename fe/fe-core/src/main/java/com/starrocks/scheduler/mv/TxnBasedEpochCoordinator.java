@@ -23,9 +23,11 @@ import com.starrocks.proto.PMVMaintenanceTaskResult;
 import com.starrocks.rpc.BackendServiceClient;
 import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.thrift.MVTaskType;
+import com.starrocks.thrift.TMVCommitEpochTask;
 import com.starrocks.thrift.TMVMaintenanceTasks;
 import com.starrocks.thrift.TMVStartEpochTask;
 import com.starrocks.thrift.TNetworkAddress;
+import com.starrocks.thrift.TStatusCode;
 import com.starrocks.transaction.TransactionState;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
@@ -33,6 +35,7 @@ import org.apache.logging.log4j.Logger;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.List;
+import java.util.concurrent.ExecutionException;
 import java.util.concurrent.Future;
 
 /**
@@ -137,6 +140,8 @@ class TxnBasedEpochCoordinator implements EpochCoordinator {
             boolean published = GlobalStateMgr.getCurrentState().getGlobalTransactionMgr().commitAndPublishTransaction(database,
                     epoch.getTxnId(), epoch.getCommitInfos(), epoch.getFailedInfos(), TXN_VISIBLE_TIMEOUT_MILLIS);
             Preconditions.checkState(published, "must be published");
+            // The epoch id is the txn id, see MVEpoch.toThrift
+            epoch.setCommittedEpochId(epoch.getTxnId());
 
             // TODO(murphy) collect binlog consumption state from execution
             BinlogConsumeStateVO binlogState = new BinlogConsumeStateVO();
@@ -152,6 +157,48 @@ class TxnBasedEpochCoordinator implements EpochCoordinator {
             LOG.warn("Failed to commit transaction for epoch {}", epoch);
             throw new RuntimeException(e);
         }
+        publishEpoch(epoch);
+    }
+
+    /**
+     * Notify the executors that the epoch is committed, then they checkpoint their states of the epoch.
+     * If an executor misses it, its states are behind the committed epoch, and the job fails to be
+     * restarted from them.
+     */
+    private void publishEpoch(MVEpoch epoch) {
+        LOG.info("publishEpoch: {}", epoch);
+        List<Future<PMVMaintenanceTaskResult>> results = new ArrayList<>();
+        for (MVMaintenanceTask task : mvMaintenanceJob.getTasks().values()) {
+            TMVMaintenanceTasks request = new TMVMaintenanceTasks();
+            request.setQuery_id(mvMaintenanceJob.getQueryId());
+            request.setTask_type(MVTaskType.COMMIT_EPOCH);
+            request.setTask_id(task.getTaskId());
+            request.setJob_id(mvMaintenanceJob.getJobId());
+            request.setMv_name(mvMaintenanceJob.getView().getName());
+            // The transaction is already published by commitAndPublishTransaction
+            TMVCommitEpochTask taskMsg = new TMVCommitEpochTask();
+            taskMsg.setEpoch(epoch.toThrift());
+            request.setCommit_epoch(taskMsg);
+            try {
+                results.add(BackendServiceClient.getInstance().submitMVMaintenanceTaskAsync(task.getBeRpcAddr(),
+                        request));
+            } catch (Exception e) {
+                LOG.warn("publish epoch {} of MV {} failed: ", epoch, mvMaintenanceJob.getView().getName());
+                throw new RuntimeException(e);
+            }
+        }
+
+        for (Future<PMVMaintenanceTaskResult> future : results) {
+            try {
+                PMVMaintenanceTaskResult result = future.get();
+                if (TStatusCode.findByValue(result.status.statusCode) != TStatusCode.OK) {
+                    throw new RuntimeException("publish epoch failed: " + result.status.errorMsgs);
+                }
+            } catch (InterruptedException | ExecutionException e) {
+                LOG.warn("publish epoch {} failed", epoch, e);
+                throw new RuntimeException(e);
+            }
+        }
     }
 
     private void abortEpoch(MVEpoch epoch) {
@@ -163,6 +163,8 @@ struct TSpillOptions {
   // used to identify which operators allow spill, only meaningful when enable_spill=true
   12: optional i64 spillable_operator_mask;
   13: optional bool enable_agg_spill_preaggregation;
+  // block compression of spilled data, applied after the column encoding of spill_encode_level
+  14: optional Types.TCompressionType spill_compression_type;
 
   21: optional bool enable_spill_to_remote_storage;
   22: optional TSpillToRemoteStorageOptions spill_to_remote_storage_options;
@@ -318,6 +320,12 @@ struct TQueryOptions {
   140: optional string catalog;
 
   141: optional i32 datacache_evict_probability;
+
+  142: optional bool enable_shared_agg_hash_table = false;
+
+  143: optional bool enable_transmission_compression_dict = false;
+
+  144: optional bool enable_adaptive_transmission_compression = false;
 }
 
 
@@ -35,9 +35,13 @@ enum MVTaskType {
 
 struct TMVMaintenanceStartTask {
     1: optional list<InternalService.TExecPlanFragmentParams> fragments;
+    // The last epoch committed by FE, the states of the MV are recovered from it
+    2: optional i64 committed_epoch_id
 }
 
 struct TMVMaintenanceStopTask {
+    // Drop the persistent states of the MV, only when the MV is dropped
+    1: optional bool drop_state
 }
 
 struct TMVEpoch {